@@ -37,6 +37,7 @@ TYPE_MAP = {
     # 'ipv6addr': 'uint128_t',
     'ipv6addr': None,
     'eui48': 'uint64_t',
+    'count': None, # Parsed as uint16.
 
     # Synthetic types with scale factor. We implement only those that occur in
     # practice.
@@ -48,6 +49,33 @@ TYPE_MAP = {
 }
 
 
+# SunSpec types as they appear in point tables. Points of other types are not
+# listed there.
+POINT_TYPE_MAP = {
+    'int16': 'INT16',
+    'int32': 'INT32',
+    'int64': 'INT64',
+    'raw16': 'RAW16',
+    'uint16': 'UINT16',
+    'uint32': 'UINT32',
+    'uint64': 'UINT64',
+    'acc16': 'ACC16',
+    'acc32': 'ACC32',
+    'acc64': 'ACC64',
+    'bitfield16': 'BITFIELD16',
+    'bitfield32': 'BITFIELD32',
+    'bitfield64': 'BITFIELD64',
+    'enum16': 'ENUM16',
+    'enum32': 'ENUM32',
+    'float32': 'FLOAT32',
+    'float64': 'FLOAT64',
+    'string': 'STRING',
+    'ipaddr': 'IPADDR',
+    'eui48': 'EUI48',
+    'count': 'UINT16',
+}
+
+
 class DocComment:
     def __init__(self, doc):
         self.doc = doc
@@ -84,6 +112,109 @@ def label_to_identifier(label, capitalizeFirst):
     return ident
 
 
+def parse_points(points, base_offset=0):
+    """
+    Returns the methods for the given points, the offsets of their scale
+    factors by name, and their total size.
+    """
+    methods = []
+    scale_factor_offsets = {}
+    offset = 0
+    for point in points:
+        curr_offset = offset
+        offset += point['size']
+        try:
+            method = Method(point, base_offset + curr_offset)
+        except Skip:
+            if point['type'] == 'sunssf':
+                scale_factor_offsets[point['name']] = base_offset + curr_offset
+            continue
+        methods.append(method)
+
+    # Uniquify method names. There are two named `SpecifiedOverExcitedPF`
+    # in model 702, for example.
+    name_counts = collections.Counter(method.name for method in methods)
+    for method in methods:
+        if name_counts[method.name] > 1:
+            method.append_offset_to_name()
+
+    return methods, scale_factor_offsets, offset
+
+
+class StringPool:
+    """
+    Strings (point names and units) that are stored in flash. Each is stored
+    once, however many points refer to it.
+    """
+
+    def __init__(self):
+        self.identifiers = {}
+
+    def identifier(self, string):
+        if string is None:
+            return 'nullptr'
+        if string not in self.identifiers:
+            base = 'STR_' + re.sub(r'[^a-zA-Z0-9]', '_', string)
+            identifier = base
+            suffix = 2
+            while identifier in self.identifiers.values():
+                identifier = f'{base}_{suffix}'
+                suffix += 1
+            self.identifiers[string] = identifier
+        return self.identifiers[string]
+
+    def __str__(self):
+        return ''.join(
+            f'char const {identifier}[] PROGMEM = {json.dumps(string)};\n'
+            for string, identifier in self.identifiers.items())
+
+
+class PointDescriptor:
+    """
+    Describes the point behind a getter, for the generic decoder. The point is
+    named after the getter, so that generic output uses the same names as the
+    typed API.
+    """
+
+    # Must match `SunSpecPointDescriptor`.
+    NO_SCALE_FACTOR = 'SunSpecPointDescriptor::NO_SCALE_FACTOR'
+    SCALE_FACTOR_IN_GROUP = 'SunSpecPointDescriptor::SCALE_FACTOR_IN_GROUP'
+
+    def __init__(self, method):
+        self.name = method.name
+        self.units = method.units
+        self.offset = method.offset
+        self.size = method.size
+        self.type = POINT_TYPE_MAP[method.point_type]
+        self.scale_factor = method.scale_factor
+        self.scale_factor_offset = self.NO_SCALE_FACTOR
+
+    def resolve_scale_factor(self, model_scale_factor_offsets, group_scale_factor_offsets={}):
+        if not isinstance(self.scale_factor, str):
+            return
+        if self.scale_factor in group_scale_factor_offsets:
+            self.scale_factor_offset = f'{self.SCALE_FACTOR_IN_GROUP} | {group_scale_factor_offsets[self.scale_factor]}'
+        else:
+            self.scale_factor_offset = str(model_scale_factor_offsets[self.scale_factor])
+
+    def initializer(self, strings):
+        return (
+            f'{{{strings.identifier(self.name)}, {strings.identifier(self.units)}, '
+            f'{self.offset}, {self.size}, {self.scale_factor_offset}, '
+            f'SunSpecPointType::{self.type}}},')
+
+
+def point_array_str(identifier, descriptors, strings):
+    if not descriptors:
+        return ''
+    initializers = '\n'.join(descriptor.initializer(strings) for descriptor in descriptors)
+    return f'''\
+SunSpecPointDescriptor const {identifier}[] PROGMEM = {{
+{textwrap.indent(initializers, ' ' * 2)}
+}};
+'''
+
+
 class Class:
     def __init__(self, root):
         group = root['group']
@@ -91,65 +222,152 @@ class Class:
         # Some models have no descriptive name (just something like
         # `model_17`), but the label is always somewhat brief and descriptive.
         self.name = label_to_identifier(group['label'], True)
-        if 'groups' in group:
-            logging.warning(f'Repeating groups not yet supported; skipping {self.name}')
-            raise Skip()
         self.doc = DocComment(group.get('desc', None))
         points = group['points']
-        self.methods = []
-        scale_factor_offsets = {}
-        offset = 0
         assert(points[0]['name'] == 'ID')
         assert(points[0]['size'] == 1)
         assert(points[1]['name'] == 'L')
         assert(points[1]['size'] == 1)
-        for point in points[2:]:
-            curr_offset = offset
-            offset += point['size']
-            try:
-                method = Method(point, curr_offset)
-            except Skip:
-                if point['type'] == 'sunssf':
-                    scale_factor_offsets[point['name']] = curr_offset
-                continue
-            self.methods.append(method)
-        self.size = offset
-
-        # Uniquify method names. There are two named `SpecifiedOverExcitedPF`
-        # in model 702, for example.
-        name_counts = collections.Counter(method.name for method in self.methods)
-        for method in self.methods:
-            if name_counts[method.name] > 1:
-                method.append_offset_to_name()
-
+        self.methods, scale_factor_offsets, self.size = parse_points(points[2:])
         for method in self.methods:
             if isinstance(method.scale_factor, str):
-                method.parse_args.append(scale_factor_offsets[method.scale_factor])
+                method.template_args.append(scale_factor_offsets[method.scale_factor])
+        self.scale_factor_offsets = sorted(scale_factor_offsets.values())
+        self.point_descriptors = list(map(PointDescriptor, self.methods))
+        for descriptor in self.point_descriptors:
+            descriptor.resolve_scale_factor(scale_factor_offsets)
+
+        # We support a single repeating group at the end of the model, which is
+        # what most models with groups have. Nested groups (as in the curve
+        # models 7xx) are not supported.
+        self.group = None
+        groups = group.get('groups', [])
+        if len(groups) > 1 or any('groups' in g for g in groups):
+            logging.warning(f'Multiple or nested repeating groups not yet supported; skipping {self.name}')
+            raise Skip()
+        if groups:
+            self.group = Group(groups[0], self, scale_factor_offsets)
 
     def append_id_to_name(self):
         self.name += f'_{self.id}'
 
     def __str__(self):
         assert(self.name)
+        members = [f'''\
+{DocComment('Descriptors of all points, for generic access.')}static SunSpecPointTable pointTable();
+''']
+        members.extend(map(str, self.methods))
+        repeat_size = 0
+        if self.group:
+            members.append(self.group.class_str())
+            members.extend(self.group.accessors_str())
+            repeat_size = self.group.size
+        members = '\n'.join(members)
+        template_args = ', '.join(map(str, [self.id, self.size, repeat_size] + self.scale_factor_offsets))
+        return f'''\
+{self.doc}class {self.name} : public SunSpecModel<{template_args}> {{
+  public:
+{textwrap.indent(members, ' ' * 4)}
+}};
+'''
+
+    def definitions_str(self, strings):
+        points = f'POINTS_{self.id}'
+        group_points = f'GROUP_POINTS_{self.id}'
+        arrays = point_array_str(points, self.point_descriptors, strings)
+        table = [
+            self.id,
+            self.size,
+            0,
+            points if self.point_descriptors else 'nullptr',
+            len(self.point_descriptors),
+            'nullptr',
+            'nullptr',
+            0,
+        ]
+        if self.group:
+            arrays += point_array_str(group_points, self.group.point_descriptors, strings)
+            table[2] = self.group.size
+            table[5] = strings.identifier(self.group.accessor_name)
+            if self.group.point_descriptors:
+                table[6] = group_points
+                table[7] = len(self.group.point_descriptors)
+        return f'''\
+{arrays}
+SunSpecPointTable {self.name}::pointTable() {{
+  return {{{', '.join(map(str, table))}}};
+}}
+'''
+
+
+class Group:
+    """
+    A repeating group. Its getters take the offset of the repeat at run time.
+    Scale factors in the fixed part of the model are looked up at compile
+    time, like for points in the fixed part; scale factors in the group itself
+    are decoded on each call.
+    """
+
+    def __init__(self, group, model, model_scale_factor_offsets):
+        self.model = model
+        self.name = label_to_identifier(group['name'], True)
+        self.accessor_name = label_to_identifier(group['name'], False)
+        self.doc = DocComment(group.get('desc', group.get('label', '').strip()))
+        self.methods, scale_factor_offsets, self.size = parse_points(group['points'])
+        for method in self.methods:
+            method.in_group = True
+            if not isinstance(method.scale_factor, str):
+                continue
+            if method.scale_factor in scale_factor_offsets:
+                # Both offsets are relative to the repeat.
+                method.parse_args = [method.offset, scale_factor_offsets[method.scale_factor]]
+            else:
+                method.template_args = [model_scale_factor_offsets[method.scale_factor]]
+                method.parse_args = [method.offset]
+        self.point_descriptors = list(map(PointDescriptor, self.methods))
+        for descriptor in self.point_descriptors:
+            descriptor.resolve_scale_factor(model_scale_factor_offsets, scale_factor_offsets)
+
+    def class_str(self):
         methods = '\n'.join(map(str, self.methods))
         return f'''\
-{self.doc}class {self.name} : public SunSpecModel<{self.id}, {self.size}> {{
+{self.doc}class {self.name} : public SunSpecGroup<{self.model.name}, {self.size}> {{
   public:
+    using SunSpecGroup::SunSpecGroup;
+
 {textwrap.indent(methods, ' ' * 4)}
 }};
 '''
 
+    def accessors_str(self):
+        return [
+            f'''\
+{DocComment(f'Number of repeats of `{self.name}`.')}inline uint16_t num{self.name}s() const {{ return numRepeats(); }}
+''',
+            f'''\
+{DocComment(f'The repeat of `{self.name}` with the given index, which must be less than `num{self.name}s()`.')}inline {self.name} {self.accessor_name}(uint16_t index) const {{ return {self.name}(this, repeatOffset(index)); }}
+''',
+            f'''\
+{DocComment(f'All repeats of `{self.name}`, for iteration.')}inline SunSpecRepeats<{self.name}> {self.accessor_name}s() const {{ return SunSpecRepeats<{self.name}>(this, repeatOffset(0), numRepeats()); }}
+''',
+        ]
+
 
 class Method:
     def __init__(self, point, offset):
         self.point_name = point['name']
         self.name = label_to_identifier(point.get('label', self.point_name), False)
         doc = point.get('desc', '')
-        units = point.get('units', None)
-        if units:
-            doc += f' [{units}]'
+        self.units = point.get('units', None)
+        if self.units:
+            doc += f' [{self.units}]'
         self.doc = DocComment(doc.strip())
-        self.type = point['type']
+        self.point_type = point['type']
+        self.size = point['size']
+        self.type = self.point_type
+        if self.type == 'count':
+            self.type = 'uint16'
+        self.in_group = False
         if not self.return_type:
             raise Skip()
         self.offset = offset
@@ -157,8 +375,13 @@ class Method:
         if self.type == 'string':
             self.parse_args.append(point['size'])
         self.scale_factor = point.get('sf', None)
+        self.template_args = []
         if isinstance(self.scale_factor, str):
             self.type += '_sunssf'
+            # Offsets are passed as template arguments, so that the lookup of
+            # the decoded scale factor happens at compile time.
+            self.template_args = self.parse_args
+            self.parse_args = []
 
     @property
     def return_type(self):
@@ -170,8 +393,20 @@ class Method:
     def __str__(self):
         assert(self.name)
         assert(self.type)
+        template_args = f'<{", ".join(map(str, self.template_args))}>' if self.template_args else ''
+        if self.in_group:
+            # Offsets within the group are relative to the repeat. (The
+            # second argument of a string is its length, not an offset.)
+            args = [f'groupOffset() + {arg}' for arg in self.parse_args]
+            if self.type == 'string':
+                args[1] = str(self.parse_args[1])
+            parse_args = ', '.join(args)
+            receiver = 'groupModel().'
+        else:
+            parse_args = ', '.join(map(str, self.parse_args))
+            receiver = ''
         return f'''\
-{self.doc}inline {self.return_type} {self.name}() const {{ return parse_{self.type}({', '.join(map(str, self.parse_args))}); }}
+{self.doc}inline {self.return_type} {self.name}() const {{ return {receiver}parse_{self.type}{template_args}({parse_args}); }}
 '''
 
 
@@ -192,6 +427,9 @@ def main():
     parser.add_argument('--out_file',
                         help='Filename of .h file to be written',
                         default=os.path.join(SCRIPT_DIR, 'src', 'SunSpecModels.h'))
+    parser.add_argument('--out_cpp_file',
+                        help='Filename of .cpp file to be written, which contains the point tables',
+                        default=os.path.join(SCRIPT_DIR, 'src', 'SunSpecModels.cpp'))
     parser.add_argument('--verbose', '-v',
                         help='Increase verbosity',
                         action='count', default=0)
@@ -229,6 +467,7 @@ def main():
 #pragma once
 
 #include "SunSpecModel.h"
+#include "SunSpecPoint.h"
 
 namespace SunSpecModels {{
 
@@ -236,6 +475,24 @@ namespace SunSpecModels {{
 }}
 ''')
 
+    strings = StringPool()
+    definitions_str = '\n'.join(class_.definitions_str(strings) for class_ in classes)
+    with open(args.out_cpp_file, 'wt') as out:
+        out.write(f'''\
+#include "SunSpec.h"
+#include "SunSpecModels.h"
+
+namespace SunSpecModels {{
+
+namespace {{
+
+{strings}
+}}
+
+{definitions_str}
+}}
+''')
+
 
 if __name__ == '__main__':
     main()
@@ -1,5 +1,9 @@
 #pragma once
 
 #include "SunSpec.h"
+#include "SunSpecCache.h"
+#include "SunSpecJson.h"
 #include "SunSpecModel.h"
 #include "SunSpecModels.h"
+#include "SunSpecPoint.h"
+#include "SunSpecTransport.h"
@@ -5,26 +5,55 @@
 namespace {
 
 // Some libraries only look at 40000 and 50000, but the SunSpec specification
-// really also allows 0.
-uint16 const START_ADDRESSES[] = {0, 40000, 50000};
+// really also allows 0. In order of preference; 40000 is by far the most
+// common, so it is found without waiting for the others.
+uint16 const START_ADDRESSES[] = {40000, 50000, 0};
+uint16 const NUM_START_ADDRESSES = sizeof(START_ADDRESSES) / sizeof(*START_ADDRESSES);
 
 uint16 const START_ADDRESS_MARKER_A = 0x5375;
 uint16 const START_ADDRESS_MARKER_B = 0x6e53;
 
 uint16 const LAST_MODEL_ID = 0xffff;
 
+// The aggregator model, and the offset of its update number (UN) point.
+uint16 const AGGREGATOR_MODEL_ID = 2;
+uint16 const AGGREGATOR_UPDATE_NUMBER_OFFSET = 2;
+
+// Maximum number of registers that can be read in a single Modbus request.
+uint16 const MAX_REGISTERS_PER_READ = 125;
+
+// SMA Sunny Boy inverters work differently: the server ID is the Unit ID +
+// 123. The Unit ID is configurable, and its current value can be found from
+// four registers starting at 42109 at server ID 1. Note that simply reading
+// the one register we care about does not work; we have to read all four of
+// them!
+// See section 3.5.1 and 3.5.2 in the SMA Modbus documentation:
+// https://files.sma.de/downloads/SMA-Modbus-general-TI-en-10.pdf
+uint8 const SMA_UNIT_ID_SERVER_ID = 1;
+uint16 const SMA_UNIT_ID_ADDRESS = 42109;
+uint16 const SMA_UNIT_ID_COUNT = 4;
+uint16 const SMA_SERVER_ID_OFFSET = 123;
+
 }
 
-SunSpec::SunSpec(ModbusClient *client) :
-  client_(client)
+SunSpec::SunSpec(SunSpecTransport *transport) :
+  transport_(transport)
 {
 }
 
-bool SunSpec::begin() {
-  if (!findServerId()) {
-    return false;
+SunSpec::~SunSpec() {
+  releaseAll();
+  deleteBody();
+}
+
+void SunSpec::begin() {
+  // Server ID is usually 0 but some inverters get creative.
+  serverId_ = 0;
+  triedSmaServerId_ = false;
+  if (cache_) {
+    cache_->beginScan();
   }
-  return restart();
+  startStep(Step::PROBE_START_ADDRESSES, NUM_START_ADDRESSES);
 }
 
 bool SunSpec::hasCurrentModel() {
@@ -35,136 +64,352 @@ uint16 SunSpec::currentModelId() {
   return currentModelId_;
 }
 
-bool SunSpec::nextModel() {
-  currentModelAddress_ += 2 + currentModelLength_;
-  if (!readModelHeader()) {
-    ARDUINO_SUNSPEC_DEBUG_LOGLN("Failed to read model header");
-    return false;
+uint16 SunSpec::currentModelLength() {
+  return currentModelLength_;
+}
+
+void SunSpec::readCurrentModel() {
+  uint16 const *cached = cache_ ? cache_->lookup(currentModelAddress_, currentModelId_, currentModelLength_) : nullptr;
+  if (cached) {
+    startStep(Step::NONE, 0);
+    body_ = new uint16[currentModelLength_];
+    memcpy(body_, cached, currentModelLength_ * sizeof(uint16));
+    bodyComplete_ = true;
+    status_ = Status::DONE;
+    return;
   }
-  return true;
+
+  uint16 const numParts = (currentModelLength_ + MAX_REGISTERS_PER_READ - 1) / MAX_REGISTERS_PER_READ;
+  startStep(Step::READ_MODEL_BODY, numParts);
+  body_ = new uint16[currentModelLength_];
+}
+
+void SunSpec::nextModel() {
+  currentModelAddress_ += 2 + currentModelLength_;
+  startStep(Step::READ_MODEL_HEADER, 1);
 }
 
-bool SunSpec::restart() {
+void SunSpec::restart() {
   currentModelAddress_ = start_ + 2;
-  return readModelHeader();
+  startStep(Step::READ_MODEL_HEADER, 1);
 }
 
-bool SunSpec::findServerId() {
-  // Server ID is usually 0 but some inverters get creative.
-  serverId_ = 0;
-  if (findStartAddress()) {
-    return true;
+uint16 SunSpec::currentModelAddress() {
+  return currentModelAddress_;
+}
+
+void SunSpec::seek(uint16 address) {
+  currentModelAddress_ = address;
+  startStep(Step::READ_MODEL_HEADER, 1);
+}
+
+void SunSpec::seekAndRead(uint16 address, uint16 expectedLength) {
+  currentModelAddress_ = address;
+  expectedModelLength_ = expectedLength;
+  uint16 const numParts = (2 + expectedLength + MAX_REGISTERS_PER_READ - 1) / MAX_REGISTERS_PER_READ;
+  startStep(Step::READ_MODEL_HEADER_AND_BODY, numParts);
+  body_ = new uint16[expectedLength];
+}
+
+SunSpec::Status SunSpec::poll() {
+  if (status_ != Status::BUSY) {
+    return status_;
   }
 
-  // SMA Sunny Boy inverters work differently: the server ID is the Unit ID +
-  // 123. The Unit ID is configurable, and its current value can be found from
-  // four registers starting at 42109 at server ID 1. Note that simply reading
-  // the one register we care about does not work; we have to read all four of
-  // them!
-  // See section 3.5.1 and 3.5.2 in the SMA Modbus documentation:
-  // https://files.sma.de/downloads/SMA-Modbus-general-TI-en-10.pdf
-  uint16 unitId;
-  if (request(42109, 4, 1) &&
-      // Physical serial number (2 registers).
-      read(nullptr) &&
-      read(nullptr) &&
-      // Physical SusyId (1 register).
-      read(nullptr) &&
-      // Unit ID (1 register).
-      read(&unitId))
-  {
-    serverId_ = unitId + 123;
-    if (findStartAddress()) {
-      return true;
+  if (!sendRequests()) {
+    releaseAll();
+    status_ = handleFailure();
+    return status_;
+  }
+
+  transport_->poll();
+  Step const step = step_;
+  for (size_t i = 0; i < SunSpecTransport::MAX_WINDOW_SIZE && step_ == step && status_ == Status::BUSY; i++) {
+    Outstanding &outstanding = outstanding_[i];
+    if (!outstanding.transactionId) {
+      continue;
+    }
+    switch (transport_->status(outstanding.transactionId)) {
+      case SunSpecTransport::Status::PENDING:
+        break;
+      case SunSpecTransport::Status::DONE:
+        handlePart(outstanding.part, transport_->registers(outstanding.transactionId));
+        transport_->release(outstanding.transactionId);
+        outstanding.transactionId = 0;
+        partsDone_++;
+        break;
+      case SunSpecTransport::Status::FAILED:
+        transport_->release(outstanding.transactionId);
+        outstanding.transactionId = 0;
+        partsDone_++;
+        if (!handlePartFailure(outstanding.part)) {
+          releaseAll();
+          status_ = handleFailure();
+        }
+        break;
     }
   }
 
-  ARDUINO_SUNSPEC_DEBUG_LOGLN("Could not find SunSpec start address");
-  return false;
+  if (status_ == Status::BUSY && step_ == step) {
+    status_ = checkStepComplete();
+  }
+  return status_;
+}
+
+void SunSpec::startStep(Step step, uint16 numParts) {
+  releaseAll();
+  deleteBody();
+  step_ = step;
+  status_ = Status::BUSY;
+  numParts_ = numParts;
+  nextPart_ = 0;
+  partsDone_ = 0;
+  if (step == Step::PROBE_START_ADDRESSES) {
+    startAddressesProbed_ = 0;
+    startAddressesFound_ = 0;
+  }
 }
 
-bool SunSpec::findStartAddress() {
-  // Find start address. It is identified by a pair of registers containing
-  // magic numbers.
-  for (size_t i = 0; i < sizeof(START_ADDRESSES) / sizeof(*START_ADDRESSES); i++) {
-    start_ = START_ADDRESSES[i];
-    if (checkStartAddress()) {
-      return true;
+bool SunSpec::sendRequests() {
+  size_t const windowSize = transport_->windowSize();
+  while (nextPart_ < numParts_ && numOutstanding() < windowSize) {
+    uint8 serverId;
+    uint16 address;
+    uint16 count;
+    partRange(nextPart_, &serverId, &address, &count);
+    uint16 const transactionId = transport_->request(serverId, address, count);
+    if (!transactionId) {
+      return numOutstanding() > 0;
     }
+    for (Outstanding &outstanding : outstanding_) {
+      if (!outstanding.transactionId) {
+        outstanding.transactionId = transactionId;
+        outstanding.part = nextPart_;
+        break;
+      }
+    }
+    nextPart_++;
+  }
+  return true;
+}
+
+void SunSpec::partRange(uint16 part, uint8 *serverId, uint16 *address, uint16 *count) {
+  *serverId = serverId_;
+  uint16 base = 0;
+  uint16 total = 0;
+  switch (step_) {
+    case Step::PROBE_START_ADDRESSES:
+      *address = START_ADDRESSES[part];
+      *count = 2;
+      return;
+    case Step::READ_SMA_UNIT_ID:
+      *serverId = SMA_UNIT_ID_SERVER_ID;
+      *address = SMA_UNIT_ID_ADDRESS;
+      *count = SMA_UNIT_ID_COUNT;
+      return;
+    case Step::READ_MODEL_HEADER:
+      *address = currentModelAddress_;
+      *count = 2;
+      return;
+    case Step::READ_MODEL_BODY:
+      base = currentModelAddress_ + 2;
+      total = currentModelLength_;
+      break;
+    case Step::READ_MODEL_HEADER_AND_BODY:
+      base = currentModelAddress_;
+      total = 2 + expectedModelLength_;
+      break;
+    case Step::NONE:
+      break;
+  }
+  uint16 const offset = part * MAX_REGISTERS_PER_READ;
+  uint16 const remaining = total - offset;
+  *address = base + offset;
+  *count = remaining < MAX_REGISTERS_PER_READ ? remaining : MAX_REGISTERS_PER_READ;
+}
+
+void SunSpec::handlePart(uint16 part, uint16 const *registers) {
+  uint8 serverId;
+  uint16 address;
+  uint16 count;
+  partRange(part, &serverId, &address, &count);
+
+  switch (step_) {
+    case Step::PROBE_START_ADDRESSES:
+      startAddressesProbed_ |= 1 << part;
+      if (registers[0] == START_ADDRESS_MARKER_A && registers[1] == START_ADDRESS_MARKER_B) {
+        startAddressesFound_ |= 1 << part;
+      }
+      break;
+
+    case Step::READ_SMA_UNIT_ID:
+      // Physical serial number (2 registers), physical SusyId (1 register),
+      // Unit ID (1 register).
+      serverId_ = registers[3] + SMA_SERVER_ID_OFFSET;
+      break;
+
+    case Step::READ_MODEL_HEADER:
+      currentModelId_ = registers[0];
+      currentModelLength_ = registers[1];
+      break;
+
+    case Step::READ_MODEL_BODY:
+      memcpy(body_ + part * MAX_REGISTERS_PER_READ, registers, count * sizeof(uint16));
+      break;
+
+    case Step::READ_MODEL_HEADER_AND_BODY: {
+      // The first two registers of the first part are the header.
+      uint16 offset = part * MAX_REGISTERS_PER_READ;
+      if (part == 0) {
+        currentModelId_ = registers[0];
+        currentModelLength_ = registers[1];
+        registers += 2;
+        count -= 2;
+        offset += 2;
+      }
+      memcpy(body_ + offset - 2, registers, count * sizeof(uint16));
+      break;
+    }
+
+    case Step::NONE:
+      break;
   }
-  return false;
 }
 
-bool SunSpec::checkStartAddress() {
-  uint16 a;
-  uint16 b;
-  if (request(start_, 2) &&
-      read(&a) &&
-      read(&b) &&
-      a == START_ADDRESS_MARKER_A &&
-      b == START_ADDRESS_MARKER_B)
-  {
-    ARDUINO_SUNSPEC_DEBUG_LOG("Found SunSpec start address at server ID ");
-    ARDUINO_SUNSPEC_DEBUG_LOG(serverId_);
-    ARDUINO_SUNSPEC_DEBUG_LOG(" address ");
-    ARDUINO_SUNSPEC_DEBUG_LOGLN(start_);
+bool SunSpec::handlePartFailure(uint16 part) {
+  if (step_ == Step::PROBE_START_ADDRESSES) {
+    // Probing a start address that doesn't exist may well fail; that's what
+    // we're trying to find out.
+    startAddressesProbed_ |= 1 << part;
     return true;
   }
   return false;
 }
 
-bool SunSpec::readModelHeader() {
-  return
-    request(currentModelAddress_, 2) &&
-    read(&currentModelId_) &&
-    read(&currentModelLength_);
-}
+SunSpec::Status SunSpec::checkStepComplete() {
+  switch (step_) {
+    case Step::PROBE_START_ADDRESSES:
+      // Find start address. It is identified by a pair of registers
+      // containing magic numbers. If there are several, the first one in
+      // `START_ADDRESSES` wins, so we might have to wait for earlier ones
+      // even if a later one responded already.
+      for (uint16 i = 0; i < NUM_START_ADDRESSES; i++) {
+        if (!(startAddressesProbed_ & (1 << i))) {
+          return Status::BUSY;
+        }
+        if (startAddressesFound_ & (1 << i)) {
+          start_ = START_ADDRESSES[i];
+          LOG_INFO("sunspec", "Found SunSpec start address at server ID %u address %u", serverId_, start_);
+          restart();
+          return Status::BUSY;
+        }
+      }
+      return handleFailure();
+
+    case Step::READ_SMA_UNIT_ID:
+      if (partsDone_ < numParts_) {
+        return Status::BUSY;
+      }
+      startStep(Step::PROBE_START_ADDRESSES, NUM_START_ADDRESSES);
+      return Status::BUSY;
+
+    case Step::READ_MODEL_HEADER:
+    case Step::READ_MODEL_BODY:
+      if (partsDone_ < numParts_) {
+        return Status::BUSY;
+      }
+      bodyComplete_ = step_ == Step::READ_MODEL_BODY;
+      if (bodyComplete_) {
+        storeInCache();
+      }
+      return Status::DONE;
 
-bool SunSpec::request(uint16 address, uint16 count) {
-  return request(address, count, serverId_);
+    case Step::READ_MODEL_HEADER_AND_BODY:
+      if (partsDone_ < numParts_) {
+        return Status::BUSY;
+      }
+      if (currentModelLength_ == expectedModelLength_) {
+        bodyComplete_ = true;
+        storeInCache();
+      } else {
+        // The model is not what we expected, so what we read as its contents
+        // is garbage. We do know its header now.
+        deleteBody();
+      }
+      return Status::DONE;
+
+    case Step::NONE:
+      break;
+  }
+  return Status::FAILED;
 }
 
-bool SunSpec::request(uint16 address, uint16 count, uint16 serverId) {
-  int readCount = client_->requestFrom(serverId, HOLDING_REGISTERS, address, count);
-  if (readCount < count) {
-    ARDUINO_SUNSPEC_DEBUG_LOG("Read error: requested ");
-    ARDUINO_SUNSPEC_DEBUG_LOG(count);
-    ARDUINO_SUNSPEC_DEBUG_LOG(" holding registers at ");
-    ARDUINO_SUNSPEC_DEBUG_LOG(address);
-    ARDUINO_SUNSPEC_DEBUG_LOG(" from server ID ");
-    ARDUINO_SUNSPEC_DEBUG_LOG(serverId);
-    ARDUINO_SUNSPEC_DEBUG_LOG(" but got only ");
-    ARDUINO_SUNSPEC_DEBUG_LOGLN(readCount);
-    return false;
+SunSpec::Status SunSpec::handleFailure() {
+  switch (step_) {
+    case Step::PROBE_START_ADDRESSES:
+      if (!triedSmaServerId_) {
+        triedSmaServerId_ = true;
+        startStep(Step::READ_SMA_UNIT_ID, 1);
+        return Status::BUSY;
+      }
+      LOG_WARNING("sunspec", "Could not find SunSpec start address");
+      return Status::FAILED;
+
+    case Step::READ_SMA_UNIT_ID:
+      LOG_WARNING("sunspec", "Could not find SunSpec start address");
+      return Status::FAILED;
+
+    case Step::READ_MODEL_HEADER:
+      LOG_WARNING("sunspec", "Failed to read model header");
+      return Status::FAILED;
+
+    case Step::READ_MODEL_BODY:
+    case Step::READ_MODEL_HEADER_AND_BODY:
+      LOG_WARNING("sunspec", "Failed to read model at address %u", currentModelAddress_);
+      deleteBody();
+      if (cache_ && currentModelId_ == AGGREGATOR_MODEL_ID) {
+        // Without the update number we can't tell whether the layout changed.
+        cache_->clear();
+      }
+      return Status::FAILED;
+
+    case Step::NONE:
+      break;
   }
-  return true;
+  return Status::FAILED;
 }
 
-bool SunSpec::read(uint16 *result) {
-  long const value = client_->read();
-  if (value < 0) {
-    ARDUINO_SUNSPEC_DEBUG_LOG("Failed to read value");
-    return false;
+void SunSpec::storeInCache() {
+  if (!cache_) {
+    return;
   }
-  if (result) {
-    *result = static_cast<uint16>(value);
+  if (currentModelId_ == AGGREGATOR_MODEL_ID && currentModelLength_ > AGGREGATOR_UPDATE_NUMBER_OFFSET) {
+    cache_->setUpdateNumber(currentModelAddress_, currentModelLength_, body_[AGGREGATOR_UPDATE_NUMBER_OFFSET]);
   }
-  return true;
+  cache_->store(currentModelAddress_, currentModelId_, currentModelLength_, body_);
 }
 
-uint16 *SunSpec::readArray(uint16 offset, uint16 count) {
-  if (!request(offset, count)) {
-    return nullptr;
+size_t SunSpec::numOutstanding() const {
+  size_t count = 0;
+  for (Outstanding const &outstanding : outstanding_) {
+    if (outstanding.transactionId) {
+      count++;
+    }
   }
+  return count;
+}
 
-  uint16 *const buffer = new uint16[count];
-
-  for (uint16 i = 0; i < count; i++) {
-    if (!read(&buffer[i])) {
-      delete[] buffer;
-      return nullptr;
+void SunSpec::releaseAll() {
+  for (Outstanding &outstanding : outstanding_) {
+    if (outstanding.transactionId) {
+      transport_->release(outstanding.transactionId);
+      outstanding.transactionId = 0;
     }
   }
+}
 
-  return buffer;
+void SunSpec::deleteBody() {
+  delete[] body_; // Deleting a nullptr is okay.
+  body_ = nullptr;
+  bodyComplete_ = false;
 }
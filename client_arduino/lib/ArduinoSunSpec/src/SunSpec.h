@@ -1,34 +1,78 @@
 #pragma once
 
-#include <ArduinoModbus.h>
-
 #include <Arduino.h>
 
-#define ARDUINO_SUNSPEC_DEBUG_LOGGING 1
+#include "Log.h"
+#include "SunSpecCache.h"
+#include "SunSpecTransport.h"
 
-#if defined(ARDUINO_SUNSPEC_DEBUG_LOGGING) && (ARDUINO_SUNSPEC_DEBUG_LOGGING)
-#  define ARDUINO_SUNSPEC_DEBUG_LOG(x) Serial.print(x)
-#  define ARDUINO_SUNSPEC_DEBUG_LOGLN(x) Serial.println(x)
-#else
-#  define ARDUINO_SUNSPEC_DEBUG_LOG(x) do {} while(0)
-#  define ARDUINO_SUNSPEC_DEBUG_LOGLN(x) do {} while(0)
-#endif
+/**
+ * A compile-time list of model types, for use with `SunSpec::visit()`.
+ */
+template<typename... ModelTypes>
+struct SunSpecModelList {
+  /**
+   * Returns whether any of the model types has the given ID.
+   */
+  static constexpr bool contains(uint16 id) {
+    return ((id == ModelTypes::id()) || ...);
+  }
+};
 
 /**
  * Client for the SunSpec protocol. It acts as an iterator over models, and
  * allows to either parse them or skip over them.
+ *
+ * All operations are non-blocking: methods like `begin()` and `nextModel()`
+ * only start the operation, and `poll()` must be called repeatedly until it
+ * no longer returns `Status::BUSY`. Only one operation can be in progress at
+ * a time; starting a new one abandons the current one.
+ *
+ * Operations that need several requests whose addresses are known up front
+ * (probing start addresses, reading long models) send them all at once, up
+ * to the transport's window size, and handle the responses as they arrive.
  */
 class SunSpec {
   public:
-    explicit SunSpec(ModbusClient *client);
+    enum class Status {
+      // No operation has been started yet.
+      IDLE,
+      // The current operation is still in progress.
+      BUSY,
+      // The last operation completed successfully.
+      DONE,
+      // The last operation failed.
+      FAILED,
+    };
+
+    explicit SunSpec(SunSpecTransport *transport);
+    ~SunSpec();
 
     /**
-     * Assumes that the client is connected. Searches for the start address
-     * where SunSpec models are to be found. After this returns success
-     * (`true`), according to specifications the current model should be the
-     * `common` model with ID 1.
+     * Makes `readCurrentModel()` look in the given cache before going to the
+     * device, and store what it reads there. Pass `nullptr` to disable.
+     * `begin()` calls `SunSpecCache::beginScan()`, so if the device has an
+     * aggregator model, read it before expecting any hits.
      */
-    bool begin();
+    void setCache(SunSpecCache *cache) { cache_ = cache; }
+
+    /**
+     * Assumes that the transport is connected. Starts searching for the start
+     * address where SunSpec models are to be found. After this completes
+     * successfully, according to specifications the current model should be
+     * the `common` model with ID 1.
+     */
+    void begin();
+
+    /**
+     * Advances the current operation without blocking, and returns its status.
+     */
+    Status poll();
+
+    /**
+     * Returns the status of the current operation without advancing it.
+     */
+    Status status() const { return status_; }
 
     /**
      * Returns whether we are currently at a valid model.
@@ -49,94 +93,224 @@ class SunSpec {
     }
 
     /**
-     * Enumerates models until the one of the given type is found. Returns a
-     * valid model on success, an invalid model if not found or any error
-     * occurred.
+     * Starts reading the contents of the current model. After this completes,
+     * use `currentModelAs()` or `visit()` to parse them. If the contents are
+     * cached, this completes immediately.
      */
-    template<typename ModelType>
-    ModelType findModel() {
-      while (hasCurrentModel()) {
-        if (currentModelIs<ModelType>()) {
-          return currentModelAs<ModelType>();
-        }
-        if (!nextModel()) {
-          break;
-        }
-      }
-      return ModelType();
-    }
+    void readCurrentModel();
 
     /**
      * Returns the current model as the given type. Returns an invalid model if
-     * the current model type does not match, or the parse failed.
+     * the current model type does not match, or its contents have not been
+     * read successfully using `readCurrentModel()`. The contents are handed
+     * over to the returned model, so this can only be called once per read.
      */
     template<typename ModelType>
     ModelType currentModelAs() {
       if (!currentModelIs<ModelType>()) {
-        ARDUINO_SUNSPEC_DEBUG_LOG("Tried to parse model ");
-        ARDUINO_SUNSPEC_DEBUG_LOG(currentModelId_);
-        ARDUINO_SUNSPEC_DEBUG_LOG(" as ");
-        ARDUINO_SUNSPEC_DEBUG_LOGLN(ModelType::id());
+        LOG_WARNING("sunspec", "Tried to parse model %u as %u", currentModelId_, ModelType::id());
         return ModelType();
       }
 
-      uint16 const count = currentModelLength_;
-      uint16 *buffer = readArray(currentModelAddress_ + 2, count);
-      if (!buffer) {
+      if (!body_ || !bodyComplete_) {
         return ModelType();
       }
 
       ModelType model;
-      model.setBuffer(buffer, count);
+      model.setBuffer(body_, currentModelLength_);
+      body_ = nullptr;
+      bodyComplete_ = false;
       return model;
     }
 
     /**
-     * Moves on to the next model.
+     * Parses the current model as whichever of `ModelTypes` has a matching
+     * ID, and calls `visitor` with a const reference to the parsed model.
+     * This lets callers handle a family of similar models (e.g. all inverter
+     * models) with a single generic lambda. Returns `true` if a type matched
+     * and the model had been read successfully.
+     *
+     * The IDs are compile-time constants, so the fold expression below
+     * compiles down to the equivalent of a `switch` on the model ID.
+     */
+    template<typename... ModelTypes, typename Visitor>
+    bool visit(Visitor &&visitor) {
+      static_assert(idsAreUnique<ModelTypes...>(), "Model types passed to visit() must have unique IDs");
+      bool visited = false;
+      (void) ((currentModelId_ == ModelTypes::id() && (visited = visitAs<ModelTypes>(visitor), true)) || ...);
+      return visited;
+    }
+
+    /**
+     * Like `visit<ModelTypes...>()`, but takes the types from a
+     * `SunSpecModelList`.
+     */
+    template<typename... ModelTypes, typename Visitor>
+    bool visit(SunSpecModelList<ModelTypes...>, Visitor &&visitor) {
+      return visit<ModelTypes...>(visitor);
+    }
+
+    /**
+     * Starts moving on to the next model.
+     */
+    void nextModel();
+
+    /**
+     * Starts resetting the current model pointer to the beginning.
+     */
+    void restart();
+
+    /**
+     * Returns the Modbus address of the current model's header. It can be
+     * passed to `seek()` later to return to the same model without walking
+     * the model list again.
      */
-    bool nextModel();
+    uint16 currentModelAddress();
 
     /**
-     * Resets the current model pointer to the beginning.
+     * Starts moving the current model pointer to the model whose header is at
+     * the given address, as previously returned by `currentModelAddress()`.
      */
-    bool restart();
+    void seek(uint16 address);
+
+    /**
+     * Like `seek()`, but also reads the contents of the model, assuming that
+     * it has the given length. Header and contents are requested at the same
+     * time, saving a round trip. If the length turns out to be different,
+     * this behaves like `seek()` and the contents must be read separately.
+     */
+    void seekAndRead(uint16 address, uint16 expectedLength);
+
+    /**
+     * Returns the length (in registers) of the current model, excluding its
+     * header.
+     */
+    uint16 currentModelLength();
 
   private:
-    ModbusClient *const client_;
+    enum class Step {
+      NONE,
+      PROBE_START_ADDRESSES,
+      READ_SMA_UNIT_ID,
+      READ_MODEL_HEADER,
+      READ_MODEL_BODY,
+      READ_MODEL_HEADER_AND_BODY,
+    };
+
+    /**
+     * A request that has been sent for a part of the current step.
+     */
+    struct Outstanding {
+      uint16 transactionId;
+      uint16 part;
+    };
+
+    SunSpecTransport *const transport_;
+    SunSpecCache *cache_ = nullptr;
+
+    Step step_ = Step::NONE;
+    Status status_ = Status::IDLE;
+
+    // Each step consists of one or more parts, each of which is a single
+    // request.
+    uint16 numParts_ = 0;
+    uint16 nextPart_ = 0;
+    uint16 partsDone_ = 0;
+    Outstanding outstanding_[SunSpecTransport::MAX_WINDOW_SIZE] = {};
 
     uint16 serverId_ = 0;
     uint16 start_ = 0;
+    bool triedSmaServerId_ = false;
+
+    // Bit masks of start addresses (indices into `START_ADDRESSES`) that
+    // have been probed, and of those that turned out to be valid.
+    uint8 startAddressesProbed_ = 0;
+    uint8 startAddressesFound_ = 0;
 
     uint16 currentModelAddress_ = 0;
     uint16 currentModelId_ = 0;
     uint16 currentModelLength_ = 0;
+    uint16 expectedModelLength_ = 0;
 
-    bool findServerId();
-    bool findStartAddress();
-    bool checkStartAddress();
-    bool readModelHeader();
+    // Contents of the current model, allocated with `new` by
+    // `readCurrentModel()` or `seekAndRead()`.
+    uint16 *body_ = nullptr;
+    bool bodyComplete_ = false;
 
     /**
-     * Starts a read of `count` holding registers starting at address `address`
-     * from server ID `serverId_`.
+     * Abandons the current operation, if any, and starts the given step,
+     * consisting of the given number of requests.
      */
-    bool request(uint16 address, uint16 count);
+    void startStep(Step step, uint16 numParts);
 
     /**
-     * Starts a read of `count` holding registers starting at address `address`
-     * from server ID `serverId`.
+     * Sends requests for as many parts of the current step as the window
+     * allows. Returns `false` if nothing could be sent and nothing is
+     * outstanding.
      */
-    bool request(uint16 address, uint16 count, uint16 serverId);
+    bool sendRequests();
 
     /**
-     * Reads the next register from the last request.
+     * Returns the register range to be requested for the given part of the
+     * current step.
      */
-    bool read(uint16 *result);
+    void partRange(uint16 part, uint8 *serverId, uint16 *address, uint16 *count);
 
     /**
-     * Reads `count` registers into an array allocated with `new`, and returns
-     * the array. Returns `nullptr` on failure.
+     * Handles the response to a single part of the current step.
      */
-    uint16 *readArray(uint16 offset, uint16 count);
+    void handlePart(uint16 part, uint16 const *registers);
+
+    /**
+     * Handles a failed request for a single part of the current step. Returns
+     * `false` if the step as a whole has failed.
+     */
+    bool handlePartFailure(uint16 part);
+
+    /**
+     * If all the parts that the current step needs have been handled, returns
+     * the resulting status. Otherwise, returns `Status::BUSY`.
+     */
+    Status checkStepComplete();
+
+    /**
+     * Handles failure of the current step. Returns the resulting status.
+     */
+    Status handleFailure();
+
+    /**
+     * Hands the contents of the current model, which have just been read
+     * completely, to the cache.
+     */
+    void storeInCache();
+
+    size_t numOutstanding() const;
+    void releaseAll();
+    void deleteBody();
+
+    template<typename ModelType, typename Visitor>
+    bool visitAs(Visitor &visitor) {
+      ModelType const model = currentModelAs<ModelType>();
+      if (!model.isValid()) {
+        return false;
+      }
+      visitor(model);
+      return true;
+    }
+
+    template<typename... ModelTypes>
+    static constexpr bool idsAreUnique() {
+      uint16 const ids[] = {ModelTypes::id()...};
+      for (size_t i = 0; i < sizeof...(ModelTypes); i++) {
+        for (size_t j = i + 1; j < sizeof...(ModelTypes); j++) {
+          if (ids[i] == ids[j]) {
+            return false;
+          }
+        }
+      }
+      return true;
+    }
 
+    SunSpec(SunSpec const &) = delete;
+    SunSpec &operator=(SunSpec const &) = delete;
 };
@@ -0,0 +1,117 @@
+#include "SunSpecCache.h"
+
+SunSpecCache::~SunSpecCache() {
+  clear();
+}
+
+SunSpecCache::ModelClass SunSpecCache::classOf(uint16 modelId) {
+  switch (modelId) {
+    case 1: // Common
+    case 120: // Nameplate
+      return ModelClass::STATIC;
+    case 121: // Basic settings
+    case 123: // Immediate controls
+    case 126: // Volt-VAR
+    case 127: // Freq-Watt parameters
+    case 128: // Dynamic reactive current
+    case 129: // LVRT
+    case 130: // HVRT
+    case 131: // Watt-PF
+    case 132: // Volt-Watt
+    case 145: // Extended settings
+      return ModelClass::SETTINGS;
+    default:
+      return ModelClass::MEASUREMENT;
+  }
+}
+
+uint16 const *SunSpecCache::lookup(uint16 address, uint16 modelId, uint16 length) {
+  unsigned long const ttl = ttlMillis(modelId);
+  if (!ttl) {
+    return nullptr;
+  }
+  if (!updateNumberChecked()) {
+    // The layout may have changed since the entry was stored.
+    numMisses_++;
+    return nullptr;
+  }
+  for (Entry &entry : entries_) {
+    if (entry.registers && entry.address == address && entry.modelId == modelId && entry.length == length) {
+      if (millis() - entry.storedMillis >= ttl) {
+        erase(entry);
+        break;
+      }
+      numHits_++;
+      return entry.registers;
+    }
+  }
+  numMisses_++;
+  return nullptr;
+}
+
+void SunSpecCache::store(uint16 address, uint16 modelId, uint16 length, uint16 const *registers) {
+  if (!ttlMillis(modelId)) {
+    return;
+  }
+
+  // Reuse the entry for the same address, or a free one, or else evict the
+  // oldest one.
+  unsigned long const now = millis();
+  Entry *target = nullptr;
+  for (Entry &entry : entries_) {
+    if (entry.registers && entry.address == address) {
+      target = &entry;
+      break;
+    }
+    if (!target ||
+        (target->registers && !entry.registers) ||
+        (target->registers && now - entry.storedMillis > now - target->storedMillis)) {
+      target = &entry;
+    }
+  }
+  erase(*target);
+
+  target->address = address;
+  target->modelId = modelId;
+  target->length = length;
+  target->storedMillis = now;
+  target->registers = new uint16[length];
+  memcpy(target->registers, registers, length * sizeof(uint16));
+}
+
+void SunSpecCache::setUpdateNumber(uint16 address, uint16 length, uint16 updateNumber) {
+  if (hasUpdateNumber_ && updateNumber != updateNumber_) {
+    clear();
+  }
+  hasUpdateNumber_ = true;
+  updateNumberChecked_ = true;
+  updateNumber_ = updateNumber;
+  aggregatorAddress_ = address;
+  aggregatorLength_ = length;
+}
+
+void SunSpecCache::clear() {
+  for (Entry &entry : entries_) {
+    erase(entry);
+  }
+  hasUpdateNumber_ = false;
+  aggregatorAddress_ = 0;
+  aggregatorLength_ = 0;
+}
+
+unsigned long SunSpecCache::ttlMillis(uint16 modelId) {
+  switch (classOf(modelId)) {
+    case ModelClass::STATIC:
+      return STATIC_TTL_MILLIS;
+    case ModelClass::SETTINGS:
+      return SETTINGS_TTL_MILLIS;
+    case ModelClass::MEASUREMENT:
+      break;
+  }
+  return MEASUREMENT_TTL_MILLIS;
+}
+
+void SunSpecCache::erase(Entry &entry) {
+  delete[] entry.registers; // Deleting a nullptr is okay.
+  entry.registers = nullptr;
+}
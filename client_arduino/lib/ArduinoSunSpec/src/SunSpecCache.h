@@ -0,0 +1,115 @@
+#pragma once
+
+#include <Arduino.h>
+
+/**
+ * Cache of model contents, so that models that rarely change don't have to be
+ * read from the device every time. How long an entry stays valid depends on
+ * the class of the model: static (e.g. common, nameplate), settings (e.g.
+ * basic settings, immediate controls) or measurement (everything else). By
+ * default, measurements are not cached at all.
+ *
+ * Entries are keyed by address, model ID and length, which are all known from
+ * the model header before the contents are read, so a changed model layout
+ * simply results in a miss. Devices that implement the aggregator model
+ * (ID 2) also tell us explicitly that their layout changed, through its
+ * update number (UN); when it changes, or the aggregator can't be read, the
+ * entire cache is cleared. For such devices, nothing is served after
+ * `beginScan()` until the update number has been checked again, so callers
+ * should read the aggregator first (see `aggregatorAddress()`).
+ */
+class SunSpecCache {
+  public:
+    enum class ModelClass {
+      STATIC,
+      SETTINGS,
+      MEASUREMENT,
+    };
+
+    static size_t const MAX_ENTRIES = 4;
+
+    // How long models of each class stay valid. A TTL of 0 disables caching
+    // for that class.
+    static unsigned long const STATIC_TTL_MILLIS = 24ul * 60 * 60 * 1000;
+    static unsigned long const SETTINGS_TTL_MILLIS = 10ul * 60 * 1000;
+    static unsigned long const MEASUREMENT_TTL_MILLIS = 0;
+
+    SunSpecCache() {}
+    ~SunSpecCache();
+
+    static ModelClass classOf(uint16 modelId);
+
+    /**
+     * Returns the cached contents of the given model, or `nullptr` if they are
+     * not cached or have expired.
+     */
+    uint16 const *lookup(uint16 address, uint16 modelId, uint16 length);
+
+    /**
+     * Stores a copy of the contents of the given model, if its class is
+     * cached at all.
+     */
+    void store(uint16 address, uint16 modelId, uint16 length, uint16 const *registers);
+
+    /**
+     * Called when the device is (re)discovered. If the device has an
+     * aggregator model, stops serving entries until `setUpdateNumber()` has
+     * been called again.
+     */
+    void beginScan() { updateNumberChecked_ = false; }
+
+    /**
+     * Records the update number from the aggregator model with the given
+     * header address and length. If it differs from the previous one, clears
+     * the cache.
+     */
+    void setUpdateNumber(uint16 address, uint16 length, uint16 updateNumber);
+
+    /**
+     * Returns whether the update number has been checked since
+     * `beginScan()`, or the device is not known to have an aggregator model.
+     */
+    bool updateNumberChecked() const { return !hasUpdateNumber_ || updateNumberChecked_; }
+
+    /**
+     * Returns the header address and length of the aggregator model that the
+     * last update number came from, or 0 if there is none.
+     */
+    uint16 aggregatorAddress() const { return aggregatorAddress_; }
+    uint16 aggregatorLength() const { return aggregatorLength_; }
+
+    /**
+     * Removes all entries, and forgets the update number.
+     */
+    void clear();
+
+    uint32 numHits() const { return numHits_; }
+    uint32 numMisses() const { return numMisses_; }
+
+  private:
+    struct Entry {
+      uint16 address = 0;
+      uint16 modelId = 0;
+      uint16 length = 0;
+      unsigned long storedMillis = 0;
+      // Allocated with `new`; `nullptr` if the entry is unused.
+      uint16 *registers = nullptr;
+    };
+
+    Entry entries_[MAX_ENTRIES];
+
+    bool hasUpdateNumber_ = false;
+    bool updateNumberChecked_ = false;
+    uint16 updateNumber_ = 0;
+    uint16 aggregatorAddress_ = 0;
+    uint16 aggregatorLength_ = 0;
+
+    uint32 numHits_ = 0;
+    uint32 numMisses_ = 0;
+
+    static unsigned long ttlMillis(uint16 modelId);
+    void erase(Entry &entry);
+
+    SunSpecCache(SunSpecCache const &) = delete;
+    SunSpecCache &operator=(SunSpecCache const &) = delete;
+};
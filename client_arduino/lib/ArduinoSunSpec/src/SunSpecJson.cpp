@@ -0,0 +1,228 @@
+#include "SunSpecJson.h"
+
+namespace {
+
+class Writer {
+  public:
+    explicit Writer(Print &out) : out_(out) {}
+
+    size_t written() const { return written_; }
+
+    void write(char c) {
+      written_ += out_.write(static_cast<uint8_t>(c));
+    }
+
+    void write(char const *s, size_t length) {
+      written_ += out_.write(reinterpret_cast<uint8_t const *>(s), length);
+    }
+
+    void writeProgmem(PGM_P s) {
+      for (char c = pgm_read_byte(s); c; c = pgm_read_byte(++s)) {
+        write(c);
+      }
+    }
+
+    void writeKey(PGM_P name) {
+      write('"');
+      writeProgmem(name);
+      write("\":", 2);
+    }
+
+    void writeUnsigned(uint64_t value) {
+      char digits[20];
+      size_t const length = formatUnsigned(value, digits);
+      write(digits, length);
+    }
+
+    /**
+     * Writes `mantissa * 10^exponent` as an exact decimal.
+     */
+    void writeDecimal(bool negative, uint64_t mantissa, int8_t exponent) {
+      // 20 digits, plus up to 10 leading or trailing zeros, a sign and a
+      // decimal point.
+      char buffer[32];
+      char digits[20];
+      size_t numDigits = formatUnsigned(mantissa, digits);
+      size_t length = 0;
+      if (negative && mantissa) {
+        buffer[length++] = '-';
+      }
+      if (exponent >= 0 || !mantissa) {
+        memcpy(buffer + length, digits, numDigits);
+        length += numDigits;
+        for (int8_t i = 0; mantissa && i < exponent; i++) {
+          buffer[length++] = '0';
+        }
+        write(buffer, length);
+        return;
+      }
+
+      // Trailing zeros after the decimal point carry no information.
+      size_t numDecimals = -exponent;
+      while (numDecimals && digits[numDigits - 1] == '0') {
+        numDigits--;
+        numDecimals--;
+      }
+      if (numDigits <= numDecimals) {
+        buffer[length++] = '0';
+      } else {
+        memcpy(buffer + length, digits, numDigits - numDecimals);
+        length += numDigits - numDecimals;
+      }
+      if (numDecimals) {
+        buffer[length++] = '.';
+        for (size_t i = numDigits; i < numDecimals; i++) {
+          buffer[length++] = '0';
+        }
+        size_t const start = numDigits > numDecimals ? numDigits - numDecimals : 0;
+        memcpy(buffer + length, digits + start, numDigits - start);
+        length += numDigits - start;
+      }
+      write(buffer, length);
+    }
+
+    void writeFloat(double value) {
+      if (!std::isfinite(value)) {
+        write("null", 4);
+        return;
+      }
+      char buffer[32];
+      int const length = snprintf(buffer, sizeof(buffer), "%.7g", value);
+      write(buffer, length);
+    }
+
+    void writeString(uint16_t const *registers, uint16_t numRegisters) {
+      write('"');
+      for (uint16_t i = 0; i < 2 * numRegisters; i++) {
+        char const c = i % 2 ? registers[i / 2] & 0xff : registers[i / 2] >> 8;
+        if (!c) {
+          break;
+        }
+        if (c == '"' || c == '\\') {
+          write('\\');
+          write(c);
+        } else if (static_cast<uint8_t>(c) < 0x20) {
+          char escape[7];
+          snprintf(escape, sizeof(escape), "\\u%04x", c);
+          write(escape, 6);
+        } else {
+          write(c);
+        }
+      }
+      write('"');
+    }
+
+    void writeIpAddress(uint32_t address) {
+      write('"');
+      for (int shift = 24; shift >= 0; shift -= 8) {
+        writeUnsigned((address >> shift) & 0xff);
+        if (shift) {
+          write('.');
+        }
+      }
+      write('"');
+    }
+
+    /**
+     * Writes the implemented points from the given table as members of an
+     * object, each preceded by a comma if `first` is `false`.
+     */
+    void writePoints(
+        SunSpecPointDescriptor const *points, uint16_t numPoints,
+        uint16_t const *registers, uint16_t numRegisters, uint16_t repeatOffset,
+        bool first) {
+      for (uint16_t i = 0; i < numPoints; i++) {
+        SunSpecPointDescriptor const point = SunSpecPoints::descriptor(points + i);
+        SunSpecPointValue const value = SunSpecPoints::decode(registers, numRegisters, point, repeatOffset);
+        if (!value.isImplemented()) {
+          continue;
+        }
+        if (!first) {
+          write(',');
+        }
+        first = false;
+        writeKey(point.name);
+        writeValue(point, value);
+      }
+    }
+
+  private:
+    Print &out_;
+    size_t written_ = 0;
+
+    /**
+     * Formats the value into `digits` without a terminating NUL, and returns
+     * the number of digits.
+     */
+    static size_t formatUnsigned(uint64_t value, char digits[20]) {
+      char reversed[20];
+      size_t length = 0;
+      do {
+        reversed[length++] = '0' + value % 10;
+        value /= 10;
+      } while (value);
+      for (size_t i = 0; i < length; i++) {
+        digits[i] = reversed[length - 1 - i];
+      }
+      return length;
+    }
+
+    void writeValue(SunSpecPointDescriptor const &point, SunSpecPointValue const &value) {
+      switch (value.kind) {
+        case SunSpecPointValue::Kind::SIGNED: {
+          // Negate in unsigned arithmetic, so that INT64_MIN survives.
+          uint64_t const magnitude = value.i < 0 ? -static_cast<uint64_t>(value.i) : value.i;
+          writeDecimal(value.i < 0, magnitude, value.exponent);
+          break;
+        }
+        case SunSpecPointValue::Kind::UNSIGNED:
+          if (point.type == SunSpecPointType::IPADDR) {
+            writeIpAddress(value.u);
+          } else {
+            writeDecimal(false, value.u, value.exponent);
+          }
+          break;
+        case SunSpecPointValue::Kind::FLOAT:
+          writeFloat(value.f);
+          break;
+        case SunSpecPointValue::Kind::STRING:
+          writeString(value.string, value.length);
+          break;
+        case SunSpecPointValue::Kind::NOT_IMPLEMENTED:
+          write("null", 4);
+          break;
+      }
+    }
+};
+
+}
+
+namespace SunSpecJson {
+
+size_t write(Print &out, SunSpecPointTable const &table, uint16_t const *registers, uint16_t numRegisters) {
+  Writer writer(out);
+  writer.write("{\"id\":", 6);
+  writer.writeUnsigned(table.id);
+  uint16_t const fixedLength = numRegisters < table.length ? numRegisters : table.length;
+  writer.writePoints(table.points, table.numPoints, registers, fixedLength, 0, false);
+
+  if (table.groupName && table.repeatLength) {
+    writer.write(',');
+    writer.writeKey(table.groupName);
+    writer.write('[');
+    for (uint16_t offset = table.length; offset + table.repeatLength <= numRegisters; offset += table.repeatLength) {
+      if (offset != table.length) {
+        writer.write(',');
+      }
+      writer.write('{');
+      writer.writePoints(table.groupPoints, table.numGroupPoints, registers, numRegisters, offset, true);
+      writer.write('}');
+    }
+    writer.write(']');
+  }
+
+  writer.write('}');
+  return writer.written();
+}
+
+}
@@ -0,0 +1,34 @@
+#pragma once
+
+#include <Arduino.h>
+
+#include "SunSpecPoint.h"
+
+/**
+ * Serializes any model to JSON by walking its point table, writing straight
+ * from the register buffer to the output without building a document or
+ * copying strings.
+ *
+ * The output is a single object with the model ID under "id" and every
+ * implemented point under the name of its getter, e.g.
+ * `{"id":103,"amps":12.3,"watts":2500,"wattHours":1000000}`. Scaled integers are written
+ * as exact decimals. If the model has a repeating group, its repeats follow
+ * as an array of objects under the name of the group.
+ */
+namespace SunSpecJson {
+
+  /**
+   * Writes the model with the given table and registers. Returns the number
+   * of bytes written.
+   */
+  size_t write(Print &out, SunSpecPointTable const &table, uint16_t const *registers, uint16_t numRegisters);
+
+  template<typename ModelType>
+  size_t write(Print &out, ModelType const &model) {
+    if (!model.isValid()) {
+      return 0;
+    }
+    return write(out, ModelType::pointTable(), model.registers(), model.numRegisters());
+  }
+
+}
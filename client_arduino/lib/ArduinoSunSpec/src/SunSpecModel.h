@@ -1,8 +1,11 @@
 #pragma once
 
+#include <array>
 #include <cmath>
 #include <cstdint>
 
+#include "Log.h"
+
 static inline constexpr float uint32_to_float(uint32_t i) {
   static_assert(sizeof(float) == sizeof(uint32_t));
   union U {
@@ -48,16 +51,88 @@ namespace NotImplemented {
   const uint64_t EUI48 = 0x0000000000000000; // Missing from the spec.
 }
 
+/**
+ * Scale factors are powers of ten. The SunSpec specification limits them to
+ * the range -10 to 10, so we can look them up in a table instead of calling
+ * `pow10f`/`pow10`, which are expensive on hardware without an FPU.
+ */
+namespace SunSpecScaleFactor {
+  const int8_t MIN_EXPONENT = -10;
+  const int8_t MAX_EXPONENT = 10;
+
+  /**
+   * Marks a scale factor that is not implemented or out of range.
+   */
+  const int8_t INVALID_EXPONENT = INT8_MIN;
+
+  constexpr float POW10F[MAX_EXPONENT - MIN_EXPONENT + 1] = {
+    1e-10f, 1e-9f, 1e-8f, 1e-7f, 1e-6f, 1e-5f, 1e-4f, 1e-3f, 1e-2f, 1e-1f,
+    1e0f,
+    1e1f, 1e2f, 1e3f, 1e4f, 1e5f, 1e6f, 1e7f, 1e8f, 1e9f, 1e10f,
+  };
+
+  constexpr double POW10[MAX_EXPONENT - MIN_EXPONENT + 1] = {
+    1e-10, 1e-9, 1e-8, 1e-7, 1e-6, 1e-5, 1e-4, 1e-3, 1e-2, 1e-1,
+    1e0,
+    1e1, 1e2, 1e3, 1e4, 1e5, 1e6, 1e7, 1e8, 1e9, 1e10,
+  };
+
+  /**
+   * Converts the raw value of a `sunssf` register to an exponent, or
+   * `INVALID_EXPONENT` if it is not implemented or out of range.
+   */
+  static inline constexpr int8_t decode(uint16_t raw) {
+    int16_t const exponent = static_cast<int16_t>(raw);
+    return exponent >= MIN_EXPONENT && exponent <= MAX_EXPONENT ?
+      static_cast<int8_t>(exponent) :
+      INVALID_EXPONENT;
+  }
+
+  static inline constexpr float pow10f(int8_t exponent) {
+    return POW10F[exponent - MIN_EXPONENT];
+  }
+
+  static inline constexpr double pow10(int8_t exponent) {
+    return POW10[exponent - MIN_EXPONENT];
+  }
+}
+
+/**
+ * A fixed-point value with a decimal exponent, as decoded by the scaled
+ * getters before conversion to floating point. The value is
+ * `mantissa * 10^exponent`. If either the point or its scale factor is not
+ * implemented, `isValid()` returns `false`.
+ *
+ * Callers that want to avoid floating-point arithmetic altogether get the
+ * same from the point table; see `SunSpecPoints::decode()`.
+ */
+template<typename T>
+struct SunSpecScaled {
+  T mantissa;
+  int8_t exponent;
+
+  bool isValid() const {
+    return exponent != SunSpecScaleFactor::INVALID_EXPONENT;
+  }
+};
+
 /**
  * A "lazy" parser of a SunSpec model. It contains an array of register values
  * and parses fields from it on request.
  *
  * Autogenerated classes derive from this and add getter functions for each
- * point (field).
+ * point (field). They pass the offsets of all the model's scale factor
+ * points as `SCALE_FACTOR_OFFSETS`; these are decoded once, when the buffer
+ * is set, rather than on every call to a getter.
+ *
+ * `LENGTH` is the length of the fixed part of the model. Models with a
+ * repeating group pass the length of one repeat as `REPEAT_LENGTH` (or 0 if
+ * there is none); the repeats follow the fixed part, and their number follows
+ * from the actual length of the model.
  *
  * Note that write access is not currently supported.
  */
-template<uint16_t ID, uint16_t LENGTH>
+template<uint16_t ID, uint16_t LENGTH, uint16_t REPEAT_LENGTH, uint16_t... SCALE_FACTOR_OFFSETS>
 class SunSpecModel {
   public:
     static constexpr uint16_t id() {
@@ -70,6 +145,7 @@ class SunSpecModel {
     SunSpecModel(SunSpecModel &&other) {
       buffer_ = other.buffer_;
       bufSize_ = other.bufSize_;
+      exponents_ = other.exponents_;
       other.buffer_ = nullptr;
       other.bufSize_ = 0;
     }
@@ -82,6 +158,7 @@ class SunSpecModel {
       deleteBuffer();
       buffer_ = other.buffer_;
       bufSize_ = other.bufSize_;
+      exponents_ = other.exponents_;
       other.buffer_ = nullptr;
       other.bufSize_ = 0;
       return &this;
@@ -91,8 +168,34 @@ class SunSpecModel {
       return buffer_ != nullptr;
     }
 
+    /**
+     * The raw contents of the model, for generic access through its
+     * `pointTable()`.
+     */
+    uint16 const *registers() const {
+      return buffer_;
+    }
+
+    uint16 numRegisters() const {
+      return bufSize_;
+    }
+
   protected:
 
+    /**
+     * Number of repeats of the repeating group that fit in the buffer.
+     */
+    uint16_t numRepeats() const {
+      return REPEAT_LENGTH && bufSize_ > LENGTH ? (bufSize_ - LENGTH) / REPEAT_LENGTH : 0;
+    }
+
+    /**
+     * Offset of the given repeat of the repeating group.
+     */
+    static constexpr uint16_t repeatOffset(uint16_t index) {
+      return LENGTH + index * REPEAT_LENGTH;
+    }
+
     int16_t parse_int16(uint16_t offset) const {
       if (!canRead(offset, 1)) {
         return NotImplemented::INT16;
@@ -269,55 +372,139 @@ class SunSpecModel {
         static_cast<uint64_t>(buffer_[offset + 2]);
     }
 
+    // Each scaled getter comes in three variants: with the offsets of value
+    // and scale factor known at compile time (for points in the fixed part
+    // of a model); with only the scale factor offset known at compile time
+    // (for points in a repeating group whose scale factor is in the fixed
+    // part); and with both known only at run time (for points in a repeating
+    // group whose scale factor is in the same group). Only the last variant
+    // decodes the scale factor on every call.
+
+    template<uint16_t OFFSET, uint16_t SCALE_OFFSET>
+    float parse_int16_sunssf() const {
+      return parse_int16_sunssf<SCALE_OFFSET>(OFFSET);
+    }
+
+    template<uint16_t OFFSET, uint16_t SCALE_OFFSET>
+    float parse_uint16_sunssf() const {
+      return parse_uint16_sunssf<SCALE_OFFSET>(OFFSET);
+    }
+
+    template<uint16_t OFFSET, uint16_t SCALE_OFFSET>
+    double parse_uint32_sunssf() const {
+      return parse_uint32_sunssf<SCALE_OFFSET>(OFFSET);
+    }
+
+    template<uint16_t OFFSET, uint16_t SCALE_OFFSET>
+    double parse_uint64_sunssf() const {
+      return parse_uint64_sunssf<SCALE_OFFSET>(OFFSET);
+    }
+
+    template<uint16_t OFFSET, uint16_t SCALE_OFFSET>
+    double parse_acc32_sunssf() const {
+      return parse_acc32_sunssf<SCALE_OFFSET>(OFFSET);
+    }
+
+    template<uint16_t SCALE_OFFSET>
+    float parse_int16_sunssf(uint16_t offset) const {
+      return toFloat(parse_int16_scaled<SCALE_OFFSET>(offset));
+    }
+
+    template<uint16_t SCALE_OFFSET>
+    float parse_uint16_sunssf(uint16_t offset) const {
+      return toFloat(parse_uint16_scaled<SCALE_OFFSET>(offset));
+    }
+
+    template<uint16_t SCALE_OFFSET>
+    double parse_uint32_sunssf(uint16_t offset) const {
+      return toDouble(parse_uint32_scaled<SCALE_OFFSET>(offset));
+    }
+
+    template<uint16_t SCALE_OFFSET>
+    double parse_uint64_sunssf(uint16_t offset) const {
+      return toDouble(parse_uint64_scaled<SCALE_OFFSET>(offset));
+    }
+
+    template<uint16_t SCALE_OFFSET>
+    double parse_acc32_sunssf(uint16_t offset) const {
+      return toDouble(parse_acc32_scaled<SCALE_OFFSET>(offset));
+    }
+
     float parse_int16_sunssf(uint16_t offset, uint16_t scaleOffset) const {
-      int16_t mantissa = parse_int16(offset);
-      int16_t exponent = parse_int16(scaleOffset);
-      if (mantissa == NotImplemented::INT16 || exponent == NotImplemented::SUNSSF) {
-        return NotImplemented::FLOAT32;
-      } 
-      return static_cast<float>(mantissa) * pow10f(static_cast<float>(exponent));
+      return toFloat(parse_int16_scaled(offset, scaleOffset));
     }
 
     float parse_uint16_sunssf(uint16_t offset, uint16_t scaleOffset) const {
-      uint16_t mantissa = parse_uint16(offset);
-      int16_t exponent = parse_int16(scaleOffset);
-      if (mantissa == NotImplemented::UINT16 || exponent == NotImplemented::SUNSSF) {
-        return NotImplemented::FLOAT32;
-      } 
-      return static_cast<float>(mantissa) * pow10f(static_cast<float>(exponent));
+      return toFloat(parse_uint16_scaled(offset, scaleOffset));
     }
 
     double parse_uint32_sunssf(uint16_t offset, uint16_t scaleOffset) const {
-      uint32_t mantissa = parse_uint32(offset);
-      int16_t exponent = parse_int16(scaleOffset);
-      if (mantissa == NotImplemented::UINT32 || exponent == NotImplemented::SUNSSF) {
-        return NotImplemented::FLOAT64;
-      } 
-      return static_cast<double>(mantissa) * pow10(static_cast<double>(exponent));
+      return toDouble(parse_uint32_scaled(offset, scaleOffset));
     }
 
     double parse_uint64_sunssf(uint16_t offset, uint16_t scaleOffset) const {
-      uint64_t mantissa = parse_uint64(offset);
-      int16_t exponent = parse_int16(scaleOffset);
-      if (mantissa == NotImplemented::UINT64 || exponent == NotImplemented::SUNSSF) {
-        return NotImplemented::FLOAT64;
-      } 
-      return static_cast<double>(mantissa) * pow10(static_cast<double>(exponent));
+      return toDouble(parse_uint64_scaled(offset, scaleOffset));
     }
 
     double parse_acc32_sunssf(uint16_t offset, uint16_t scaleOffset) const {
-      uint32_t mantissa = parse_acc32(offset);
-      int16_t exponent = parse_int16(scaleOffset);
-      if (mantissa == NotImplemented::ACC32 || exponent == NotImplemented::SUNSSF) {
-        return NotImplemented::FLOAT64;
-      } 
-      return static_cast<double>(mantissa) * pow10(static_cast<double>(exponent));
+      return toDouble(parse_acc32_scaled(offset, scaleOffset));
+    }
+
+    template<uint16_t SCALE_OFFSET>
+    SunSpecScaled<int16_t> parse_int16_scaled(uint16_t offset) const {
+      return scaled(parse_int16(offset), NotImplemented::INT16, exponent<SCALE_OFFSET>());
+    }
+
+    template<uint16_t SCALE_OFFSET>
+    SunSpecScaled<uint16_t> parse_uint16_scaled(uint16_t offset) const {
+      return scaled(parse_uint16(offset), NotImplemented::UINT16, exponent<SCALE_OFFSET>());
+    }
+
+    template<uint16_t SCALE_OFFSET>
+    SunSpecScaled<uint32_t> parse_uint32_scaled(uint16_t offset) const {
+      return scaled(parse_uint32(offset), NotImplemented::UINT32, exponent<SCALE_OFFSET>());
+    }
+
+    template<uint16_t SCALE_OFFSET>
+    SunSpecScaled<uint64_t> parse_uint64_scaled(uint16_t offset) const {
+      return scaled(parse_uint64(offset), NotImplemented::UINT64, exponent<SCALE_OFFSET>());
+    }
+
+    template<uint16_t SCALE_OFFSET>
+    SunSpecScaled<uint32_t> parse_acc32_scaled(uint16_t offset) const {
+      return scaled(parse_acc32(offset), NotImplemented::ACC32, exponent<SCALE_OFFSET>());
+    }
+
+    SunSpecScaled<int16_t> parse_int16_scaled(uint16_t offset, uint16_t scaleOffset) const {
+      return scaled(parse_int16(offset), NotImplemented::INT16, dynamicExponent(scaleOffset));
+    }
+
+    SunSpecScaled<uint16_t> parse_uint16_scaled(uint16_t offset, uint16_t scaleOffset) const {
+      return scaled(parse_uint16(offset), NotImplemented::UINT16, dynamicExponent(scaleOffset));
+    }
+
+    SunSpecScaled<uint32_t> parse_uint32_scaled(uint16_t offset, uint16_t scaleOffset) const {
+      return scaled(parse_uint32(offset), NotImplemented::UINT32, dynamicExponent(scaleOffset));
+    }
+
+    SunSpecScaled<uint64_t> parse_uint64_scaled(uint16_t offset, uint16_t scaleOffset) const {
+      return scaled(parse_uint64(offset), NotImplemented::UINT64, dynamicExponent(scaleOffset));
+    }
+
+    SunSpecScaled<uint32_t> parse_acc32_scaled(uint16_t offset, uint16_t scaleOffset) const {
+      return scaled(parse_acc32(offset), NotImplemented::ACC32, dynamicExponent(scaleOffset));
     }
 
   private:
+    static constexpr size_t NUM_SCALE_FACTORS = sizeof...(SCALE_FACTOR_OFFSETS);
+    static constexpr std::array<uint16_t, NUM_SCALE_FACTORS> scaleFactorOffsets_ = {SCALE_FACTOR_OFFSETS...};
+
     uint16 const *buffer_ = nullptr;
     uint16 bufSize_ = 0;
 
+    // Decoded scale factors, in the same order as `SCALE_FACTOR_OFFSETS`.
+    std::array<int8_t, NUM_SCALE_FACTORS> exponents_ = {};
+
     SunSpecModel(SunSpecModel const &) = delete;
     SunSpecModel &operator=(SunSpecModel const &) = delete;
 
@@ -328,22 +515,84 @@ class SunSpecModel {
     void setBuffer(uint16 *buffer, uint16 bufSize) {
       deleteBuffer();
 
-      if (bufSize != LENGTH) {
-        ARDUINO_SUNSPEC_DEBUG_LOG("Model ");
-        ARDUINO_SUNSPEC_DEBUG_LOG(ID);
-        ARDUINO_SUNSPEC_DEBUG_LOG(" should have length ");
-        ARDUINO_SUNSPEC_DEBUG_LOG(LENGTH);
-        ARDUINO_SUNSPEC_DEBUG_LOG(" but has length ");
-        ARDUINO_SUNSPEC_DEBUG_LOG(bufSize);
+      bool const lengthOk = REPEAT_LENGTH ?
+        bufSize >= LENGTH && (bufSize - LENGTH) % REPEAT_LENGTH == 0 :
+        bufSize == LENGTH;
+      if (!lengthOk) {
         if (bufSize < LENGTH) {
-          ARDUINO_SUNSPEC_DEBUG_LOGLN("; missing points will be defaulted");
-        } else if (bufSize > LENGTH) {
-          ARDUINO_SUNSPEC_DEBUG_LOGLN("; extra registers will be ignored");
+          LOG_WARNING("sunspec", "Model %u should have length %u but has length %u; missing points will be defaulted",
+              ID, LENGTH, bufSize);
+        } else {
+          LOG_WARNING("sunspec", "Model %u should have length %u but has length %u; extra registers will be ignored",
+              ID, LENGTH, bufSize);
         }
       }
 
       buffer_ = buffer;
       bufSize_ = bufSize;
+
+      for (size_t i = 0; i < NUM_SCALE_FACTORS; i++) {
+        exponents_[i] = canRead(scaleFactorOffsets_[i], 1) ?
+          SunSpecScaleFactor::decode(read_uint16(scaleFactorOffsets_[i])) :
+          SunSpecScaleFactor::INVALID_EXPONENT;
+      }
+    }
+
+    /**
+     * Returns the index of the given scale factor offset in
+     * `SCALE_FACTOR_OFFSETS`, or `NUM_SCALE_FACTORS` if it is not in there.
+     */
+    static constexpr size_t scaleFactorIndex(uint16_t scaleOffset) {
+      for (size_t i = 0; i < NUM_SCALE_FACTORS; i++) {
+        if (scaleFactorOffsets_[i] == scaleOffset) {
+          return i;
+        }
+      }
+      return NUM_SCALE_FACTORS;
+    }
+
+    /**
+     * Returns the decoded exponent of the scale factor at the given offset.
+     * The lookup of the offset happens at compile time.
+     */
+    template<uint16_t SCALE_OFFSET>
+    int8_t exponent() const {
+      constexpr size_t index = scaleFactorIndex(SCALE_OFFSET);
+      static_assert(index < NUM_SCALE_FACTORS, "Offset is not a scale factor of this model");
+      return exponents_[index];
+    }
+
+    /**
+     * Decodes the scale factor at the given offset on the spot.
+     */
+    int8_t dynamicExponent(uint16_t scaleOffset) const {
+      return canRead(scaleOffset, 1) ?
+        SunSpecScaleFactor::decode(read_uint16(scaleOffset)) :
+        SunSpecScaleFactor::INVALID_EXPONENT;
+    }
+
+    template<typename T>
+    static SunSpecScaled<T> scaled(T mantissa, T notImplemented, int8_t scaleExponent) {
+      if (mantissa == notImplemented) {
+        return { mantissa, SunSpecScaleFactor::INVALID_EXPONENT };
+      }
+      return { mantissa, scaleExponent };
+    }
+
+    template<typename T>
+    static float toFloat(SunSpecScaled<T> value) {
+      if (!value.isValid()) {
+        return NotImplemented::FLOAT32;
+      }
+      return static_cast<float>(value.mantissa) * SunSpecScaleFactor::pow10f(value.exponent);
+    }
+
+    template<typename T>
+    static double toDouble(SunSpecScaled<T> value) {
+      if (!value.isValid()) {
+        return NotImplemented::FLOAT64;
+      }
+      return static_cast<double>(value.mantissa) * SunSpecScaleFactor::pow10(value.exponent);
     }
 
     /**
@@ -383,3 +632,82 @@ class SunSpecModel {
 
     friend class SunSpec;
 };
+
+/**
+ * A view of a single repeat of a repeating group, as a window into the buffer
+ * of the model that contains it. Creating one doesn't allocate or copy
+ * anything; it is just a pointer and an offset, and it is only valid as long
+ * as the model is.
+ *
+ * Autogenerated classes for repeating groups derive from this and add getter
+ * functions for each point, which call into the model's parsers with the
+ * offset of the repeat added.
+ */
+template<typename Model, uint16_t GROUP_LENGTH>
+class SunSpecGroup {
+  public:
+    using ModelType = Model;
+
+    static constexpr uint16_t length() {
+      return GROUP_LENGTH;
+    }
+
+    SunSpecGroup(Model const *model, uint16_t offset) :
+      model_(model),
+      offset_(offset)
+    {
+    }
+
+  protected:
+    Model const &groupModel() const { return *model_; }
+    uint16_t groupOffset() const { return offset_; }
+
+  private:
+    Model const *model_;
+    uint16_t offset_;
+};
+
+/**
+ * All repeats of a repeating group in a model, for use in range-based `for`
+ * loops. Advancing the iterator is just an addition.
+ */
+template<typename Group>
+class SunSpecRepeats {
+  public:
+    using Model = typename Group::ModelType;
+
+    class Iterator {
+      public:
+        Iterator(Model const *model, uint16_t offset) :
+          model_(model),
+          offset_(offset)
+        {
+        }
+
+        Group operator*() const { return Group(model_, offset_); }
+        Iterator &operator++() { offset_ += Group::length(); return *this; }
+        bool operator!=(Iterator const &other) const { return offset_ != other.offset_; }
+
+      private:
+        Model const *model_;
+        uint16_t offset_;
+    };
+
+    SunSpecRepeats(Model const *model, uint16_t offset, uint16_t count) :
+      model_(model),
+      offset_(offset),
+      count_(count)
+    {
+    }
+
+    uint16_t size() const { return count_; }
+    Group operator[](uint16_t index) const { return Group(model_, offset_ + index * Group::length()); }
+
+    Iterator begin() const { return Iterator(model_, offset_); }
+    Iterator end() const { return Iterator(model_, offset_ + count_ * Group::length()); }
+
+  private:
+    Model const *model_;
+    uint16_t offset_;
+    uint16_t count_;
+};
@@ -0,0 +1,2377 @@
+#include "SunSpec.h"
+#include "SunSpecModels.h"
+
+namespace SunSpecModels {
+
+namespace {
+
+char const STR_manufacturer[] PROGMEM = "manufacturer";
+char const STR_model[] PROGMEM = "model";
+char const STR_options[] PROGMEM = "options";
+char const STR_version[] PROGMEM = "version";
+char const STR_serialNumber[] PROGMEM = "serialNumber";
+char const STR_deviceAddress[] PROGMEM = "deviceAddress";
+char const STR_AID[] PROGMEM = "AID";
+char const STR_N[] PROGMEM = "N";
+char const STR_UN[] PROGMEM = "UN";
+char const STR_status[] PROGMEM = "status";
+char const STR_vendorStatus[] PROGMEM = "vendorStatus";
+char const STR_eventCode[] PROGMEM = "eventCode";
+char const STR_vendorEventCode[] PROGMEM = "vendorEventCode";
+char const STR_control[] PROGMEM = "control";
+char const STR_vendorControl[] PROGMEM = "vendorControl";
+char const STR_controlValue[] PROGMEM = "controlValue";
+char const STR_interfaceStatus[] PROGMEM = "interfaceStatus";
+char const STR_interfaceControl[] PROGMEM = "interfaceControl";
+char const STR_physicalAccessType[] PROGMEM = "physicalAccessType";
+char const STR_ethernetLinkSpeed[] PROGMEM = "ethernetLinkSpeed";
+char const STR_Mbps[] PROGMEM = "Mbps";
+char const STR_interfaceStatusFlags[] PROGMEM = "interfaceStatusFlags";
+char const STR_linkState[] PROGMEM = "linkState";
+char const STR_MAC[] PROGMEM = "MAC";
+char const STR_name[] PROGMEM = "name";
+char const STR_forcedSpeed[] PROGMEM = "forcedSpeed";
+char const STR_configStatus[] PROGMEM = "configStatus";
+char const STR_changeStatus[] PROGMEM = "changeStatus";
+char const STR_configCapability[] PROGMEM = "configCapability";
+char const STR_iPv4Config[] PROGMEM = "iPv4Config";
+char const STR_IP[] PROGMEM = "IP";
+char const STR_netmask[] PROGMEM = "netmask";
+char const STR_gateway[] PROGMEM = "gateway";
+char const STR_DNS1[] PROGMEM = "DNS1";
+char const STR_DNS2[] PROGMEM = "DNS2";
+char const STR_NTP1[] PROGMEM = "NTP1";
+char const STR_NTP2[] PROGMEM = "NTP2";
+char const STR_domain[] PROGMEM = "domain";
+char const STR_hostName[] PROGMEM = "hostName";
+char const STR_iPv6Config[] PROGMEM = "iPv6Config";
+char const STR_CIDR[] PROGMEM = "CIDR";
+char const STR_capabilities[] PROGMEM = "capabilities";
+char const STR_config[] PROGMEM = "config";
+char const STR_type[] PROGMEM = "type";
+char const STR_address[] PROGMEM = "address";
+char const STR_port[] PROGMEM = "port";
+char const STR_username[] PROGMEM = "username";
+char const STR_password[] PROGMEM = "password";
+char const STR_clear[] PROGMEM = "clear";
+char const STR_inputCount[] PROGMEM = "inputCount";
+char const STR_inputUnicastCount[] PROGMEM = "inputUnicastCount";
+char const STR_inputNonUnicastCount[] PROGMEM = "inputNonUnicastCount";
+char const STR_inputDiscardedCount[] PROGMEM = "inputDiscardedCount";
+char const STR_inputErrorCount[] PROGMEM = "inputErrorCount";
+char const STR_inputUnknownCount[] PROGMEM = "inputUnknownCount";
+char const STR_outputCount[] PROGMEM = "outputCount";
+char const STR_outputUnicastCount[] PROGMEM = "outputUnicastCount";
+char const STR_outputNonUnicastCount[] PROGMEM = "outputNonUnicastCount";
+char const STR_outputDiscardedCount[] PROGMEM = "outputDiscardedCount";
+char const STR_outputErrorCount[] PROGMEM = "outputErrorCount";
+char const STR_linkControl[] PROGMEM = "linkControl";
+char const STR_rate[] PROGMEM = "rate";
+char const STR_bps[] PROGMEM = "bps";
+char const STR_bits[] PROGMEM = "bits";
+char const STR_parity[] PROGMEM = "parity";
+char const STR_duplex[] PROGMEM = "duplex";
+char const STR_flowControl[] PROGMEM = "flowControl";
+char const STR_interfaceType[] PROGMEM = "interfaceType";
+char const STR_protocol[] PROGMEM = "protocol";
+char const STR_IMEI[] PROGMEM = "IMEI";
+char const STR_APN[] PROGMEM = "APN";
+char const STR_number[] PROGMEM = "number";
+char const STR_PIN[] PROGMEM = "PIN";
+char const STR_authentication[] PROGMEM = "authentication";
+char const STR_amps[] PROGMEM = "amps";
+char const STR_A[] PROGMEM = "A";
+char const STR_ampsPhaseA[] PROGMEM = "ampsPhaseA";
+char const STR_ampsPhaseB[] PROGMEM = "ampsPhaseB";
+char const STR_ampsPhaseC[] PROGMEM = "ampsPhaseC";
+char const STR_phaseVoltageAB[] PROGMEM = "phaseVoltageAB";
+char const STR_V[] PROGMEM = "V";
+char const STR_phaseVoltageBC[] PROGMEM = "phaseVoltageBC";
+char const STR_phaseVoltageCA[] PROGMEM = "phaseVoltageCA";
+char const STR_phaseVoltageAN[] PROGMEM = "phaseVoltageAN";
+char const STR_phaseVoltageBN[] PROGMEM = "phaseVoltageBN";
+char const STR_phaseVoltageCN[] PROGMEM = "phaseVoltageCN";
+char const STR_watts[] PROGMEM = "watts";
+char const STR_W[] PROGMEM = "W";
+char const STR_hz[] PROGMEM = "hz";
+char const STR_Hz[] PROGMEM = "Hz";
+char const STR_VA[] PROGMEM = "VA";
+char const STR_vAr[] PROGMEM = "vAr";
+char const STR_var[] PROGMEM = "var";
+char const STR_PF[] PROGMEM = "PF";
+char const STR_Pct[] PROGMEM = "Pct";
+char const STR_wattHours[] PROGMEM = "wattHours";
+char const STR_Wh[] PROGMEM = "Wh";
+char const STR_DCAmps[] PROGMEM = "DCAmps";
+char const STR_DCVoltage[] PROGMEM = "DCVoltage";
+char const STR_DCWatts[] PROGMEM = "DCWatts";
+char const STR_cabinetTemperature[] PROGMEM = "cabinetTemperature";
+char const STR_C[] PROGMEM = "C";
+char const STR_heatSinkTemperature[] PROGMEM = "heatSinkTemperature";
+char const STR_transformerTemperature[] PROGMEM = "transformerTemperature";
+char const STR_otherTemperature[] PROGMEM = "otherTemperature";
+char const STR_operatingState[] PROGMEM = "operatingState";
+char const STR_vendorOperatingState[] PROGMEM = "vendorOperatingState";
+char const STR_event1[] PROGMEM = "event1";
+char const STR_eventBitfield2[] PROGMEM = "eventBitfield2";
+char const STR_vendorEventBitfield1[] PROGMEM = "vendorEventBitfield1";
+char const STR_vendorEventBitfield2[] PROGMEM = "vendorEventBitfield2";
+char const STR_vendorEventBitfield3[] PROGMEM = "vendorEventBitfield3";
+char const STR_vendorEventBitfield4[] PROGMEM = "vendorEventBitfield4";
+char const STR_dERTyp[] PROGMEM = "dERTyp";
+char const STR_wRtg[] PROGMEM = "wRtg";
+char const STR_vARtg[] PROGMEM = "vARtg";
+char const STR_vArRtgQ1[] PROGMEM = "vArRtgQ1";
+char const STR_vArRtgQ2[] PROGMEM = "vArRtgQ2";
+char const STR_vArRtgQ3[] PROGMEM = "vArRtgQ3";
+char const STR_vArRtgQ4[] PROGMEM = "vArRtgQ4";
+char const STR_aRtg[] PROGMEM = "aRtg";
+char const STR_pFRtgQ1[] PROGMEM = "pFRtgQ1";
+char const STR_cos__[] PROGMEM = "cos()";
+char const STR_pFRtgQ2[] PROGMEM = "pFRtgQ2";
+char const STR_pFRtgQ3[] PROGMEM = "pFRtgQ3";
+char const STR_pFRtgQ4[] PROGMEM = "pFRtgQ4";
+char const STR_wHRtg[] PROGMEM = "wHRtg";
+char const STR_ahrRtg[] PROGMEM = "ahrRtg";
+char const STR_AH[] PROGMEM = "AH";
+char const STR_maxChaRte[] PROGMEM = "maxChaRte";
+char const STR_maxDisChaRte[] PROGMEM = "maxDisChaRte";
+char const STR_wMax[] PROGMEM = "wMax";
+char const STR_vRef[] PROGMEM = "vRef";
+char const STR_vRefOfs[] PROGMEM = "vRefOfs";
+char const STR_vMax[] PROGMEM = "vMax";
+char const STR_vMin[] PROGMEM = "vMin";
+char const STR_vAMax[] PROGMEM = "vAMax";
+char const STR_vArMaxQ1[] PROGMEM = "vArMaxQ1";
+char const STR_vArMaxQ2[] PROGMEM = "vArMaxQ2";
+char const STR_vArMaxQ3[] PROGMEM = "vArMaxQ3";
+char const STR_vArMaxQ4[] PROGMEM = "vArMaxQ4";
+char const STR_wGra[] PROGMEM = "wGra";
+char const STR___WMax_sec[] PROGMEM = "% WMax/sec";
+char const STR_pFMinQ1[] PROGMEM = "pFMinQ1";
+char const STR_pFMinQ2[] PROGMEM = "pFMinQ2";
+char const STR_pFMinQ3[] PROGMEM = "pFMinQ3";
+char const STR_pFMinQ4[] PROGMEM = "pFMinQ4";
+char const STR_vArAct[] PROGMEM = "vArAct";
+char const STR_clcTotVA[] PROGMEM = "clcTotVA";
+char const STR_maxRmpRte[] PROGMEM = "maxRmpRte";
+char const STR___WGra[] PROGMEM = "% WGra";
+char const STR_eCPNomHz[] PROGMEM = "eCPNomHz";
+char const STR_connPh[] PROGMEM = "connPh";
+char const STR_pVConn[] PROGMEM = "pVConn";
+char const STR_storConn[] PROGMEM = "storConn";
+char const STR_eCPConn[] PROGMEM = "eCPConn";
+char const STR_actWh[] PROGMEM = "actWh";
+char const STR_actVAh[] PROGMEM = "actVAh";
+char const STR_VAh[] PROGMEM = "VAh";
+char const STR_actVArhQ1[] PROGMEM = "actVArhQ1";
+char const STR_varh[] PROGMEM = "varh";
+char const STR_actVArhQ2[] PROGMEM = "actVArhQ2";
+char const STR_actVArhQ3[] PROGMEM = "actVArhQ3";
+char const STR_actVArhQ4[] PROGMEM = "actVArhQ4";
+char const STR_vArAval[] PROGMEM = "vArAval";
+char const STR_wAval[] PROGMEM = "wAval";
+char const STR_stSetLimMsk[] PROGMEM = "stSetLimMsk";
+char const STR_stActCtl[] PROGMEM = "stActCtl";
+char const STR_tmSrc[] PROGMEM = "tmSrc";
+char const STR_tms[] PROGMEM = "tms";
+char const STR_Secs[] PROGMEM = "Secs";
+char const STR_rtSt[] PROGMEM = "rtSt";
+char const STR_ris[] PROGMEM = "ris";
+char const STR_ohms[] PROGMEM = "ohms";
+char const STR_conn_WinTms[] PROGMEM = "conn_WinTms";
+char const STR_conn_RvrtTms[] PROGMEM = "conn_RvrtTms";
+char const STR_conn[] PROGMEM = "conn";
+char const STR_wMaxLimPct[] PROGMEM = "wMaxLimPct";
+char const STR___WMax[] PROGMEM = "% WMax";
+char const STR_wMaxLimPct_WinTms[] PROGMEM = "wMaxLimPct_WinTms";
+char const STR_wMaxLimPct_RvrtTms[] PROGMEM = "wMaxLimPct_RvrtTms";
+char const STR_wMaxLimPct_RmpTms[] PROGMEM = "wMaxLimPct_RmpTms";
+char const STR_wMaxLim_Ena[] PROGMEM = "wMaxLim_Ena";
+char const STR_outPFSet[] PROGMEM = "outPFSet";
+char const STR_outPFSet_WinTms[] PROGMEM = "outPFSet_WinTms";
+char const STR_outPFSet_RvrtTms[] PROGMEM = "outPFSet_RvrtTms";
+char const STR_outPFSet_RmpTms[] PROGMEM = "outPFSet_RmpTms";
+char const STR_outPFSet_Ena[] PROGMEM = "outPFSet_Ena";
+char const STR_vArWMaxPct[] PROGMEM = "vArWMaxPct";
+char const STR_vArMaxPct[] PROGMEM = "vArMaxPct";
+char const STR___VArMax[] PROGMEM = "% VArMax";
+char const STR_vArAvalPct[] PROGMEM = "vArAvalPct";
+char const STR___VArAval[] PROGMEM = "% VArAval";
+char const STR_vArPct_WinTms[] PROGMEM = "vArPct_WinTms";
+char const STR_vArPct_RvrtTms[] PROGMEM = "vArPct_RvrtTms";
+char const STR_vArPct_RmpTms[] PROGMEM = "vArPct_RmpTms";
+char const STR_vArPct_Mod[] PROGMEM = "vArPct_Mod";
+char const STR_vArPct_Ena[] PROGMEM = "vArPct_Ena";
+char const STR_wChaMax[] PROGMEM = "wChaMax";
+char const STR_wChaGra[] PROGMEM = "wChaGra";
+char const STR___WChaMax_sec[] PROGMEM = "% WChaMax/sec";
+char const STR_wDisChaGra[] PROGMEM = "wDisChaGra";
+char const STR_storCtl_Mod[] PROGMEM = "storCtl_Mod";
+char const STR_vAChaMax[] PROGMEM = "vAChaMax";
+char const STR_minRsvPct[] PROGMEM = "minRsvPct";
+char const STR___WChaMax[] PROGMEM = "% WChaMax";
+char const STR_chaState[] PROGMEM = "chaState";
+char const STR___AhrRtg[] PROGMEM = "% AhrRtg";
+char const STR_storAval[] PROGMEM = "storAval";
+char const STR_inBatV[] PROGMEM = "inBatV";
+char const STR_chaSt[] PROGMEM = "chaSt";
+char const STR_outWRte[] PROGMEM = "outWRte";
+char const STR___WDisChaMax[] PROGMEM = "% WDisChaMax";
+char const STR_inWRte[] PROGMEM = "inWRte";
+char const STR____WChaMax[] PROGMEM = " % WChaMax";
+char const STR_inOutWRte_WinTms[] PROGMEM = "inOutWRte_WinTms";
+char const STR_inOutWRte_RvrtTms[] PROGMEM = "inOutWRte_RvrtTms";
+char const STR_inOutWRte_RmpTms[] PROGMEM = "inOutWRte_RmpTms";
+char const STR_chaGriSet[] PROGMEM = "chaGriSet";
+char const STR_modEna[] PROGMEM = "modEna";
+char const STR_sigType[] PROGMEM = "sigType";
+char const STR_sig[] PROGMEM = "sig";
+char const STR_winTms[] PROGMEM = "winTms";
+char const STR_rvtTms[] PROGMEM = "rvtTms";
+char const STR_rmpTms[] PROGMEM = "rmpTms";
+char const STR___PM_Hz[] PROGMEM = "% PM/Hz";
+char const STR_hzStr[] PROGMEM = "hzStr";
+char const STR_hzStop[] PROGMEM = "hzStop";
+char const STR_hysEna[] PROGMEM = "hysEna";
+char const STR_hzStopWGra[] PROGMEM = "hzStopWGra";
+char const STR___WMax_min[] PROGMEM = "% WMax/min";
+char const STR_arGraMod[] PROGMEM = "arGraMod";
+char const STR_arGraSag[] PROGMEM = "arGraSag";
+char const STR__ARtg__dV[] PROGMEM = "%ARtg/%dV";
+char const STR_arGraSwell[] PROGMEM = "arGraSwell";
+char const STR_filTms[] PROGMEM = "filTms";
+char const STR_dbVMin[] PROGMEM = "dbVMin";
+char const STR___VRef[] PROGMEM = "% VRef";
+char const STR_dbVMax[] PROGMEM = "dbVMax";
+char const STR_blkZnV[] PROGMEM = "blkZnV";
+char const STR_hysBlkZnV[] PROGMEM = "hysBlkZnV";
+char const STR_blkZnTmms[] PROGMEM = "blkZnTmms";
+char const STR_mSecs[] PROGMEM = "mSecs";
+char const STR_holdTmms[] PROGMEM = "holdTmms";
+char const STR_rampUpRate[] PROGMEM = "rampUpRate";
+char const STR_nomRmpDnRte[] PROGMEM = "nomRmpDnRte";
+char const STR_emergencyRampUpRate[] PROGMEM = "emergencyRampUpRate";
+char const STR_emergencyRampDownRate[] PROGMEM = "emergencyRampDownRate";
+char const STR_connectRampUpRate[] PROGMEM = "connectRampUpRate";
+char const STR_connectRampDownRate[] PROGMEM = "connectRampDownRate";
+char const STR_defaultRampRate[] PROGMEM = "defaultRampRate";
+char const STR_globalEvents[] PROGMEM = "globalEvents";
+char const STR_numberOfModules[] PROGMEM = "numberOfModules";
+char const STR_timestampPeriod[] PROGMEM = "timestampPeriod";
+char const STR_inputID[] PROGMEM = "inputID";
+char const STR_inputIDString[] PROGMEM = "inputIDString";
+char const STR_DCCurrent[] PROGMEM = "DCCurrent";
+char const STR_DCPower[] PROGMEM = "DCPower";
+char const STR_lifetimeEnergy[] PROGMEM = "lifetimeEnergy";
+char const STR_timestamp[] PROGMEM = "timestamp";
+char const STR_temperature[] PROGMEM = "temperature";
+char const STR_moduleEvents[] PROGMEM = "moduleEvents";
+char const STR_module[] PROGMEM = "module";
+char const STR_voltageLN[] PROGMEM = "voltageLN";
+char const STR_voltageLL[] PROGMEM = "voltageLL";
+char const STR_wattsPhaseA[] PROGMEM = "wattsPhaseA";
+char const STR_wattsPhaseB[] PROGMEM = "wattsPhaseB";
+char const STR_wattsPhaseC[] PROGMEM = "wattsPhaseC";
+char const STR_VAPhaseA[] PROGMEM = "VAPhaseA";
+char const STR_VAPhaseB[] PROGMEM = "VAPhaseB";
+char const STR_VAPhaseC[] PROGMEM = "VAPhaseC";
+char const STR_VAR[] PROGMEM = "VAR";
+char const STR_VARPhaseA[] PROGMEM = "VARPhaseA";
+char const STR_VARPhaseB[] PROGMEM = "VARPhaseB";
+char const STR_VARPhaseC[] PROGMEM = "VARPhaseC";
+char const STR_PFPhaseA[] PROGMEM = "PFPhaseA";
+char const STR_PFPhaseB[] PROGMEM = "PFPhaseB";
+char const STR_PFPhaseC[] PROGMEM = "PFPhaseC";
+char const STR_totalWattHoursExported[] PROGMEM = "totalWattHoursExported";
+char const STR_totalWattHoursExportedPhaseA[] PROGMEM = "totalWattHoursExportedPhaseA";
+char const STR_totalWattHoursExportedPhaseB[] PROGMEM = "totalWattHoursExportedPhaseB";
+char const STR_totalWattHoursExportedPhaseC[] PROGMEM = "totalWattHoursExportedPhaseC";
+char const STR_totalWattHoursImported[] PROGMEM = "totalWattHoursImported";
+char const STR_totalWattHoursImportedPhaseA[] PROGMEM = "totalWattHoursImportedPhaseA";
+char const STR_totalWattHoursImportedPhaseB[] PROGMEM = "totalWattHoursImportedPhaseB";
+char const STR_totalWattHoursImportedPhaseC[] PROGMEM = "totalWattHoursImportedPhaseC";
+char const STR_totalVAHoursExported[] PROGMEM = "totalVAHoursExported";
+char const STR_totalVAHoursExportedPhaseA[] PROGMEM = "totalVAHoursExportedPhaseA";
+char const STR_totalVAHoursExportedPhaseB[] PROGMEM = "totalVAHoursExportedPhaseB";
+char const STR_totalVAHoursExportedPhaseC[] PROGMEM = "totalVAHoursExportedPhaseC";
+char const STR_totalVAHoursImported[] PROGMEM = "totalVAHoursImported";
+char const STR_totalVAHoursImportedPhaseA[] PROGMEM = "totalVAHoursImportedPhaseA";
+char const STR_totalVAHoursImportedPhaseB[] PROGMEM = "totalVAHoursImportedPhaseB";
+char const STR_totalVAHoursImportedPhaseC[] PROGMEM = "totalVAHoursImportedPhaseC";
+char const STR_totalVARHoursImportedQ1[] PROGMEM = "totalVARHoursImportedQ1";
+char const STR_totalVArHoursImportedQ1PhaseA[] PROGMEM = "totalVArHoursImportedQ1PhaseA";
+char const STR_totalVArHoursImportedQ1PhaseB[] PROGMEM = "totalVArHoursImportedQ1PhaseB";
+char const STR_totalVArHoursImportedQ1PhaseC[] PROGMEM = "totalVArHoursImportedQ1PhaseC";
+char const STR_totalVArHoursImportedQ2[] PROGMEM = "totalVArHoursImportedQ2";
+char const STR_totalVArHoursImportedQ2PhaseA[] PROGMEM = "totalVArHoursImportedQ2PhaseA";
+char const STR_totalVArHoursImportedQ2PhaseB[] PROGMEM = "totalVArHoursImportedQ2PhaseB";
+char const STR_totalVArHoursImportedQ2PhaseC[] PROGMEM = "totalVArHoursImportedQ2PhaseC";
+char const STR_totalVArHoursExportedQ3[] PROGMEM = "totalVArHoursExportedQ3";
+char const STR_totalVArHoursExportedQ3PhaseA[] PROGMEM = "totalVArHoursExportedQ3PhaseA";
+char const STR_totalVArHoursExportedQ3PhaseB[] PROGMEM = "totalVArHoursExportedQ3PhaseB";
+char const STR_totalVArHoursExportedQ3PhaseC[] PROGMEM = "totalVArHoursExportedQ3PhaseC";
+char const STR_totalVArHoursExportedQ4[] PROGMEM = "totalVArHoursExportedQ4";
+char const STR_totalVArHoursExportedQ4ImportedPhaseA[] PROGMEM = "totalVArHoursExportedQ4ImportedPhaseA";
+char const STR_totalVArHoursExportedQ4ImportedPhaseB[] PROGMEM = "totalVArHoursExportedQ4ImportedPhaseB";
+char const STR_totalVArHoursExportedQ4ImportedPhaseC[] PROGMEM = "totalVArHoursExportedQ4ImportedPhaseC";
+char const STR_events[] PROGMEM = "events";
+char const STR_tm[] PROGMEM = "tm";
+char const STR_hhmmss_sssZ[] PROGMEM = "hhmmss.sssZ";
+char const STR_date[] PROGMEM = "date";
+char const STR_YYYYMMDD[] PROGMEM = "YYYYMMDD";
+char const STR_location[] PROGMEM = "location";
+char const STR_text[] PROGMEM = "text";
+char const STR_lat[] PROGMEM = "lat";
+char const STR_Degrees[] PROGMEM = "Degrees";
+char const STR_long_[] PROGMEM = "long_";
+char const STR_altitude[] PROGMEM = "altitude";
+char const STR_meters[] PROGMEM = "meters";
+char const STR_GHI[] PROGMEM = "GHI";
+char const STR_W_m2[] PROGMEM = "W/m2";
+char const STR_voltage[] PROGMEM = "voltage";
+char const STR_ambientTemperature[] PROGMEM = "ambientTemperature";
+char const STR_relativeHumidity[] PROGMEM = "relativeHumidity";
+char const STR_barometricPressure[] PROGMEM = "barometricPressure";
+char const STR_HPa[] PROGMEM = "HPa";
+char const STR_windSpeed[] PROGMEM = "windSpeed";
+char const STR_mps[] PROGMEM = "mps";
+char const STR_windDirection[] PROGMEM = "windDirection";
+char const STR_deg[] PROGMEM = "deg";
+char const STR_rainfall[] PROGMEM = "rainfall";
+char const STR_mm[] PROGMEM = "mm";
+char const STR_snowDepth[] PROGMEM = "snowDepth";
+char const STR_precipitationType[] PROGMEM = "precipitationType";
+char const STR_electricField[] PROGMEM = "electricField";
+char const STR_Vm[] PROGMEM = "Vm";
+char const STR_surfaceWetness[] PROGMEM = "surfaceWetness";
+char const STR_kO[] PROGMEM = "kO";
+char const STR_soilWetness[] PROGMEM = "soilWetness";
+char const STR_temp[] PROGMEM = "temp";
+char const STR_m_s[] PROGMEM = "m/s";
+char const STR_vendorModuleEventFlags[] PROGMEM = "vendorModuleEventFlags";
+char const STR_outputCurrent[] PROGMEM = "outputCurrent";
+char const STR_outputVoltage[] PROGMEM = "outputVoltage";
+char const STR_outputEnergy[] PROGMEM = "outputEnergy";
+char const STR_outputPower[] PROGMEM = "outputPower";
+char const STR_inputCurrent[] PROGMEM = "inputCurrent";
+char const STR_inputVoltage[] PROGMEM = "inputVoltage";
+char const STR_inputEnergy[] PROGMEM = "inputEnergy";
+char const STR_inputPower[] PROGMEM = "inputPower";
+char const STR_ACWiringType[] PROGMEM = "ACWiringType";
+char const STR_inverterState[] PROGMEM = "inverterState";
+char const STR_gridConnectionState[] PROGMEM = "gridConnectionState";
+char const STR_alarmBitfield[] PROGMEM = "alarmBitfield";
+char const STR_DEROperationalCharacteristics[] PROGMEM = "DEROperationalCharacteristics";
+char const STR_activePower[] PROGMEM = "activePower";
+char const STR_apparentPower[] PROGMEM = "apparentPower";
+char const STR_reactivePower[] PROGMEM = "reactivePower";
+char const STR_Var[] PROGMEM = "Var";
+char const STR_powerFactor[] PROGMEM = "powerFactor";
+char const STR_totalACCurrent[] PROGMEM = "totalACCurrent";
+char const STR_frequency[] PROGMEM = "frequency";
+char const STR_totalEnergyInjected[] PROGMEM = "totalEnergyInjected";
+char const STR_totalEnergyAbsorbed[] PROGMEM = "totalEnergyAbsorbed";
+char const STR_totalReactiveEnergyInj[] PROGMEM = "totalReactiveEnergyInj";
+char const STR_Varh[] PROGMEM = "Varh";
+char const STR_totalReactiveEnergyAbs[] PROGMEM = "totalReactiveEnergyAbs";
+char const STR_IGBTMOSFETTemperature[] PROGMEM = "IGBTMOSFETTemperature";
+char const STR_wattsL1[] PROGMEM = "wattsL1";
+char const STR_VAL1[] PROGMEM = "VAL1";
+char const STR_varL1[] PROGMEM = "varL1";
+char const STR_PFL1[] PROGMEM = "PFL1";
+char const STR_ampsL1[] PROGMEM = "ampsL1";
+char const STR_phaseVoltageL1L2[] PROGMEM = "phaseVoltageL1L2";
+char const STR_phaseVoltageL1N[] PROGMEM = "phaseVoltageL1N";
+char const STR_totalWattHoursInjL1[] PROGMEM = "totalWattHoursInjL1";
+char const STR_totalWattHoursAbsL1[] PROGMEM = "totalWattHoursAbsL1";
+char const STR_totalVarHoursInjL1[] PROGMEM = "totalVarHoursInjL1";
+char const STR_totalVarHoursAbsL1[] PROGMEM = "totalVarHoursAbsL1";
+char const STR_wattsL2[] PROGMEM = "wattsL2";
+char const STR_VAL2[] PROGMEM = "VAL2";
+char const STR_varL2[] PROGMEM = "varL2";
+char const STR_PFL2[] PROGMEM = "PFL2";
+char const STR_ampsL2[] PROGMEM = "ampsL2";
+char const STR_phaseVoltageL2L3[] PROGMEM = "phaseVoltageL2L3";
+char const STR_phaseVoltageL2N[] PROGMEM = "phaseVoltageL2N";
+char const STR_totalWattHoursInjL2[] PROGMEM = "totalWattHoursInjL2";
+char const STR_totalWattHoursAbsL2[] PROGMEM = "totalWattHoursAbsL2";
+char const STR_totalVarHoursInjL2[] PROGMEM = "totalVarHoursInjL2";
+char const STR_totalVarHoursAbsL2[] PROGMEM = "totalVarHoursAbsL2";
+char const STR_wattsL3[] PROGMEM = "wattsL3";
+char const STR_VAL3[] PROGMEM = "VAL3";
+char const STR_varL3[] PROGMEM = "varL3";
+char const STR_PFL3[] PROGMEM = "PFL3";
+char const STR_ampsL3[] PROGMEM = "ampsL3";
+char const STR_phaseVoltageL3L1[] PROGMEM = "phaseVoltageL3L1";
+char const STR_phaseVoltageL3N[] PROGMEM = "phaseVoltageL3N";
+char const STR_totalWattHoursInjL3[] PROGMEM = "totalWattHoursInjL3";
+char const STR_totalWattHoursAbsL3[] PROGMEM = "totalWattHoursAbsL3";
+char const STR_totalVarHoursInjL3[] PROGMEM = "totalVarHoursInjL3";
+char const STR_totalVarHoursAbsL3[] PROGMEM = "totalVarHoursAbsL3";
+char const STR_throttlingInPct[] PROGMEM = "throttlingInPct";
+char const STR_throttleSourceInformation[] PROGMEM = "throttleSourceInformation";
+char const STR_manufacturerAlarmInfo[] PROGMEM = "manufacturerAlarmInfo";
+char const STR_activePowerMaxRating[] PROGMEM = "activePowerMaxRating";
+char const STR_activePowerOverExcitedRating[] PROGMEM = "activePowerOverExcitedRating";
+char const STR_specifiedOverExcitedPF_2[] PROGMEM = "specifiedOverExcitedPF_2";
+char const STR_activePowerUnderExcitedRating[] PROGMEM = "activePowerUnderExcitedRating";
+char const STR_specifiedUnderExcitedPF_4[] PROGMEM = "specifiedUnderExcitedPF_4";
+char const STR_apparentPowerMaxRating[] PROGMEM = "apparentPowerMaxRating";
+char const STR_reactivePowerInjectedRating[] PROGMEM = "reactivePowerInjectedRating";
+char const STR_reactivePowerAbsorbedRating[] PROGMEM = "reactivePowerAbsorbedRating";
+char const STR_chargeRateMaxRating[] PROGMEM = "chargeRateMaxRating";
+char const STR_dischargeRateMaxRating[] PROGMEM = "dischargeRateMaxRating";
+char const STR_chargeRateMaxVARating[] PROGMEM = "chargeRateMaxVARating";
+char const STR_dischargeRateMaxVARating[] PROGMEM = "dischargeRateMaxVARating";
+char const STR_ACVoltageNominalRating[] PROGMEM = "ACVoltageNominalRating";
+char const STR_ACVoltageMaxRating[] PROGMEM = "ACVoltageMaxRating";
+char const STR_ACVoltageMinRating[] PROGMEM = "ACVoltageMinRating";
+char const STR_ACCurrentMaxRating[] PROGMEM = "ACCurrentMaxRating";
+char const STR_PFOverExcitedRating[] PROGMEM = "PFOverExcitedRating";
+char const STR_PFUnderExcitedRating[] PROGMEM = "PFUnderExcitedRating";
+char const STR_reactiveSusceptance[] PROGMEM = "reactiveSusceptance";
+char const STR_S[] PROGMEM = "S";
+char const STR_normalOperatingCategory[] PROGMEM = "normalOperatingCategory";
+char const STR_abnormalOperatingCategory[] PROGMEM = "abnormalOperatingCategory";
+char const STR_supportedControlModes[] PROGMEM = "supportedControlModes";
+char const STR_intentionalIslandCategories_23[] PROGMEM = "intentionalIslandCategories_23";
+char const STR_activePowerMaxSetting[] PROGMEM = "activePowerMaxSetting";
+char const STR_activePowerOverExcitedSetting[] PROGMEM = "activePowerOverExcitedSetting";
+char const STR_specifiedOverExcitedPF_26[] PROGMEM = "specifiedOverExcitedPF_26";
+char const STR_activePowerUnderExcitedSetting[] PROGMEM = "activePowerUnderExcitedSetting";
+char const STR_specifiedUnderExcitedPF_28[] PROGMEM = "specifiedUnderExcitedPF_28";
+char const STR_apparentPowerMaxSetting[] PROGMEM = "apparentPowerMaxSetting";
+char const STR_reactivePowerInjectedSetting[] PROGMEM = "reactivePowerInjectedSetting";
+char const STR_reactivePowerAbsorbedSetting[] PROGMEM = "reactivePowerAbsorbedSetting";
+char const STR_chargeRateMaxSetting[] PROGMEM = "chargeRateMaxSetting";
+char const STR_dischargeRateMaxSetting[] PROGMEM = "dischargeRateMaxSetting";
+char const STR_chargeRateMaxVASetting[] PROGMEM = "chargeRateMaxVASetting";
+char const STR_dischargeRateMaxVASetting[] PROGMEM = "dischargeRateMaxVASetting";
+char const STR_nominalACVoltageSetting[] PROGMEM = "nominalACVoltageSetting";
+char const STR_ACVoltageMaxSetting[] PROGMEM = "ACVoltageMaxSetting";
+char const STR_ACVoltageMinSetting[] PROGMEM = "ACVoltageMinSetting";
+char const STR_ACCurrentMaxSetting[] PROGMEM = "ACCurrentMaxSetting";
+char const STR_PFOverExcitedSetting[] PROGMEM = "PFOverExcitedSetting";
+char const STR_PFUnderExcitedSetting[] PROGMEM = "PFUnderExcitedSetting";
+char const STR_intentionalIslandCategories_42[] PROGMEM = "intentionalIslandCategories_42";
+char const STR_permitEnterService[] PROGMEM = "permitEnterService";
+char const STR_enterServiceVoltageHigh[] PROGMEM = "enterServiceVoltageHigh";
+char const STR_enterServiceVoltageLow[] PROGMEM = "enterServiceVoltageLow";
+char const STR_enterServiceFrequencyHigh[] PROGMEM = "enterServiceFrequencyHigh";
+char const STR_enterServiceFrequencyLow[] PROGMEM = "enterServiceFrequencyLow";
+char const STR_enterServiceDelayTime[] PROGMEM = "enterServiceDelayTime";
+char const STR_enterServiceRandomDelay[] PROGMEM = "enterServiceRandomDelay";
+char const STR_enterServiceRampTime[] PROGMEM = "enterServiceRampTime";
+char const STR_enterServiceDelayRemaining[] PROGMEM = "enterServiceDelayRemaining";
+char const STR_energyRating[] PROGMEM = "energyRating";
+char const STR_WH[] PROGMEM = "WH";
+char const STR_energyAvailable[] PROGMEM = "energyAvailable";
+char const STR_stateOfCharge[] PROGMEM = "stateOfCharge";
+char const STR_stateOfHealth[] PROGMEM = "stateOfHealth";
+char const STR_controlMode[] PROGMEM = "controlMode";
+char const STR_DERHeartbeat[] PROGMEM = "DERHeartbeat";
+char const STR_controllerHeartbeat[] PROGMEM = "controllerHeartbeat";
+char const STR_alarmReset[] PROGMEM = "alarmReset";
+char const STR_setOperation[] PROGMEM = "setOperation";
+char const STR_deprecatedModel[] PROGMEM = "deprecatedModel";
+char const STR_nameplateChargeCapacity[] PROGMEM = "nameplateChargeCapacity";
+char const STR_Ah[] PROGMEM = "Ah";
+char const STR_nameplateEnergyCapacity[] PROGMEM = "nameplateEnergyCapacity";
+char const STR_nameplateMaxChargeRate[] PROGMEM = "nameplateMaxChargeRate";
+char const STR_nameplateMaxDischargeRate[] PROGMEM = "nameplateMaxDischargeRate";
+char const STR_selfDischargeRate[] PROGMEM = "selfDischargeRate";
+char const STR__WHRtg[] PROGMEM = "%WHRtg";
+char const STR_nameplateMaxSoC[] PROGMEM = "nameplateMaxSoC";
+char const STR_nameplateMinSoC[] PROGMEM = "nameplateMinSoC";
+char const STR_maxReservePercent[] PROGMEM = "maxReservePercent";
+char const STR_minReservePercent[] PROGMEM = "minReservePercent";
+char const STR_depthOfDischarge[] PROGMEM = "depthOfDischarge";
+char const STR__[] PROGMEM = "%";
+char const STR_cycleCount[] PROGMEM = "cycleCount";
+char const STR_chargeStatus[] PROGMEM = "chargeStatus";
+char const STR_batteryHeartbeat[] PROGMEM = "batteryHeartbeat";
+char const STR_batteryType[] PROGMEM = "batteryType";
+char const STR_stateOfTheBatteryBank[] PROGMEM = "stateOfTheBatteryBank";
+char const STR_vendorBatteryBankState[] PROGMEM = "vendorBatteryBankState";
+char const STR_warrantyDate[] PROGMEM = "warrantyDate";
+char const STR_batteryEvent1Bitfield[] PROGMEM = "batteryEvent1Bitfield";
+char const STR_batteryEvent2Bitfield[] PROGMEM = "batteryEvent2Bitfield";
+char const STR_externalBatteryVoltage[] PROGMEM = "externalBatteryVoltage";
+char const STR_maxBatteryVoltage[] PROGMEM = "maxBatteryVoltage";
+char const STR_minBatteryVoltage[] PROGMEM = "minBatteryVoltage";
+char const STR_maxCellVoltage[] PROGMEM = "maxCellVoltage";
+char const STR_maxCellVoltageString[] PROGMEM = "maxCellVoltageString";
+char const STR_maxCellVoltageModule[] PROGMEM = "maxCellVoltageModule";
+char const STR_minCellVoltage[] PROGMEM = "minCellVoltage";
+char const STR_minCellVoltageString[] PROGMEM = "minCellVoltageString";
+char const STR_minCellVoltageModule[] PROGMEM = "minCellVoltageModule";
+char const STR_averageCellVoltage[] PROGMEM = "averageCellVoltage";
+char const STR_totalDCCurrent[] PROGMEM = "totalDCCurrent";
+char const STR_maxChargeCurrent[] PROGMEM = "maxChargeCurrent";
+char const STR_maxDischargeCurrent[] PROGMEM = "maxDischargeCurrent";
+char const STR_totalPower[] PROGMEM = "totalPower";
+char const STR_inverterStateRequest[] PROGMEM = "inverterStateRequest";
+char const STR_batteryPowerRequest[] PROGMEM = "batteryPowerRequest";
+char const STR_setInverterState[] PROGMEM = "setInverterState";
+char const STR_commandCode[] PROGMEM = "commandCode";
+char const STR_hardwareRevision[] PROGMEM = "hardwareRevision";
+char const STR_RSFWRevision[] PROGMEM = "RSFWRevision";
+char const STR_OSFWRevision[] PROGMEM = "OSFWRevision";
+char const STR_productRevision[] PROGMEM = "productRevision";
+char const STR_bootCount[] PROGMEM = "bootCount";
+char const STR_DIPSwitches[] PROGMEM = "DIPSwitches";
+char const STR_numDetectedSensors[] PROGMEM = "numDetectedSensors";
+char const STR_numCommunicatingSensors[] PROGMEM = "numCommunicatingSensors";
+char const STR_systemStatus[] PROGMEM = "systemStatus";
+char const STR_systemConfiguration[] PROGMEM = "systemConfiguration";
+char const STR_LEDBlinkThreshold[] PROGMEM = "LEDBlinkThreshold";
+char const STR_LEDOnThreshold[] PROGMEM = "LEDOnThreshold";
+char const STR_reserved[] PROGMEM = "reserved";
+char const STR_locationString[] PROGMEM = "locationString";
+char const STR_sensor1UnitID[] PROGMEM = "sensor1UnitID";
+char const STR_sensor1Address[] PROGMEM = "sensor1Address";
+char const STR_sensor1OSVersion[] PROGMEM = "sensor1OSVersion";
+char const STR_sensor1ProductVersion[] PROGMEM = "sensor1ProductVersion";
+char const STR_sensor1SerialNum[] PROGMEM = "sensor1SerialNum";
+char const STR_sensor2UnitID[] PROGMEM = "sensor2UnitID";
+char const STR_sensor2Address[] PROGMEM = "sensor2Address";
+char const STR_sensor2OSVersion[] PROGMEM = "sensor2OSVersion";
+char const STR_sensor2ProductVersion[] PROGMEM = "sensor2ProductVersion";
+char const STR_sensor2SerialNum[] PROGMEM = "sensor2SerialNum";
+char const STR_sensor3UnitID[] PROGMEM = "sensor3UnitID";
+char const STR_sensor3Address[] PROGMEM = "sensor3Address";
+char const STR_sensor3OSVersion[] PROGMEM = "sensor3OSVersion";
+char const STR_sensor3ProductVersion[] PROGMEM = "sensor3ProductVersion";
+char const STR_sensor3SerialNum[] PROGMEM = "sensor3SerialNum";
+char const STR_sensor4UnitID[] PROGMEM = "sensor4UnitID";
+char const STR_sensor4Address[] PROGMEM = "sensor4Address";
+char const STR_sensor4OSVersion[] PROGMEM = "sensor4OSVersion";
+char const STR_sensor4ProductVersion[] PROGMEM = "sensor4ProductVersion";
+char const STR_sensor4SerialNum[] PROGMEM = "sensor4SerialNum";
+char const STR_eltek_Country_Code[] PROGMEM = "eltek_Country_Code";
+char const STR_eltek_Feeding_Phase[] PROGMEM = "eltek_Feeding_Phase";
+char const STR_eltek_APD_Method[] PROGMEM = "eltek_APD_Method";
+char const STR_eltek_APD_Power_Ref[] PROGMEM = "eltek_APD_Power_Ref";
+char const STR_eltek_RPS_Method[] PROGMEM = "eltek_RPS_Method";
+char const STR_eltek_RPS_Q_Ref[] PROGMEM = "eltek_RPS_Q_Ref";
+char const STR_eltek_RPS_CosPhi_Ref[] PROGMEM = "eltek_RPS_CosPhi_Ref";
+char const STR_AXSMajorFirmwareNumber[] PROGMEM = "AXSMajorFirmwareNumber";
+char const STR_AXSMidFirmwareNumber[] PROGMEM = "AXSMidFirmwareNumber";
+char const STR_AXSMinorFirmwareNumber[] PROGMEM = "AXSMinorFirmwareNumber";
+char const STR_encryptionKey[] PROGMEM = "encryptionKey";
+char const STR_MACAddress[] PROGMEM = "MACAddress";
+char const STR_writePassword[] PROGMEM = "writePassword";
+char const STR_enableDHCP[] PROGMEM = "enableDHCP";
+char const STR_TCPIPAddress[] PROGMEM = "TCPIPAddress";
+char const STR_TCPIPGateway[] PROGMEM = "TCPIPGateway";
+char const STR_TCPIPNetmask[] PROGMEM = "TCPIPNetmask";
+char const STR_TCPIPDNS1[] PROGMEM = "TCPIPDNS1";
+char const STR_TCPIPDNS2[] PROGMEM = "TCPIPDNS2";
+char const STR_modBusPort[] PROGMEM = "modBusPort";
+char const STR_SMTPServerName[] PROGMEM = "SMTPServerName";
+char const STR_SMTPAccountName[] PROGMEM = "SMTPAccountName";
+char const STR_enableSMTPSSL[] PROGMEM = "enableSMTPSSL";
+char const STR_SMTPPassword[] PROGMEM = "SMTPPassword";
+char const STR_SMTPUserName[] PROGMEM = "SMTPUserName";
+char const STR_statusEmailInterval[] PROGMEM = "statusEmailInterval";
+char const STR_statusEmailStartHour[] PROGMEM = "statusEmailStartHour";
+char const STR_statusEmailSubject[] PROGMEM = "statusEmailSubject";
+char const STR_statusEmailToAddress1[] PROGMEM = "statusEmailToAddress1";
+char const STR_statusEmailToAddress2[] PROGMEM = "statusEmailToAddress2";
+char const STR_enableAlarmEmail[] PROGMEM = "enableAlarmEmail";
+char const STR_alarmEmailSubject[] PROGMEM = "alarmEmailSubject";
+char const STR_alarmEmailToAddress1[] PROGMEM = "alarmEmailToAddress1";
+char const STR_alarmEmailToAddress2[] PROGMEM = "alarmEmailToAddress2";
+char const STR_FTPPassword[] PROGMEM = "FTPPassword";
+char const STR_telnetPassword[] PROGMEM = "telnetPassword";
+char const STR_SDCardDatalogWriteInterval[] PROGMEM = "SDCardDatalogWriteInterval";
+char const STR_Tms[] PROGMEM = "Tms";
+char const STR_SDCardDatalogRetain[] PROGMEM = "SDCardDatalogRetain";
+char const STR_Tmd[] PROGMEM = "Tmd";
+char const STR_SDCardDatalogMode[] PROGMEM = "SDCardDatalogMode";
+char const STR_NTPTimerServerName[] PROGMEM = "NTPTimerServerName";
+char const STR_enableNetworkTime[] PROGMEM = "enableNetworkTime";
+char const STR_timeZone[] PROGMEM = "timeZone";
+char const STR_Tmh[] PROGMEM = "Tmh";
+char const STR_year[] PROGMEM = "year";
+char const STR_month[] PROGMEM = "month";
+char const STR_day[] PROGMEM = "day";
+char const STR_hour[] PROGMEM = "hour";
+char const STR_minute[] PROGMEM = "minute";
+char const STR_second[] PROGMEM = "second";
+char const STR_batteryTemperature[] PROGMEM = "batteryTemperature";
+char const STR_AXSError[] PROGMEM = "AXSError";
+char const STR_AXSStatus[] PROGMEM = "AXSStatus";
+char const STR_spare[] PROGMEM = "spare";
+char const STR_portNumber[] PROGMEM = "portNumber";
+char const STR_batteryVoltage[] PROGMEM = "batteryVoltage";
+char const STR_arrayVoltage[] PROGMEM = "arrayVoltage";
+char const STR_arrayCurrent[] PROGMEM = "arrayCurrent";
+char const STR_outputWattage[] PROGMEM = "outputWattage";
+char const STR_todaySMinimumBatteryVoltage[] PROGMEM = "todaySMinimumBatteryVoltage";
+char const STR_todaySMaximumBatteryVoltage[] PROGMEM = "todaySMaximumBatteryVoltage";
+char const STR_VOC[] PROGMEM = "VOC";
+char const STR_todaySMaximumVOC[] PROGMEM = "todaySMaximumVOC";
+char const STR_todaySKWh[] PROGMEM = "todaySKWh";
+char const STR_kWh[] PROGMEM = "kWh";
+char const STR_todaySAH[] PROGMEM = "todaySAH";
+char const STR_lifetimeKWh[] PROGMEM = "lifetimeKWh";
+char const STR_lifetimeKAH[] PROGMEM = "lifetimeKAH";
+char const STR_kAH[] PROGMEM = "kAH";
+char const STR_lifetimeMaximumOutputWattage[] PROGMEM = "lifetimeMaximumOutputWattage";
+char const STR_lifetimeMaximumBatteryVoltage[] PROGMEM = "lifetimeMaximumBatteryVoltage";
+char const STR_lifetimeMaximumVOCVoltage[] PROGMEM = "lifetimeMaximumVOCVoltage";
+char const STR_faults[] PROGMEM = "faults";
+char const STR_absorb[] PROGMEM = "absorb";
+char const STR_absorbTime[] PROGMEM = "absorbTime";
+char const STR_absorbEnd[] PROGMEM = "absorbEnd";
+char const STR_rebulk[] PROGMEM = "rebulk";
+char const STR_float_[] PROGMEM = "float_";
+char const STR_maximumCharge[] PROGMEM = "maximumCharge";
+char const STR_equalize[] PROGMEM = "equalize";
+char const STR_equalizeTime[] PROGMEM = "equalizeTime";
+char const STR_autoEqualizeInterval[] PROGMEM = "autoEqualizeInterval";
+char const STR_MPPTMode[] PROGMEM = "MPPTMode";
+char const STR_sweepWidth[] PROGMEM = "sweepWidth";
+char const STR_sweepMaximum[] PROGMEM = "sweepMaximum";
+char const STR_UPickPWMDutyCycle[] PROGMEM = "UPickPWMDutyCycle";
+char const STR_gridTieMode[] PROGMEM = "gridTieMode";
+char const STR_tempCompMode[] PROGMEM = "tempCompMode";
+char const STR_tempCompLowerLimit[] PROGMEM = "tempCompLowerLimit";
+char const STR_tempCompUpperLimit[] PROGMEM = "tempCompUpperLimit";
+char const STR_autoRestartMode[] PROGMEM = "autoRestartMode";
+char const STR_wakeupVOCChange[] PROGMEM = "wakeupVOCChange";
+char const STR_snoozeMode[] PROGMEM = "snoozeMode";
+char const STR_wakeupInterval[] PROGMEM = "wakeupInterval";
+char const STR_AUXOutputMode[] PROGMEM = "AUXOutputMode";
+char const STR_AUXOutputControl[] PROGMEM = "AUXOutputControl";
+char const STR_AUXOutputState[] PROGMEM = "AUXOutputState";
+char const STR_AUXOutputPolarity[] PROGMEM = "AUXOutputPolarity";
+char const STR_AUXLowBatteryDisconnect[] PROGMEM = "AUXLowBatteryDisconnect";
+char const STR_AUXLowBatteryReconnect[] PROGMEM = "AUXLowBatteryReconnect";
+char const STR_AUXLowBatteryDisconnectDelay[] PROGMEM = "AUXLowBatteryDisconnectDelay";
+char const STR_AUXVentFan[] PROGMEM = "AUXVentFan";
+char const STR_AUXPVTrigger[] PROGMEM = "AUXPVTrigger";
+char const STR_AUXPVTriggerHoldTime[] PROGMEM = "AUXPVTriggerHoldTime";
+char const STR_AUXNightLightThreshold[] PROGMEM = "AUXNightLightThreshold";
+char const STR_AUXNightLightOnTime[] PROGMEM = "AUXNightLightOnTime";
+char const STR_AUXNightLightOnHysteresis[] PROGMEM = "AUXNightLightOnHysteresis";
+char const STR_AUXNightLightOffHysteresis[] PROGMEM = "AUXNightLightOffHysteresis";
+char const STR_AUXErrorOutputLowBattery[] PROGMEM = "AUXErrorOutputLowBattery";
+char const STR_AUXDivertHoldTime[] PROGMEM = "AUXDivertHoldTime";
+char const STR_AUXDivertDelayTime[] PROGMEM = "AUXDivertDelayTime";
+char const STR_AUXDivertRelative[] PROGMEM = "AUXDivertRelative";
+char const STR_AUXDivertHysteresis[] PROGMEM = "AUXDivertHysteresis";
+char const STR_FMCCMajorFirmwareNumber[] PROGMEM = "FMCCMajorFirmwareNumber";
+char const STR_FMCCMidFirmwareNumber[] PROGMEM = "FMCCMidFirmwareNumber";
+char const STR_FMCCMinorFirmwareNumber[] PROGMEM = "FMCCMinorFirmwareNumber";
+char const STR_setDataLogDayOffset[] PROGMEM = "setDataLogDayOffset";
+char const STR_currentDataLogDayOffset[] PROGMEM = "currentDataLogDayOffset";
+char const STR_dataLogDailyAh[] PROGMEM = "dataLogDailyAh";
+char const STR_dataLogDailyKWh[] PROGMEM = "dataLogDailyKWh";
+char const STR_dataLogDailyMaximumOutputA[] PROGMEM = "dataLogDailyMaximumOutputA";
+char const STR_dataLogDailyMaximumOutputW[] PROGMEM = "dataLogDailyMaximumOutputW";
+char const STR_dataLogDailyAbsorbTime[] PROGMEM = "dataLogDailyAbsorbTime";
+char const STR_dataLogDailyFloatTime[] PROGMEM = "dataLogDailyFloatTime";
+char const STR_dataLogDailyMinimumBattery[] PROGMEM = "dataLogDailyMinimumBattery";
+char const STR_dataLogDailyMaximumBattery[] PROGMEM = "dataLogDailyMaximumBattery";
+char const STR_dataLogDailyMaximumInput[] PROGMEM = "dataLogDailyMaximumInput";
+char const STR_dataLogClear[] PROGMEM = "dataLogClear";
+char const STR_dataLogClearComplement[] PROGMEM = "dataLogClearComplement";
+
+}
+
+SunSpecPointDescriptor const POINTS_1[] PROGMEM = {
+  {STR_manufacturer, nullptr, 0, 16, SunSpecPointDescriptor::NO_SCALE_FACTOR, SunSpecPointType::STRING},
+  {STR_model, nullptr, 16, 16, SunSpecPointDescriptor::NO_SCALE_FACTOR, SunSpecPointType::STRING},
+  {STR_options, nullptr, 32, 8, SunSpecPointDescriptor::NO_SCALE_FACTOR, SunSpecPointType::STRING},
+  {STR_version, nullptr, 40, 8, SunSpecPointDescriptor::NO_SCALE_FACTOR, SunSpecPointType::STRING},
+  {STR_serialNumber, nullptr, 48, 16, SunSpecPointDescriptor::NO_SCALE_FACTOR, SunSpecPointType::STRING},
+  {STR_deviceAddress, nullptr, 64, 1, SunSpecPointDescriptor::NO_SCALE_FACTOR, SunSpecPointType::UINT16},
+};
+
+SunSpecPointTable Common::pointTable() {
+  return {1, 66, 0, POINTS_1, 6, nullptr, nullptr, 0};
+}
+
+SunSpecPointDescriptor const POINTS_2[] PROGMEM = {
+  {STR_AID, nullptr, 0, 1, SunSpecPointDescriptor::NO_SCALE_FACTOR, SunSpecPointType::UINT16},
+  {STR_N, nullptr, 1, 1, SunSpecPointDescriptor::NO_SCALE_FACTOR, SunSpecPointType::UINT16},
+  {STR_UN, nullptr, 2, 1, SunSpecPointDescriptor::NO_SCALE_FACTOR, SunSpecPointType::UINT16},
+  {STR_status, nullptr, 3, 1, SunSpecPointDescriptor::NO_SCALE_FACTOR, SunSpecPointType::ENUM16},
+  {STR_vendorStatus, nullptr, 4, 1, SunSpecPointDescriptor::NO_SCALE_FACTOR, SunSpecPointType::ENUM16},
+  {STR_eventCode, nullptr, 5, 2, SunSpecPointDescriptor::NO_SCALE_FACTOR, SunSpecPointType::BITFIELD32},
+  {STR_vendorEventCode, nullptr, 7, 2, SunSpecPointDescriptor::NO_SCALE_FACTOR, SunSpecPointType::BITFIELD32},
+  {STR_control, nullptr, 9, 1, SunSpecPointDescriptor::NO_SCALE_FACTOR, SunSpecPointType::ENUM16},
+  {STR_vendorControl, nullptr, 10, 2, SunSpecPointDescriptor::NO_SCALE_FACTOR, SunSpecPointType::ENUM32},
+  {STR_controlValue, nullptr, 12, 2, SunSpecPointDescriptor::NO_SCALE_FACTOR, SunSpecPointType::ENUM32},
+};
+
+SunSpecPointTable BasicAggregator::pointTable() {
+  return {2, 14, 0, POINTS_2, 10, nullptr, nullptr, 0};
+}
+
+SunSpecPointDescriptor const POINTS_10[] PROGMEM = {
+  {STR_interfaceStatus, nullptr, 0, 1, SunSpecPointDescriptor::NO_SCALE_FACTOR, SunSpecPointType::ENUM16},
+  {STR_interfaceControl, nullptr, 1, 1, SunSpecPointDescriptor::NO_SCALE_FACTOR, SunSpecPointType::UINT16},
+  {STR_physicalAccessType, nullptr, 2, 1, SunSpecPointDescriptor::NO_SCALE_FACTOR, SunSpecPointType::ENUM16},
+};
+
+SunSpecPointTable CommunicationInterfaceHeader::pointTable() {
+  return {10, 4, 0, POINTS_10, 3, nullptr, nullptr, 0};
+}
+
+SunSpecPointDescriptor const POINTS_11[] PROGMEM = {
+  {STR_ethernetLinkSpeed, STR_Mbps, 0, 1, SunSpecPointDescriptor::NO_SCALE_FACTOR, SunSpecPointType::UINT16},
+  {STR_interfaceStatusFlags, nullptr, 1, 1, SunSpecPointDescriptor::NO_SCALE_FACTOR, SunSpecPointType::BITFIELD16},
+  {STR_linkState, nullptr, 2, 1, SunSpecPointDescriptor::NO_SCALE_FACTOR, SunSpecPointType::ENUM16},
+  {STR_MAC, nullptr, 3, 4, SunSpecPointDescriptor::NO_SCALE_FACTOR, SunSpecPointType::EUI48},
+  {STR_name, nullptr, 7, 4, SunSpecPointDescriptor::NO_SCALE_FACTOR, SunSpecPointType::STRING},
+  {STR_control, nullptr, 11, 1, SunSpecPointDescriptor::NO_SCALE_FACTOR, SunSpecPointType::BITFIELD16},
+  {STR_forcedSpeed, STR_Mbps, 12, 1, SunSpecPointDescriptor::NO_SCALE_FACTOR, SunSpecPointType::UINT16},
+};
+
+SunSpecPointTable EthernetLinkLayer::pointTable() {
+  return {11, 13, 0, POINTS_11, 7, nullptr, nullptr, 0};
+}
+
+SunSpecPointDescriptor const POINTS_12[] PROGMEM = {
+  {STR_name, nullptr, 0, 4, SunSpecPointDescriptor::NO_SCALE_FACTOR, SunSpecPointType::STRING},
+  {STR_configStatus, nullptr, 4, 1, SunSpecPointDescriptor::NO_SCALE_FACTOR, SunSpecPointType::ENUM16},
+  {STR_changeStatus, nullptr, 5, 1, SunSpecPointDescriptor::NO_SCALE_FACTOR, SunSpecPointType::BITFIELD16},
+  {STR_configCapability, nullptr, 6, 1, SunSpecPointDescriptor::NO_SCALE_FACTOR, SunSpecPointType::BITFIELD16},
+  {STR_iPv4Config, nullptr, 7, 1, SunSpecPointDescriptor::NO_SCALE_FACTOR, SunSpecPointType::ENUM16},
+  {STR_control, nullptr, 8, 1, SunSpecPointDescriptor::NO_SCALE_FACTOR, SunSpecPointType::ENUM16},
+  {STR_IP, nullptr, 9, 8, SunSpecPointDescriptor::NO_SCALE_FACTOR, SunSpecPointType::STRING},
+  {STR_netmask, nullptr, 17, 8, SunSpecPointDescriptor::NO_SCALE_FACTOR, SunSpecPointType::STRING},
+  {STR_gateway, nullptr, 25, 8, SunSpecPointDescriptor::NO_SCALE_FACTOR, SunSpecPointType::STRING},
+  {STR_DNS1, nullptr, 33, 8, SunSpecPointDescriptor::NO_SCALE_FACTOR, SunSpecPointType::STRING},
+  {STR_DNS2, nullptr, 41, 8, SunSpecPointDescriptor::NO_SCALE_FACTOR, SunSpecPointType::STRING},
+  {STR_NTP1, nullptr, 49, 12, SunSpecPointDescriptor::NO_SCALE_FACTOR, SunSpecPointType::STRING},
+  {STR_NTP2, nullptr, 61, 12, SunSpecPointDescriptor::NO_SCALE_FACTOR, SunSpecPointType::STRING},
+  {STR_domain, nullptr, 73, 12, SunSpecPointDescriptor::NO_SCALE_FACTOR, SunSpecPointType::STRING},
+  {STR_hostName, nullptr, 85, 12, SunSpecPointDescriptor::NO_SCALE_FACTOR, SunSpecPointType::STRING},
+};
+
+SunSpecPointTable IPv4::pointTable() {
+  return {12, 98, 0, POINTS_12, 15, nullptr, nullptr, 0};
+}
+
+SunSpecPointDescriptor const POINTS_13[] PROGMEM = {
+  {STR_name, nullptr, 0, 4, SunSpecPointDescriptor::NO_SCALE_FACTOR, SunSpecPointType::STRING},
+  {STR_configStatus, nullptr, 4, 1, SunSpecPointDescriptor::NO_SCALE_FACTOR, SunSpecPointType::ENUM16},
+  {STR_changeStatus, nullptr, 5, 1, SunSpecPointDescriptor::NO_SCALE_FACTOR, SunSpecPointType::BITFIELD16},
+  {STR_configCapability, nullptr, 6, 1, SunSpecPointDescriptor::NO_SCALE_FACTOR, SunSpecPointType::BITFIELD16},
+  {STR_iPv6Config, nullptr, 7, 1, SunSpecPointDescriptor::NO_SCALE_FACTOR, SunSpecPointType::ENUM16},
+  {STR_control, nullptr, 8, 1, SunSpecPointDescriptor::NO_SCALE_FACTOR, SunSpecPointType::ENUM16},
+  {STR_IP, nullptr, 9, 20, SunSpecPointDescriptor::NO_SCALE_FACTOR, SunSpecPointType::STRING},
+  {STR_CIDR, nullptr, 29, 20, SunSpecPointDescriptor::NO_SCALE_FACTOR, SunSpecPointType::STRING},
+  {STR_gateway, nullptr, 49, 20, SunSpecPointDescriptor::NO_SCALE_FACTOR, SunSpecPointType::STRING},
+  {STR_DNS1, nullptr, 69, 20, SunSpecPointDescriptor::NO_SCALE_FACTOR, SunSpecPointType::STRING},
+  {STR_DNS2, nullptr, 89, 20, SunSpecPointDescriptor::NO_SCALE_FACTOR, SunSpecPointType::STRING},
+  {STR_NTP1, nullptr, 109, 20, SunSpecPointDescriptor::NO_SCALE_FACTOR, SunSpecPointType::STRING},
+  {STR_NTP2, nullptr, 129, 20, SunSpecPointDescriptor::NO_SCALE_FACTOR, SunSpecPointType::STRING},
+  {STR_domain, nullptr, 149, 12, SunSpecPointDescriptor::NO_SCALE_FACTOR, SunSpecPointType::STRING},
+  {STR_hostName, nullptr, 161, 12, SunSpecPointDescriptor::NO_SCALE_FACTOR, SunSpecPointType::STRING},
+};
+
+SunSpecPointTable IPv6::pointTable() {
+  return {13, 174, 0, POINTS_13, 15, nullptr, nullptr, 0};
+}
+
+SunSpecPointDescriptor const POINTS_14[] PROGMEM = {
+  {STR_name, nullptr, 0, 4, SunSpecPointDescriptor::NO_SCALE_FACTOR, SunSpecPointType::STRING},
+  {STR_capabilities, nullptr, 4, 1, SunSpecPointDescriptor::NO_SCALE_FACTOR, SunSpecPointType::BITFIELD16},
+  {STR_config, nullptr, 5, 1, SunSpecPointDescriptor::NO_SCALE_FACTOR, SunSpecPointType::ENUM16},
+  {STR_type, nullptr, 6, 1, SunSpecPointDescriptor::NO_SCALE_FACTOR, SunSpecPointType::BITFIELD16},
+  {STR_address, nullptr, 7, 20, SunSpecPointDescriptor::NO_SCALE_FACTOR, SunSpecPointType::STRING},
+  {STR_port, nullptr, 27, 1, SunSpecPointDescriptor::NO_SCALE_FACTOR, SunSpecPointType::UINT16},
+  {STR_username, nullptr, 28, 12, SunSpecPointDescriptor::NO_SCALE_FACTOR, SunSpecPointType::STRING},
+  {STR_password, nullptr, 40, 12, SunSpecPointDescriptor::NO_SCALE_FACTOR, SunSpecPointType::STRING},
+};
+
+SunSpecPointTable ProxyServer::pointTable() {
+  return {14, 52, 0, POINTS_14, 8, nullptr, nullptr, 0};
+}
+
+SunSpecPointDescriptor const POINTS_15[] PROGMEM = {
+  {STR_clear, nullptr, 0, 1, SunSpecPointDescriptor::NO_SCALE_FACTOR, SunSpecPointType::UINT16},
+  {STR_inputCount, nullptr, 1, 2, SunSpecPointDescriptor::NO_SCALE_FACTOR, SunSpecPointType::ACC32},
+  {STR_inputUnicastCount, nullptr, 3, 2, SunSpecPointDescriptor::NO_SCALE_FACTOR, SunSpecPointType::ACC32},
+  {STR_inputNonUnicastCount, nullptr, 5, 2, SunSpecPointDescriptor::NO_SCALE_FACTOR, SunSpecPointType::ACC32},
+  {STR_inputDiscardedCount, nullptr, 7, 2, SunSpecPointDescriptor::NO_SCALE_FACTOR, SunSpecPointType::ACC32},
+  {STR_inputErrorCount, nullptr, 9, 2, SunSpecPointDescriptor::NO_SCALE_FACTOR, SunSpecPointType::ACC32},
+  {STR_inputUnknownCount, nullptr, 11, 2, SunSpecPointDescriptor::NO_SCALE_FACTOR, SunSpecPointType::ACC32},
+  {STR_outputCount, nullptr, 13, 2, SunSpecPointDescriptor::NO_SCALE_FACTOR, SunSpecPointType::ACC32},
+  {STR_outputUnicastCount, nullptr, 15, 2, SunSpecPointDescriptor::NO_SCALE_FACTOR, SunSpecPointType::ACC32},
+  {STR_outputNonUnicastCount, nullptr, 17, 2, SunSpecPointDescriptor::NO_SCALE_FACTOR, SunSpecPointType::ACC32},
+  {STR_outputDiscardedCount, nullptr, 19, 2, SunSpecPointDescriptor::NO_SCALE_FACTOR, SunSpecPointType::ACC32},
+  {STR_outputErrorCount, nullptr, 21, 2, SunSpecPointDescriptor::NO_SCALE_FACTOR, SunSpecPointType::ACC32},
+};
+
+SunSpecPointTable InterfaceCountersModel::pointTable() {
+  return {15, 24, 0, POINTS_15, 12, nullptr, nullptr, 0};
+}
+
+SunSpecPointDescriptor const POINTS_16[] PROGMEM = {
+  {STR_name, nullptr, 0, 4, SunSpecPointDescriptor::NO_SCALE_FACTOR, SunSpecPointType::STRING},
+  {STR_config, nullptr, 4, 1, SunSpecPointDescriptor::NO_SCALE_FACTOR, SunSpecPointType::ENUM16},
+  {STR_control, nullptr, 5, 1, SunSpecPointDescriptor::NO_SCALE_FACTOR, SunSpecPointType::BITFIELD16},
+  {STR_address, nullptr, 6, 8, SunSpecPointDescriptor::NO_SCALE_FACTOR, SunSpecPointType::STRING},
+  {STR_netmask, nullptr, 14, 8, SunSpecPointDescriptor::NO_SCALE_FACTOR, SunSpecPointType::STRING},
+  {STR_gateway, nullptr, 22, 8, SunSpecPointDescriptor::NO_SCALE_FACTOR, SunSpecPointType::STRING},
+  {STR_DNS1, nullptr, 30, 8, SunSpecPointDescriptor::NO_SCALE_FACTOR, SunSpecPointType::STRING},
+  {STR_DNS2, nullptr, 38, 8, SunSpecPointDescriptor::NO_SCALE_FACTOR, SunSpecPointType::STRING},
+  {STR_MAC, nullptr, 46, 4, SunSpecPointDescriptor::NO_SCALE_FACTOR, SunSpecPointType::EUI48},
+  {STR_linkControl, nullptr, 50, 1, SunSpecPointDescriptor::NO_SCALE_FACTOR, SunSpecPointType::BITFIELD16},
+};
+
+SunSpecPointTable SimpleIPNetwork::pointTable() {
+  return {16, 52, 0, POINTS_16, 10, nullptr, nullptr, 0};
+}
+
+SunSpecPointDescriptor const POINTS_17[] PROGMEM = {
+  {STR_name, nullptr, 0, 4, SunSpecPointDescriptor::NO_SCALE_FACTOR, SunSpecPointType::STRING},
+  {STR_rate, STR_bps, 4, 2, SunSpecPointDescriptor::NO_SCALE_FACTOR, SunSpecPointType::UINT32},
+  {STR_bits, nullptr, 6, 1, SunSpecPointDescriptor::NO_SCALE_FACTOR, SunSpecPointType::UINT16},
+  {STR_parity, nullptr, 7, 1, SunSpecPointDescriptor::NO_SCALE_FACTOR, SunSpecPointType::ENUM16},
+  {STR_duplex, nullptr, 8, 1, SunSpecPointDescriptor::NO_SCALE_FACTOR, SunSpecPointType::ENUM16},
+  {STR_flowControl, nullptr, 9, 1, SunSpecPointDescriptor::NO_SCALE_FACTOR, SunSpecPointType::ENUM16},
+  {STR_interfaceType, nullptr, 10, 1, SunSpecPointDescriptor::NO_SCALE_FACTOR, SunSpecPointType::ENUM16},
+  {STR_protocol, nullptr, 11, 1, SunSpecPointDescriptor::NO_SCALE_FACTOR, SunSpecPointType::ENUM16},
+};
+
+SunSpecPointTable SerialInterface::pointTable() {
+  return {17, 12, 0, POINTS_17, 8, nullptr, nullptr, 0};
+}
+
+SunSpecPointDescriptor const POINTS_18[] PROGMEM = {
+  {STR_name, nullptr, 0, 4, SunSpecPointDescriptor::NO_SCALE_FACTOR, SunSpecPointType::STRING},
+  {STR_IMEI, nullptr, 4, 2, SunSpecPointDescriptor::NO_SCALE_FACTOR, SunSpecPointType::UINT32},
+  {STR_APN, nullptr, 6, 4, SunSpecPointDescriptor::NO_SCALE_FACTOR, SunSpecPointType::STRING},
+  {STR_number, nullptr, 10, 6, SunSpecPointDescriptor::NO_SCALE_FACTOR, SunSpecPointType::STRING},
+  {STR_PIN, nullptr, 16, 6, SunSpecPointDescriptor::NO_SCALE_FACTOR, SunSpecPointType::STRING},
+};
+
+SunSpecPointTable CellularLink::pointTable() {
+  return {18, 22, 0, POINTS_18, 5, nullptr, nullptr, 0};
+}
+
+SunSpecPointDescriptor const POINTS_19[] PROGMEM = {
+  {STR_name, nullptr, 0, 4, SunSpecPointDescriptor::NO_SCALE_FACTOR, SunSpecPointType::STRING},
+  {STR_rate, STR_bps, 4, 2, SunSpecPointDescriptor::NO_SCALE_FACTOR, SunSpecPointType::UINT32},
+  {STR_bits, nullptr, 6, 1, SunSpecPointDescriptor::NO_SCALE_FACTOR, SunSpecPointType::UINT16},
+  {STR_parity, nullptr, 7, 1, SunSpecPointDescriptor::NO_SCALE_FACTOR, SunSpecPointType::ENUM16},
+  {STR_duplex, nullptr, 8, 1, SunSpecPointDescriptor::NO_SCALE_FACTOR, SunSpecPointType::ENUM16},
+  {STR_flowControl, nullptr, 9, 1, SunSpecPointDescriptor::NO_SCALE_FACTOR, SunSpecPointType::ENUM16},
+  {STR_authentication, nullptr, 10, 1, SunSpecPointDescriptor::NO_SCALE_FACTOR, SunSpecPointType::ENUM16},
+  {STR_username, nullptr, 11, 12, SunSpecPointDescriptor::NO_SCALE_FACTOR, SunSpecPointType::STRING},
+  {STR_password, nullptr, 23, 6, SunSpecPointDescriptor::NO_SCALE_FACTOR, SunSpecPointType::STRING},
+};
+
+SunSpecPointTable PPPLink::pointTable() {
+  return {19, 30, 0, POINTS_19, 9, nullptr, nullptr, 0};
+}
+
+SunSpecPointDescriptor const POINTS_101[] PROGMEM = {
+  {STR_amps, STR_A, 0, 1, 4, SunSpecPointType::UINT16},
+  {STR_ampsPhaseA, STR_A, 1, 1, 4, SunSpecPointType::UINT16},
+  {STR_ampsPhaseB, STR_A, 2, 1, 4, SunSpecPointType::UINT16},
+  {STR_ampsPhaseC, STR_A, 3, 1, 4, SunSpecPointType::UINT16},
+  {STR_phaseVoltageAB, STR_V, 5, 1, 11, SunSpecPointType::UINT16},
+  {STR_phaseVoltageBC, STR_V, 6, 1, 11, SunSpecPointType::UINT16},
+  {STR_phaseVoltageCA, STR_V, 7, 1, 11, SunSpecPointType::UINT16},
+  {STR_phaseVoltageAN, STR_V, 8, 1, 11, SunSpecPointType::UINT16},
+  {STR_phaseVoltageBN, STR_V, 9, 1, 11, SunSpecPointType::UINT16},
+  {STR_phaseVoltageCN, STR_V, 10, 1, 11, SunSpecPointType::UINT16},
+  {STR_watts, STR_W, 12, 1, 13, SunSpecPointType::INT16},
+  {STR_hz, STR_Hz, 14, 1, 15, SunSpecPointType::UINT16},
+  {STR_VA, STR_VA, 16, 1, 17, SunSpecPointType::INT16},
+  {STR_vAr, STR_var, 18, 1, 19, SunSpecPointType::INT16},
+  {STR_PF, STR_Pct, 20, 1, 21, SunSpecPointType::INT16},
+  {STR_wattHours, STR_Wh, 22, 2, 24, SunSpecPointType::ACC32},
+  {STR_DCAmps, STR_A, 25, 1, 26, SunSpecPointType::UINT16},
+  {STR_DCVoltage, STR_V, 27, 1, 28, SunSpecPointType::UINT16},
+  {STR_DCWatts, STR_W, 29, 1, 30, SunSpecPointType::INT16},
+  {STR_cabinetTemperature, STR_C, 31, 1, 35, SunSpecPointType::INT16},
+  {STR_heatSinkTemperature, STR_C, 32, 1, 35, SunSpecPointType::INT16},
+  {STR_transformerTemperature, STR_C, 33, 1, 35, SunSpecPointType::INT16},
+  {STR_otherTemperature, STR_C, 34, 1, 35, SunSpecPointType::INT16},
+  {STR_operatingState, nullptr, 36, 1, SunSpecPointDescriptor::NO_SCALE_FACTOR, SunSpecPointType::ENUM16},
+  {STR_vendorOperatingState, nullptr, 37, 1, SunSpecPointDescriptor::NO_SCALE_FACTOR, SunSpecPointType::ENUM16},
+  {STR_event1, nullptr, 38, 2, SunSpecPointDescriptor::NO_SCALE_FACTOR, SunSpecPointType::BITFIELD32},
+  {STR_eventBitfield2, nullptr, 40, 2, SunSpecPointDescriptor::NO_SCALE_FACTOR, SunSpecPointType::BITFIELD32},
+  {STR_vendorEventBitfield1, nullptr, 42, 2, SunSpecPointDescriptor::NO_SCALE_FACTOR, SunSpecPointType::BITFIELD32},
+  {STR_vendorEventBitfield2, nullptr, 44, 2, SunSpecPointDescriptor::NO_SCALE_FACTOR, SunSpecPointType::BITFIELD32},
+  {STR_vendorEventBitfield3, nullptr, 46, 2, SunSpecPointDescriptor::NO_SCALE_FACTOR, SunSpecPointType::BITFIELD32},
+  {STR_vendorEventBitfield4, nullptr, 48, 2, SunSpecPointDescriptor::NO_SCALE_FACTOR, SunSpecPointType::BITFIELD32},
+};
+
+SunSpecPointTable InverterSinglePhase::pointTable() {
+  return {101, 50, 0, POINTS_101, 31, nullptr, nullptr, 0};
+}
+
+SunSpecPointDescriptor const POINTS_102[] PROGMEM = {
+  {STR_amps, STR_A, 0, 1, 4, SunSpecPointType::UINT16},
+  {STR_ampsPhaseA, STR_A, 1, 1, 4, SunSpecPointType::UINT16},
+  {STR_ampsPhaseB, STR_A, 2, 1, 4, SunSpecPointType::UINT16},
+  {STR_ampsPhaseC, STR_A, 3, 1, 4, SunSpecPointType::UINT16},
+  {STR_phaseVoltageAB, STR_V, 5, 1, 11, SunSpecPointType::UINT16},
+  {STR_phaseVoltageBC, STR_V, 6, 1, 11, SunSpecPointType::UINT16},
+  {STR_phaseVoltageCA, STR_V, 7, 1, 11, SunSpecPointType::UINT16},
+  {STR_phaseVoltageAN, STR_V, 8, 1, 11, SunSpecPointType::UINT16},
+  {STR_phaseVoltageBN, STR_V, 9, 1, 11, SunSpecPointType::UINT16},
+  {STR_phaseVoltageCN, STR_V, 10, 1, 11, SunSpecPointType::UINT16},
+  {STR_watts, STR_W, 12, 1, 13, SunSpecPointType::INT16},
+  {STR_hz, STR_Hz, 14, 1, 15, SunSpecPointType::UINT16},
+  {STR_VA, STR_VA, 16, 1, 17, SunSpecPointType::INT16},
+  {STR_vAr, STR_var, 18, 1, 19, SunSpecPointType::INT16},
+  {STR_PF, STR_Pct, 20, 1, 21, SunSpecPointType::INT16},
+  {STR_wattHours, STR_Wh, 22, 2, 24, SunSpecPointType::ACC32},
+  {STR_DCAmps, STR_A, 25, 1, 26, SunSpecPointType::UINT16},
+  {STR_DCVoltage, STR_V, 27, 1, 28, SunSpecPointType::UINT16},
+  {STR_DCWatts, STR_W, 29, 1, 30, SunSpecPointType::INT16},
+  {STR_cabinetTemperature, STR_C, 31, 1, 35, SunSpecPointType::INT16},
+  {STR_heatSinkTemperature, STR_C, 32, 1, 35, SunSpecPointType::INT16},
+  {STR_transformerTemperature, STR_C, 33, 1, 35, SunSpecPointType::INT16},
+  {STR_otherTemperature, STR_C, 34, 1, 35, SunSpecPointType::INT16},
+  {STR_operatingState, nullptr, 36, 1, SunSpecPointDescriptor::NO_SCALE_FACTOR, SunSpecPointType::ENUM16},
+  {STR_vendorOperatingState, nullptr, 37, 1, SunSpecPointDescriptor::NO_SCALE_FACTOR, SunSpecPointType::ENUM16},
+  {STR_event1, nullptr, 38, 2, SunSpecPointDescriptor::NO_SCALE_FACTOR, SunSpecPointType::BITFIELD32},
+  {STR_eventBitfield2, nullptr, 40, 2, SunSpecPointDescriptor::NO_SCALE_FACTOR, SunSpecPointType::BITFIELD32},
+  {STR_vendorEventBitfield1, nullptr, 42, 2, SunSpecPointDescriptor::NO_SCALE_FACTOR, SunSpecPointType::BITFIELD32},
+  {STR_vendorEventBitfield2, nullptr, 44, 2, SunSpecPointDescriptor::NO_SCALE_FACTOR, SunSpecPointType::BITFIELD32},
+  {STR_vendorEventBitfield3, nullptr, 46, 2, SunSpecPointDescriptor::NO_SCALE_FACTOR, SunSpecPointType::BITFIELD32},
+  {STR_vendorEventBitfield4, nullptr, 48, 2, SunSpecPointDescriptor::NO_SCALE_FACTOR, SunSpecPointType::BITFIELD32},
+};
+
+SunSpecPointTable InverterSplitPhase::pointTable() {
+  return {102, 50, 0, POINTS_102, 31, nullptr, nullptr, 0};
+}
+
+SunSpecPointDescriptor const POINTS_103[] PROGMEM = {
+  {STR_amps, STR_A, 0, 1, 4, SunSpecPointType::UINT16},
+  {STR_ampsPhaseA, STR_A, 1, 1, 4, SunSpecPointType::UINT16},
+  {STR_ampsPhaseB, STR_A, 2, 1, 4, SunSpecPointType::UINT16},
+  {STR_ampsPhaseC, STR_A, 3, 1, 4, SunSpecPointType::UINT16},
+  {STR_phaseVoltageAB, STR_V, 5, 1, 11, SunSpecPointType::UINT16},
+  {STR_phaseVoltageBC, STR_V, 6, 1, 11, SunSpecPointType::UINT16},
+  {STR_phaseVoltageCA, STR_V, 7, 1, 11, SunSpecPointType::UINT16},
+  {STR_phaseVoltageAN, STR_V, 8, 1, 11, SunSpecPointType::UINT16},
+  {STR_phaseVoltageBN, STR_V, 9, 1, 11, SunSpecPointType::UINT16},
+  {STR_phaseVoltageCN, STR_V, 10, 1, 11, SunSpecPointType::UINT16},
+  {STR_watts, STR_W, 12, 1, 13, SunSpecPointType::INT16},
+  {STR_hz, STR_Hz, 14, 1, 15, SunSpecPointType::UINT16},
+  {STR_VA, STR_VA, 16, 1, 17, SunSpecPointType::INT16},
+  {STR_vAr, STR_var, 18, 1, 19, SunSpecPointType::INT16},
+  {STR_PF, STR_Pct, 20, 1, 21, SunSpecPointType::INT16},
+  {STR_wattHours, STR_Wh, 22, 2, 24, SunSpecPointType::ACC32},
+  {STR_DCAmps, STR_A, 25, 1, 26, SunSpecPointType::UINT16},
+  {STR_DCVoltage, STR_V, 27, 1, 28, SunSpecPointType::UINT16},
+  {STR_DCWatts, STR_W, 29, 1, 30, SunSpecPointType::INT16},
+  {STR_cabinetTemperature, STR_C, 31, 1, 35, SunSpecPointType::INT16},
+  {STR_heatSinkTemperature, STR_C, 32, 1, 35, SunSpecPointType::INT16},
+  {STR_transformerTemperature, STR_C, 33, 1, 35, SunSpecPointType::INT16},
+  {STR_otherTemperature, STR_C, 34, 1, 35, SunSpecPointType::INT16},
+  {STR_operatingState, nullptr, 36, 1, SunSpecPointDescriptor::NO_SCALE_FACTOR, SunSpecPointType::ENUM16},
+  {STR_vendorOperatingState, nullptr, 37, 1, SunSpecPointDescriptor::NO_SCALE_FACTOR, SunSpecPointType::ENUM16},
+  {STR_event1, nullptr, 38, 2, SunSpecPointDescriptor::NO_SCALE_FACTOR, SunSpecPointType::BITFIELD32},
+  {STR_eventBitfield2, nullptr, 40, 2, SunSpecPointDescriptor::NO_SCALE_FACTOR, SunSpecPointType::BITFIELD32},
+  {STR_vendorEventBitfield1, nullptr, 42, 2, SunSpecPointDescriptor::NO_SCALE_FACTOR, SunSpecPointType::BITFIELD32},
+  {STR_vendorEventBitfield2, nullptr, 44, 2, SunSpecPointDescriptor::NO_SCALE_FACTOR, SunSpecPointType::BITFIELD32},
+  {STR_vendorEventBitfield3, nullptr, 46, 2, SunSpecPointDescriptor::NO_SCALE_FACTOR, SunSpecPointType::BITFIELD32},
+  {STR_vendorEventBitfield4, nullptr, 48, 2, SunSpecPointDescriptor::NO_SCALE_FACTOR, SunSpecPointType::BITFIELD32},
+};
+
+SunSpecPointTable InverterThreePhase::pointTable() {
+  return {103, 50, 0, POINTS_103, 31, nullptr, nullptr, 0};
+}
+
+SunSpecPointDescriptor const POINTS_111[] PROGMEM = {
+  {STR_amps, STR_A, 0, 2, SunSpecPointDescriptor::NO_SCALE_FACTOR, SunSpecPointType::FLOAT32},
+  {STR_ampsPhaseA, STR_A, 2, 2, SunSpecPointDescriptor::NO_SCALE_FACTOR, SunSpecPointType::FLOAT32},
+  {STR_ampsPhaseB, STR_A, 4, 2, SunSpecPointDescriptor::NO_SCALE_FACTOR, SunSpecPointType::FLOAT32},
+  {STR_ampsPhaseC, STR_A, 6, 2, SunSpecPointDescriptor::NO_SCALE_FACTOR, SunSpecPointType::FLOAT32},
+  {STR_phaseVoltageAB, STR_V, 8, 2, SunSpecPointDescriptor::NO_SCALE_FACTOR, SunSpecPointType::FLOAT32},
+  {STR_phaseVoltageBC, STR_V, 10, 2, SunSpecPointDescriptor::NO_SCALE_FACTOR, SunSpecPointType::FLOAT32},
+  {STR_phaseVoltageCA, STR_V, 12, 2, SunSpecPointDescriptor::NO_SCALE_FACTOR, SunSpecPointType::FLOAT32},
+  {STR_phaseVoltageAN, STR_V, 14, 2, SunSpecPointDescriptor::NO_SCALE_FACTOR, SunSpecPointType::FLOAT32},
+  {STR_phaseVoltageBN, STR_V, 16, 2, SunSpecPointDescriptor::NO_SCALE_FACTOR, SunSpecPointType::FLOAT32},
+  {STR_phaseVoltageCN, STR_V, 18, 2, SunSpecPointDescriptor::NO_SCALE_FACTOR, SunSpecPointType::FLOAT32},
+  {STR_watts, STR_W, 20, 2, SunSpecPointDescriptor::NO_SCALE_FACTOR, SunSpecPointType::FLOAT32},
+  {STR_hz, STR_Hz, 22, 2, SunSpecPointDescriptor::NO_SCALE_FACTOR, SunSpecPointType::FLOAT32},
+  {STR_VA, STR_VA, 24, 2, SunSpecPointDescriptor::NO_SCALE_FACTOR, SunSpecPointType::FLOAT32},
+  {STR_vAr, STR_var, 26, 2, SunSpecPointDescriptor::NO_SCALE_FACTOR, SunSpecPointType::FLOAT32},
+  {STR_PF, STR_Pct, 28, 2, SunSpecPointDescriptor::NO_SCALE_FACTOR, SunSpecPointType::FLOAT32},
+  {STR_wattHours, STR_Wh, 30, 2, SunSpecPointDescriptor::NO_SCALE_FACTOR, SunSpecPointType::FLOAT32},
+  {STR_DCAmps, STR_A, 32, 2, SunSpecPointDescriptor::NO_SCALE_FACTOR, SunSpecPointType::FLOAT32},
+  {STR_DCVoltage, STR_V, 34, 2, SunSpecPointDescriptor::NO_SCALE_FACTOR, SunSpecPointType::FLOAT32},
+  {STR_DCWatts, STR_W, 36, 2, SunSpecPointDescriptor::NO_SCALE_FACTOR, SunSpecPointType::FLOAT32},
+  {STR_cabinetTemperature, STR_C, 38, 2, SunSpecPointDescriptor::NO_SCALE_FACTOR, SunSpecPointType::FLOAT32},
+  {STR_heatSinkTemperature, STR_C, 40, 2, SunSpecPointDescriptor::NO_SCALE_FACTOR, SunSpecPointType::FLOAT32},
+  {STR_transformerTemperature, STR_C, 42, 2, SunSpecPointDescriptor::NO_SCALE_FACTOR, SunSpecPointType::FLOAT32},
+  {STR_otherTemperature, STR_C, 44, 2, SunSpecPointDescriptor::NO_SCALE_FACTOR, SunSpecPointType::FLOAT32},
+  {STR_operatingState, nullptr, 46, 1, SunSpecPointDescriptor::NO_SCALE_FACTOR, SunSpecPointType::ENUM16},
+  {STR_vendorOperatingState, nullptr, 47, 1, SunSpecPointDescriptor::NO_SCALE_FACTOR, SunSpecPointType::ENUM16},
+  {STR_event1, nullptr, 48, 2, SunSpecPointDescriptor::NO_SCALE_FACTOR, SunSpecPointType::BITFIELD32},
+  {STR_eventBitfield2, nullptr, 50, 2, SunSpecPointDescriptor::NO_SCALE_FACTOR, SunSpecPointType::BITFIELD32},
+  {STR_vendorEventBitfield1, nullptr, 52, 2, SunSpecPointDescriptor::NO_SCALE_FACTOR, SunSpecPointType::BITFIELD32},
+  {STR_vendorEventBitfield2, nullptr, 54, 2, SunSpecPointDescriptor::NO_SCALE_FACTOR, SunSpecPointType::BITFIELD32},
+  {STR_vendorEventBitfield3, nullptr, 56, 2, SunSpecPointDescriptor::NO_SCALE_FACTOR, SunSpecPointType::BITFIELD32},
+  {STR_vendorEventBitfield4, nullptr, 58, 2, SunSpecPointDescriptor::NO_SCALE_FACTOR, SunSpecPointType::BITFIELD32},
+};
+
+SunSpecPointTable InverterSinglePhaseFLOAT::pointTable() {
+  return {111, 60, 0, POINTS_111, 31, nullptr, nullptr, 0};
+}
+
+SunSpecPointDescriptor const POINTS_112[] PROGMEM = {
+  {STR_amps, STR_A, 0, 2, SunSpecPointDescriptor::NO_SCALE_FACTOR, SunSpecPointType::FLOAT32},
+  {STR_ampsPhaseA, STR_A, 2, 2, SunSpecPointDescriptor::NO_SCALE_FACTOR, SunSpecPointType::FLOAT32},
+  {STR_ampsPhaseB, STR_A, 4, 2, SunSpecPointDescriptor::NO_SCALE_FACTOR, SunSpecPointType::FLOAT32},
+  {STR_ampsPhaseC, STR_A, 6, 2, SunSpecPointDescriptor::NO_SCALE_FACTOR, SunSpecPointType::FLOAT32},
+  {STR_phaseVoltageAB, STR_V, 8, 2, SunSpecPointDescriptor::NO_SCALE_FACTOR, SunSpecPointType::FLOAT32},
+  {STR_phaseVoltageBC, STR_V, 10, 2, SunSpecPointDescriptor::NO_SCALE_FACTOR, SunSpecPointType::FLOAT32},
+  {STR_phaseVoltageCA, STR_V, 12, 2, SunSpecPointDescriptor::NO_SCALE_FACTOR, SunSpecPointType::FLOAT32},
+  {STR_phaseVoltageAN, STR_V, 14, 2, SunSpecPointDescriptor::NO_SCALE_FACTOR, SunSpecPointType::FLOAT32},
+  {STR_phaseVoltageBN, STR_V, 16, 2, SunSpecPointDescriptor::NO_SCALE_FACTOR, SunSpecPointType::FLOAT32},
+  {STR_phaseVoltageCN, STR_V, 18, 2, SunSpecPointDescriptor::NO_SCALE_FACTOR, SunSpecPointType::FLOAT32},
+  {STR_watts, STR_W, 20, 2, SunSpecPointDescriptor::NO_SCALE_FACTOR, SunSpecPointType::FLOAT32},
+  {STR_hz, STR_Hz, 22, 2, SunSpecPointDescriptor::NO_SCALE_FACTOR, SunSpecPointType::FLOAT32},
+  {STR_VA, STR_VA, 24, 2, SunSpecPointDescriptor::NO_SCALE_FACTOR, SunSpecPointType::FLOAT32},
+  {STR_vAr, STR_var, 26, 2, SunSpecPointDescriptor::NO_SCALE_FACTOR, SunSpecPointType::FLOAT32},
+  {STR_PF, STR_Pct, 28, 2, SunSpecPointDescriptor::NO_SCALE_FACTOR, SunSpecPointType::FLOAT32},
+  {STR_wattHours, STR_Wh, 30, 2, SunSpecPointDescriptor::NO_SCALE_FACTOR, SunSpecPointType::FLOAT32},
+  {STR_DCAmps, STR_A, 32, 2, SunSpecPointDescriptor::NO_SCALE_FACTOR, SunSpecPointType::FLOAT32},
+  {STR_DCVoltage, STR_V, 34, 2, SunSpecPointDescriptor::NO_SCALE_FACTOR, SunSpecPointType::FLOAT32},
+  {STR_DCWatts, STR_W, 36, 2, SunSpecPointDescriptor::NO_SCALE_FACTOR, SunSpecPointType::FLOAT32},
+  {STR_cabinetTemperature, STR_C, 38, 2, SunSpecPointDescriptor::NO_SCALE_FACTOR, SunSpecPointType::FLOAT32},
+  {STR_heatSinkTemperature, STR_C, 40, 2, SunSpecPointDescriptor::NO_SCALE_FACTOR, SunSpecPointType::FLOAT32},
+  {STR_transformerTemperature, STR_C, 42, 2, SunSpecPointDescriptor::NO_SCALE_FACTOR, SunSpecPointType::FLOAT32},
+  {STR_otherTemperature, STR_C, 44, 2, SunSpecPointDescriptor::NO_SCALE_FACTOR, SunSpecPointType::FLOAT32},
+  {STR_operatingState, nullptr, 46, 1, SunSpecPointDescriptor::NO_SCALE_FACTOR, SunSpecPointType::ENUM16},
+  {STR_vendorOperatingState, nullptr, 47, 1, SunSpecPointDescriptor::NO_SCALE_FACTOR, SunSpecPointType::ENUM16},
+  {STR_event1, nullptr, 48, 2, SunSpecPointDescriptor::NO_SCALE_FACTOR, SunSpecPointType::BITFIELD32},
+  {STR_eventBitfield2, nullptr, 50, 2, SunSpecPointDescriptor::NO_SCALE_FACTOR, SunSpecPointType::BITFIELD32},
+  {STR_vendorEventBitfield1, nullptr, 52, 2, SunSpecPointDescriptor::NO_SCALE_FACTOR, SunSpecPointType::BITFIELD32},
+  {STR_vendorEventBitfield2, nullptr, 54, 2, SunSpecPointDescriptor::NO_SCALE_FACTOR, SunSpecPointType::BITFIELD32},
+  {STR_vendorEventBitfield3, nullptr, 56, 2, SunSpecPointDescriptor::NO_SCALE_FACTOR, SunSpecPointType::BITFIELD32},
+  {STR_vendorEventBitfield4, nullptr, 58, 2, SunSpecPointDescriptor::NO_SCALE_FACTOR, SunSpecPointType::BITFIELD32},
+};
+
+SunSpecPointTable InverterSplitPhaseFLOAT::pointTable() {
+  return {112, 60, 0, POINTS_112, 31, nullptr, nullptr, 0};
+}
+
+SunSpecPointDescriptor const POINTS_113[] PROGMEM = {
+  {STR_amps, STR_A, 0, 2, SunSpecPointDescriptor::NO_SCALE_FACTOR, SunSpecPointType::FLOAT32},
+  {STR_ampsPhaseA, STR_A, 2, 2, SunSpecPointDescriptor::NO_SCALE_FACTOR, SunSpecPointType::FLOAT32},
+  {STR_ampsPhaseB, STR_A, 4, 2, SunSpecPointDescriptor::NO_SCALE_FACTOR, SunSpecPointType::FLOAT32},
+  {STR_ampsPhaseC, STR_A, 6, 2, SunSpecPointDescriptor::NO_SCALE_FACTOR, SunSpecPointType::FLOAT32},
+  {STR_phaseVoltageAB, STR_V, 8, 2, SunSpecPointDescriptor::NO_SCALE_FACTOR, SunSpecPointType::FLOAT32},
+  {STR_phaseVoltageBC, STR_V, 10, 2, SunSpecPointDescriptor::NO_SCALE_FACTOR, SunSpecPointType::FLOAT32},
+  {STR_phaseVoltageCA, STR_V, 12, 2, SunSpecPointDescriptor::NO_SCALE_FACTOR, SunSpecPointType::FLOAT32},
+  {STR_phaseVoltageAN, STR_V, 14, 2, SunSpecPointDescriptor::NO_SCALE_FACTOR, SunSpecPointType::FLOAT32},
+  {STR_phaseVoltageBN, STR_V, 16, 2, SunSpecPointDescriptor::NO_SCALE_FACTOR, SunSpecPointType::FLOAT32},
+  {STR_phaseVoltageCN, STR_V, 18, 2, SunSpecPointDescriptor::NO_SCALE_FACTOR, SunSpecPointType::FLOAT32},
+  {STR_watts, STR_W, 20, 2, SunSpecPointDescriptor::NO_SCALE_FACTOR, SunSpecPointType::FLOAT32},
+  {STR_hz, STR_Hz, 22, 2, SunSpecPointDescriptor::NO_SCALE_FACTOR, SunSpecPointType::FLOAT32},
+  {STR_VA, STR_VA, 24, 2, SunSpecPointDescriptor::NO_SCALE_FACTOR, SunSpecPointType::FLOAT32},
+  {STR_vAr, STR_var, 26, 2, SunSpecPointDescriptor::NO_SCALE_FACTOR, SunSpecPointType::FLOAT32},
+  {STR_PF, STR_Pct, 28, 2, SunSpecPointDescriptor::NO_SCALE_FACTOR, SunSpecPointType::FLOAT32},
+  {STR_wattHours, STR_Wh, 30, 2, SunSpecPointDescriptor::NO_SCALE_FACTOR, SunSpecPointType::FLOAT32},
+  {STR_DCAmps, STR_A, 32, 2, SunSpecPointDescriptor::NO_SCALE_FACTOR, SunSpecPointType::FLOAT32},
+  {STR_DCVoltage, STR_V, 34, 2, SunSpecPointDescriptor::NO_SCALE_FACTOR, SunSpecPointType::FLOAT32},
+  {STR_DCWatts, STR_W, 36, 2, SunSpecPointDescriptor::NO_SCALE_FACTOR, SunSpecPointType::FLOAT32},
+  {STR_cabinetTemperature, STR_C, 38, 2, SunSpecPointDescriptor::NO_SCALE_FACTOR, SunSpecPointType::FLOAT32},
+  {STR_heatSinkTemperature, STR_C, 40, 2, SunSpecPointDescriptor::NO_SCALE_FACTOR, SunSpecPointType::FLOAT32},
+  {STR_transformerTemperature, STR_C, 42, 2, SunSpecPointDescriptor::NO_SCALE_FACTOR, SunSpecPointType::FLOAT32},
+  {STR_otherTemperature, STR_C, 44, 2, SunSpecPointDescriptor::NO_SCALE_FACTOR, SunSpecPointType::FLOAT32},
+  {STR_operatingState, nullptr, 46, 1, SunSpecPointDescriptor::NO_SCALE_FACTOR, SunSpecPointType::ENUM16},
+  {STR_vendorOperatingState, nullptr, 47, 1, SunSpecPointDescriptor::NO_SCALE_FACTOR, SunSpecPointType::ENUM16},
+  {STR_event1, nullptr, 48, 2, SunSpecPointDescriptor::NO_SCALE_FACTOR, SunSpecPointType::BITFIELD32},
+  {STR_eventBitfield2, nullptr, 50, 2, SunSpecPointDescriptor::NO_SCALE_FACTOR, SunSpecPointType::BITFIELD32},
+  {STR_vendorEventBitfield1, nullptr, 52, 2, SunSpecPointDescriptor::NO_SCALE_FACTOR, SunSpecPointType::BITFIELD32},
+  {STR_vendorEventBitfield2, nullptr, 54, 2, SunSpecPointDescriptor::NO_SCALE_FACTOR, SunSpecPointType::BITFIELD32},
+  {STR_vendorEventBitfield3, nullptr, 56, 2, SunSpecPointDescriptor::NO_SCALE_FACTOR, SunSpecPointType::BITFIELD32},
+  {STR_vendorEventBitfield4, nullptr, 58, 2, SunSpecPointDescriptor::NO_SCALE_FACTOR, SunSpecPointType::BITFIELD32},
+};
+
+SunSpecPointTable InverterThreePhaseFLOAT::pointTable() {
+  return {113, 60, 0, POINTS_113, 31, nullptr, nullptr, 0};
+}
+
+SunSpecPointDescriptor const POINTS_120[] PROGMEM = {
+  {STR_dERTyp, nullptr, 0, 1, SunSpecPointDescriptor::NO_SCALE_FACTOR, SunSpecPointType::ENUM16},
+  {STR_wRtg, STR_W, 1, 1, 2, SunSpecPointType::UINT16},
+  {STR_vARtg, STR_VA, 3, 1, 4, SunSpecPointType::UINT16},
+  {STR_vArRtgQ1, STR_var, 5, 1, 9, SunSpecPointType::INT16},
+  {STR_vArRtgQ2, STR_var, 6, 1, 9, SunSpecPointType::INT16},
+  {STR_vArRtgQ3, STR_var, 7, 1, 9, SunSpecPointType::INT16},
+  {STR_vArRtgQ4, STR_var, 8, 1, 9, SunSpecPointType::INT16},
+  {STR_aRtg, STR_A, 10, 1, 11, SunSpecPointType::UINT16},
+  {STR_pFRtgQ1, STR_cos__, 12, 1, 16, SunSpecPointType::INT16},
+  {STR_pFRtgQ2, STR_cos__, 13, 1, 16, SunSpecPointType::INT16},
+  {STR_pFRtgQ3, STR_cos__, 14, 1, 16, SunSpecPointType::INT16},
+  {STR_pFRtgQ4, STR_cos__, 15, 1, 16, SunSpecPointType::INT16},
+  {STR_wHRtg, STR_Wh, 17, 1, 18, SunSpecPointType::UINT16},
+  {STR_ahrRtg, STR_AH, 19, 1, 20, SunSpecPointType::UINT16},
+  {STR_maxChaRte, STR_W, 21, 1, 22, SunSpecPointType::UINT16},
+  {STR_maxDisChaRte, STR_W, 23, 1, 24, SunSpecPointType::UINT16},
+};
+
+SunSpecPointTable Nameplate::pointTable() {
+  return {120, 26, 0, POINTS_120, 16, nullptr, nullptr, 0};
+}
+
+SunSpecPointDescriptor const POINTS_121[] PROGMEM = {
+  {STR_wMax, STR_W, 0, 1, 20, SunSpecPointType::UINT16},
+  {STR_vRef, STR_V, 1, 1, 21, SunSpecPointType::UINT16},
+  {STR_vRefOfs, STR_V, 2, 1, 22, SunSpecPointType::INT16},
+  {STR_vMax, STR_V, 3, 1, 23, SunSpecPointType::UINT16},
+  {STR_vMin, STR_V, 4, 1, 23, SunSpecPointType::UINT16},
+  {STR_vAMax, STR_VA, 5, 1, 24, SunSpecPointType::UINT16},
+  {STR_vArMaxQ1, STR_var, 6, 1, 25, SunSpecPointType::INT16},
+  {STR_vArMaxQ2, STR_var, 7, 1, 25, SunSpecPointType::INT16},
+  {STR_vArMaxQ3, STR_var, 8, 1, 25, SunSpecPointType::INT16},
+  {STR_vArMaxQ4, STR_var, 9, 1, 25, SunSpecPointType::INT16},
+  {STR_wGra, STR___WMax_sec, 10, 1, 26, SunSpecPointType::UINT16},
+  {STR_pFMinQ1, STR_cos__, 11, 1, 27, SunSpecPointType::INT16},
+  {STR_pFMinQ2, STR_cos__, 12, 1, 27, SunSpecPointType::INT16},
+  {STR_pFMinQ3, STR_cos__, 13, 1, 27, SunSpecPointType::INT16},
+  {STR_pFMinQ4, STR_cos__, 14, 1, 27, SunSpecPointType::INT16},
+  {STR_vArAct, nullptr, 15, 1, SunSpecPointDescriptor::NO_SCALE_FACTOR, SunSpecPointType::ENUM16},
+  {STR_clcTotVA, nullptr, 16, 1, SunSpecPointDescriptor::NO_SCALE_FACTOR, SunSpecPointType::ENUM16},
+  {STR_maxRmpRte, STR___WGra, 17, 1, 28, SunSpecPointType::UINT16},
+  {STR_eCPNomHz, STR_Hz, 18, 1, 29, SunSpecPointType::UINT16},
+  {STR_connPh, nullptr, 19, 1, SunSpecPointDescriptor::NO_SCALE_FACTOR, SunSpecPointType::ENUM16},
+};
+
+SunSpecPointTable BasicSettings::pointTable() {
+  return {121, 30, 0, POINTS_121, 20, nullptr, nullptr, 0};
+}
+
+SunSpecPointDescriptor const POINTS_122[] PROGMEM = {
+  {STR_pVConn, nullptr, 0, 1, SunSpecPointDescriptor::NO_SCALE_FACTOR, SunSpecPointType::BITFIELD16},
+  {STR_storConn, nullptr, 1, 1, SunSpecPointDescriptor::NO_SCALE_FACTOR, SunSpecPointType::BITFIELD16},
+  {STR_eCPConn, nullptr, 2, 1, SunSpecPointDescriptor::NO_SCALE_FACTOR, SunSpecPointType::BITFIELD16},
+  {STR_actWh, STR_Wh, 3, 4, SunSpecPointDescriptor::NO_SCALE_FACTOR, SunSpecPointType::ACC64},
+  {STR_actVAh, STR_VAh, 7, 4, SunSpecPointDescriptor::NO_SCALE_FACTOR, SunSpecPointType::ACC64},
+  {STR_actVArhQ1, STR_varh, 11, 4, SunSpecPointDescriptor::NO_SCALE_FACTOR, SunSpecPointType::ACC64},
+  {STR_actVArhQ2, STR_varh, 15, 4, SunSpecPointDescriptor::NO_SCALE_FACTOR, SunSpecPointType::ACC64},
+  {STR_actVArhQ3, STR_varh, 19, 4, SunSpecPointDescriptor::NO_SCALE_FACTOR, SunSpecPointType::ACC64},
+  {STR_actVArhQ4, STR_varh, 23, 4, SunSpecPointDescriptor::NO_SCALE_FACTOR, SunSpecPointType::ACC64},
+  {STR_vArAval, STR_var, 27, 1, 28, SunSpecPointType::INT16},
+  {STR_wAval, STR_var, 29, 1, 30, SunSpecPointType::UINT16},
+  {STR_stSetLimMsk, nullptr, 31, 2, SunSpecPointDescriptor::NO_SCALE_FACTOR, SunSpecPointType::BITFIELD32},
+  {STR_stActCtl, nullptr, 33, 2, SunSpecPointDescriptor::NO_SCALE_FACTOR, SunSpecPointType::BITFIELD32},
+  {STR_tmSrc, nullptr, 35, 4, SunSpecPointDescriptor::NO_SCALE_FACTOR, SunSpecPointType::STRING},
+  {STR_tms, STR_Secs, 39, 2, SunSpecPointDescriptor::NO_SCALE_FACTOR, SunSpecPointType::UINT32},
+  {STR_rtSt, nullptr, 41, 1, SunSpecPointDescriptor::NO_SCALE_FACTOR, SunSpecPointType::BITFIELD16},
+  {STR_ris, STR_ohms, 42, 1, 43, SunSpecPointType::UINT16},
+};
+
+SunSpecPointTable Measurements_Status::pointTable() {
+  return {122, 44, 0, POINTS_122, 17, nullptr, nullptr, 0};
+}
+
+SunSpecPointDescriptor const POINTS_123[] PROGMEM = {
+  {STR_conn_WinTms, STR_Secs, 0, 1, SunSpecPointDescriptor::NO_SCALE_FACTOR, SunSpecPointType::UINT16},
+  {STR_conn_RvrtTms, STR_Secs, 1, 1, SunSpecPointDescriptor::NO_SCALE_FACTOR, SunSpecPointType::UINT16},
+  {STR_conn, nullptr, 2, 1, SunSpecPointDescriptor::NO_SCALE_FACTOR, SunSpecPointType::ENUM16},
+  {STR_wMaxLimPct, STR___WMax, 3, 1, 21, SunSpecPointType::UINT16},
+  {STR_wMaxLimPct_WinTms, STR_Secs, 4, 1, SunSpecPointDescriptor::NO_SCALE_FACTOR, SunSpecPointType::UINT16},
+  {STR_wMaxLimPct_RvrtTms, STR_Secs, 5, 1, SunSpecPointDescriptor::NO_SCALE_FACTOR, SunSpecPointType::UINT16},
+  {STR_wMaxLimPct_RmpTms, STR_Secs, 6, 1, SunSpecPointDescriptor::NO_SCALE_FACTOR, SunSpecPointType::UINT16},
+  {STR_wMaxLim_Ena, nullptr, 7, 1, SunSpecPointDescriptor::NO_SCALE_FACTOR, SunSpecPointType::ENUM16},
+  {STR_outPFSet, STR_cos__, 8, 1, 22, SunSpecPointType::INT16},
+  {STR_outPFSet_WinTms, STR_Secs, 9, 1, SunSpecPointDescriptor::NO_SCALE_FACTOR, SunSpecPointType::UINT16},
+  {STR_outPFSet_RvrtTms, STR_Secs, 10, 1, SunSpecPointDescriptor::NO_SCALE_FACTOR, SunSpecPointType::UINT16},
+  {STR_outPFSet_RmpTms, STR_Secs, 11, 1, SunSpecPointDescriptor::NO_SCALE_FACTOR, SunSpecPointType::UINT16},
+  {STR_outPFSet_Ena, nullptr, 12, 1, SunSpecPointDescriptor::NO_SCALE_FACTOR, SunSpecPointType::ENUM16},
+  {STR_vArWMaxPct, STR___WMax, 13, 1, 23, SunSpecPointType::INT16},
+  {STR_vArMaxPct, STR___VArMax, 14, 1, 23, SunSpecPointType::INT16},
+  {STR_vArAvalPct, STR___VArAval, 15, 1, 23, SunSpecPointType::INT16},
+  {STR_vArPct_WinTms, STR_Secs, 16, 1, SunSpecPointDescriptor::NO_SCALE_FACTOR, SunSpecPointType::UINT16},
+  {STR_vArPct_RvrtTms, STR_Secs, 17, 1, SunSpecPointDescriptor::NO_SCALE_FACTOR, SunSpecPointType::UINT16},
+  {STR_vArPct_RmpTms, STR_Secs, 18, 1, SunSpecPointDescriptor::NO_SCALE_FACTOR, SunSpecPointType::UINT16},
+  {STR_vArPct_Mod, nullptr, 19, 1, SunSpecPointDescriptor::NO_SCALE_FACTOR, SunSpecPointType::ENUM16},
+  {STR_vArPct_Ena, nullptr, 20, 1, SunSpecPointDescriptor::NO_SCALE_FACTOR, SunSpecPointType::ENUM16},
+};
+
+SunSpecPointTable ImmediateControls::pointTable() {
+  return {123, 24, 0, POINTS_123, 21, nullptr, nullptr, 0};
+}
+
+SunSpecPointDescriptor const POINTS_124[] PROGMEM = {
+  {STR_wChaMax, STR_W, 0, 1, 16, SunSpecPointType::UINT16},
+  {STR_wChaGra, STR___WChaMax_sec, 1, 1, 17, SunSpecPointType::UINT16},
+  {STR_wDisChaGra, STR___WChaMax_sec, 2, 1, 17, SunSpecPointType::UINT16},
+  {STR_storCtl_Mod, nullptr, 3, 1, SunSpecPointDescriptor::NO_SCALE_FACTOR, SunSpecPointType::BITFIELD16},
+  {STR_vAChaMax, STR_VA, 4, 1, 18, SunSpecPointType::UINT16},
+  {STR_minRsvPct, STR___WChaMax, 5, 1, 19, SunSpecPointType::UINT16},
+  {STR_chaState, STR___AhrRtg, 6, 1, 20, SunSpecPointType::UINT16},
+  {STR_storAval, STR_AH, 7, 1, 21, SunSpecPointType::UINT16},
+  {STR_inBatV, STR_V, 8, 1, 22, SunSpecPointType::UINT16},
+  {STR_chaSt, nullptr, 9, 1, SunSpecPointDescriptor::NO_SCALE_FACTOR, SunSpecPointType::ENUM16},
+  {STR_outWRte, STR___WDisChaMax, 10, 1, 23, SunSpecPointType::INT16},
+  {STR_inWRte, STR____WChaMax, 11, 1, 23, SunSpecPointType::INT16},
+  {STR_inOutWRte_WinTms, STR_Secs, 12, 1, SunSpecPointDescriptor::NO_SCALE_FACTOR, SunSpecPointType::UINT16},
+  {STR_inOutWRte_RvrtTms, STR_Secs, 13, 1, SunSpecPointDescriptor::NO_SCALE_FACTOR, SunSpecPointType::UINT16},
+  {STR_inOutWRte_RmpTms, STR_Secs, 14, 1, SunSpecPointDescriptor::NO_SCALE_FACTOR, SunSpecPointType::UINT16},
+  {STR_chaGriSet, nullptr, 15, 1, SunSpecPointDescriptor::NO_SCALE_FACTOR, SunSpecPointType::ENUM16},
+};
+
+SunSpecPointTable Storage::pointTable() {
+  return {124, 24, 0, POINTS_124, 16, nullptr, nullptr, 0};
+}
+
+SunSpecPointDescriptor const POINTS_125[] PROGMEM = {
+  {STR_modEna, nullptr, 0, 1, SunSpecPointDescriptor::NO_SCALE_FACTOR, SunSpecPointType::BITFIELD16},
+  {STR_sigType, nullptr, 1, 1, SunSpecPointDescriptor::NO_SCALE_FACTOR, SunSpecPointType::ENUM16},
+  {STR_sig, nullptr, 2, 1, 6, SunSpecPointType::INT16},
+  {STR_winTms, STR_Secs, 3, 1, SunSpecPointDescriptor::NO_SCALE_FACTOR, SunSpecPointType::UINT16},
+  {STR_rvtTms, STR_Secs, 4, 1, SunSpecPointDescriptor::NO_SCALE_FACTOR, SunSpecPointType::UINT16},
+  {STR_rmpTms, STR_Secs, 5, 1, SunSpecPointDescriptor::NO_SCALE_FACTOR, SunSpecPointType::UINT16},
+};
+
+SunSpecPointTable Pricing::pointTable() {
+  return {125, 8, 0, POINTS_125, 6, nullptr, nullptr, 0};
+}
+
+SunSpecPointDescriptor const POINTS_127[] PROGMEM = {
+  {STR_wGra, STR___PM_Hz, 0, 1, 6, SunSpecPointType::UINT16},
+  {STR_hzStr, STR_Hz, 1, 1, 7, SunSpecPointType::INT16},
+  {STR_hzStop, STR_Hz, 2, 1, 7, SunSpecPointType::INT16},
+  {STR_hysEna, nullptr, 3, 1, SunSpecPointDescriptor::NO_SCALE_FACTOR, SunSpecPointType::BITFIELD16},
+  {STR_modEna, nullptr, 4, 1, SunSpecPointDescriptor::NO_SCALE_FACTOR, SunSpecPointType::BITFIELD16},
+  {STR_hzStopWGra, STR___WMax_min, 5, 1, 8, SunSpecPointType::UINT16},
+};
+
+SunSpecPointTable FreqWattParam::pointTable() {
+  return {127, 10, 0, POINTS_127, 6, nullptr, nullptr, 0};
+}
+
+SunSpecPointDescriptor const POINTS_128[] PROGMEM = {
+  {STR_arGraMod, nullptr, 0, 1, SunSpecPointDescriptor::NO_SCALE_FACTOR, SunSpecPointType::ENUM16},
+  {STR_arGraSag, STR__ARtg__dV, 1, 1, 11, SunSpecPointType::UINT16},
+  {STR_arGraSwell, STR__ARtg__dV, 2, 1, 11, SunSpecPointType::UINT16},
+  {STR_modEna, nullptr, 3, 1, SunSpecPointDescriptor::NO_SCALE_FACTOR, SunSpecPointType::BITFIELD16},
+  {STR_filTms, STR_Secs, 4, 1, SunSpecPointDescriptor::NO_SCALE_FACTOR, SunSpecPointType::UINT16},
+  {STR_dbVMin, STR___VRef, 5, 1, 12, SunSpecPointType::UINT16},
+  {STR_dbVMax, STR___VRef, 6, 1, 12, SunSpecPointType::UINT16},
+  {STR_blkZnV, STR___VRef, 7, 1, 12, SunSpecPointType::UINT16},
+  {STR_hysBlkZnV, STR___VRef, 8, 1, 12, SunSpecPointType::UINT16},
+  {STR_blkZnTmms, STR_mSecs, 9, 1, SunSpecPointDescriptor::NO_SCALE_FACTOR, SunSpecPointType::UINT16},
+  {STR_holdTmms, STR_mSecs, 10, 1, SunSpecPointDescriptor::NO_SCALE_FACTOR, SunSpecPointType::UINT16},
+};
+
+SunSpecPointTable DynamicReactiveCurrent::pointTable() {
+  return {128, 14, 0, POINTS_128, 11, nullptr, nullptr, 0};
+}
+
+SunSpecPointDescriptor const POINTS_145[] PROGMEM = {
+  {STR_rampUpRate, STR_Pct, 0, 1, 7, SunSpecPointType::UINT16},
+  {STR_nomRmpDnRte, STR_Pct, 1, 1, 7, SunSpecPointType::UINT16},
+  {STR_emergencyRampUpRate, STR_Pct, 2, 1, 7, SunSpecPointType::UINT16},
+  {STR_emergencyRampDownRate, STR_Pct, 3, 1, 7, SunSpecPointType::UINT16},
+  {STR_connectRampUpRate, STR_Pct, 4, 1, 7, SunSpecPointType::UINT16},
+  {STR_connectRampDownRate, STR_Pct, 5, 1, 7, SunSpecPointType::UINT16},
+  {STR_defaultRampRate, STR_Pct, 6, 1, 7, SunSpecPointType::UINT16},
+};
+
+SunSpecPointTable ExtendedSettings::pointTable() {
+  return {145, 8, 0, POINTS_145, 7, nullptr, nullptr, 0};
+}
+
+SunSpecPointDescriptor const POINTS_160[] PROGMEM = {
+  {STR_globalEvents, nullptr, 4, 2, SunSpecPointDescriptor::NO_SCALE_FACTOR, SunSpecPointType::BITFIELD32},
+  {STR_numberOfModules, nullptr, 6, 1, SunSpecPointDescriptor::NO_SCALE_FACTOR, SunSpecPointType::UINT16},
+  {STR_timestampPeriod, nullptr, 7, 1, SunSpecPointDescriptor::NO_SCALE_FACTOR, SunSpecPointType::UINT16},
+};
+SunSpecPointDescriptor const GROUP_POINTS_160[] PROGMEM = {
+  {STR_inputID, nullptr, 0, 1, SunSpecPointDescriptor::NO_SCALE_FACTOR, SunSpecPointType::UINT16},
+  {STR_inputIDString, nullptr, 1, 8, SunSpecPointDescriptor::NO_SCALE_FACTOR, SunSpecPointType::STRING},
+  {STR_DCCurrent, STR_A, 9, 1, 0, SunSpecPointType::UINT16},
+  {STR_DCVoltage, STR_V, 10, 1, 1, SunSpecPointType::UINT16},
+  {STR_DCPower, STR_W, 11, 1, 2, SunSpecPointType::UINT16},
+  {STR_lifetimeEnergy, STR_Wh, 12, 2, 3, SunSpecPointType::ACC32},
+  {STR_timestamp, STR_Secs, 14, 2, SunSpecPointDescriptor::NO_SCALE_FACTOR, SunSpecPointType::UINT32},
+  {STR_temperature, STR_C, 16, 1, SunSpecPointDescriptor::NO_SCALE_FACTOR, SunSpecPointType::INT16},
+  {STR_operatingState, nullptr, 17, 1, SunSpecPointDescriptor::NO_SCALE_FACTOR, SunSpecPointType::ENUM16},
+  {STR_moduleEvents, nullptr, 18, 2, SunSpecPointDescriptor::NO_SCALE_FACTOR, SunSpecPointType::BITFIELD32},
+};
+
+SunSpecPointTable MultipleMPPTInverterExtensionModel::pointTable() {
+  return {160, 8, 20, POINTS_160, 3, STR_module, GROUP_POINTS_160, 10};
+}
+
+SunSpecPointDescriptor const POINTS_201[] PROGMEM = {
+  {STR_amps, STR_A, 0, 1, 4, SunSpecPointType::INT16},
+  {STR_ampsPhaseA, STR_A, 1, 1, 4, SunSpecPointType::INT16},
+  {STR_ampsPhaseB, STR_A, 2, 1, 4, SunSpecPointType::INT16},
+  {STR_ampsPhaseC, STR_A, 3, 1, 4, SunSpecPointType::INT16},
+  {STR_voltageLN, STR_V, 5, 1, 13, SunSpecPointType::INT16},
+  {STR_phaseVoltageAN, STR_V, 6, 1, 13, SunSpecPointType::INT16},
+  {STR_phaseVoltageBN, STR_V, 7, 1, 13, SunSpecPointType::INT16},
+  {STR_phaseVoltageCN, STR_V, 8, 1, 13, SunSpecPointType::INT16},
+  {STR_voltageLL, STR_V, 9, 1, 13, SunSpecPointType::INT16},
+  {STR_phaseVoltageAB, STR_V, 10, 1, 13, SunSpecPointType::INT16},
+  {STR_phaseVoltageBC, STR_V, 11, 1, 13, SunSpecPointType::INT16},
+  {STR_phaseVoltageCA, STR_V, 12, 1, 13, SunSpecPointType::INT16},
+  {STR_hz, STR_Hz, 14, 1, 15, SunSpecPointType::INT16},
+  {STR_watts, STR_W, 16, 1, 20, SunSpecPointType::INT16},
+  {STR_wattsPhaseA, STR_W, 17, 1, 20, SunSpecPointType::INT16},
+  {STR_wattsPhaseB, STR_W, 18, 1, 20, SunSpecPointType::INT16},
+  {STR_wattsPhaseC, STR_W, 19, 1, 20, SunSpecPointType::INT16},
+  {STR_VA, STR_VA, 21, 1, 25, SunSpecPointType::INT16},
+  {STR_VAPhaseA, STR_VA, 22, 1, 25, SunSpecPointType::INT16},
+  {STR_VAPhaseB, STR_VA, 23, 1, 25, SunSpecPointType::INT16},
+  {STR_VAPhaseC, STR_VA, 24, 1, 25, SunSpecPointType::INT16},
+  {STR_VAR, STR_var, 26, 1, 30, SunSpecPointType::INT16},
+  {STR_VARPhaseA, STR_var, 27, 1, 30, SunSpecPointType::INT16},
+  {STR_VARPhaseB, STR_var, 28, 1, 30, SunSpecPointType::INT16},
+  {STR_VARPhaseC, STR_var, 29, 1, 30, SunSpecPointType::INT16},
+  {STR_PF, STR_Pct, 31, 1, 35, SunSpecPointType::INT16},
+  {STR_PFPhaseA, STR_Pct, 32, 1, 35, SunSpecPointType::INT16},
+  {STR_PFPhaseB, STR_Pct, 33, 1, 35, SunSpecPointType::INT16},
+  {STR_PFPhaseC, STR_Pct, 34, 1, 35, SunSpecPointType::INT16},
+  {STR_totalWattHoursExported, STR_Wh, 36, 2, 52, SunSpecPointType::ACC32},
+  {STR_totalWattHoursExportedPhaseA, STR_Wh, 38, 2, 52, SunSpecPointType::ACC32},
+  {STR_totalWattHoursExportedPhaseB, STR_Wh, 40, 2, 52, SunSpecPointType::ACC32},
+  {STR_totalWattHoursExportedPhaseC, STR_Wh, 42, 2, 52, SunSpecPointType::ACC32},
+  {STR_totalWattHoursImported, STR_Wh, 44, 2, 52, SunSpecPointType::ACC32},
+  {STR_totalWattHoursImportedPhaseA, STR_Wh, 46, 2, 52, SunSpecPointType::ACC32},
+  {STR_totalWattHoursImportedPhaseB, STR_Wh, 48, 2, 52, SunSpecPointType::ACC32},
+  {STR_totalWattHoursImportedPhaseC, STR_Wh, 50, 2, 52, SunSpecPointType::ACC32},
+  {STR_totalVAHoursExported, STR_VAh, 53, 2, 69, SunSpecPointType::ACC32},
+  {STR_totalVAHoursExportedPhaseA, STR_VAh, 55, 2, 69, SunSpecPointType::ACC32},
+  {STR_totalVAHoursExportedPhaseB, STR_VAh, 57, 2, 69, SunSpecPointType::ACC32},
+  {STR_totalVAHoursExportedPhaseC, STR_VAh, 59, 2, 69, SunSpecPointType::ACC32},
+  {STR_totalVAHoursImported, STR_VAh, 61, 2, 69, SunSpecPointType::ACC32},
+  {STR_totalVAHoursImportedPhaseA, STR_VAh, 63, 2, 69, SunSpecPointType::ACC32},
+  {STR_totalVAHoursImportedPhaseB, STR_VAh, 65, 2, 69, SunSpecPointType::ACC32},
+  {STR_totalVAHoursImportedPhaseC, STR_VAh, 67, 2, 69, SunSpecPointType::ACC32},
+  {STR_totalVARHoursImportedQ1, STR_varh, 70, 2, 102, SunSpecPointType::ACC32},
+  {STR_totalVArHoursImportedQ1PhaseA, STR_varh, 72, 2, 102, SunSpecPointType::ACC32},
+  {STR_totalVArHoursImportedQ1PhaseB, STR_varh, 74, 2, 102, SunSpecPointType::ACC32},
+  {STR_totalVArHoursImportedQ1PhaseC, STR_varh, 76, 2, 102, SunSpecPointType::ACC32},
+  {STR_totalVArHoursImportedQ2, STR_varh, 78, 2, 102, SunSpecPointType::ACC32},
+  {STR_totalVArHoursImportedQ2PhaseA, STR_varh, 80, 2, 102, SunSpecPointType::ACC32},
+  {STR_totalVArHoursImportedQ2PhaseB, STR_varh, 82, 2, 102, SunSpecPointType::ACC32},
+  {STR_totalVArHoursImportedQ2PhaseC, STR_varh, 84, 2, 102, SunSpecPointType::ACC32},
+  {STR_totalVArHoursExportedQ3, STR_varh, 86, 2, 102, SunSpecPointType::ACC32},
+  {STR_totalVArHoursExportedQ3PhaseA, STR_varh, 88, 2, 102, SunSpecPointType::ACC32},
+  {STR_totalVArHoursExportedQ3PhaseB, STR_varh, 90, 2, 102, SunSpecPointType::ACC32},
+  {STR_totalVArHoursExportedQ3PhaseC, STR_varh, 92, 2, 102, SunSpecPointType::ACC32},
+  {STR_totalVArHoursExportedQ4, STR_varh, 94, 2, 102, SunSpecPointType::ACC32},
+  {STR_totalVArHoursExportedQ4ImportedPhaseA, STR_varh, 96, 2, 102, SunSpecPointType::ACC32},
+  {STR_totalVArHoursExportedQ4ImportedPhaseB, STR_varh, 98, 2, 102, SunSpecPointType::ACC32},
+  {STR_totalVArHoursExportedQ4ImportedPhaseC, STR_varh, 100, 2, 102, SunSpecPointType::ACC32},
+  {STR_events, nullptr, 103, 2, SunSpecPointDescriptor::NO_SCALE_FACTOR, SunSpecPointType::BITFIELD32},
+};
+
+SunSpecPointTable MeterSinglePhaseSinglePhaseANOrABMeter::pointTable() {
+  return {201, 105, 0, POINTS_201, 62, nullptr, nullptr, 0};
+}
+
+SunSpecPointDescriptor const POINTS_202[] PROGMEM = {
+  {STR_amps, STR_A, 0, 1, 4, SunSpecPointType::INT16},
+  {STR_ampsPhaseA, STR_A, 1, 1, 4, SunSpecPointType::INT16},
+  {STR_ampsPhaseB, STR_A, 2, 1, 4, SunSpecPointType::INT16},
+  {STR_ampsPhaseC, STR_A, 3, 1, 4, SunSpecPointType::INT16},
+  {STR_voltageLN, STR_V, 5, 1, 13, SunSpecPointType::INT16},
+  {STR_phaseVoltageAN, STR_V, 6, 1, 13, SunSpecPointType::INT16},
+  {STR_phaseVoltageBN, STR_V, 7, 1, 13, SunSpecPointType::INT16},
+  {STR_phaseVoltageCN, STR_V, 8, 1, 13, SunSpecPointType::INT16},
+  {STR_voltageLL, STR_V, 9, 1, 13, SunSpecPointType::INT16},
+  {STR_phaseVoltageAB, STR_V, 10, 1, 13, SunSpecPointType::INT16},
+  {STR_phaseVoltageBC, STR_V, 11, 1, 13, SunSpecPointType::INT16},
+  {STR_phaseVoltageCA, STR_V, 12, 1, 13, SunSpecPointType::INT16},
+  {STR_hz, STR_Hz, 14, 1, 15, SunSpecPointType::INT16},
+  {STR_watts, STR_W, 16, 1, 20, SunSpecPointType::INT16},
+  {STR_wattsPhaseA, STR_W, 17, 1, 20, SunSpecPointType::INT16},
+  {STR_wattsPhaseB, STR_W, 18, 1, 20, SunSpecPointType::INT16},
+  {STR_wattsPhaseC, STR_W, 19, 1, 20, SunSpecPointType::INT16},
+  {STR_VA, STR_VA, 21, 1, 25, SunSpecPointType::INT16},
+  {STR_VAPhaseA, STR_VA, 22, 1, 25, SunSpecPointType::INT16},
+  {STR_VAPhaseB, STR_VA, 23, 1, 25, SunSpecPointType::INT16},
+  {STR_VAPhaseC, STR_VA, 24, 1, 25, SunSpecPointType::INT16},
+  {STR_VAR, STR_var, 26, 1, 30, SunSpecPointType::INT16},
+  {STR_VARPhaseA, STR_var, 27, 1, 30, SunSpecPointType::INT16},
+  {STR_VARPhaseB, STR_var, 28, 1, 30, SunSpecPointType::INT16},
+  {STR_VARPhaseC, STR_var, 29, 1, 30, SunSpecPointType::INT16},
+  {STR_PF, STR_Pct, 31, 1, 35, SunSpecPointType::INT16},
+  {STR_PFPhaseA, STR_Pct, 32, 1, 35, SunSpecPointType::INT16},
+  {STR_PFPhaseB, STR_Pct, 33, 1, 35, SunSpecPointType::INT16},
+  {STR_PFPhaseC, STR_Pct, 34, 1, 35, SunSpecPointType::INT16},
+  {STR_totalWattHoursExported, STR_Wh, 36, 2, 52, SunSpecPointType::ACC32},
+  {STR_totalWattHoursExportedPhaseA, STR_Wh, 38, 2, 52, SunSpecPointType::ACC32},
+  {STR_totalWattHoursExportedPhaseB, STR_Wh, 40, 2, 52, SunSpecPointType::ACC32},
+  {STR_totalWattHoursExportedPhaseC, STR_Wh, 42, 2, 52, SunSpecPointType::ACC32},
+  {STR_totalWattHoursImported, STR_Wh, 44, 2, 52, SunSpecPointType::ACC32},
+  {STR_totalWattHoursImportedPhaseA, STR_Wh, 46, 2, 52, SunSpecPointType::ACC32},
+  {STR_totalWattHoursImportedPhaseB, STR_Wh, 48, 2, 52, SunSpecPointType::ACC32},
+  {STR_totalWattHoursImportedPhaseC, STR_Wh, 50, 2, 52, SunSpecPointType::ACC32},
+  {STR_totalVAHoursExported, STR_VAh, 53, 2, 69, SunSpecPointType::ACC32},
+  {STR_totalVAHoursExportedPhaseA, STR_VAh, 55, 2, 69, SunSpecPointType::ACC32},
+  {STR_totalVAHoursExportedPhaseB, STR_VAh, 57, 2, 69, SunSpecPointType::ACC32},
+  {STR_totalVAHoursExportedPhaseC, STR_VAh, 59, 2, 69, SunSpecPointType::ACC32},
+  {STR_totalVAHoursImported, STR_VAh, 61, 2, 69, SunSpecPointType::ACC32},
+  {STR_totalVAHoursImportedPhaseA, STR_VAh, 63, 2, 69, SunSpecPointType::ACC32},
+  {STR_totalVAHoursImportedPhaseB, STR_VAh, 65, 2, 69, SunSpecPointType::ACC32},
+  {STR_totalVAHoursImportedPhaseC, STR_VAh, 67, 2, 69, SunSpecPointType::ACC32},
+  {STR_totalVARHoursImportedQ1, STR_varh, 70, 2, 102, SunSpecPointType::ACC32},
+  {STR_totalVArHoursImportedQ1PhaseA, STR_varh, 72, 2, 102, SunSpecPointType::ACC32},
+  {STR_totalVArHoursImportedQ1PhaseB, STR_varh, 74, 2, 102, SunSpecPointType::ACC32},
+  {STR_totalVArHoursImportedQ1PhaseC, STR_varh, 76, 2, 102, SunSpecPointType::ACC32},
+  {STR_totalVArHoursImportedQ2, STR_varh, 78, 2, 102, SunSpecPointType::ACC32},
+  {STR_totalVArHoursImportedQ2PhaseA, STR_varh, 80, 2, 102, SunSpecPointType::ACC32},
+  {STR_totalVArHoursImportedQ2PhaseB, STR_varh, 82, 2, 102, SunSpecPointType::ACC32},
+  {STR_totalVArHoursImportedQ2PhaseC, STR_varh, 84, 2, 102, SunSpecPointType::ACC32},
+  {STR_totalVArHoursExportedQ3, STR_varh, 86, 2, 102, SunSpecPointType::ACC32},
+  {STR_totalVArHoursExportedQ3PhaseA, STR_varh, 88, 2, 102, SunSpecPointType::ACC32},
+  {STR_totalVArHoursExportedQ3PhaseB, STR_varh, 90, 2, 102, SunSpecPointType::ACC32},
+  {STR_totalVArHoursExportedQ3PhaseC, STR_varh, 92, 2, 102, SunSpecPointType::ACC32},
+  {STR_totalVArHoursExportedQ4, STR_varh, 94, 2, 102, SunSpecPointType::ACC32},
+  {STR_totalVArHoursExportedQ4ImportedPhaseA, STR_varh, 96, 2, 102, SunSpecPointType::ACC32},
+  {STR_totalVArHoursExportedQ4ImportedPhaseB, STR_varh, 98, 2, 102, SunSpecPointType::ACC32},
+  {STR_totalVArHoursExportedQ4ImportedPhaseC, STR_varh, 100, 2, 102, SunSpecPointType::ACC32},
+  {STR_events, nullptr, 103, 2, SunSpecPointDescriptor::NO_SCALE_FACTOR, SunSpecPointType::BITFIELD32},
+};
+
+SunSpecPointTable SplitSinglePhaseABNMeter_202::pointTable() {
+  return {202, 105, 0, POINTS_202, 62, nullptr, nullptr, 0};
+}
+
+SunSpecPointDescriptor const POINTS_203[] PROGMEM = {
+  {STR_amps, STR_A, 0, 1, 4, SunSpecPointType::INT16},
+  {STR_ampsPhaseA, STR_A, 1, 1, 4, SunSpecPointType::INT16},
+  {STR_ampsPhaseB, STR_A, 2, 1, 4, SunSpecPointType::INT16},
+  {STR_ampsPhaseC, STR_A, 3, 1, 4, SunSpecPointType::INT16},
+  {STR_voltageLN, STR_V, 5, 1, 13, SunSpecPointType::INT16},
+  {STR_phaseVoltageAN, STR_V, 6, 1, 13, SunSpecPointType::INT16},
+  {STR_phaseVoltageBN, STR_V, 7, 1, 13, SunSpecPointType::INT16},
+  {STR_phaseVoltageCN, STR_V, 8, 1, 13, SunSpecPointType::INT16},
+  {STR_voltageLL, STR_V, 9, 1, 13, SunSpecPointType::INT16},
+  {STR_phaseVoltageAB, STR_V, 10, 1, 13, SunSpecPointType::INT16},
+  {STR_phaseVoltageBC, STR_V, 11, 1, 13, SunSpecPointType::INT16},
+  {STR_phaseVoltageCA, STR_V, 12, 1, 13, SunSpecPointType::INT16},
+  {STR_hz, STR_Hz, 14, 1, 15, SunSpecPointType::INT16},
+  {STR_watts, STR_W, 16, 1, 20, SunSpecPointType::INT16},
+  {STR_wattsPhaseA, STR_W, 17, 1, 20, SunSpecPointType::INT16},
+  {STR_wattsPhaseB, STR_W, 18, 1, 20, SunSpecPointType::INT16},
+  {STR_wattsPhaseC, STR_W, 19, 1, 20, SunSpecPointType::INT16},
+  {STR_VA, STR_VA, 21, 1, 25, SunSpecPointType::INT16},
+  {STR_VAPhaseA, STR_VA, 22, 1, 25, SunSpecPointType::INT16},
+  {STR_VAPhaseB, STR_VA, 23, 1, 25, SunSpecPointType::INT16},
+  {STR_VAPhaseC, STR_VA, 24, 1, 25, SunSpecPointType::INT16},
+  {STR_VAR, STR_var, 26, 1, 30, SunSpecPointType::INT16},
+  {STR_VARPhaseA, STR_var, 27, 1, 30, SunSpecPointType::INT16},
+  {STR_VARPhaseB, STR_var, 28, 1, 30, SunSpecPointType::INT16},
+  {STR_VARPhaseC, STR_var, 29, 1, 30, SunSpecPointType::INT16},
+  {STR_PF, STR_Pct, 31, 1, 35, SunSpecPointType::INT16},
+  {STR_PFPhaseA, STR_Pct, 32, 1, 35, SunSpecPointType::INT16},
+  {STR_PFPhaseB, STR_Pct, 33, 1, 35, SunSpecPointType::INT16},
+  {STR_PFPhaseC, STR_Pct, 34, 1, 35, SunSpecPointType::INT16},
+  {STR_totalWattHoursExported, STR_Wh, 36, 2, 52, SunSpecPointType::ACC32},
+  {STR_totalWattHoursExportedPhaseA, STR_Wh, 38, 2, 52, SunSpecPointType::ACC32},
+  {STR_totalWattHoursExportedPhaseB, STR_Wh, 40, 2, 52, SunSpecPointType::ACC32},
+  {STR_totalWattHoursExportedPhaseC, STR_Wh, 42, 2, 52, SunSpecPointType::ACC32},
+  {STR_totalWattHoursImported, STR_Wh, 44, 2, 52, SunSpecPointType::ACC32},
+  {STR_totalWattHoursImportedPhaseA, STR_Wh, 46, 2, 52, SunSpecPointType::ACC32},
+  {STR_totalWattHoursImportedPhaseB, STR_Wh, 48, 2, 52, SunSpecPointType::ACC32},
+  {STR_totalWattHoursImportedPhaseC, STR_Wh, 50, 2, 52, SunSpecPointType::ACC32},
+  {STR_totalVAHoursExported, STR_VAh, 53, 2, 69, SunSpecPointType::ACC32},
+  {STR_totalVAHoursExportedPhaseA, STR_VAh, 55, 2, 69, SunSpecPointType::ACC32},
+  {STR_totalVAHoursExportedPhaseB, STR_VAh, 57, 2, 69, SunSpecPointType::ACC32},
+  {STR_totalVAHoursExportedPhaseC, STR_VAh, 59, 2, 69, SunSpecPointType::ACC32},
+  {STR_totalVAHoursImported, STR_VAh, 61, 2, 69, SunSpecPointType::ACC32},
+  {STR_totalVAHoursImportedPhaseA, STR_VAh, 63, 2, 69, SunSpecPointType::ACC32},
+  {STR_totalVAHoursImportedPhaseB, STR_VAh, 65, 2, 69, SunSpecPointType::ACC32},
+  {STR_totalVAHoursImportedPhaseC, STR_VAh, 67, 2, 69, SunSpecPointType::ACC32},
+  {STR_totalVARHoursImportedQ1, STR_varh, 70, 2, 102, SunSpecPointType::ACC32},
+  {STR_totalVArHoursImportedQ1PhaseA, STR_varh, 72, 2, 102, SunSpecPointType::ACC32},
+  {STR_totalVArHoursImportedQ1PhaseB, STR_varh, 74, 2, 102, SunSpecPointType::ACC32},
+  {STR_totalVArHoursImportedQ1PhaseC, STR_varh, 76, 2, 102, SunSpecPointType::ACC32},
+  {STR_totalVArHoursImportedQ2, STR_varh, 78, 2, 102, SunSpecPointType::ACC32},
+  {STR_totalVArHoursImportedQ2PhaseA, STR_varh, 80, 2, 102, SunSpecPointType::ACC32},
+  {STR_totalVArHoursImportedQ2PhaseB, STR_varh, 82, 2, 102, SunSpecPointType::ACC32},
+  {STR_totalVArHoursImportedQ2PhaseC, STR_varh, 84, 2, 102, SunSpecPointType::ACC32},
+  {STR_totalVArHoursExportedQ3, STR_varh, 86, 2, 102, SunSpecPointType::ACC32},
+  {STR_totalVArHoursExportedQ3PhaseA, STR_varh, 88, 2, 102, SunSpecPointType::ACC32},
+  {STR_totalVArHoursExportedQ3PhaseB, STR_varh, 90, 2, 102, SunSpecPointType::ACC32},
+  {STR_totalVArHoursExportedQ3PhaseC, STR_varh, 92, 2, 102, SunSpecPointType::ACC32},
+  {STR_totalVArHoursExportedQ4, STR_varh, 94, 2, 102, SunSpecPointType::ACC32},
+  {STR_totalVArHoursExportedQ4ImportedPhaseA, STR_varh, 96, 2, 102, SunSpecPointType::ACC32},
+  {STR_totalVArHoursExportedQ4ImportedPhaseB, STR_varh, 98, 2, 102, SunSpecPointType::ACC32},
+  {STR_totalVArHoursExportedQ4ImportedPhaseC, STR_varh, 100, 2, 102, SunSpecPointType::ACC32},
+  {STR_events, nullptr, 103, 2, SunSpecPointDescriptor::NO_SCALE_FACTOR, SunSpecPointType::BITFIELD32},
+};
+
+SunSpecPointTable WyeConnectThreePhaseAbcnMeter_203::pointTable() {
+  return {203, 105, 0, POINTS_203, 62, nullptr, nullptr, 0};
+}
+
+SunSpecPointDescriptor const POINTS_204[] PROGMEM = {
+  {STR_amps, STR_A, 0, 1, 4, SunSpecPointType::INT16},
+  {STR_ampsPhaseA, STR_A, 1, 1, 4, SunSpecPointType::INT16},
+  {STR_ampsPhaseB, STR_A, 2, 1, 4, SunSpecPointType::INT16},
+  {STR_ampsPhaseC, STR_A, 3, 1, 4, SunSpecPointType::INT16},
+  {STR_voltageLN, STR_V, 5, 1, 13, SunSpecPointType::INT16},
+  {STR_phaseVoltageAN, STR_V, 6, 1, 13, SunSpecPointType::INT16},
+  {STR_phaseVoltageBN, STR_V, 7, 1, 13, SunSpecPointType::INT16},
+  {STR_phaseVoltageCN, STR_V, 8, 1, 13, SunSpecPointType::INT16},
+  {STR_voltageLL, STR_V, 9, 1, 13, SunSpecPointType::INT16},
+  {STR_phaseVoltageAB, STR_V, 10, 1, 13, SunSpecPointType::INT16},
+  {STR_phaseVoltageBC, STR_V, 11, 1, 13, SunSpecPointType::INT16},
+  {STR_phaseVoltageCA, STR_V, 12, 1, 13, SunSpecPointType::INT16},
+  {STR_hz, STR_Hz, 14, 1, 15, SunSpecPointType::INT16},
+  {STR_watts, STR_W, 16, 1, 20, SunSpecPointType::INT16},
+  {STR_wattsPhaseA, STR_W, 17, 1, 20, SunSpecPointType::INT16},
+  {STR_wattsPhaseB, STR_W, 18, 1, 20, SunSpecPointType::INT16},
+  {STR_wattsPhaseC, STR_W, 19, 1, 20, SunSpecPointType::INT16},
+  {STR_VA, STR_VA, 21, 1, 25, SunSpecPointType::INT16},
+  {STR_VAPhaseA, STR_VA, 22, 1, 25, SunSpecPointType::INT16},
+  {STR_VAPhaseB, STR_VA, 23, 1, 25, SunSpecPointType::INT16},
+  {STR_VAPhaseC, STR_VA, 24, 1, 25, SunSpecPointType::INT16},
+  {STR_VAR, STR_var, 26, 1, 30, SunSpecPointType::INT16},
+  {STR_VARPhaseA, STR_var, 27, 1, 30, SunSpecPointType::INT16},
+  {STR_VARPhaseB, STR_var, 28, 1, 30, SunSpecPointType::INT16},
+  {STR_VARPhaseC, STR_var, 29, 1, 30, SunSpecPointType::INT16},
+  {STR_PF, STR_Pct, 31, 1, 35, SunSpecPointType::INT16},
+  {STR_PFPhaseA, STR_Pct, 32, 1, 35, SunSpecPointType::INT16},
+  {STR_PFPhaseB, STR_Pct, 33, 1, 35, SunSpecPointType::INT16},
+  {STR_PFPhaseC, STR_Pct, 34, 1, 35, SunSpecPointType::INT16},
+  {STR_totalWattHoursExported, STR_Wh, 36, 2, 52, SunSpecPointType::ACC32},
+  {STR_totalWattHoursExportedPhaseA, STR_Wh, 38, 2, 52, SunSpecPointType::ACC32},
+  {STR_totalWattHoursExportedPhaseB, STR_Wh, 40, 2, 52, SunSpecPointType::ACC32},
+  {STR_totalWattHoursExportedPhaseC, STR_Wh, 42, 2, 52, SunSpecPointType::ACC32},
+  {STR_totalWattHoursImported, STR_Wh, 44, 2, 52, SunSpecPointType::ACC32},
+  {STR_totalWattHoursImportedPhaseA, STR_Wh, 46, 2, 52, SunSpecPointType::ACC32},
+  {STR_totalWattHoursImportedPhaseB, STR_Wh, 48, 2, 52, SunSpecPointType::ACC32},
+  {STR_totalWattHoursImportedPhaseC, STR_Wh, 50, 2, 52, SunSpecPointType::ACC32},
+  {STR_totalVAHoursExported, STR_VAh, 53, 2, 69, SunSpecPointType::ACC32},
+  {STR_totalVAHoursExportedPhaseA, STR_VAh, 55, 2, 69, SunSpecPointType::ACC32},
+  {STR_totalVAHoursExportedPhaseB, STR_VAh, 57, 2, 69, SunSpecPointType::ACC32},
+  {STR_totalVAHoursExportedPhaseC, STR_VAh, 59, 2, 69, SunSpecPointType::ACC32},
+  {STR_totalVAHoursImported, STR_VAh, 61, 2, 69, SunSpecPointType::ACC32},
+  {STR_totalVAHoursImportedPhaseA, STR_VAh, 63, 2, 69, SunSpecPointType::ACC32},
+  {STR_totalVAHoursImportedPhaseB, STR_VAh, 65, 2, 69, SunSpecPointType::ACC32},
+  {STR_totalVAHoursImportedPhaseC, STR_VAh, 67, 2, 69, SunSpecPointType::ACC32},
+  {STR_totalVARHoursImportedQ1, STR_varh, 70, 2, 102, SunSpecPointType::ACC32},
+  {STR_totalVArHoursImportedQ1PhaseA, STR_varh, 72, 2, 102, SunSpecPointType::ACC32},
+  {STR_totalVArHoursImportedQ1PhaseB, STR_varh, 74, 2, 102, SunSpecPointType::ACC32},
+  {STR_totalVArHoursImportedQ1PhaseC, STR_varh, 76, 2, 102, SunSpecPointType::ACC32},
+  {STR_totalVArHoursImportedQ2, STR_varh, 78, 2, 102, SunSpecPointType::ACC32},
+  {STR_totalVArHoursImportedQ2PhaseA, STR_varh, 80, 2, 102, SunSpecPointType::ACC32},
+  {STR_totalVArHoursImportedQ2PhaseB, STR_varh, 82, 2, 102, SunSpecPointType::ACC32},
+  {STR_totalVArHoursImportedQ2PhaseC, STR_varh, 84, 2, 102, SunSpecPointType::ACC32},
+  {STR_totalVArHoursExportedQ3, STR_varh, 86, 2, 102, SunSpecPointType::ACC32},
+  {STR_totalVArHoursExportedQ3PhaseA, STR_varh, 88, 2, 102, SunSpecPointType::ACC32},
+  {STR_totalVArHoursExportedQ3PhaseB, STR_varh, 90, 2, 102, SunSpecPointType::ACC32},
+  {STR_totalVArHoursExportedQ3PhaseC, STR_varh, 92, 2, 102, SunSpecPointType::ACC32},
+  {STR_totalVArHoursExportedQ4, STR_varh, 94, 2, 102, SunSpecPointType::ACC32},
+  {STR_totalVArHoursExportedQ4ImportedPhaseA, STR_varh, 96, 2, 102, SunSpecPointType::ACC32},
+  {STR_totalVArHoursExportedQ4ImportedPhaseB, STR_varh, 98, 2, 102, SunSpecPointType::ACC32},
+  {STR_totalVArHoursExportedQ4ImportedPhaseC, STR_varh, 100, 2, 102, SunSpecPointType::ACC32},
+  {STR_events, nullptr, 103, 2, SunSpecPointDescriptor::NO_SCALE_FACTOR, SunSpecPointType::BITFIELD32},
+};
+
+SunSpecPointTable DeltaConnectThreePhaseAbcMeter_204::pointTable() {
+  return {204, 105, 0, POINTS_204, 62, nullptr, nullptr, 0};
+}
+
+SunSpecPointDescriptor const POINTS_211[] PROGMEM = {
+  {STR_amps, STR_A, 0, 2, SunSpecPointDescriptor::NO_SCALE_FACTOR, SunSpecPointType::FLOAT32},
+  {STR_ampsPhaseA, STR_A, 2, 2, SunSpecPointDescriptor::NO_SCALE_FACTOR, SunSpecPointType::FLOAT32},
+  {STR_ampsPhaseB, STR_A, 4, 2, SunSpecPointDescriptor::NO_SCALE_FACTOR, SunSpecPointType::FLOAT32},
+  {STR_ampsPhaseC, STR_A, 6, 2, SunSpecPointDescriptor::NO_SCALE_FACTOR, SunSpecPointType::FLOAT32},
+  {STR_voltageLN, STR_V, 8, 2, SunSpecPointDescriptor::NO_SCALE_FACTOR, SunSpecPointType::FLOAT32},
+  {STR_phaseVoltageAN, STR_V, 10, 2, SunSpecPointDescriptor::NO_SCALE_FACTOR, SunSpecPointType::FLOAT32},
+  {STR_phaseVoltageBN, STR_V, 12, 2, SunSpecPointDescriptor::NO_SCALE_FACTOR, SunSpecPointType::FLOAT32},
+  {STR_phaseVoltageCN, STR_V, 14, 2, SunSpecPointDescriptor::NO_SCALE_FACTOR, SunSpecPointType::FLOAT32},
+  {STR_voltageLL, STR_V, 16, 2, SunSpecPointDescriptor::NO_SCALE_FACTOR, SunSpecPointType::FLOAT32},
+  {STR_phaseVoltageAB, STR_V, 18, 2, SunSpecPointDescriptor::NO_SCALE_FACTOR, SunSpecPointType::FLOAT32},
+  {STR_phaseVoltageBC, STR_V, 20, 2, SunSpecPointDescriptor::NO_SCALE_FACTOR, SunSpecPointType::FLOAT32},
+  {STR_phaseVoltageCA, STR_V, 22, 2, SunSpecPointDescriptor::NO_SCALE_FACTOR, SunSpecPointType::FLOAT32},
+  {STR_hz, STR_Hz, 24, 2, SunSpecPointDescriptor::NO_SCALE_FACTOR, SunSpecPointType::FLOAT32},
+  {STR_watts, STR_W, 26, 2, SunSpecPointDescriptor::NO_SCALE_FACTOR, SunSpecPointType::FLOAT32},
+  {STR_wattsPhaseA, STR_W, 28, 2, SunSpecPointDescriptor::NO_SCALE_FACTOR, SunSpecPointType::FLOAT32},
+  {STR_wattsPhaseB, STR_W, 30, 2, SunSpecPointDescriptor::NO_SCALE_FACTOR, SunSpecPointType::FLOAT32},
+  {STR_wattsPhaseC, STR_W, 32, 2, SunSpecPointDescriptor::NO_SCALE_FACTOR, SunSpecPointType::FLOAT32},
+  {STR_VA, STR_VA, 34, 2, SunSpecPointDescriptor::NO_SCALE_FACTOR, SunSpecPointType::FLOAT32},
+  {STR_VAPhaseA, STR_VA, 36, 2, SunSpecPointDescriptor::NO_SCALE_FACTOR, SunSpecPointType::FLOAT32},
+  {STR_VAPhaseB, STR_VA, 38, 2, SunSpecPointDescriptor::NO_SCALE_FACTOR, SunSpecPointType::FLOAT32},
+  {STR_VAPhaseC, STR_VA, 40, 2, SunSpecPointDescriptor::NO_SCALE_FACTOR, SunSpecPointType::FLOAT32},
+  {STR_VAR, STR_var, 42, 2, SunSpecPointDescriptor::NO_SCALE_FACTOR, SunSpecPointType::FLOAT32},
+  {STR_VARPhaseA, STR_var, 44, 2, SunSpecPointDescriptor::NO_SCALE_FACTOR, SunSpecPointType::FLOAT32},
+  {STR_VARPhaseB, STR_var, 46, 2, SunSpecPointDescriptor::NO_SCALE_FACTOR, SunSpecPointType::FLOAT32},
+  {STR_VARPhaseC, STR_var, 48, 2, SunSpecPointDescriptor::NO_SCALE_FACTOR, SunSpecPointType::FLOAT32},
+  {STR_PF, STR_PF, 50, 2, SunSpecPointDescriptor::NO_SCALE_FACTOR, SunSpecPointType::FLOAT32},
+  {STR_PFPhaseA, STR_PF, 52, 2, SunSpecPointDescriptor::NO_SCALE_FACTOR, SunSpecPointType::FLOAT32},
+  {STR_PFPhaseB, STR_PF, 54, 2, SunSpecPointDescriptor::NO_SCALE_FACTOR, SunSpecPointType::FLOAT32},
+  {STR_PFPhaseC, STR_PF, 56, 2, SunSpecPointDescriptor::NO_SCALE_FACTOR, SunSpecPointType::FLOAT32},
+  {STR_totalWattHoursExported, STR_Wh, 58, 2, SunSpecPointDescriptor::NO_SCALE_FACTOR, SunSpecPointType::FLOAT32},
+  {STR_totalWattHoursExportedPhaseA, STR_Wh, 60, 2, SunSpecPointDescriptor::NO_SCALE_FACTOR, SunSpecPointType::FLOAT32},
+  {STR_totalWattHoursExportedPhaseB, STR_Wh, 62, 2, SunSpecPointDescriptor::NO_SCALE_FACTOR, SunSpecPointType::FLOAT32},
+  {STR_totalWattHoursExportedPhaseC, STR_Wh, 64, 2, SunSpecPointDescriptor::NO_SCALE_FACTOR, SunSpecPointType::FLOAT32},
+  {STR_totalWattHoursImported, STR_Wh, 66, 2, SunSpecPointDescriptor::NO_SCALE_FACTOR, SunSpecPointType::FLOAT32},
+  {STR_totalWattHoursImportedPhaseA, STR_Wh, 68, 2, SunSpecPointDescriptor::NO_SCALE_FACTOR, SunSpecPointType::FLOAT32},
+  {STR_totalWattHoursImportedPhaseB, STR_Wh, 70, 2, SunSpecPointDescriptor::NO_SCALE_FACTOR, SunSpecPointType::FLOAT32},
+  {STR_totalWattHoursImportedPhaseC, STR_Wh, 72, 2, SunSpecPointDescriptor::NO_SCALE_FACTOR, SunSpecPointType::FLOAT32},
+  {STR_totalVAHoursExported, STR_VAh, 74, 2, SunSpecPointDescriptor::NO_SCALE_FACTOR, SunSpecPointType::FLOAT32},
+  {STR_totalVAHoursExportedPhaseA, STR_VAh, 76, 2, SunSpecPointDescriptor::NO_SCALE_FACTOR, SunSpecPointType::FLOAT32},
+  {STR_totalVAHoursExportedPhaseB, STR_VAh, 78, 2, SunSpecPointDescriptor::NO_SCALE_FACTOR, SunSpecPointType::FLOAT32},
+  {STR_totalVAHoursExportedPhaseC, STR_VAh, 80, 2, SunSpecPointDescriptor::NO_SCALE_FACTOR, SunSpecPointType::FLOAT32},
+  {STR_totalVAHoursImported, STR_VAh, 82, 2, SunSpecPointDescriptor::NO_SCALE_FACTOR, SunSpecPointType::FLOAT32},
+  {STR_totalVAHoursImportedPhaseA, STR_VAh, 84, 2, SunSpecPointDescriptor::NO_SCALE_FACTOR, SunSpecPointType::FLOAT32},
+  {STR_totalVAHoursImportedPhaseB, STR_VAh, 86, 2, SunSpecPointDescriptor::NO_SCALE_FACTOR, SunSpecPointType::FLOAT32},
+  {STR_totalVAHoursImportedPhaseC, STR_VAh, 88, 2, SunSpecPointDescriptor::NO_SCALE_FACTOR, SunSpecPointType::FLOAT32},
+  {STR_totalVARHoursImportedQ1, STR_varh, 90, 2, SunSpecPointDescriptor::NO_SCALE_FACTOR, SunSpecPointType::FLOAT32},
+  {STR_totalVArHoursImportedQ1PhaseA, STR_varh, 92, 2, SunSpecPointDescriptor::NO_SCALE_FACTOR, SunSpecPointType::FLOAT32},
+  {STR_totalVArHoursImportedQ1PhaseB, STR_varh, 94, 2, SunSpecPointDescriptor::NO_SCALE_FACTOR, SunSpecPointType::FLOAT32},
+  {STR_totalVArHoursImportedQ1PhaseC, STR_varh, 96, 2, SunSpecPointDescriptor::NO_SCALE_FACTOR, SunSpecPointType::FLOAT32},
+  {STR_totalVArHoursImportedQ2, STR_varh, 98, 2, SunSpecPointDescriptor::NO_SCALE_FACTOR, SunSpecPointType::FLOAT32},
+  {STR_totalVArHoursImportedQ2PhaseA, STR_varh, 100, 2, SunSpecPointDescriptor::NO_SCALE_FACTOR, SunSpecPointType::FLOAT32},
+  {STR_totalVArHoursImportedQ2PhaseB, STR_varh, 102, 2, SunSpecPointDescriptor::NO_SCALE_FACTOR, SunSpecPointType::FLOAT32},
+  {STR_totalVArHoursImportedQ2PhaseC, STR_varh, 104, 2, SunSpecPointDescriptor::NO_SCALE_FACTOR, SunSpecPointType::FLOAT32},
+  {STR_totalVArHoursExportedQ3, STR_varh, 106, 2, SunSpecPointDescriptor::NO_SCALE_FACTOR, SunSpecPointType::FLOAT32},
+  {STR_totalVArHoursExportedQ3PhaseA, STR_varh, 108, 2, SunSpecPointDescriptor::NO_SCALE_FACTOR, SunSpecPointType::FLOAT32},
+  {STR_totalVArHoursExportedQ3PhaseB, STR_varh, 110, 2, SunSpecPointDescriptor::NO_SCALE_FACTOR, SunSpecPointType::FLOAT32},
+  {STR_totalVArHoursExportedQ3PhaseC, STR_varh, 112, 2, SunSpecPointDescriptor::NO_SCALE_FACTOR, SunSpecPointType::FLOAT32},
+  {STR_totalVArHoursExportedQ4, STR_varh, 114, 2, SunSpecPointDescriptor::NO_SCALE_FACTOR, SunSpecPointType::FLOAT32},
+  {STR_totalVArHoursExportedQ4ImportedPhaseA, STR_varh, 116, 2, SunSpecPointDescriptor::NO_SCALE_FACTOR, SunSpecPointType::FLOAT32},
+  {STR_totalVArHoursExportedQ4ImportedPhaseB, STR_varh, 118, 2, SunSpecPointDescriptor::NO_SCALE_FACTOR, SunSpecPointType::FLOAT32},
+  {STR_totalVArHoursExportedQ4ImportedPhaseC, STR_varh, 120, 2, SunSpecPointDescriptor::NO_SCALE_FACTOR, SunSpecPointType::FLOAT32},
+  {STR_events, nullptr, 122, 2, SunSpecPointDescriptor::NO_SCALE_FACTOR, SunSpecPointType::BITFIELD32},
+};
+
+SunSpecPointTable SinglePhaseANOrABMeter::pointTable() {
+  return {211, 124, 0, POINTS_211, 62, nullptr, nullptr, 0};
+}
+
+SunSpecPointDescriptor const POINTS_212[] PROGMEM = {
+  {STR_amps, STR_A, 0, 2, SunSpecPointDescriptor::NO_SCALE_FACTOR, SunSpecPointType::FLOAT32},
+  {STR_ampsPhaseA, STR_A, 2, 2, SunSpecPointDescriptor::NO_SCALE_FACTOR, SunSpecPointType::FLOAT32},
+  {STR_ampsPhaseB, STR_A, 4, 2, SunSpecPointDescriptor::NO_SCALE_FACTOR, SunSpecPointType::FLOAT32},
+  {STR_ampsPhaseC, STR_A, 6, 2, SunSpecPointDescriptor::NO_SCALE_FACTOR, SunSpecPointType::FLOAT32},
+  {STR_voltageLN, STR_V, 8, 2, SunSpecPointDescriptor::NO_SCALE_FACTOR, SunSpecPointType::FLOAT32},
+  {STR_phaseVoltageAN, STR_V, 10, 2, SunSpecPointDescriptor::NO_SCALE_FACTOR, SunSpecPointType::FLOAT32},
+  {STR_phaseVoltageBN, STR_V, 12, 2, SunSpecPointDescriptor::NO_SCALE_FACTOR, SunSpecPointType::FLOAT32},
+  {STR_phaseVoltageCN, STR_V, 14, 2, SunSpecPointDescriptor::NO_SCALE_FACTOR, SunSpecPointType::FLOAT32},
+  {STR_voltageLL, STR_V, 16, 2, SunSpecPointDescriptor::NO_SCALE_FACTOR, SunSpecPointType::FLOAT32},
+  {STR_phaseVoltageAB, STR_V, 18, 2, SunSpecPointDescriptor::NO_SCALE_FACTOR, SunSpecPointType::FLOAT32},
+  {STR_phaseVoltageBC, STR_V, 20, 2, SunSpecPointDescriptor::NO_SCALE_FACTOR, SunSpecPointType::FLOAT32},
+  {STR_phaseVoltageCA, STR_V, 22, 2, SunSpecPointDescriptor::NO_SCALE_FACTOR, SunSpecPointType::FLOAT32},
+  {STR_hz, STR_Hz, 24, 2, SunSpecPointDescriptor::NO_SCALE_FACTOR, SunSpecPointType::FLOAT32},
+  {STR_watts, STR_W, 26, 2, SunSpecPointDescriptor::NO_SCALE_FACTOR, SunSpecPointType::FLOAT32},
+  {STR_wattsPhaseA, STR_W, 28, 2, SunSpecPointDescriptor::NO_SCALE_FACTOR, SunSpecPointType::FLOAT32},
+  {STR_wattsPhaseB, STR_W, 30, 2, SunSpecPointDescriptor::NO_SCALE_FACTOR, SunSpecPointType::FLOAT32},
+  {STR_wattsPhaseC, STR_W, 32, 2, SunSpecPointDescriptor::NO_SCALE_FACTOR, SunSpecPointType::FLOAT32},
+  {STR_VA, STR_VA, 34, 2, SunSpecPointDescriptor::NO_SCALE_FACTOR, SunSpecPointType::FLOAT32},
+  {STR_VAPhaseA, STR_VA, 36, 2, SunSpecPointDescriptor::NO_SCALE_FACTOR, SunSpecPointType::FLOAT32},
+  {STR_VAPhaseB, STR_VA, 38, 2, SunSpecPointDescriptor::NO_SCALE_FACTOR, SunSpecPointType::FLOAT32},
+  {STR_VAPhaseC, STR_VA, 40, 2, SunSpecPointDescriptor::NO_SCALE_FACTOR, SunSpecPointType::FLOAT32},
+  {STR_VAR, STR_var, 42, 2, SunSpecPointDescriptor::NO_SCALE_FACTOR, SunSpecPointType::FLOAT32},
+  {STR_VARPhaseA, STR_var, 44, 2, SunSpecPointDescriptor::NO_SCALE_FACTOR, SunSpecPointType::FLOAT32},
+  {STR_VARPhaseB, STR_var, 46, 2, SunSpecPointDescriptor::NO_SCALE_FACTOR, SunSpecPointType::FLOAT32},
+  {STR_VARPhaseC, STR_var, 48, 2, SunSpecPointDescriptor::NO_SCALE_FACTOR, SunSpecPointType::FLOAT32},
+  {STR_PF, STR_PF, 50, 2, SunSpecPointDescriptor::NO_SCALE_FACTOR, SunSpecPointType::FLOAT32},
+  {STR_PFPhaseA, STR_PF, 52, 2, SunSpecPointDescriptor::NO_SCALE_FACTOR, SunSpecPointType::FLOAT32},
+  {STR_PFPhaseB, STR_PF, 54, 2, SunSpecPointDescriptor::NO_SCALE_FACTOR, SunSpecPointType::FLOAT32},
+  {STR_PFPhaseC, STR_PF, 56, 2, SunSpecPointDescriptor::NO_SCALE_FACTOR, SunSpecPointType::FLOAT32},
+  {STR_totalWattHoursExported, STR_Wh, 58, 2, SunSpecPointDescriptor::NO_SCALE_FACTOR, SunSpecPointType::FLOAT32},
+  {STR_totalWattHoursExportedPhaseA, STR_Wh, 60, 2, SunSpecPointDescriptor::NO_SCALE_FACTOR, SunSpecPointType::FLOAT32},
+  {STR_totalWattHoursExportedPhaseB, STR_Wh, 62, 2, SunSpecPointDescriptor::NO_SCALE_FACTOR, SunSpecPointType::FLOAT32},
+  {STR_totalWattHoursExportedPhaseC, STR_Wh, 64, 2, SunSpecPointDescriptor::NO_SCALE_FACTOR, SunSpecPointType::FLOAT32},
+  {STR_totalWattHoursImported, STR_Wh, 66, 2, SunSpecPointDescriptor::NO_SCALE_FACTOR, SunSpecPointType::FLOAT32},
+  {STR_totalWattHoursImportedPhaseA, STR_Wh, 68, 2, SunSpecPointDescriptor::NO_SCALE_FACTOR, SunSpecPointType::FLOAT32},
+  {STR_totalWattHoursImportedPhaseB, STR_Wh, 70, 2, SunSpecPointDescriptor::NO_SCALE_FACTOR, SunSpecPointType::FLOAT32},
+  {STR_totalWattHoursImportedPhaseC, STR_Wh, 72, 2, SunSpecPointDescriptor::NO_SCALE_FACTOR, SunSpecPointType::FLOAT32},
+  {STR_totalVAHoursExported, STR_VAh, 74, 2, SunSpecPointDescriptor::NO_SCALE_FACTOR, SunSpecPointType::FLOAT32},
+  {STR_totalVAHoursExportedPhaseA, STR_VAh, 76, 2, SunSpecPointDescriptor::NO_SCALE_FACTOR, SunSpecPointType::FLOAT32},
+  {STR_totalVAHoursExportedPhaseB, STR_VAh, 78, 2, SunSpecPointDescriptor::NO_SCALE_FACTOR, SunSpecPointType::FLOAT32},
+  {STR_totalVAHoursExportedPhaseC, STR_VAh, 80, 2, SunSpecPointDescriptor::NO_SCALE_FACTOR, SunSpecPointType::FLOAT32},
+  {STR_totalVAHoursImported, STR_VAh, 82, 2, SunSpecPointDescriptor::NO_SCALE_FACTOR, SunSpecPointType::FLOAT32},
+  {STR_totalVAHoursImportedPhaseA, STR_VAh, 84, 2, SunSpecPointDescriptor::NO_SCALE_FACTOR, SunSpecPointType::FLOAT32},
+  {STR_totalVAHoursImportedPhaseB, STR_VAh, 86, 2, SunSpecPointDescriptor::NO_SCALE_FACTOR, SunSpecPointType::FLOAT32},
+  {STR_totalVAHoursImportedPhaseC, STR_VAh, 88, 2, SunSpecPointDescriptor::NO_SCALE_FACTOR, SunSpecPointType::FLOAT32},
+  {STR_totalVARHoursImportedQ1, STR_varh, 90, 2, SunSpecPointDescriptor::NO_SCALE_FACTOR, SunSpecPointType::FLOAT32},
+  {STR_totalVArHoursImportedQ1PhaseA, STR_varh, 92, 2, SunSpecPointDescriptor::NO_SCALE_FACTOR, SunSpecPointType::FLOAT32},
+  {STR_totalVArHoursImportedQ1PhaseB, STR_varh, 94, 2, SunSpecPointDescriptor::NO_SCALE_FACTOR, SunSpecPointType::FLOAT32},
+  {STR_totalVArHoursImportedQ1PhaseC, STR_varh, 96, 2, SunSpecPointDescriptor::NO_SCALE_FACTOR, SunSpecPointType::FLOAT32},
+  {STR_totalVArHoursImportedQ2, STR_varh, 98, 2, SunSpecPointDescriptor::NO_SCALE_FACTOR, SunSpecPointType::FLOAT32},
+  {STR_totalVArHoursImportedQ2PhaseA, STR_varh, 100, 2, SunSpecPointDescriptor::NO_SCALE_FACTOR, SunSpecPointType::FLOAT32},
+  {STR_totalVArHoursImportedQ2PhaseB, STR_varh, 102, 2, SunSpecPointDescriptor::NO_SCALE_FACTOR, SunSpecPointType::FLOAT32},
+  {STR_totalVArHoursImportedQ2PhaseC, STR_varh, 104, 2, SunSpecPointDescriptor::NO_SCALE_FACTOR, SunSpecPointType::FLOAT32},
+  {STR_totalVArHoursExportedQ3, STR_varh, 106, 2, SunSpecPointDescriptor::NO_SCALE_FACTOR, SunSpecPointType::FLOAT32},
+  {STR_totalVArHoursExportedQ3PhaseA, STR_varh, 108, 2, SunSpecPointDescriptor::NO_SCALE_FACTOR, SunSpecPointType::FLOAT32},
+  {STR_totalVArHoursExportedQ3PhaseB, STR_varh, 110, 2, SunSpecPointDescriptor::NO_SCALE_FACTOR, SunSpecPointType::FLOAT32},
+  {STR_totalVArHoursExportedQ3PhaseC, STR_varh, 112, 2, SunSpecPointDescriptor::NO_SCALE_FACTOR, SunSpecPointType::FLOAT32},
+  {STR_totalVArHoursExportedQ4, STR_varh, 114, 2, SunSpecPointDescriptor::NO_SCALE_FACTOR, SunSpecPointType::FLOAT32},
+  {STR_totalVArHoursExportedQ4ImportedPhaseA, STR_varh, 116, 2, SunSpecPointDescriptor::NO_SCALE_FACTOR, SunSpecPointType::FLOAT32},
+  {STR_totalVArHoursExportedQ4ImportedPhaseB, STR_varh, 118, 2, SunSpecPointDescriptor::NO_SCALE_FACTOR, SunSpecPointType::FLOAT32},
+  {STR_totalVArHoursExportedQ4ImportedPhaseC, STR_varh, 120, 2, SunSpecPointDescriptor::NO_SCALE_FACTOR, SunSpecPointType::FLOAT32},
+  {STR_events, nullptr, 122, 2, SunSpecPointDescriptor::NO_SCALE_FACTOR, SunSpecPointType::BITFIELD32},
+};
+
+SunSpecPointTable SplitSinglePhaseABNMeter_212::pointTable() {
+  return {212, 124, 0, POINTS_212, 62, nullptr, nullptr, 0};
+}
+
+SunSpecPointDescriptor const POINTS_213[] PROGMEM = {
+  {STR_amps, STR_A, 0, 2, SunSpecPointDescriptor::NO_SCALE_FACTOR, SunSpecPointType::FLOAT32},
+  {STR_ampsPhaseA, STR_A, 2, 2, SunSpecPointDescriptor::NO_SCALE_FACTOR, SunSpecPointType::FLOAT32},
+  {STR_ampsPhaseB, STR_A, 4, 2, SunSpecPointDescriptor::NO_SCALE_FACTOR, SunSpecPointType::FLOAT32},
+  {STR_ampsPhaseC, STR_A, 6, 2, SunSpecPointDescriptor::NO_SCALE_FACTOR, SunSpecPointType::FLOAT32},
+  {STR_voltageLN, STR_V, 8, 2, SunSpecPointDescriptor::NO_SCALE_FACTOR, SunSpecPointType::FLOAT32},
+  {STR_phaseVoltageAN, STR_V, 10, 2, SunSpecPointDescriptor::NO_SCALE_FACTOR, SunSpecPointType::FLOAT32},
+  {STR_phaseVoltageBN, STR_V, 12, 2, SunSpecPointDescriptor::NO_SCALE_FACTOR, SunSpecPointType::FLOAT32},
+  {STR_phaseVoltageCN, STR_V, 14, 2, SunSpecPointDescriptor::NO_SCALE_FACTOR, SunSpecPointType::FLOAT32},
+  {STR_voltageLL, STR_V, 16, 2, SunSpecPointDescriptor::NO_SCALE_FACTOR, SunSpecPointType::FLOAT32},
+  {STR_phaseVoltageAB, STR_V, 18, 2, SunSpecPointDescriptor::NO_SCALE_FACTOR, SunSpecPointType::FLOAT32},
+  {STR_phaseVoltageBC, STR_V, 20, 2, SunSpecPointDescriptor::NO_SCALE_FACTOR, SunSpecPointType::FLOAT32},
+  {STR_phaseVoltageCA, STR_V, 22, 2, SunSpecPointDescriptor::NO_SCALE_FACTOR, SunSpecPointType::FLOAT32},
+  {STR_hz, STR_Hz, 24, 2, SunSpecPointDescriptor::NO_SCALE_FACTOR, SunSpecPointType::FLOAT32},
+  {STR_watts, STR_W, 26, 2, SunSpecPointDescriptor::NO_SCALE_FACTOR, SunSpecPointType::FLOAT32},
+  {STR_wattsPhaseA, STR_W, 28, 2, SunSpecPointDescriptor::NO_SCALE_FACTOR, SunSpecPointType::FLOAT32},
+  {STR_wattsPhaseB, STR_W, 30, 2, SunSpecPointDescriptor::NO_SCALE_FACTOR, SunSpecPointType::FLOAT32},
+  {STR_wattsPhaseC, STR_W, 32, 2, SunSpecPointDescriptor::NO_SCALE_FACTOR, SunSpecPointType::FLOAT32},
+  {STR_VA, STR_VA, 34, 2, SunSpecPointDescriptor::NO_SCALE_FACTOR, SunSpecPointType::FLOAT32},
+  {STR_VAPhaseA, STR_VA, 36, 2, SunSpecPointDescriptor::NO_SCALE_FACTOR, SunSpecPointType::FLOAT32},
+  {STR_VAPhaseB, STR_VA, 38, 2, SunSpecPointDescriptor::NO_SCALE_FACTOR, SunSpecPointType::FLOAT32},
+  {STR_VAPhaseC, STR_VA, 40, 2, SunSpecPointDescriptor::NO_SCALE_FACTOR, SunSpecPointType::FLOAT32},
+  {STR_VAR, STR_var, 42, 2, SunSpecPointDescriptor::NO_SCALE_FACTOR, SunSpecPointType::FLOAT32},
+  {STR_VARPhaseA, STR_var, 44, 2, SunSpecPointDescriptor::NO_SCALE_FACTOR, SunSpecPointType::FLOAT32},
+  {STR_VARPhaseB, STR_var, 46, 2, SunSpecPointDescriptor::NO_SCALE_FACTOR, SunSpecPointType::FLOAT32},
+  {STR_VARPhaseC, STR_var, 48, 2, SunSpecPointDescriptor::NO_SCALE_FACTOR, SunSpecPointType::FLOAT32},
+  {STR_PF, STR_PF, 50, 2, SunSpecPointDescriptor::NO_SCALE_FACTOR, SunSpecPointType::FLOAT32},
+  {STR_PFPhaseA, STR_PF, 52, 2, SunSpecPointDescriptor::NO_SCALE_FACTOR, SunSpecPointType::FLOAT32},
+  {STR_PFPhaseB, STR_PF, 54, 2, SunSpecPointDescriptor::NO_SCALE_FACTOR, SunSpecPointType::FLOAT32},
+  {STR_PFPhaseC, STR_PF, 56, 2, SunSpecPointDescriptor::NO_SCALE_FACTOR, SunSpecPointType::FLOAT32},
+  {STR_totalWattHoursExported, STR_Wh, 58, 2, SunSpecPointDescriptor::NO_SCALE_FACTOR, SunSpecPointType::FLOAT32},
+  {STR_totalWattHoursExportedPhaseA, STR_Wh, 60, 2, SunSpecPointDescriptor::NO_SCALE_FACTOR, SunSpecPointType::FLOAT32},
+  {STR_totalWattHoursExportedPhaseB, STR_Wh, 62, 2, SunSpecPointDescriptor::NO_SCALE_FACTOR, SunSpecPointType::FLOAT32},
+  {STR_totalWattHoursExportedPhaseC, STR_Wh, 64, 2, SunSpecPointDescriptor::NO_SCALE_FACTOR, SunSpecPointType::FLOAT32},
+  {STR_totalWattHoursImported, STR_Wh, 66, 2, SunSpecPointDescriptor::NO_SCALE_FACTOR, SunSpecPointType::FLOAT32},
+  {STR_totalWattHoursImportedPhaseA, STR_Wh, 68, 2, SunSpecPointDescriptor::NO_SCALE_FACTOR, SunSpecPointType::FLOAT32},
+  {STR_totalWattHoursImportedPhaseB, STR_Wh, 70, 2, SunSpecPointDescriptor::NO_SCALE_FACTOR, SunSpecPointType::FLOAT32},
+  {STR_totalWattHoursImportedPhaseC, STR_Wh, 72, 2, SunSpecPointDescriptor::NO_SCALE_FACTOR, SunSpecPointType::FLOAT32},
+  {STR_totalVAHoursExported, STR_VAh, 74, 2, SunSpecPointDescriptor::NO_SCALE_FACTOR, SunSpecPointType::FLOAT32},
+  {STR_totalVAHoursExportedPhaseA, STR_VAh, 76, 2, SunSpecPointDescriptor::NO_SCALE_FACTOR, SunSpecPointType::FLOAT32},
+  {STR_totalVAHoursExportedPhaseB, STR_VAh, 78, 2, SunSpecPointDescriptor::NO_SCALE_FACTOR, SunSpecPointType::FLOAT32},
+  {STR_totalVAHoursExportedPhaseC, STR_VAh, 80, 2, SunSpecPointDescriptor::NO_SCALE_FACTOR, SunSpecPointType::FLOAT32},
+  {STR_totalVAHoursImported, STR_VAh, 82, 2, SunSpecPointDescriptor::NO_SCALE_FACTOR, SunSpecPointType::FLOAT32},
+  {STR_totalVAHoursImportedPhaseA, STR_VAh, 84, 2, SunSpecPointDescriptor::NO_SCALE_FACTOR, SunSpecPointType::FLOAT32},
+  {STR_totalVAHoursImportedPhaseB, STR_VAh, 86, 2, SunSpecPointDescriptor::NO_SCALE_FACTOR, SunSpecPointType::FLOAT32},
+  {STR_totalVAHoursImportedPhaseC, STR_VAh, 88, 2, SunSpecPointDescriptor::NO_SCALE_FACTOR, SunSpecPointType::FLOAT32},
+  {STR_totalVARHoursImportedQ1, STR_varh, 90, 2, SunSpecPointDescriptor::NO_SCALE_FACTOR, SunSpecPointType::FLOAT32},
+  {STR_totalVArHoursImportedQ1PhaseA, STR_varh, 92, 2, SunSpecPointDescriptor::NO_SCALE_FACTOR, SunSpecPointType::FLOAT32},
+  {STR_totalVArHoursImportedQ1PhaseB, STR_varh, 94, 2, SunSpecPointDescriptor::NO_SCALE_FACTOR, SunSpecPointType::FLOAT32},
+  {STR_totalVArHoursImportedQ1PhaseC, STR_varh, 96, 2, SunSpecPointDescriptor::NO_SCALE_FACTOR, SunSpecPointType::FLOAT32},
+  {STR_totalVArHoursImportedQ2, STR_varh, 98, 2, SunSpecPointDescriptor::NO_SCALE_FACTOR, SunSpecPointType::FLOAT32},
+  {STR_totalVArHoursImportedQ2PhaseA, STR_varh, 100, 2, SunSpecPointDescriptor::NO_SCALE_FACTOR, SunSpecPointType::FLOAT32},
+  {STR_totalVArHoursImportedQ2PhaseB, STR_varh, 102, 2, SunSpecPointDescriptor::NO_SCALE_FACTOR, SunSpecPointType::FLOAT32},
+  {STR_totalVArHoursImportedQ2PhaseC, STR_varh, 104, 2, SunSpecPointDescriptor::NO_SCALE_FACTOR, SunSpecPointType::FLOAT32},
+  {STR_totalVArHoursExportedQ3, STR_varh, 106, 2, SunSpecPointDescriptor::NO_SCALE_FACTOR, SunSpecPointType::FLOAT32},
+  {STR_totalVArHoursExportedQ3PhaseA, STR_varh, 108, 2, SunSpecPointDescriptor::NO_SCALE_FACTOR, SunSpecPointType::FLOAT32},
+  {STR_totalVArHoursExportedQ3PhaseB, STR_varh, 110, 2, SunSpecPointDescriptor::NO_SCALE_FACTOR, SunSpecPointType::FLOAT32},
+  {STR_totalVArHoursExportedQ3PhaseC, STR_varh, 112, 2, SunSpecPointDescriptor::NO_SCALE_FACTOR, SunSpecPointType::FLOAT32},
+  {STR_totalVArHoursExportedQ4, STR_varh, 114, 2, SunSpecPointDescriptor::NO_SCALE_FACTOR, SunSpecPointType::FLOAT32},
+  {STR_totalVArHoursExportedQ4ImportedPhaseA, STR_varh, 116, 2, SunSpecPointDescriptor::NO_SCALE_FACTOR, SunSpecPointType::FLOAT32},
+  {STR_totalVArHoursExportedQ4ImportedPhaseB, STR_varh, 118, 2, SunSpecPointDescriptor::NO_SCALE_FACTOR, SunSpecPointType::FLOAT32},
+  {STR_totalVArHoursExportedQ4ImportedPhaseC, STR_varh, 120, 2, SunSpecPointDescriptor::NO_SCALE_FACTOR, SunSpecPointType::FLOAT32},
+  {STR_events, nullptr, 122, 2, SunSpecPointDescriptor::NO_SCALE_FACTOR, SunSpecPointType::BITFIELD32},
+};
+
+SunSpecPointTable WyeConnectThreePhaseAbcnMeter_213::pointTable() {
+  return {213, 124, 0, POINTS_213, 62, nullptr, nullptr, 0};
+}
+
+SunSpecPointDescriptor const POINTS_214[] PROGMEM = {
+  {STR_amps, STR_A, 0, 2, SunSpecPointDescriptor::NO_SCALE_FACTOR, SunSpecPointType::FLOAT32},
+  {STR_ampsPhaseA, STR_A, 2, 2, SunSpecPointDescriptor::NO_SCALE_FACTOR, SunSpecPointType::FLOAT32},
+  {STR_ampsPhaseB, STR_A, 4, 2, SunSpecPointDescriptor::NO_SCALE_FACTOR, SunSpecPointType::FLOAT32},
+  {STR_ampsPhaseC, STR_A, 6, 2, SunSpecPointDescriptor::NO_SCALE_FACTOR, SunSpecPointType::FLOAT32},
+  {STR_voltageLN, STR_V, 8, 2, SunSpecPointDescriptor::NO_SCALE_FACTOR, SunSpecPointType::FLOAT32},
+  {STR_phaseVoltageAN, STR_V, 10, 2, SunSpecPointDescriptor::NO_SCALE_FACTOR, SunSpecPointType::FLOAT32},
+  {STR_phaseVoltageBN, STR_V, 12, 2, SunSpecPointDescriptor::NO_SCALE_FACTOR, SunSpecPointType::FLOAT32},
+  {STR_phaseVoltageCN, STR_V, 14, 2, SunSpecPointDescriptor::NO_SCALE_FACTOR, SunSpecPointType::FLOAT32},
+  {STR_voltageLL, STR_V, 16, 2, SunSpecPointDescriptor::NO_SCALE_FACTOR, SunSpecPointType::FLOAT32},
+  {STR_phaseVoltageAB, STR_V, 18, 2, SunSpecPointDescriptor::NO_SCALE_FACTOR, SunSpecPointType::FLOAT32},
+  {STR_phaseVoltageBC, STR_V, 20, 2, SunSpecPointDescriptor::NO_SCALE_FACTOR, SunSpecPointType::FLOAT32},
+  {STR_phaseVoltageCA, STR_V, 22, 2, SunSpecPointDescriptor::NO_SCALE_FACTOR, SunSpecPointType::FLOAT32},
+  {STR_hz, STR_Hz, 24, 2, SunSpecPointDescriptor::NO_SCALE_FACTOR, SunSpecPointType::FLOAT32},
+  {STR_watts, STR_W, 26, 2, SunSpecPointDescriptor::NO_SCALE_FACTOR, SunSpecPointType::FLOAT32},
+  {STR_wattsPhaseA, STR_W, 28, 2, SunSpecPointDescriptor::NO_SCALE_FACTOR, SunSpecPointType::FLOAT32},
+  {STR_wattsPhaseB, STR_W, 30, 2, SunSpecPointDescriptor::NO_SCALE_FACTOR, SunSpecPointType::FLOAT32},
+  {STR_wattsPhaseC, STR_W, 32, 2, SunSpecPointDescriptor::NO_SCALE_FACTOR, SunSpecPointType::FLOAT32},
+  {STR_VA, STR_VA, 34, 2, SunSpecPointDescriptor::NO_SCALE_FACTOR, SunSpecPointType::FLOAT32},
+  {STR_VAPhaseA, STR_VA, 36, 2, SunSpecPointDescriptor::NO_SCALE_FACTOR, SunSpecPointType::FLOAT32},
+  {STR_VAPhaseB, STR_VA, 38, 2, SunSpecPointDescriptor::NO_SCALE_FACTOR, SunSpecPointType::FLOAT32},
+  {STR_VAPhaseC, STR_VA, 40, 2, SunSpecPointDescriptor::NO_SCALE_FACTOR, SunSpecPointType::FLOAT32},
+  {STR_VAR, STR_var, 42, 2, SunSpecPointDescriptor::NO_SCALE_FACTOR, SunSpecPointType::FLOAT32},
+  {STR_VARPhaseA, STR_var, 44, 2, SunSpecPointDescriptor::NO_SCALE_FACTOR, SunSpecPointType::FLOAT32},
+  {STR_VARPhaseB, STR_var, 46, 2, SunSpecPointDescriptor::NO_SCALE_FACTOR, SunSpecPointType::FLOAT32},
+  {STR_VARPhaseC, STR_var, 48, 2, SunSpecPointDescriptor::NO_SCALE_FACTOR, SunSpecPointType::FLOAT32},
+  {STR_PF, STR_PF, 50, 2, SunSpecPointDescriptor::NO_SCALE_FACTOR, SunSpecPointType::FLOAT32},
+  {STR_PFPhaseA, STR_PF, 52, 2, SunSpecPointDescriptor::NO_SCALE_FACTOR, SunSpecPointType::FLOAT32},
+  {STR_PFPhaseB, STR_PF, 54, 2, SunSpecPointDescriptor::NO_SCALE_FACTOR, SunSpecPointType::FLOAT32},
+  {STR_PFPhaseC, STR_PF, 56, 2, SunSpecPointDescriptor::NO_SCALE_FACTOR, SunSpecPointType::FLOAT32},
+  {STR_totalWattHoursExported, STR_Wh, 58, 2, SunSpecPointDescriptor::NO_SCALE_FACTOR, SunSpecPointType::FLOAT32},
+  {STR_totalWattHoursExportedPhaseA, STR_Wh, 60, 2, SunSpecPointDescriptor::NO_SCALE_FACTOR, SunSpecPointType::FLOAT32},
+  {STR_totalWattHoursExportedPhaseB, STR_Wh, 62, 2, SunSpecPointDescriptor::NO_SCALE_FACTOR, SunSpecPointType::FLOAT32},
+  {STR_totalWattHoursExportedPhaseC, STR_Wh, 64, 2, SunSpecPointDescriptor::NO_SCALE_FACTOR, SunSpecPointType::FLOAT32},
+  {STR_totalWattHoursImported, STR_Wh, 66, 2, SunSpecPointDescriptor::NO_SCALE_FACTOR, SunSpecPointType::FLOAT32},
+  {STR_totalWattHoursImportedPhaseA, STR_Wh, 68, 2, SunSpecPointDescriptor::NO_SCALE_FACTOR, SunSpecPointType::FLOAT32},
+  {STR_totalWattHoursImportedPhaseB, STR_Wh, 70, 2, SunSpecPointDescriptor::NO_SCALE_FACTOR, SunSpecPointType::FLOAT32},
+  {STR_totalWattHoursImportedPhaseC, STR_Wh, 72, 2, SunSpecPointDescriptor::NO_SCALE_FACTOR, SunSpecPointType::FLOAT32},
+  {STR_totalVAHoursExported, STR_VAh, 74, 2, SunSpecPointDescriptor::NO_SCALE_FACTOR, SunSpecPointType::FLOAT32},
+  {STR_totalVAHoursExportedPhaseA, STR_VAh, 76, 2, SunSpecPointDescriptor::NO_SCALE_FACTOR, SunSpecPointType::FLOAT32},
+  {STR_totalVAHoursExportedPhaseB, STR_VAh, 78, 2, SunSpecPointDescriptor::NO_SCALE_FACTOR, SunSpecPointType::FLOAT32},
+  {STR_totalVAHoursExportedPhaseC, STR_VAh, 80, 2, SunSpecPointDescriptor::NO_SCALE_FACTOR, SunSpecPointType::FLOAT32},
+  {STR_totalVAHoursImported, STR_VAh, 82, 2, SunSpecPointDescriptor::NO_SCALE_FACTOR, SunSpecPointType::FLOAT32},
+  {STR_totalVAHoursImportedPhaseA, STR_VAh, 84, 2, SunSpecPointDescriptor::NO_SCALE_FACTOR, SunSpecPointType::FLOAT32},
+  {STR_totalVAHoursImportedPhaseB, STR_VAh, 86, 2, SunSpecPointDescriptor::NO_SCALE_FACTOR, SunSpecPointType::FLOAT32},
+  {STR_totalVAHoursImportedPhaseC, STR_VAh, 88, 2, SunSpecPointDescriptor::NO_SCALE_FACTOR, SunSpecPointType::FLOAT32},
+  {STR_totalVARHoursImportedQ1, STR_varh, 90, 2, SunSpecPointDescriptor::NO_SCALE_FACTOR, SunSpecPointType::FLOAT32},
+  {STR_totalVArHoursImportedQ1PhaseA, STR_varh, 92, 2, SunSpecPointDescriptor::NO_SCALE_FACTOR, SunSpecPointType::FLOAT32},
+  {STR_totalVArHoursImportedQ1PhaseB, STR_varh, 94, 2, SunSpecPointDescriptor::NO_SCALE_FACTOR, SunSpecPointType::FLOAT32},
+  {STR_totalVArHoursImportedQ1PhaseC, STR_varh, 96, 2, SunSpecPointDescriptor::NO_SCALE_FACTOR, SunSpecPointType::FLOAT32},
+  {STR_totalVArHoursImportedQ2, STR_varh, 98, 2, SunSpecPointDescriptor::NO_SCALE_FACTOR, SunSpecPointType::FLOAT32},
+  {STR_totalVArHoursImportedQ2PhaseA, STR_varh, 100, 2, SunSpecPointDescriptor::NO_SCALE_FACTOR, SunSpecPointType::FLOAT32},
+  {STR_totalVArHoursImportedQ2PhaseB, STR_varh, 102, 2, SunSpecPointDescriptor::NO_SCALE_FACTOR, SunSpecPointType::FLOAT32},
+  {STR_totalVArHoursImportedQ2PhaseC, STR_varh, 104, 2, SunSpecPointDescriptor::NO_SCALE_FACTOR, SunSpecPointType::FLOAT32},
+  {STR_totalVArHoursExportedQ3, STR_varh, 106, 2, SunSpecPointDescriptor::NO_SCALE_FACTOR, SunSpecPointType::FLOAT32},
+  {STR_totalVArHoursExportedQ3PhaseA, STR_varh, 108, 2, SunSpecPointDescriptor::NO_SCALE_FACTOR, SunSpecPointType::FLOAT32},
+  {STR_totalVArHoursExportedQ3PhaseB, STR_varh, 110, 2, SunSpecPointDescriptor::NO_SCALE_FACTOR, SunSpecPointType::FLOAT32},
+  {STR_totalVArHoursExportedQ3PhaseC, STR_varh, 112, 2, SunSpecPointDescriptor::NO_SCALE_FACTOR, SunSpecPointType::FLOAT32},
+  {STR_totalVArHoursExportedQ4, STR_varh, 114, 2, SunSpecPointDescriptor::NO_SCALE_FACTOR, SunSpecPointType::FLOAT32},
+  {STR_totalVArHoursExportedQ4ImportedPhaseA, STR_varh, 116, 2, SunSpecPointDescriptor::NO_SCALE_FACTOR, SunSpecPointType::FLOAT32},
+  {STR_totalVArHoursExportedQ4ImportedPhaseB, STR_varh, 118, 2, SunSpecPointDescriptor::NO_SCALE_FACTOR, SunSpecPointType::FLOAT32},
+  {STR_totalVArHoursExportedQ4ImportedPhaseC, STR_varh, 120, 2, SunSpecPointDescriptor::NO_SCALE_FACTOR, SunSpecPointType::FLOAT32},
+  {STR_events, nullptr, 122, 2, SunSpecPointDescriptor::NO_SCALE_FACTOR, SunSpecPointType::BITFIELD32},
+};
+
+SunSpecPointTable DeltaConnectThreePhaseAbcMeter_214::pointTable() {
+  return {214, 124, 0, POINTS_214, 62, nullptr, nullptr, 0};
+}
+
+SunSpecPointDescriptor const POINTS_305[] PROGMEM = {
+  {STR_tm, STR_hhmmss_sssZ, 0, 6, SunSpecPointDescriptor::NO_SCALE_FACTOR, SunSpecPointType::STRING},
+  {STR_date, STR_YYYYMMDD, 6, 4, SunSpecPointDescriptor::NO_SCALE_FACTOR, SunSpecPointType::STRING},
+  {STR_location, STR_text, 10, 20, SunSpecPointDescriptor::NO_SCALE_FACTOR, SunSpecPointType::STRING},
+  {STR_lat, STR_Degrees, 30, 2, SunSpecPointDescriptor::NO_SCALE_FACTOR, SunSpecPointType::INT32},
+  {STR_long_, STR_Degrees, 32, 2, SunSpecPointDescriptor::NO_SCALE_FACTOR, SunSpecPointType::INT32},
+  {STR_altitude, STR_meters, 34, 2, SunSpecPointDescriptor::NO_SCALE_FACTOR, SunSpecPointType::INT32},
+};
+
+SunSpecPointTable GPS::pointTable() {
+  return {305, 36, 0, POINTS_305, 6, nullptr, nullptr, 0};
+}
+
+SunSpecPointDescriptor const POINTS_306[] PROGMEM = {
+  {STR_GHI, STR_W_m2, 0, 1, SunSpecPointDescriptor::NO_SCALE_FACTOR, SunSpecPointType::UINT16},
+  {STR_amps, STR_W_m2, 1, 1, SunSpecPointDescriptor::NO_SCALE_FACTOR, SunSpecPointType::UINT16},
+  {STR_voltage, STR_W_m2, 2, 1, SunSpecPointDescriptor::NO_SCALE_FACTOR, SunSpecPointType::UINT16},
+  {STR_temperature, STR_W_m2, 3, 1, SunSpecPointDescriptor::NO_SCALE_FACTOR, SunSpecPointType::UINT16},
+};
+
+SunSpecPointTable ReferencePointModel::pointTable() {
+  return {306, 4, 0, POINTS_306, 4, nullptr, nullptr, 0};
+}
+
+SunSpecPointDescriptor const POINTS_307[] PROGMEM = {
+  {STR_ambientTemperature, STR_C, 0, 1, SunSpecPointDescriptor::NO_SCALE_FACTOR, SunSpecPointType::INT16},
+  {STR_relativeHumidity, STR_Pct, 1, 1, SunSpecPointDescriptor::NO_SCALE_FACTOR, SunSpecPointType::INT16},
+  {STR_barometricPressure, STR_HPa, 2, 1, SunSpecPointDescriptor::NO_SCALE_FACTOR, SunSpecPointType::INT16},
+  {STR_windSpeed, STR_mps, 3, 1, SunSpecPointDescriptor::NO_SCALE_FACTOR, SunSpecPointType::INT16},
+  {STR_windDirection, STR_deg, 4, 1, SunSpecPointDescriptor::NO_SCALE_FACTOR, SunSpecPointType::INT16},
+  {STR_rainfall, STR_mm, 5, 1, SunSpecPointDescriptor::NO_SCALE_FACTOR, SunSpecPointType::INT16},
+  {STR_snowDepth, STR_mm, 6, 1, SunSpecPointDescriptor::NO_SCALE_FACTOR, SunSpecPointType::INT16},
+  {STR_precipitationType, nullptr, 7, 1, SunSpecPointDescriptor::NO_SCALE_FACTOR, SunSpecPointType::INT16},
+  {STR_electricField, STR_Vm, 8, 1, SunSpecPointDescriptor::NO_SCALE_FACTOR, SunSpecPointType::INT16},
+  {STR_surfaceWetness, STR_kO, 9, 1, SunSpecPointDescriptor::NO_SCALE_FACTOR, SunSpecPointType::INT16},
+  {STR_soilWetness, STR_Pct, 10, 1, SunSpecPointDescriptor::NO_SCALE_FACTOR, SunSpecPointType::INT16},
+};
+
+SunSpecPointTable BaseMet::pointTable() {
+  return {307, 11, 0, POINTS_307, 11, nullptr, nullptr, 0};
+}
+
+SunSpecPointDescriptor const POINTS_308[] PROGMEM = {
+  {STR_GHI, STR_W_m2, 0, 1, SunSpecPointDescriptor::NO_SCALE_FACTOR, SunSpecPointType::UINT16},
+  {STR_temp, STR_C, 1, 1, SunSpecPointDescriptor::NO_SCALE_FACTOR, SunSpecPointType::INT16},
+  {STR_ambientTemperature, STR_C, 2, 1, SunSpecPointDescriptor::NO_SCALE_FACTOR, SunSpecPointType::INT16},
+  {STR_windSpeed, STR_m_s, 3, 1, SunSpecPointDescriptor::NO_SCALE_FACTOR, SunSpecPointType::UINT16},
+};
+
+SunSpecPointTable MiniMetModel::pointTable() {
+  return {308, 4, 0, POINTS_308, 4, nullptr, nullptr, 0};
+}
+
+SunSpecPointDescriptor const POINTS_501[] PROGMEM = {
+  {STR_status, nullptr, 0, 1, SunSpecPointDescriptor::NO_SCALE_FACTOR, SunSpecPointType::ENUM16},
+  {STR_vendorStatus, nullptr, 1, 1, SunSpecPointDescriptor::NO_SCALE_FACTOR, SunSpecPointType::ENUM16},
+  {STR_events, nullptr, 2, 2, SunSpecPointDescriptor::NO_SCALE_FACTOR, SunSpecPointType::BITFIELD32},
+  {STR_vendorModuleEventFlags, nullptr, 4, 2, SunSpecPointDescriptor::NO_SCALE_FACTOR, SunSpecPointType::BITFIELD32},
+  {STR_control, nullptr, 6, 1, SunSpecPointDescriptor::NO_SCALE_FACTOR, SunSpecPointType::ENUM16},
+  {STR_vendorControl, nullptr, 7, 2, SunSpecPointDescriptor::NO_SCALE_FACTOR, SunSpecPointType::ENUM32},
+  {STR_controlValue, nullptr, 9, 2, SunSpecPointDescriptor::NO_SCALE_FACTOR, SunSpecPointType::INT32},
+  {STR_timestamp, STR_Secs, 11, 2, SunSpecPointDescriptor::NO_SCALE_FACTOR, SunSpecPointType::UINT32},
+  {STR_outputCurrent, STR_A, 13, 2, SunSpecPointDescriptor::NO_SCALE_FACTOR, SunSpecPointType::FLOAT32},
+  {STR_outputVoltage, STR_V, 15, 2, SunSpecPointDescriptor::NO_SCALE_FACTOR, SunSpecPointType::FLOAT32},
+  {STR_outputEnergy, STR_Wh, 17, 2, SunSpecPointDescriptor::NO_SCALE_FACTOR, SunSpecPointType::FLOAT32},
+  {STR_outputPower, STR_W, 19, 2, SunSpecPointDescriptor::NO_SCALE_FACTOR, SunSpecPointType::FLOAT32},
+  {STR_temp, STR_C, 21, 2, SunSpecPointDescriptor::NO_SCALE_FACTOR, SunSpecPointType::FLOAT32},
+  {STR_inputCurrent, STR_A, 23, 2, SunSpecPointDescriptor::NO_SCALE_FACTOR, SunSpecPointType::FLOAT32},
+  {STR_inputVoltage, STR_V, 25, 2, SunSpecPointDescriptor::NO_SCALE_FACTOR, SunSpecPointType::FLOAT32},
+  {STR_inputEnergy, STR_Wh, 27, 2, SunSpecPointDescriptor::NO_SCALE_FACTOR, SunSpecPointType::FLOAT32},
+  {STR_inputPower, STR_W, 29, 2, SunSpecPointDescriptor::NO_SCALE_FACTOR, SunSpecPointType::FLOAT32},
+};
+
+SunSpecPointTable SolarModule_501::pointTable() {
+  return {501, 31, 0, POINTS_501, 17, nullptr, nullptr, 0};
+}
+
+SunSpecPointDescriptor const POINTS_502[] PROGMEM = {
+  {STR_status, nullptr, 4, 1, SunSpecPointDescriptor::NO_SCALE_FACTOR, SunSpecPointType::ENUM16},
+  {STR_vendorStatus, nullptr, 5, 1, SunSpecPointDescriptor::NO_SCALE_FACTOR, SunSpecPointType::ENUM16},
+  {STR_events, nullptr, 6, 2, SunSpecPointDescriptor::NO_SCALE_FACTOR, SunSpecPointType::BITFIELD32},
+  {STR_vendorModuleEventFlags, nullptr, 8, 2, SunSpecPointDescriptor::NO_SCALE_FACTOR, SunSpecPointType::BITFIELD32},
+  {STR_control, nullptr, 10, 1, SunSpecPointDescriptor::NO_SCALE_FACTOR, SunSpecPointType::ENUM16},
+  {STR_vendorControl, nullptr, 11, 2, SunSpecPointDescriptor::NO_SCALE_FACTOR, SunSpecPointType::ENUM32},
+  {STR_controlValue, nullptr, 13, 2, SunSpecPointDescriptor::NO_SCALE_FACTOR, SunSpecPointType::INT32},
+  {STR_timestamp, STR_Secs, 15, 2, SunSpecPointDescriptor::NO_SCALE_FACTOR, SunSpecPointType::UINT32},
+  {STR_outputCurrent, STR_A, 17, 1, 0, SunSpecPointType::INT16},
+  {STR_outputVoltage, STR_V, 18, 1, 1, SunSpecPointType::INT16},
+  {STR_outputEnergy, STR_Wh, 19, 2, 3, SunSpecPointType::ACC32},
+  {STR_outputPower, STR_W, 21, 1, 2, SunSpecPointType::INT16},
+  {STR_temp, STR_C, 22, 1, SunSpecPointDescriptor::NO_SCALE_FACTOR, SunSpecPointType::INT16},
+  {STR_inputCurrent, STR_A, 23, 1, 0, SunSpecPointType::INT16},
+  {STR_inputVoltage, STR_V, 24, 1, 1, SunSpecPointType::INT16},
+  {STR_inputEnergy, STR_Wh, 25, 2, 3, SunSpecPointType::ACC32},
+  {STR_inputPower, STR_W, 27, 1, 2, SunSpecPointType::INT16},
+};
+
+SunSpecPointTable SolarModule_502::pointTable() {
+  return {502, 28, 0, POINTS_502, 17, nullptr, nullptr, 0};
+}
+
+SunSpecPointDescriptor const POINTS_701[] PROGMEM = {
+  {STR_ACWiringType, nullptr, 0, 1, SunSpecPointDescriptor::NO_SCALE_FACTOR, SunSpecPointType::ENUM16},
+  {STR_operatingState, nullptr, 1, 1, SunSpecPointDescriptor::NO_SCALE_FACTOR, SunSpecPointType::ENUM16},
+  {STR_inverterState, nullptr, 2, 1, SunSpecPointDescriptor::NO_SCALE_FACTOR, SunSpecPointType::ENUM16},
+  {STR_gridConnectionState, nullptr, 3, 1, SunSpecPointDescriptor::NO_SCALE_FACTOR, SunSpecPointType::ENUM16},
+  {STR_alarmBitfield, nullptr, 4, 2, SunSpecPointDescriptor::NO_SCALE_FACTOR, SunSpecPointType::BITFIELD32},
+  {STR_DEROperationalCharacteristics, nullptr, 6, 2, SunSpecPointDescriptor::NO_SCALE_FACTOR, SunSpecPointType::BITFIELD32},
+  {STR_activePower, STR_W, 8, 1, 114, SunSpecPointType::INT16},
+  {STR_apparentPower, STR_VA, 9, 1, 116, SunSpecPointType::INT16},
+  {STR_reactivePower, STR_Var, 10, 1, 117, SunSpecPointType::INT16},
+  {STR_powerFactor, nullptr, 11, 1, 115, SunSpecPointType::INT16},
+  {STR_totalACCurrent, STR_A, 12, 1, 111, SunSpecPointType::INT16},
+  {STR_voltageLL, STR_V, 13, 1, 112, SunSpecPointType::UINT16},
+  {STR_voltageLN, STR_V, 14, 1, 112, SunSpecPointType::UINT16},
+  {STR_frequency, STR_Hz, 15, 2, 113, SunSpecPointType::UINT32},
+  {STR_totalEnergyInjected, STR_Wh, 17, 4, 118, SunSpecPointType::UINT64},
+  {STR_totalEnergyAbsorbed, STR_Wh, 21, 4, 118, SunSpecPointType::UINT64},
+  {STR_totalReactiveEnergyInj, STR_Varh, 25, 4, 119, SunSpecPointType::UINT64},
+  {STR_totalReactiveEnergyAbs, STR_Varh, 29, 4, 119, SunSpecPointType::UINT64},
+  {STR_ambientTemperature, STR_C, 33, 1, 120, SunSpecPointType::INT16},
+  {STR_cabinetTemperature, STR_C, 34, 1, 120, SunSpecPointType::INT16},
+  {STR_heatSinkTemperature, STR_C, 35, 1, 120, SunSpecPointType::INT16},
+  {STR_transformerTemperature, STR_C, 36, 1, 120, SunSpecPointType::INT16},
+  {STR_IGBTMOSFETTemperature, STR_C, 37, 1, 120, SunSpecPointType::INT16},
+  {STR_otherTemperature, STR_C, 38, 1, 120, SunSpecPointType::INT16},
+  {STR_wattsL1, STR_W, 39, 1, 114, SunSpecPointType::INT16},
+  {STR_VAL1, STR_VA, 40, 1, 116, SunSpecPointType::INT16},
+  {STR_varL1, STR_Var, 41, 1, 117, SunSpecPointType::INT16},
+  {STR_PFL1, nullptr, 42, 1, 115, SunSpecPointType::INT16},
+  {STR_ampsL1, STR_A, 43, 1, 111, SunSpecPointType::INT16},
+  {STR_phaseVoltageL1L2, STR_V, 44, 1, 112, SunSpecPointType::UINT16},
+  {STR_phaseVoltageL1N, STR_V, 45, 1, 112, SunSpecPointType::UINT16},
+  {STR_totalWattHoursInjL1, STR_Wh, 46, 4, 118, SunSpecPointType::UINT64},
+  {STR_totalWattHoursAbsL1, STR_Wh, 50, 4, 118, SunSpecPointType::UINT64},
+  {STR_totalVarHoursInjL1, STR_Varh, 54, 4, 119, SunSpecPointType::UINT64},
+  {STR_totalVarHoursAbsL1, STR_Varh, 58, 4, 119, SunSpecPointType::UINT64},
+  {STR_wattsL2, STR_W, 62, 1, 114, SunSpecPointType::INT16},
+  {STR_VAL2, STR_VA, 63, 1, 116, SunSpecPointType::INT16},
+  {STR_varL2, STR_Var, 64, 1, 117, SunSpecPointType::INT16},
+  {STR_PFL2, nullptr, 65, 1, 115, SunSpecPointType::INT16},
+  {STR_ampsL2, STR_A, 66, 1, 111, SunSpecPointType::INT16},
+  {STR_phaseVoltageL2L3, STR_V, 67, 1, 112, SunSpecPointType::UINT16},
+  {STR_phaseVoltageL2N, STR_V, 68, 1, 112, SunSpecPointType::UINT16},
+  {STR_totalWattHoursInjL2, STR_Wh, 69, 4, 118, SunSpecPointType::UINT64},
+  {STR_totalWattHoursAbsL2, STR_Wh, 73, 4, 118, SunSpecPointType::UINT64},
+  {STR_totalVarHoursInjL2, STR_Varh, 77, 4, 119, SunSpecPointType::UINT64},
+  {STR_totalVarHoursAbsL2, STR_Varh, 81, 4, 119, SunSpecPointType::UINT64},
+  {STR_wattsL3, STR_W, 85, 1, 114, SunSpecPointType::INT16},
+  {STR_VAL3, STR_VA, 86, 1, 116, SunSpecPointType::INT16},
+  {STR_varL3, STR_Var, 87, 1, 117, SunSpecPointType::INT16},
+  {STR_PFL3, nullptr, 88, 1, 115, SunSpecPointType::INT16},
+  {STR_ampsL3, STR_A, 89, 1, 111, SunSpecPointType::INT16},
+  {STR_phaseVoltageL3L1, STR_V, 90, 1, 112, SunSpecPointType::UINT16},
+  {STR_phaseVoltageL3N, STR_V, 91, 1, 112, SunSpecPointType::UINT16},
+  {STR_totalWattHoursInjL3, STR_Wh, 92, 4, 118, SunSpecPointType::UINT64},
+  {STR_totalWattHoursAbsL3, STR_Wh, 96, 4, 118, SunSpecPointType::UINT64},
+  {STR_totalVarHoursInjL3, STR_Varh, 100, 4, 119, SunSpecPointType::UINT64},
+  {STR_totalVarHoursAbsL3, STR_Varh, 104, 4, 119, SunSpecPointType::UINT64},
+  {STR_throttlingInPct, STR_Pct, 108, 1, SunSpecPointDescriptor::NO_SCALE_FACTOR, SunSpecPointType::UINT16},
+  {STR_throttleSourceInformation, nullptr, 109, 2, SunSpecPointDescriptor::NO_SCALE_FACTOR, SunSpecPointType::BITFIELD32},
+  {STR_manufacturerAlarmInfo, nullptr, 121, 32, SunSpecPointDescriptor::NO_SCALE_FACTOR, SunSpecPointType::STRING},
+};
+
+SunSpecPointTable DERACMeasurement::pointTable() {
+  return {701, 153, 0, POINTS_701, 60, nullptr, nullptr, 0};
+}
+
+SunSpecPointDescriptor const POINTS_702[] PROGMEM = {
+  {STR_activePowerMaxRating, STR_W, 0, 1, 43, SunSpecPointType::UINT16},
+  {STR_activePowerOverExcitedRating, STR_W, 1, 1, 43, SunSpecPointType::UINT16},
+  {STR_specifiedOverExcitedPF_2, nullptr, 2, 1, 44, SunSpecPointType::UINT16},
+  {STR_activePowerUnderExcitedRating, STR_W, 3, 1, 43, SunSpecPointType::UINT16},
+  {STR_specifiedUnderExcitedPF_4, nullptr, 4, 1, 44, SunSpecPointType::UINT16},
+  {STR_apparentPowerMaxRating, STR_VA, 5, 1, 45, SunSpecPointType::UINT16},
+  {STR_reactivePowerInjectedRating, STR_Var, 6, 1, 46, SunSpecPointType::UINT16},
+  {STR_reactivePowerAbsorbedRating, STR_Var, 7, 1, 46, SunSpecPointType::UINT16},
+  {STR_chargeRateMaxRating, STR_W, 8, 1, 43, SunSpecPointType::UINT16},
+  {STR_dischargeRateMaxRating, STR_W, 9, 1, 43, SunSpecPointType::UINT16},
+  {STR_chargeRateMaxVARating, STR_VA, 10, 1, 45, SunSpecPointType::UINT16},
+  {STR_dischargeRateMaxVARating, STR_VA, 11, 1, 45, SunSpecPointType::UINT16},
+  {STR_ACVoltageNominalRating, STR_V, 12, 1, 47, SunSpecPointType::UINT16},
+  {STR_ACVoltageMaxRating, STR_V, 13, 1, 47, SunSpecPointType::UINT16},
+  {STR_ACVoltageMinRating, STR_V, 14, 1, 47, SunSpecPointType::UINT16},
+  {STR_ACCurrentMaxRating, STR_A, 15, 1, 48, SunSpecPointType::UINT16},
+  {STR_PFOverExcitedRating, nullptr, 16, 1, 44, SunSpecPointType::UINT16},
+  {STR_PFUnderExcitedRating, nullptr, 17, 1, 44, SunSpecPointType::UINT16},
+  {STR_reactiveSusceptance, STR_S, 18, 1, 49, SunSpecPointType::UINT16},
+  {STR_normalOperatingCategory, nullptr, 19, 1, SunSpecPointDescriptor::NO_SCALE_FACTOR, SunSpecPointType::ENUM16},
+  {STR_abnormalOperatingCategory, nullptr, 20, 1, SunSpecPointDescriptor::NO_SCALE_FACTOR, SunSpecPointType::ENUM16},
+  {STR_supportedControlModes, nullptr, 21, 2, SunSpecPointDescriptor::NO_SCALE_FACTOR, SunSpecPointType::BITFIELD32},
+  {STR_intentionalIslandCategories_23, nullptr, 23, 1, SunSpecPointDescriptor::NO_SCALE_FACTOR, SunSpecPointType::BITFIELD16},
+  {STR_activePowerMaxSetting, STR_W, 24, 1, 43, SunSpecPointType::UINT16},
+  {STR_activePowerOverExcitedSetting, STR_W, 25, 1, 43, SunSpecPointType::UINT16},
+  {STR_specifiedOverExcitedPF_26, nullptr, 26, 1, 44, SunSpecPointType::UINT16},
+  {STR_activePowerUnderExcitedSetting, STR_W, 27, 1, 43, SunSpecPointType::UINT16},
+  {STR_specifiedUnderExcitedPF_28, nullptr, 28, 1, 44, SunSpecPointType::UINT16},
+  {STR_apparentPowerMaxSetting, STR_VA, 29, 1, 45, SunSpecPointType::UINT16},
+  {STR_reactivePowerInjectedSetting, STR_Var, 30, 1, 46, SunSpecPointType::UINT16},
+  {STR_reactivePowerAbsorbedSetting, STR_Var, 31, 1, 46, SunSpecPointType::UINT16},
+  {STR_chargeRateMaxSetting, STR_W, 32, 1, 43, SunSpecPointType::UINT16},
+  {STR_dischargeRateMaxSetting, STR_W, 33, 1, 43, SunSpecPointType::UINT16},
+  {STR_chargeRateMaxVASetting, STR_VA, 34, 1, 45, SunSpecPointType::UINT16},
+  {STR_dischargeRateMaxVASetting, STR_VA, 35, 1, 45, SunSpecPointType::UINT16},
+  {STR_nominalACVoltageSetting, STR_V, 36, 1, 47, SunSpecPointType::UINT16},
+  {STR_ACVoltageMaxSetting, STR_V, 37, 1, 47, SunSpecPointType::UINT16},
+  {STR_ACVoltageMinSetting, STR_V, 38, 1, 47, SunSpecPointType::UINT16},
+  {STR_ACCurrentMaxSetting, STR_A, 39, 1, 48, SunSpecPointType::UINT16},
+  {STR_PFOverExcitedSetting, nullptr, 40, 1, 44, SunSpecPointType::UINT16},
+  {STR_PFUnderExcitedSetting, nullptr, 41, 1, 44, SunSpecPointType::UINT16},
+  {STR_intentionalIslandCategories_42, nullptr, 42, 1, SunSpecPointDescriptor::NO_SCALE_FACTOR, SunSpecPointType::BITFIELD16},
+};
+
+SunSpecPointTable DERCapacity::pointTable() {
+  return {702, 50, 0, POINTS_702, 42, nullptr, nullptr, 0};
+}
+
+SunSpecPointDescriptor const POINTS_703[] PROGMEM = {
+  {STR_permitEnterService, nullptr, 0, 1, SunSpecPointDescriptor::NO_SCALE_FACTOR, SunSpecPointType::ENUM16},
+  {STR_enterServiceVoltageHigh, STR_Pct, 1, 1, 15, SunSpecPointType::UINT16},
+  {STR_enterServiceVoltageLow, STR_Pct, 2, 1, 15, SunSpecPointType::UINT16},
+  {STR_enterServiceFrequencyHigh, STR_Hz, 3, 2, 16, SunSpecPointType::UINT32},
+  {STR_enterServiceFrequencyLow, STR_Hz, 5, 2, 16, SunSpecPointType::UINT32},
+  {STR_enterServiceDelayTime, STR_Secs, 7, 2, SunSpecPointDescriptor::NO_SCALE_FACTOR, SunSpecPointType::UINT32},
+  {STR_enterServiceRandomDelay, STR_Secs, 9, 2, SunSpecPointDescriptor::NO_SCALE_FACTOR, SunSpecPointType::UINT32},
+  {STR_enterServiceRampTime, STR_Secs, 11, 2, SunSpecPointDescriptor::NO_SCALE_FACTOR, SunSpecPointType::UINT32},
+  {STR_enterServiceDelayRemaining, STR_Secs, 13, 2, SunSpecPointDescriptor::NO_SCALE_FACTOR, SunSpecPointType::UINT32},
+};
+
+SunSpecPointTable EnterService::pointTable() {
+  return {703, 17, 0, POINTS_703, 9, nullptr, nullptr, 0};
+}
+
+SunSpecPointDescriptor const POINTS_713[] PROGMEM = {
+  {STR_energyRating, STR_WH, 0, 1, 5, SunSpecPointType::UINT16},
+  {STR_energyAvailable, STR_WH, 1, 1, 5, SunSpecPointType::UINT16},
+  {STR_stateOfCharge, STR_Pct, 2, 1, 6, SunSpecPointType::UINT16},
+  {STR_stateOfHealth, STR_Pct, 3, 1, 6, SunSpecPointType::UINT16},
+  {STR_status, nullptr, 4, 1, SunSpecPointDescriptor::NO_SCALE_FACTOR, SunSpecPointType::ENUM16},
+};
+
+SunSpecPointTable DERStorageCapacity::pointTable() {
+  return {713, 7, 0, POINTS_713, 5, nullptr, nullptr, 0};
+}
+
+SunSpecPointDescriptor const POINTS_715[] PROGMEM = {
+  {STR_controlMode, nullptr, 0, 1, SunSpecPointDescriptor::NO_SCALE_FACTOR, SunSpecPointType::ENUM16},
+  {STR_DERHeartbeat, nullptr, 1, 2, SunSpecPointDescriptor::NO_SCALE_FACTOR, SunSpecPointType::UINT32},
+  {STR_controllerHeartbeat, nullptr, 3, 2, SunSpecPointDescriptor::NO_SCALE_FACTOR, SunSpecPointType::UINT32},
+  {STR_alarmReset, nullptr, 5, 1, SunSpecPointDescriptor::NO_SCALE_FACTOR, SunSpecPointType::UINT16},
+  {STR_setOperation, nullptr, 6, 1, SunSpecPointDescriptor::NO_SCALE_FACTOR, SunSpecPointType::ENUM16},
+};
+
+SunSpecPointTable DERCtl::pointTable() {
+  return {715, 7, 0, POINTS_715, 5, nullptr, nullptr, 0};
+}
+
+SunSpecPointDescriptor const POINTS_801[] PROGMEM = {
+  {STR_deprecatedModel, nullptr, 0, 1, SunSpecPointDescriptor::NO_SCALE_FACTOR, SunSpecPointType::ENUM16},
+};
+
+SunSpecPointTable EnergyStorageBaseModelDEPRECATED::pointTable() {
+  return {801, 1, 0, POINTS_801, 1, nullptr, nullptr, 0};
+}
+
+SunSpecPointDescriptor const POINTS_802[] PROGMEM = {
+  {STR_nameplateChargeCapacity, STR_Ah, 0, 1, 50, SunSpecPointType::UINT16},
+  {STR_nameplateEnergyCapacity, STR_Wh, 1, 1, 51, SunSpecPointType::UINT16},
+  {STR_nameplateMaxChargeRate, STR_W, 2, 1, 52, SunSpecPointType::UINT16},
+  {STR_nameplateMaxDischargeRate, STR_W, 3, 1, 52, SunSpecPointType::UINT16},
+  {STR_selfDischargeRate, STR__WHRtg, 4, 1, 53, SunSpecPointType::UINT16},
+  {STR_nameplateMaxSoC, STR__WHRtg, 5, 1, 54, SunSpecPointType::UINT16},
+  {STR_nameplateMinSoC, STR__WHRtg, 6, 1, 54, SunSpecPointType::UINT16},
+  {STR_maxReservePercent, STR__WHRtg, 7, 1, 54, SunSpecPointType::UINT16},
+  {STR_minReservePercent, STR__WHRtg, 8, 1, 54, SunSpecPointType::UINT16},
+  {STR_stateOfCharge, STR__WHRtg, 9, 1, 54, SunSpecPointType::UINT16},
+  {STR_depthOfDischarge, STR__, 10, 1, 55, SunSpecPointType::UINT16},
+  {STR_stateOfHealth, STR__, 11, 1, 56, SunSpecPointType::UINT16},
+  {STR_cycleCount, nullptr, 12, 2, SunSpecPointDescriptor::NO_SCALE_FACTOR, SunSpecPointType::UINT32},
+  {STR_chargeStatus, nullptr, 14, 1, SunSpecPointDescriptor::NO_SCALE_FACTOR, SunSpecPointType::ENUM16},
+  {STR_controlMode, nullptr, 15, 1, SunSpecPointDescriptor::NO_SCALE_FACTOR, SunSpecPointType::ENUM16},
+  {STR_batteryHeartbeat, nullptr, 16, 1, SunSpecPointDescriptor::NO_SCALE_FACTOR, SunSpecPointType::UINT16},
+  {STR_controllerHeartbeat, nullptr, 17, 1, SunSpecPointDescriptor::NO_SCALE_FACTOR, SunSpecPointType::UINT16},
+  {STR_alarmReset, nullptr, 18, 1, SunSpecPointDescriptor::NO_SCALE_FACTOR, SunSpecPointType::UINT16},
+  {STR_batteryType, nullptr, 19, 1, SunSpecPointDescriptor::NO_SCALE_FACTOR, SunSpecPointType::ENUM16},
+  {STR_stateOfTheBatteryBank, nullptr, 20, 1, SunSpecPointDescriptor::NO_SCALE_FACTOR, SunSpecPointType::ENUM16},
+  {STR_vendorBatteryBankState, nullptr, 21, 1, SunSpecPointDescriptor::NO_SCALE_FACTOR, SunSpecPointType::ENUM16},
+  {STR_warrantyDate, nullptr, 22, 2, SunSpecPointDescriptor::NO_SCALE_FACTOR, SunSpecPointType::UINT32},
+  {STR_batteryEvent1Bitfield, nullptr, 24, 2, SunSpecPointDescriptor::NO_SCALE_FACTOR, SunSpecPointType::BITFIELD32},
+  {STR_batteryEvent2Bitfield, nullptr, 26, 2, SunSpecPointDescriptor::NO_SCALE_FACTOR, SunSpecPointType::BITFIELD32},
+  {STR_vendorEventBitfield1, nullptr, 28, 2, SunSpecPointDescriptor::NO_SCALE_FACTOR, SunSpecPointType::BITFIELD32},
+  {STR_vendorEventBitfield2, nullptr, 30, 2, SunSpecPointDescriptor::NO_SCALE_FACTOR, SunSpecPointType::BITFIELD32},
+  {STR_externalBatteryVoltage, STR_V, 32, 1, 57, SunSpecPointType::UINT16},
+  {STR_maxBatteryVoltage, STR_V, 33, 1, 57, SunSpecPointType::UINT16},
+  {STR_minBatteryVoltage, STR_V, 34, 1, 57, SunSpecPointType::UINT16},
+  {STR_maxCellVoltage, STR_V, 35, 1, 58, SunSpecPointType::UINT16},
+  {STR_maxCellVoltageString, nullptr, 36, 1, SunSpecPointDescriptor::NO_SCALE_FACTOR, SunSpecPointType::UINT16},
+  {STR_maxCellVoltageModule, nullptr, 37, 1, SunSpecPointDescriptor::NO_SCALE_FACTOR, SunSpecPointType::UINT16},
+  {STR_minCellVoltage, STR_V, 38, 1, 58, SunSpecPointType::UINT16},
+  {STR_minCellVoltageString, nullptr, 39, 1, SunSpecPointDescriptor::NO_SCALE_FACTOR, SunSpecPointType::UINT16},
+  {STR_minCellVoltageModule, nullptr, 40, 1, SunSpecPointDescriptor::NO_SCALE_FACTOR, SunSpecPointType::UINT16},
+  {STR_averageCellVoltage, STR_V, 41, 1, 58, SunSpecPointType::UINT16},
+  {STR_totalDCCurrent, STR_A, 42, 1, 59, SunSpecPointType::INT16},
+  {STR_maxChargeCurrent, STR_A, 43, 1, 60, SunSpecPointType::UINT16},
+  {STR_maxDischargeCurrent, STR_A, 44, 1, 60, SunSpecPointType::UINT16},
+  {STR_totalPower, STR_W, 45, 1, 61, SunSpecPointType::INT16},
+  {STR_inverterStateRequest, nullptr, 46, 1, SunSpecPointDescriptor::NO_SCALE_FACTOR, SunSpecPointType::ENUM16},
+  {STR_batteryPowerRequest, STR_W, 47, 1, 61, SunSpecPointType::INT16},
+  {STR_setOperation, nullptr, 48, 1, SunSpecPointDescriptor::NO_SCALE_FACTOR, SunSpecPointType::ENUM16},
+  {STR_setInverterState, nullptr, 49, 1, SunSpecPointDescriptor::NO_SCALE_FACTOR, SunSpecPointType::ENUM16},
+};
+
+SunSpecPointTable BatteryBaseModel::pointTable() {
+  return {802, 62, 0, POINTS_802, 44, nullptr, nullptr, 0};
+}
+
+SunSpecPointDescriptor const POINTS_64001[] PROGMEM = {
+  {STR_commandCode, nullptr, 0, 1, SunSpecPointDescriptor::NO_SCALE_FACTOR, SunSpecPointType::ENUM16},
+  {STR_hardwareRevision, nullptr, 1, 1, SunSpecPointDescriptor::NO_SCALE_FACTOR, SunSpecPointType::UINT16},
+  {STR_RSFWRevision, nullptr, 2, 1, SunSpecPointDescriptor::NO_SCALE_FACTOR, SunSpecPointType::UINT16},
+  {STR_OSFWRevision, nullptr, 3, 1, SunSpecPointDescriptor::NO_SCALE_FACTOR, SunSpecPointType::UINT16},
+  {STR_productRevision, nullptr, 4, 2, SunSpecPointDescriptor::NO_SCALE_FACTOR, SunSpecPointType::STRING},
+  {STR_bootCount, nullptr, 6, 1, SunSpecPointDescriptor::NO_SCALE_FACTOR, SunSpecPointType::UINT16},
+  {STR_DIPSwitches, nullptr, 7, 1, SunSpecPointDescriptor::NO_SCALE_FACTOR, SunSpecPointType::BITFIELD16},
+  {STR_numDetectedSensors, nullptr, 8, 1, SunSpecPointDescriptor::NO_SCALE_FACTOR, SunSpecPointType::UINT16},
+  {STR_numCommunicatingSensors, nullptr, 9, 1, SunSpecPointDescriptor::NO_SCALE_FACTOR, SunSpecPointType::UINT16},
+  {STR_systemStatus, nullptr, 10, 1, SunSpecPointDescriptor::NO_SCALE_FACTOR, SunSpecPointType::BITFIELD16},
+  {STR_systemConfiguration, nullptr, 11, 1, SunSpecPointDescriptor::NO_SCALE_FACTOR, SunSpecPointType::BITFIELD16},
+  {STR_LEDBlinkThreshold, STR_Pct, 12, 1, SunSpecPointDescriptor::NO_SCALE_FACTOR, SunSpecPointType::UINT16},
+  {STR_LEDOnThreshold, STR_Pct, 13, 1, SunSpecPointDescriptor::NO_SCALE_FACTOR, SunSpecPointType::UINT16},
+  {STR_reserved, nullptr, 14, 1, SunSpecPointDescriptor::NO_SCALE_FACTOR, SunSpecPointType::UINT16},
+  {STR_locationString, nullptr, 15, 16, SunSpecPointDescriptor::NO_SCALE_FACTOR, SunSpecPointType::STRING},
+  {STR_sensor1UnitID, nullptr, 31, 1, SunSpecPointDescriptor::NO_SCALE_FACTOR, SunSpecPointType::ENUM16},
+  {STR_sensor1Address, nullptr, 32, 1, SunSpecPointDescriptor::NO_SCALE_FACTOR, SunSpecPointType::UINT16},
+  {STR_sensor1OSVersion, nullptr, 33, 1, SunSpecPointDescriptor::NO_SCALE_FACTOR, SunSpecPointType::UINT16},
+  {STR_sensor1ProductVersion, nullptr, 34, 2, SunSpecPointDescriptor::NO_SCALE_FACTOR, SunSpecPointType::STRING},
+  {STR_sensor1SerialNum, nullptr, 36, 5, SunSpecPointDescriptor::NO_SCALE_FACTOR, SunSpecPointType::STRING},
+  {STR_sensor2UnitID, nullptr, 41, 1, SunSpecPointDescriptor::NO_SCALE_FACTOR, SunSpecPointType::ENUM16},
+  {STR_sensor2Address, nullptr, 42, 1, SunSpecPointDescriptor::NO_SCALE_FACTOR, SunSpecPointType::UINT16},
+  {STR_sensor2OSVersion, nullptr, 43, 1, SunSpecPointDescriptor::NO_SCALE_FACTOR, SunSpecPointType::UINT16},
+  {STR_sensor2ProductVersion, nullptr, 44, 2, SunSpecPointDescriptor::NO_SCALE_FACTOR, SunSpecPointType::STRING},
+  {STR_sensor2SerialNum, nullptr, 46, 5, SunSpecPointDescriptor::NO_SCALE_FACTOR, SunSpecPointType::STRING},
+  {STR_sensor3UnitID, nullptr, 51, 1, SunSpecPointDescriptor::NO_SCALE_FACTOR, SunSpecPointType::ENUM16},
+  {STR_sensor3Address, nullptr, 52, 1, SunSpecPointDescriptor::NO_SCALE_FACTOR, SunSpecPointType::UINT16},
+  {STR_sensor3OSVersion, nullptr, 53, 1, SunSpecPointDescriptor::NO_SCALE_FACTOR, SunSpecPointType::UINT16},
+  {STR_sensor3ProductVersion, nullptr, 54, 2, SunSpecPointDescriptor::NO_SCALE_FACTOR, SunSpecPointType::STRING},
+  {STR_sensor3SerialNum, nullptr, 56, 5, SunSpecPointDescriptor::NO_SCALE_FACTOR, SunSpecPointType::STRING},
+  {STR_sensor4UnitID, nullptr, 61, 1, SunSpecPointDescriptor::NO_SCALE_FACTOR, SunSpecPointType::ENUM16},
+  {STR_sensor4Address, nullptr, 62, 1, SunSpecPointDescriptor::NO_SCALE_FACTOR, SunSpecPointType::UINT16},
+  {STR_sensor4OSVersion, nullptr, 63, 1, SunSpecPointDescriptor::NO_SCALE_FACTOR, SunSpecPointType::UINT16},
+  {STR_sensor4ProductVersion, nullptr, 64, 2, SunSpecPointDescriptor::NO_SCALE_FACTOR, SunSpecPointType::STRING},
+  {STR_sensor4SerialNum, nullptr, 66, 5, SunSpecPointDescriptor::NO_SCALE_FACTOR, SunSpecPointType::STRING},
+};
+
+SunSpecPointTable VerisStatusAndConfiguration::pointTable() {
+  return {64001, 71, 0, POINTS_64001, 35, nullptr, nullptr, 0};
+}
+
+SunSpecPointDescriptor const POINTS_64101[] PROGMEM = {
+  {STR_eltek_Country_Code, nullptr, 0, 1, SunSpecPointDescriptor::NO_SCALE_FACTOR, SunSpecPointType::UINT16},
+  {STR_eltek_Feeding_Phase, nullptr, 1, 1, SunSpecPointDescriptor::NO_SCALE_FACTOR, SunSpecPointType::UINT16},
+  {STR_eltek_APD_Method, nullptr, 2, 1, SunSpecPointDescriptor::NO_SCALE_FACTOR, SunSpecPointType::UINT16},
+  {STR_eltek_APD_Power_Ref, nullptr, 3, 1, SunSpecPointDescriptor::NO_SCALE_FACTOR, SunSpecPointType::UINT16},
+  {STR_eltek_RPS_Method, nullptr, 4, 1, SunSpecPointDescriptor::NO_SCALE_FACTOR, SunSpecPointType::UINT16},
+  {STR_eltek_RPS_Q_Ref, nullptr, 5, 1, SunSpecPointDescriptor::NO_SCALE_FACTOR, SunSpecPointType::UINT16},
+  {STR_eltek_RPS_CosPhi_Ref, nullptr, 6, 1, SunSpecPointDescriptor::NO_SCALE_FACTOR, SunSpecPointType::INT16},
+};
+
+SunSpecPointTable EltekInverterExtension::pointTable() {
+  return {64101, 7, 0, POINTS_64101, 7, nullptr, nullptr, 0};
+}
+
+SunSpecPointDescriptor const POINTS_64110[] PROGMEM = {
+  {STR_AXSMajorFirmwareNumber, nullptr, 0, 1, SunSpecPointDescriptor::NO_SCALE_FACTOR, SunSpecPointType::UINT16},
+  {STR_AXSMidFirmwareNumber, nullptr, 1, 1, SunSpecPointDescriptor::NO_SCALE_FACTOR, SunSpecPointType::UINT16},
+  {STR_AXSMinorFirmwareNumber, nullptr, 2, 1, SunSpecPointDescriptor::NO_SCALE_FACTOR, SunSpecPointType::UINT16},
+  {STR_encryptionKey, nullptr, 3, 1, SunSpecPointDescriptor::NO_SCALE_FACTOR, SunSpecPointType::UINT16},
+  {STR_MACAddress, nullptr, 4, 7, SunSpecPointDescriptor::NO_SCALE_FACTOR, SunSpecPointType::STRING},
+  {STR_writePassword, nullptr, 11, 8, SunSpecPointDescriptor::NO_SCALE_FACTOR, SunSpecPointType::STRING},
+  {STR_enableDHCP, nullptr, 19, 1, SunSpecPointDescriptor::NO_SCALE_FACTOR, SunSpecPointType::ENUM16},
+  {STR_TCPIPAddress, nullptr, 20, 2, SunSpecPointDescriptor::NO_SCALE_FACTOR, SunSpecPointType::IPADDR},
+  {STR_TCPIPGateway, nullptr, 22, 2, SunSpecPointDescriptor::NO_SCALE_FACTOR, SunSpecPointType::IPADDR},
+  {STR_TCPIPNetmask, nullptr, 24, 2, SunSpecPointDescriptor::NO_SCALE_FACTOR, SunSpecPointType::IPADDR},
+  {STR_TCPIPDNS1, nullptr, 26, 2, SunSpecPointDescriptor::NO_SCALE_FACTOR, SunSpecPointType::IPADDR},
+  {STR_TCPIPDNS2, nullptr, 28, 2, SunSpecPointDescriptor::NO_SCALE_FACTOR, SunSpecPointType::IPADDR},
+  {STR_modBusPort, nullptr, 30, 1, SunSpecPointDescriptor::NO_SCALE_FACTOR, SunSpecPointType::UINT16},
+  {STR_SMTPServerName, nullptr, 31, 20, SunSpecPointDescriptor::NO_SCALE_FACTOR, SunSpecPointType::STRING},
+  {STR_SMTPAccountName, nullptr, 51, 16, SunSpecPointDescriptor::NO_SCALE_FACTOR, SunSpecPointType::STRING},
+  {STR_enableSMTPSSL, nullptr, 67, 1, SunSpecPointDescriptor::NO_SCALE_FACTOR, SunSpecPointType::ENUM16},
+  {STR_SMTPPassword, nullptr, 68, 8, SunSpecPointDescriptor::NO_SCALE_FACTOR, SunSpecPointType::STRING},
+  {STR_SMTPUserName, nullptr, 76, 20, SunSpecPointDescriptor::NO_SCALE_FACTOR, SunSpecPointType::STRING},
+  {STR_statusEmailInterval, nullptr, 96, 1, SunSpecPointDescriptor::NO_SCALE_FACTOR, SunSpecPointType::UINT16},
+  {STR_statusEmailStartHour, nullptr, 97, 1, SunSpecPointDescriptor::NO_SCALE_FACTOR, SunSpecPointType::UINT16},
+  {STR_statusEmailSubject, nullptr, 98, 25, SunSpecPointDescriptor::NO_SCALE_FACTOR, SunSpecPointType::STRING},
+  {STR_statusEmailToAddress1, nullptr, 123, 20, SunSpecPointDescriptor::NO_SCALE_FACTOR, SunSpecPointType::STRING},
+  {STR_statusEmailToAddress2, nullptr, 143, 20, SunSpecPointDescriptor::NO_SCALE_FACTOR, SunSpecPointType::STRING},
+  {STR_enableAlarmEmail, nullptr, 163, 1, SunSpecPointDescriptor::NO_SCALE_FACTOR, SunSpecPointType::ENUM16},
+  {STR_alarmEmailSubject, nullptr, 164, 25, SunSpecPointDescriptor::NO_SCALE_FACTOR, SunSpecPointType::STRING},
+  {STR_alarmEmailToAddress1, nullptr, 189, 20, SunSpecPointDescriptor::NO_SCALE_FACTOR, SunSpecPointType::STRING},
+  {STR_alarmEmailToAddress2, nullptr, 209, 20, SunSpecPointDescriptor::NO_SCALE_FACTOR, SunSpecPointType::STRING},
+  {STR_FTPPassword, nullptr, 229, 8, SunSpecPointDescriptor::NO_SCALE_FACTOR, SunSpecPointType::STRING},
+  {STR_telnetPassword, nullptr, 237, 8, SunSpecPointDescriptor::NO_SCALE_FACTOR, SunSpecPointType::STRING},
+  {STR_SDCardDatalogWriteInterval, STR_Tms, 245, 1, SunSpecPointDescriptor::NO_SCALE_FACTOR, SunSpecPointType::UINT16},
+  {STR_SDCardDatalogRetain, STR_Tmd, 246, 1, SunSpecPointDescriptor::NO_SCALE_FACTOR, SunSpecPointType::UINT16},
+  {STR_SDCardDatalogMode, nullptr, 247, 1, SunSpecPointDescriptor::NO_SCALE_FACTOR, SunSpecPointType::ENUM16},
+  {STR_NTPTimerServerName, nullptr, 248, 20, SunSpecPointDescriptor::NO_SCALE_FACTOR, SunSpecPointType::STRING},
+  {STR_enableNetworkTime, nullptr, 268, 1, SunSpecPointDescriptor::NO_SCALE_FACTOR, SunSpecPointType::ENUM16},
+  {STR_timeZone, STR_Tmh, 269, 1, SunSpecPointDescriptor::NO_SCALE_FACTOR, SunSpecPointType::INT16},
+  {STR_year, nullptr, 270, 1, SunSpecPointDescriptor::NO_SCALE_FACTOR, SunSpecPointType::UINT16},
+  {STR_month, nullptr, 271, 1, SunSpecPointDescriptor::NO_SCALE_FACTOR, SunSpecPointType::UINT16},
+  {STR_day, nullptr, 272, 1, SunSpecPointDescriptor::NO_SCALE_FACTOR, SunSpecPointType::UINT16},
+  {STR_hour, nullptr, 273, 1, SunSpecPointDescriptor::NO_SCALE_FACTOR, SunSpecPointType::UINT16},
+  {STR_minute, nullptr, 274, 1, SunSpecPointDescriptor::NO_SCALE_FACTOR, SunSpecPointType::UINT16},
+  {STR_second, nullptr, 275, 1, SunSpecPointDescriptor::NO_SCALE_FACTOR, SunSpecPointType::UINT16},
+  {STR_batteryTemperature, STR_C, 276, 1, 278, SunSpecPointType::INT16},
+  {STR_ambientTemperature, STR_C, 277, 1, 278, SunSpecPointType::INT16},
+  {STR_AXSError, nullptr, 279, 1, SunSpecPointDescriptor::NO_SCALE_FACTOR, SunSpecPointType::BITFIELD16},
+  {STR_AXSStatus, nullptr, 280, 1, SunSpecPointDescriptor::NO_SCALE_FACTOR, SunSpecPointType::BITFIELD16},
+  {STR_spare, nullptr, 281, 1, SunSpecPointDescriptor::NO_SCALE_FACTOR, SunSpecPointType::UINT16},
+};
+
+SunSpecPointTable OutBackAXSDevice::pointTable() {
+  return {64110, 282, 0, POINTS_64110, 46, nullptr, nullptr, 0};
+}
+
+SunSpecPointDescriptor const POINTS_64111[] PROGMEM = {
+  {STR_portNumber, nullptr, 0, 1, SunSpecPointDescriptor::NO_SCALE_FACTOR, SunSpecPointType::UINT16},
+  {STR_batteryVoltage, STR_V, 6, 1, 1, SunSpecPointType::UINT16},
+  {STR_arrayVoltage, STR_V, 7, 1, 1, SunSpecPointType::UINT16},
+  {STR_outputCurrent, STR_A, 8, 1, 2, SunSpecPointType::UINT16},
+  {STR_arrayCurrent, STR_A, 9, 1, 3, SunSpecPointType::UINT16},
+  {STR_operatingState, nullptr, 10, 1, SunSpecPointDescriptor::NO_SCALE_FACTOR, SunSpecPointType::ENUM16},
+  {STR_outputWattage, STR_W, 11, 1, 3, SunSpecPointType::UINT16},
+  {STR_todaySMinimumBatteryVoltage, STR_V, 12, 1, 1, SunSpecPointType::UINT16},
+  {STR_todaySMaximumBatteryVoltage, STR_V, 13, 1, 1, SunSpecPointType::UINT16},
+  {STR_VOC, STR_V, 14, 1, 1, SunSpecPointType::UINT16},
+  {STR_todaySMaximumVOC, STR_V, 15, 1, 1, SunSpecPointType::UINT16},
+  {STR_todaySKWh, STR_kWh, 16, 1, 5, SunSpecPointType::UINT16},
+  {STR_todaySAH, STR_AH, 17, 1, 4, SunSpecPointType::UINT16},
+  {STR_lifetimeKWh, STR_kWh, 18, 1, 3, SunSpecPointType::UINT16},
+  {STR_lifetimeKAH, STR_kAH, 19, 1, 5, SunSpecPointType::UINT16},
+  {STR_lifetimeMaximumOutputWattage, STR_W, 20, 1, 3, SunSpecPointType::UINT16},
+  {STR_lifetimeMaximumBatteryVoltage, STR_V, 21, 1, 1, SunSpecPointType::UINT16},
+  {STR_lifetimeMaximumVOCVoltage, STR_V, 22, 1, 1, SunSpecPointType::UINT16},
+};
+
+SunSpecPointTable BasicChargeController::pointTable() {
+  return {64111, 23, 0, POINTS_64111, 18, nullptr, nullptr, 0};
+}
+
+SunSpecPointDescriptor const POINTS_64112[] PROGMEM = {
+  {STR_portNumber, nullptr, 0, 1, SunSpecPointDescriptor::NO_SCALE_FACTOR, SunSpecPointType::UINT16},
+  {STR_faults, nullptr, 7, 1, SunSpecPointDescriptor::NO_SCALE_FACTOR, SunSpecPointType::BITFIELD16},
+  {STR_absorb, STR_V, 8, 1, 1, SunSpecPointType::UINT16},
+  {STR_absorbTime, STR_Tmh, 9, 1, 3, SunSpecPointType::UINT16},
+  {STR_absorbEnd, STR_A, 10, 1, 1, SunSpecPointType::UINT16},
+  {STR_rebulk, STR_V, 11, 1, 1, SunSpecPointType::UINT16},
+  {STR_float_, STR_V, 12, 1, 1, SunSpecPointType::UINT16},
+  {STR_maximumCharge, STR_A, 13, 1, 1, SunSpecPointType::UINT16},
+  {STR_equalize, STR_V, 14, 1, 1, SunSpecPointType::UINT16},
+  {STR_equalizeTime, STR_Tmh, 15, 1, SunSpecPointDescriptor::NO_SCALE_FACTOR, SunSpecPointType::UINT16},
+  {STR_autoEqualizeInterval, STR_Tmd, 16, 1, SunSpecPointDescriptor::NO_SCALE_FACTOR, SunSpecPointType::UINT16},
+  {STR_MPPTMode, nullptr, 17, 1, SunSpecPointDescriptor::NO_SCALE_FACTOR, SunSpecPointType::ENUM16},
+  {STR_sweepWidth, nullptr, 18, 1, SunSpecPointDescriptor::NO_SCALE_FACTOR, SunSpecPointType::ENUM16},
+  {STR_sweepMaximum, nullptr, 19, 1, SunSpecPointDescriptor::NO_SCALE_FACTOR, SunSpecPointType::ENUM16},
+  {STR_UPickPWMDutyCycle, STR_Pct, 20, 1, 1, SunSpecPointType::UINT16},
+  {STR_gridTieMode, nullptr, 21, 1, SunSpecPointDescriptor::NO_SCALE_FACTOR, SunSpecPointType::ENUM16},
+  {STR_tempCompMode, nullptr, 22, 1, SunSpecPointDescriptor::NO_SCALE_FACTOR, SunSpecPointType::ENUM16},
+  {STR_tempCompLowerLimit, STR_V, 23, 1, 1, SunSpecPointType::UINT16},
+  {STR_tempCompUpperLimit, STR_V, 24, 1, 1, SunSpecPointType::UINT16},
+  {STR_autoRestartMode, nullptr, 25, 1, SunSpecPointDescriptor::NO_SCALE_FACTOR, SunSpecPointType::ENUM16},
+  {STR_wakeupVOCChange, STR_V, 26, 1, 1, SunSpecPointType::UINT16},
+  {STR_snoozeMode, STR_A, 27, 1, 1, SunSpecPointType::UINT16},
+  {STR_wakeupInterval, STR_Tms, 28, 1, SunSpecPointDescriptor::NO_SCALE_FACTOR, SunSpecPointType::UINT16},
+  {STR_AUXOutputMode, nullptr, 29, 1, SunSpecPointDescriptor::NO_SCALE_FACTOR, SunSpecPointType::ENUM16},
+  {STR_AUXOutputControl, nullptr, 30, 1, SunSpecPointDescriptor::NO_SCALE_FACTOR, SunSpecPointType::ENUM16},
+  {STR_AUXOutputState, nullptr, 31, 1, SunSpecPointDescriptor::NO_SCALE_FACTOR, SunSpecPointType::ENUM16},
+  {STR_AUXOutputPolarity, nullptr, 32, 1, SunSpecPointDescriptor::NO_SCALE_FACTOR, SunSpecPointType::ENUM16},
+  {STR_AUXLowBatteryDisconnect, STR_V, 33, 1, 1, SunSpecPointType::UINT16},
+  {STR_AUXLowBatteryReconnect, STR_V, 34, 1, 1, SunSpecPointType::UINT16},
+  {STR_AUXLowBatteryDisconnectDelay, STR_Tms, 35, 1, SunSpecPointDescriptor::NO_SCALE_FACTOR, SunSpecPointType::UINT16},
+  {STR_AUXVentFan, STR_V, 36, 1, 1, SunSpecPointType::UINT16},
+  {STR_AUXPVTrigger, STR_V, 37, 1, 1, SunSpecPointType::UINT16},
+  {STR_AUXPVTriggerHoldTime, STR_Tms, 38, 1, SunSpecPointDescriptor::NO_SCALE_FACTOR, SunSpecPointType::UINT16},
+  {STR_AUXNightLightThreshold, STR_V, 39, 1, 1, SunSpecPointType::UINT16},
+  {STR_AUXNightLightOnTime, STR_Tmh, 40, 1, 3, SunSpecPointType::UINT16},
+  {STR_AUXNightLightOnHysteresis, STR_Tms, 41, 1, SunSpecPointDescriptor::NO_SCALE_FACTOR, SunSpecPointType::UINT16},
+  {STR_AUXNightLightOffHysteresis, STR_Tms, 42, 1, SunSpecPointDescriptor::NO_SCALE_FACTOR, SunSpecPointType::UINT16},
+  {STR_AUXErrorOutputLowBattery, STR_V, 43, 1, 1, SunSpecPointType::UINT16},
+  {STR_AUXDivertHoldTime, STR_Tms, 44, 1, 1, SunSpecPointType::UINT16},
+  {STR_AUXDivertDelayTime, STR_Tms, 45, 1, SunSpecPointDescriptor::NO_SCALE_FACTOR, SunSpecPointType::UINT16},
+  {STR_AUXDivertRelative, STR_V, 46, 1, 1, SunSpecPointType::UINT16},
+  {STR_AUXDivertHysteresis, STR_V, 47, 1, 1, SunSpecPointType::UINT16},
+  {STR_FMCCMajorFirmwareNumber, nullptr, 48, 1, SunSpecPointDescriptor::NO_SCALE_FACTOR, SunSpecPointType::UINT16},
+  {STR_FMCCMidFirmwareNumber, nullptr, 49, 1, SunSpecPointDescriptor::NO_SCALE_FACTOR, SunSpecPointType::UINT16},
+  {STR_FMCCMinorFirmwareNumber, nullptr, 50, 1, SunSpecPointDescriptor::NO_SCALE_FACTOR, SunSpecPointType::UINT16},
+  {STR_setDataLogDayOffset, STR_Tmd, 51, 1, SunSpecPointDescriptor::NO_SCALE_FACTOR, SunSpecPointType::UINT16},
+  {STR_currentDataLogDayOffset, STR_Tmd, 52, 1, SunSpecPointDescriptor::NO_SCALE_FACTOR, SunSpecPointType::UINT16},
+  {STR_dataLogDailyAh, STR_Ah, 53, 1, SunSpecPointDescriptor::NO_SCALE_FACTOR, SunSpecPointType::UINT16},
+  {STR_dataLogDailyKWh, STR_kWh, 54, 1, 6, SunSpecPointType::UINT16},
+  {STR_dataLogDailyMaximumOutputA, STR_A, 55, 1, 1, SunSpecPointType::UINT16},
+  {STR_dataLogDailyMaximumOutputW, STR_W, 56, 1, 1, SunSpecPointType::UINT16},
+  {STR_dataLogDailyAbsorbTime, STR_Tms, 57, 1, SunSpecPointDescriptor::NO_SCALE_FACTOR, SunSpecPointType::UINT16},
+  {STR_dataLogDailyFloatTime, STR_Tms, 58, 1, SunSpecPointDescriptor::NO_SCALE_FACTOR, SunSpecPointType::UINT16},
+  {STR_dataLogDailyMinimumBattery, STR_V, 59, 1, 1, SunSpecPointType::UINT16},
+  {STR_dataLogDailyMaximumBattery, STR_V, 60, 1, 1, SunSpecPointType::UINT16},
+  {STR_dataLogDailyMaximumInput, STR_V, 61, 1, 1, SunSpecPointType::UINT16},
+  {STR_dataLogClear, nullptr, 62, 1, SunSpecPointDescriptor::NO_SCALE_FACTOR, SunSpecPointType::UINT16},
+  {STR_dataLogClearComplement, nullptr, 63, 1, SunSpecPointDescriptor::NO_SCALE_FACTOR, SunSpecPointType::UINT16},
+};
+
+SunSpecPointTable OutBackFMChargeController::pointTable() {
+  return {64112, 64, 0, POINTS_64112, 58, nullptr, nullptr, 0};
+}
+
+}
@@ -1,14 +1,20 @@
 #pragma once
 
 #include "SunSpecModel.h"
+#include "SunSpecPoint.h"
 
 namespace SunSpecModels {
 
 /**
  * All SunSpec compliant devices must include this as the first model
  */
-class Common : public SunSpecModel<1, 66> {
+class Common : public SunSpecModel<1, 66, 0> {
   public:
+    /**
+     * Descriptors of all points, for generic access.
+     */
+    static SunSpecPointTable pointTable();
+
     /**
      * Well known value registered with SunSpec for compliance
      */
@@ -44,8 +50,13 @@ class Common : public SunSpecModel<1, 66> {
 /**
  * Aggregates a collection of models for a given model id
  */
-class BasicAggregator : public SunSpecModel<2, 14> {
+class BasicAggregator : public SunSpecModel<2, 14, 0> {
   public:
+    /**
+     * Descriptors of all points, for generic access.
+     */
+    static SunSpecPointTable pointTable();
+
     /**
      * Aggregated model id
      */
@@ -101,8 +112,13 @@ class BasicAggregator : public SunSpecModel<2, 14> {
 /**
  * To be included first for a complete interface description
  */
-class CommunicationInterfaceHeader : public SunSpecModel<10, 4> {
+class CommunicationInterfaceHeader : public SunSpecModel<10, 4, 0> {
   public:
+    /**
+     * Descriptors of all points, for generic access.
+     */
+    static SunSpecPointTable pointTable();
+
     /**
      * Overall interface status
      */
@@ -123,8 +139,13 @@ class CommunicationInterfaceHeader : public SunSpecModel<10, 4> {
 /**
  * Include to support a wired ethernet port
  */
-class EthernetLinkLayer : public SunSpecModel<11, 13> {
+class EthernetLinkLayer : public SunSpecModel<11, 13, 0> {
   public:
+    /**
+     * Descriptors of all points, for generic access.
+     */
+    static SunSpecPointTable pointTable();
+
     /**
      * Interface speed in Mb/s [Mbps]
      */
@@ -165,8 +186,13 @@ class EthernetLinkLayer : public SunSpecModel<11, 13> {
 /**
  * Include to support an IPv4 protocol stack on this interface
  */
-class IPv4 : public SunSpecModel<12, 98> {
+class IPv4 : public SunSpecModel<12, 98, 0> {
   public:
+    /**
+     * Descriptors of all points, for generic access.
+     */
+    static SunSpecPointTable pointTable();
+
     /**
      * Interface name
      */
@@ -247,8 +273,13 @@ class IPv4 : public SunSpecModel<12, 98> {
 /**
  * Include to support an IPv6 protocol stack on this interface
  */
-class IPv6 : public SunSpecModel<13, 174> {
+class IPv6 : public SunSpecModel<13, 174, 0> {
   public:
+    /**
+     * Descriptors of all points, for generic access.
+     */
+    static SunSpecPointTable pointTable();
+
     /**
      * Interface name
      */
@@ -329,8 +360,13 @@ class IPv6 : public SunSpecModel<13, 174> {
 /**
  * Include this block to allow for a proxy server
  */
-class ProxyServer : public SunSpecModel<14, 52> {
+class ProxyServer : public SunSpecModel<14, 52, 0> {
   public:
+    /**
+     * Descriptors of all points, for generic access.
+     */
+    static SunSpecPointTable pointTable();
+
     /**
      * Interface name (8 chars)
      */
@@ -376,8 +412,13 @@ class ProxyServer : public SunSpecModel<14, 52> {
 /**
  * Interface counters
  */
-class InterfaceCountersModel : public SunSpecModel<15, 24> {
+class InterfaceCountersModel : public SunSpecModel<15, 24, 0> {
   public:
+    /**
+     * Descriptors of all points, for generic access.
+     */
+    static SunSpecPointTable pointTable();
+
     /**
      * Write a "1" to clear all counters
      */
@@ -443,8 +484,13 @@ class InterfaceCountersModel : public SunSpecModel<15, 24> {
 /**
  * Include this model for a simple IPv4 network stack
  */
-class SimpleIPNetwork : public SunSpecModel<16, 52> {
+class SimpleIPNetwork : public SunSpecModel<16, 52, 0> {
   public:
+    /**
+     * Descriptors of all points, for generic access.
+     */
+    static SunSpecPointTable pointTable();
+
     /**
      * Interface name.  (8 chars)
      */
@@ -500,8 +546,13 @@ class SimpleIPNetwork : public SunSpecModel<16, 52> {
 /**
  * Include this model for serial interface configuration support
  */
-class SerialInterface : public SunSpecModel<17, 12> {
+class SerialInterface : public SunSpecModel<17, 12, 0> {
   public:
+    /**
+     * Descriptors of all points, for generic access.
+     */
+    static SunSpecPointTable pointTable();
+
     /**
      * Interface name (8 chars)
      */
@@ -547,8 +598,13 @@ class SerialInterface : public SunSpecModel<17, 12> {
 /**
  * Include this model to support a cellular interface link
  */
-class CellularLink : public SunSpecModel<18, 22> {
+class CellularLink : public SunSpecModel<18, 22, 0> {
   public:
+    /**
+     * Descriptors of all points, for generic access.
+     */
+    static SunSpecPointTable pointTable();
+
     /**
      * Interface name
      */
@@ -579,8 +635,13 @@ class CellularLink : public SunSpecModel<18, 22> {
 /**
  * Include this model to configure a Point-to-Point Protocol link
  */
-class PPPLink : public SunSpecModel<19, 30> {
+class PPPLink : public SunSpecModel<19, 30, 0> {
   public:
+    /**
+     * Descriptors of all points, for generic access.
+     */
+    static SunSpecPointTable pointTable();
+
     /**
      * Interface name
      */
@@ -631,122 +692,127 @@ class PPPLink : public SunSpecModel<19, 30> {
 /**
  * Include this model for single phase inverter monitoring
  */
-class InverterSinglePhase : public SunSpecModel<101, 50> {
+class InverterSinglePhase : public SunSpecModel<101, 50, 0, 4, 11, 13, 15, 17, 19, 21, 24, 26, 28, 30, 35> {
   public:
+    /**
+     * Descriptors of all points, for generic access.
+     */
+    static SunSpecPointTable pointTable();
+
     /**
      * AC Current [A]
      */
-    inline float amps() const { return parse_uint16_sunssf(0, 4); }
+    inline float amps() const { return parse_uint16_sunssf<0, 4>(); }
 
     /**
      * Phase A Current [A]
      */
-    inline float ampsPhaseA() const { return parse_uint16_sunssf(1, 4); }
+    inline float ampsPhaseA() const { return parse_uint16_sunssf<1, 4>(); }
 
     /**
      * Phase B Current [A]
      */
-    inline float ampsPhaseB() const { return parse_uint16_sunssf(2, 4); }
+    inline float ampsPhaseB() const { return parse_uint16_sunssf<2, 4>(); }
 
     /**
      * Phase C Current [A]
      */
-    inline float ampsPhaseC() const { return parse_uint16_sunssf(3, 4); }
+    inline float ampsPhaseC() const { return parse_uint16_sunssf<3, 4>(); }
 
     /**
      * Phase Voltage AB [V]
      */
-    inline float phaseVoltageAB() const { return parse_uint16_sunssf(5, 11); }
+    inline float phaseVoltageAB() const { return parse_uint16_sunssf<5, 11>(); }
 
     /**
      * Phase Voltage BC [V]
      */
-    inline float phaseVoltageBC() const { return parse_uint16_sunssf(6, 11); }
+    inline float phaseVoltageBC() const { return parse_uint16_sunssf<6, 11>(); }
 
     /**
      * Phase Voltage CA [V]
      */
-    inline float phaseVoltageCA() const { return parse_uint16_sunssf(7, 11); }
+    inline float phaseVoltageCA() const { return parse_uint16_sunssf<7, 11>(); }
 
     /**
      * Phase Voltage AN [V]
      */
-    inline float phaseVoltageAN() const { return parse_uint16_sunssf(8, 11); }
+    inline float phaseVoltageAN() const { return parse_uint16_sunssf<8, 11>(); }
 
     /**
      * Phase Voltage BN [V]
      */
-    inline float phaseVoltageBN() const { return parse_uint16_sunssf(9, 11); }
+    inline float phaseVoltageBN() const { return parse_uint16_sunssf<9, 11>(); }
 
     /**
      * Phase Voltage CN [V]
      */
-    inline float phaseVoltageCN() const { return parse_uint16_sunssf(10, 11); }
+    inline float phaseVoltageCN() const { return parse_uint16_sunssf<10, 11>(); }
 
     /**
      * AC Power [W]
      */
-    inline float watts() const { return parse_int16_sunssf(12, 13); }
+    inline float watts() const { return parse_int16_sunssf<12, 13>(); }
 
     /**
      * Line Frequency [Hz]
      */
-    inline float hz() const { return parse_uint16_sunssf(14, 15); }
+    inline float hz() const { return parse_uint16_sunssf<14, 15>(); }
 
     /**
      * AC Apparent Power [VA]
      */
-    inline float VA() const { return parse_int16_sunssf(16, 17); }
+    inline float VA() const { return parse_int16_sunssf<16, 17>(); }
 
     /**
      * AC Reactive Power [var]
      */
-    inline float vAr() const { return parse_int16_sunssf(18, 19); }
+    inline float vAr() const { return parse_int16_sunssf<18, 19>(); }
 
     /**
      * AC Power Factor [Pct]
      */
-    inline float PF() const { return parse_int16_sunssf(20, 21); }
+    inline float PF() const { return parse_int16_sunssf<20, 21>(); }
 
     /**
      * AC Energy [Wh]
      */
-    inline double wattHours() const { return parse_acc32_sunssf(22, 24); }
+    inline double wattHours() const { return parse_acc32_sunssf<22, 24>(); }
 
     /**
      * DC Current [A]
      */
-    inline float DCAmps() const { return parse_uint16_sunssf(25, 26); }
+    inline float DCAmps() const { return parse_uint16_sunssf<25, 26>(); }
 
     /**
      * DC Voltage [V]
      */
-    inline float DCVoltage() const { return parse_uint16_sunssf(27, 28); }
+    inline float DCVoltage() const { return parse_uint16_sunssf<27, 28>(); }
 
     /**
      * DC Power [W]
      */
-    inline float DCWatts() const { return parse_int16_sunssf(29, 30); }
+    inline float DCWatts() const { return parse_int16_sunssf<29, 30>(); }
 
     /**
      * Cabinet Temperature [C]
      */
-    inline float cabinetTemperature() const { return parse_int16_sunssf(31, 35); }
+    inline float cabinetTemperature() const { return parse_int16_sunssf<31, 35>(); }
 
     /**
      * Heat Sink Temperature [C]
      */
-    inline float heatSinkTemperature() const { return parse_int16_sunssf(32, 35); }
+    inline float heatSinkTemperature() const { return parse_int16_sunssf<32, 35>(); }
 
     /**
      * Transformer Temperature [C]
      */
-    inline float transformerTemperature() const { return parse_int16_sunssf(33, 35); }
+    inline float transformerTemperature() const { return parse_int16_sunssf<33, 35>(); }
 
     /**
      * Other Temperature [C]
      */
-    inline float otherTemperature() const { return parse_int16_sunssf(34, 35); }
+    inline float otherTemperature() const { return parse_int16_sunssf<34, 35>(); }
 
     /**
      * Enumerated value.  Operating state
@@ -793,122 +859,127 @@ class InverterSinglePhase : public SunSpecModel<101, 50> {
 /**
  * Include this model for split phase inverter monitoring
  */
-class InverterSplitPhase : public SunSpecModel<102, 50> {
+class InverterSplitPhase : public SunSpecModel<102, 50, 0, 4, 11, 13, 15, 17, 19, 21, 24, 26, 28, 30, 35> {
   public:
+    /**
+     * Descriptors of all points, for generic access.
+     */
+    static SunSpecPointTable pointTable();
+
     /**
      * AC Current [A]
      */
-    inline float amps() const { return parse_uint16_sunssf(0, 4); }
+    inline float amps() const { return parse_uint16_sunssf<0, 4>(); }
 
     /**
      * Phase A Current [A]
      */
-    inline float ampsPhaseA() const { return parse_uint16_sunssf(1, 4); }
+    inline float ampsPhaseA() const { return parse_uint16_sunssf<1, 4>(); }
 
     /**
      * Phase B Current [A]
      */
-    inline float ampsPhaseB() const { return parse_uint16_sunssf(2, 4); }
+    inline float ampsPhaseB() const { return parse_uint16_sunssf<2, 4>(); }
 
     /**
      * Phase C Current [A]
      */
-    inline float ampsPhaseC() const { return parse_uint16_sunssf(3, 4); }
+    inline float ampsPhaseC() const { return parse_uint16_sunssf<3, 4>(); }
 
     /**
      * Phase Voltage AB [V]
      */
-    inline float phaseVoltageAB() const { return parse_uint16_sunssf(5, 11); }
+    inline float phaseVoltageAB() const { return parse_uint16_sunssf<5, 11>(); }
 
     /**
      * Phase Voltage BC [V]
      */
-    inline float phaseVoltageBC() const { return parse_uint16_sunssf(6, 11); }
+    inline float phaseVoltageBC() const { return parse_uint16_sunssf<6, 11>(); }
 
     /**
      * Phase Voltage CA [V]
      */
-    inline float phaseVoltageCA() const { return parse_uint16_sunssf(7, 11); }
+    inline float phaseVoltageCA() const { return parse_uint16_sunssf<7, 11>(); }
 
     /**
      * Phase Voltage AN [V]
      */
-    inline float phaseVoltageAN() const { return parse_uint16_sunssf(8, 11); }
+    inline float phaseVoltageAN() const { return parse_uint16_sunssf<8, 11>(); }
 
     /**
      * Phase Voltage BN [V]
      */
-    inline float phaseVoltageBN() const { return parse_uint16_sunssf(9, 11); }
+    inline float phaseVoltageBN() const { return parse_uint16_sunssf<9, 11>(); }
 
     /**
      * Phase Voltage CN [V]
      */
-    inline float phaseVoltageCN() const { return parse_uint16_sunssf(10, 11); }
+    inline float phaseVoltageCN() const { return parse_uint16_sunssf<10, 11>(); }
 
     /**
      * AC Power [W]
      */
-    inline float watts() const { return parse_int16_sunssf(12, 13); }
+    inline float watts() const { return parse_int16_sunssf<12, 13>(); }
 
     /**
      * Line Frequency [Hz]
      */
-    inline float hz() const { return parse_uint16_sunssf(14, 15); }
+    inline float hz() const { return parse_uint16_sunssf<14, 15>(); }
 
     /**
      * AC Apparent Power [VA]
      */
-    inline float VA() const { return parse_int16_sunssf(16, 17); }
+    inline float VA() const { return parse_int16_sunssf<16, 17>(); }
 
     /**
      * AC Reactive Power [var]
      */
-    inline float vAr() const { return parse_int16_sunssf(18, 19); }
+    inline float vAr() const { return parse_int16_sunssf<18, 19>(); }
 
     /**
      * AC Power Factor [Pct]
      */
-    inline float PF() const { return parse_int16_sunssf(20, 21); }
+    inline float PF() const { return parse_int16_sunssf<20, 21>(); }
 
     /**
      * AC Energy [Wh]
      */
-    inline double wattHours() const { return parse_acc32_sunssf(22, 24); }
+    inline double wattHours() const { return parse_acc32_sunssf<22, 24>(); }
 
     /**
      * DC Current [A]
      */
-    inline float DCAmps() const { return parse_uint16_sunssf(25, 26); }
+    inline float DCAmps() const { return parse_uint16_sunssf<25, 26>(); }
 
     /**
      * DC Voltage [V]
      */
-    inline float DCVoltage() const { return parse_uint16_sunssf(27, 28); }
+    inline float DCVoltage() const { return parse_uint16_sunssf<27, 28>(); }
 
     /**
      * DC Power [W]
      */
-    inline float DCWatts() const { return parse_int16_sunssf(29, 30); }
+    inline float DCWatts() const { return parse_int16_sunssf<29, 30>(); }
 
     /**
      * Cabinet Temperature [C]
      */
-    inline float cabinetTemperature() const { return parse_int16_sunssf(31, 35); }
+    inline float cabinetTemperature() const { return parse_int16_sunssf<31, 35>(); }
 
     /**
      * Heat Sink Temperature [C]
      */
-    inline float heatSinkTemperature() const { return parse_int16_sunssf(32, 35); }
+    inline float heatSinkTemperature() const { return parse_int16_sunssf<32, 35>(); }
 
     /**
      * Transformer Temperature [C]
      */
-    inline float transformerTemperature() const { return parse_int16_sunssf(33, 35); }
+    inline float transformerTemperature() const { return parse_int16_sunssf<33, 35>(); }
 
     /**
      * Other Temperature [C]
      */
-    inline float otherTemperature() const { return parse_int16_sunssf(34, 35); }
+    inline float otherTemperature() const { return parse_int16_sunssf<34, 35>(); }
 
     /**
      * Enumerated value.  Operating state
@@ -955,122 +1026,127 @@ class InverterSplitPhase : public SunSpecModel<102, 50> {
 /**
  * Include this model for three phase inverter monitoring
  */
-class InverterThreePhase : public SunSpecModel<103, 50> {
+class InverterThreePhase : public SunSpecModel<103, 50, 0, 4, 11, 13, 15, 17, 19, 21, 24, 26, 28, 30, 35> {
   public:
+    /**
+     * Descriptors of all points, for generic access.
+     */
+    static SunSpecPointTable pointTable();
+
     /**
      * AC Current [A]
      */
-    inline float amps() const { return parse_uint16_sunssf(0, 4); }
+    inline float amps() const { return parse_uint16_sunssf<0, 4>(); }
 
     /**
      * Phase A Current [A]
      */
-    inline float ampsPhaseA() const { return parse_uint16_sunssf(1, 4); }
+    inline float ampsPhaseA() const { return parse_uint16_sunssf<1, 4>(); }
 
     /**
      * Phase B Current [A]
      */
-    inline float ampsPhaseB() const { return parse_uint16_sunssf(2, 4); }
+    inline float ampsPhaseB() const { return parse_uint16_sunssf<2, 4>(); }
 
     /**
      * Phase C Current [A]
      */
-    inline float ampsPhaseC() const { return parse_uint16_sunssf(3, 4); }
+    inline float ampsPhaseC() const { return parse_uint16_sunssf<3, 4>(); }
 
     /**
      * Phase Voltage AB [V]
      */
-    inline float phaseVoltageAB() const { return parse_uint16_sunssf(5, 11); }
+    inline float phaseVoltageAB() const { return parse_uint16_sunssf<5, 11>(); }
 
     /**
      * Phase Voltage BC [V]
      */
-    inline float phaseVoltageBC() const { return parse_uint16_sunssf(6, 11); }
+    inline float phaseVoltageBC() const { return parse_uint16_sunssf<6, 11>(); }
 
     /**
      * Phase Voltage CA [V]
      */
-    inline float phaseVoltageCA() const { return parse_uint16_sunssf(7, 11); }
+    inline float phaseVoltageCA() const { return parse_uint16_sunssf<7, 11>(); }
 
     /**
      * Phase Voltage AN [V]
      */
-    inline float phaseVoltageAN() const { return parse_uint16_sunssf(8, 11); }
+    inline float phaseVoltageAN() const { return parse_uint16_sunssf<8, 11>(); }
 
     /**
      * Phase Voltage BN [V]
      */
-    inline float phaseVoltageBN() const { return parse_uint16_sunssf(9, 11); }
+    inline float phaseVoltageBN() const { return parse_uint16_sunssf<9, 11>(); }
 
     /**
      * Phase Voltage CN [V]
      */
-    inline float phaseVoltageCN() const { return parse_uint16_sunssf(10, 11); }
+    inline float phaseVoltageCN() const { return parse_uint16_sunssf<10, 11>(); }
 
     /**
      * AC Power [W]
      */
-    inline float watts() const { return parse_int16_sunssf(12, 13); }
+    inline float watts() const { return parse_int16_sunssf<12, 13>(); }
 
     /**
      * Line Frequency [Hz]
      */
-    inline float hz() const { return parse_uint16_sunssf(14, 15); }
+    inline float hz() const { return parse_uint16_sunssf<14, 15>(); }
 
     /**
      * AC Apparent Power [VA]
      */
-    inline float VA() const { return parse_int16_sunssf(16, 17); }
+    inline float VA() const { return parse_int16_sunssf<16, 17>(); }
 
     /**
      * AC Reactive Power [var]
      */
-    inline float vAr() const { return parse_int16_sunssf(18, 19); }
+    inline float vAr() const { return parse_int16_sunssf<18, 19>(); }
 
     /**
      * AC Power Factor [Pct]
      */
-    inline float PF() const { return parse_int16_sunssf(20, 21); }
+    inline float PF() const { return parse_int16_sunssf<20, 21>(); }
 
     /**
      * AC Energy [Wh]
      */
-    inline double wattHours() const { return parse_acc32_sunssf(22, 24); }
+    inline double wattHours() const { return parse_acc32_sunssf<22, 24>(); }
 
     /**
      * DC Current [A]
      */
-    inline float DCAmps() const { return parse_uint16_sunssf(25, 26); }
+    inline float DCAmps() const { return parse_uint16_sunssf<25, 26>(); }
 
     /**
      * DC Voltage [V]
      */
-    inline float DCVoltage() const { return parse_uint16_sunssf(27, 28); }
+    inline float DCVoltage() const { return parse_uint16_sunssf<27, 28>(); }
 
     /**
      * DC Power [W]
      */
-    inline float DCWatts() const { return parse_int16_sunssf(29, 30); }
+    inline float DCWatts() const { return parse_int16_sunssf<29, 30>(); }
 
     /**
      * Cabinet Temperature [C]
      */
-    inline float cabinetTemperature() const { return parse_int16_sunssf(31, 35); }
+    inline float cabinetTemperature() const { return parse_int16_sunssf<31, 35>(); }
 
     /**
      * Heat Sink Temperature [C]
      */
-    inline float heatSinkTemperature() const { return parse_int16_sunssf(32, 35); }
+    inline float heatSinkTemperature() const { return parse_int16_sunssf<32, 35>(); }
 
     /**
      * Transformer Temperature [C]
      */
-    inline float transformerTemperature() const { return parse_int16_sunssf(33, 35); }
+    inline float transformerTemperature() const { return parse_int16_sunssf<33, 35>(); }
 
     /**
      * Other Temperature [C]
      */
-    inline float otherTemperature() const { return parse_int16_sunssf(34, 35); }
+    inline float otherTemperature() const { return parse_int16_sunssf<34, 35>(); }
 
     /**
      * Enumerated value.  Operating state
@@ -1117,8 +1193,13 @@ class InverterThreePhase : public SunSpecModel<103, 50> {
 /**
  * Include this model for single phase inverter monitoring using float values
  */
-class InverterSinglePhaseFLOAT : public SunSpecModel<111, 60> {
+class InverterSinglePhaseFLOAT : public SunSpecModel<111, 60, 0> {
   public:
+    /**
+     * Descriptors of all points, for generic access.
+     */
+    static SunSpecPointTable pointTable();
+
     /**
      * AC Current [A]
      */
@@ -1279,8 +1360,13 @@ class InverterSinglePhaseFLOAT : public SunSpecModel<111, 60> {
 /**
  * Include this model for split phase inverter monitoring using float values
  */
-class InverterSplitPhaseFLOAT : public SunSpecModel<112, 60> {
+class InverterSplitPhaseFLOAT : public SunSpecModel<112, 60, 0> {
   public:
+    /**
+     * Descriptors of all points, for generic access.
+     */
+    static SunSpecPointTable pointTable();
+
     /**
      * AC Current [A]
      */
@@ -1441,8 +1527,13 @@ class InverterSplitPhaseFLOAT : public SunSpecModel<112, 60> {
 /**
  * Include this model for three phase inverter monitoring using float values
  */
-class InverterThreePhaseFLOAT : public SunSpecModel<113, 60> {
+class InverterThreePhaseFLOAT : public SunSpecModel<113, 60, 0> {
   public:
+    /**
+     * Descriptors of all points, for generic access.
+     */
+    static SunSpecPointTable pointTable();
+
     /**
      * AC Current [A]
      */
@@ -1603,8 +1694,13 @@ class InverterThreePhaseFLOAT : public SunSpecModel<113, 60> {
 /**
  * Inverter Controls Nameplate Ratings 
  */
-class Nameplate : public SunSpecModel<120, 26> {
+class Nameplate : public SunSpecModel<120, 26, 0, 2, 4, 9, 11, 16, 18, 20, 22, 24> {
   public:
+    /**
+     * Descriptors of all points, for generic access.
+     */
+    static SunSpecPointTable pointTable();
+
     /**
      * Type of DER device. Default value is 4 to indicate PV device.
      */
@@ -1613,159 +1709,164 @@ class Nameplate : public SunSpecModel<120, 26> {
     /**
      * Continuous power output capability of the inverter. [W]
      */
-    inline float wRtg() const { return parse_uint16_sunssf(1, 2); }
+    inline float wRtg() const { return parse_uint16_sunssf<1, 2>(); }
 
     /**
      * Continuous Volt-Ampere capability of the inverter. [VA]
      */
-    inline float vARtg() const { return parse_uint16_sunssf(3, 4); }
+    inline float vARtg() const { return parse_uint16_sunssf<3, 4>(); }
 
     /**
      * Continuous VAR capability of the inverter in quadrant 1. [var]
      */
-    inline float vArRtgQ1() const { return parse_int16_sunssf(5, 9); }
+    inline float vArRtgQ1() const { return parse_int16_sunssf<5, 9>(); }
 
     /**
      * Continuous VAR capability of the inverter in quadrant 2. [var]
      */
-    inline float vArRtgQ2() const { return parse_int16_sunssf(6, 9); }
+    inline float vArRtgQ2() const { return parse_int16_sunssf<6, 9>(); }
 
     /**
      * Continuous VAR capability of the inverter in quadrant 3. [var]
      */
-    inline float vArRtgQ3() const { return parse_int16_sunssf(7, 9); }
+    inline float vArRtgQ3() const { return parse_int16_sunssf<7, 9>(); }
 
     /**
      * Continuous VAR capability of the inverter in quadrant 4. [var]
      */
-    inline float vArRtgQ4() const { return parse_int16_sunssf(8, 9); }
+    inline float vArRtgQ4() const { return parse_int16_sunssf<8, 9>(); }
 
     /**
      * Maximum RMS AC current level capability of the inverter. [A]
      */
-    inline float aRtg() const { return parse_uint16_sunssf(10, 11); }
+    inline float aRtg() const { return parse_uint16_sunssf<10, 11>(); }
 
     /**
      * Minimum power factor capability of the inverter in quadrant 1. [cos()]
      */
-    inline float pFRtgQ1() const { return parse_int16_sunssf(12, 16); }
+    inline float pFRtgQ1() const { return parse_int16_sunssf<12, 16>(); }
 
     /**
      * Minimum power factor capability of the inverter in quadrant 2. [cos()]
      */
-    inline float pFRtgQ2() const { return parse_int16_sunssf(13, 16); }
+    inline float pFRtgQ2() const { return parse_int16_sunssf<13, 16>(); }
 
     /**
      * Minimum power factor capability of the inverter in quadrant 3. [cos()]
      */
-    inline float pFRtgQ3() const { return parse_int16_sunssf(14, 16); }
+    inline float pFRtgQ3() const { return parse_int16_sunssf<14, 16>(); }
 
     /**
      * Minimum power factor capability of the inverter in quadrant 4. [cos()]
      */
-    inline float pFRtgQ4() const { return parse_int16_sunssf(15, 16); }
+    inline float pFRtgQ4() const { return parse_int16_sunssf<15, 16>(); }
 
     /**
      * Nominal energy rating of storage device. [Wh]
      */
-    inline float wHRtg() const { return parse_uint16_sunssf(17, 18); }
+    inline float wHRtg() const { return parse_uint16_sunssf<17, 18>(); }
 
     /**
      * The usable capacity of the battery.  Maximum charge minus minimum charge from a technology capability perspective (Amp-hour capacity rating). [AH]
      */
-    inline float ahrRtg() const { return parse_uint16_sunssf(19, 20); }
+    inline float ahrRtg() const { return parse_uint16_sunssf<19, 20>(); }
 
     /**
      * Maximum rate of energy transfer into the storage device. [W]
      */
-    inline float maxChaRte() const { return parse_uint16_sunssf(21, 22); }
+    inline float maxChaRte() const { return parse_uint16_sunssf<21, 22>(); }
 
     /**
      * Maximum rate of energy transfer out of the storage device. [W]
      */
-    inline float maxDisChaRte() const { return parse_uint16_sunssf(23, 24); }
+    inline float maxDisChaRte() const { return parse_uint16_sunssf<23, 24>(); }
 
 };
 
 /**
  * Inverter Controls Basic Settings 
  */
-class BasicSettings : public SunSpecModel<121, 30> {
+class BasicSettings : public SunSpecModel<121, 30, 0, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29> {
   public:
+    /**
+     * Descriptors of all points, for generic access.
+     */
+    static SunSpecPointTable pointTable();
+
     /**
      * Setting for maximum power output. Default to WRtg. [W]
      */
-    inline float wMax() const { return parse_uint16_sunssf(0, 20); }
+    inline float wMax() const { return parse_uint16_sunssf<0, 20>(); }
 
     /**
      * Voltage at the PCC. [V]
      */
-    inline float vRef() const { return parse_uint16_sunssf(1, 21); }
+    inline float vRef() const { return parse_uint16_sunssf<1, 21>(); }
 
     /**
      * Offset  from PCC to inverter. [V]
      */
-    inline float vRefOfs() const { return parse_int16_sunssf(2, 22); }
+    inline float vRefOfs() const { return parse_int16_sunssf<2, 22>(); }
 
     /**
      * Setpoint for maximum voltage. [V]
      */
-    inline float vMax() const { return parse_uint16_sunssf(3, 23); }
+    inline float vMax() const { return parse_uint16_sunssf<3, 23>(); }
 
     /**
      * Setpoint for minimum voltage. [V]
      */
-    inline float vMin() const { return parse_uint16_sunssf(4, 23); }
+    inline float vMin() const { return parse_uint16_sunssf<4, 23>(); }
 
     /**
      * Setpoint for maximum apparent power. Default to VARtg. [VA]
      */
-    inline float vAMax() const { return parse_uint16_sunssf(5, 24); }
+    inline float vAMax() const { return parse_uint16_sunssf<5, 24>(); }
 
     /**
      * Setting for maximum reactive power in quadrant 1. Default to VArRtgQ1. [var]
      */
-    inline float vArMaxQ1() const { return parse_int16_sunssf(6, 25); }
+    inline float vArMaxQ1() const { return parse_int16_sunssf<6, 25>(); }
 
     /**
      * Setting for maximum reactive power in quadrant 2. Default to VArRtgQ2. [var]
      */
-    inline float vArMaxQ2() const { return parse_int16_sunssf(7, 25); }
+    inline float vArMaxQ2() const { return parse_int16_sunssf<7, 25>(); }
 
     /**
      * Setting for maximum reactive power in quadrant 3. Default to VArRtgQ3. [var]
      */
-    inline float vArMaxQ3() const { return parse_int16_sunssf(8, 25); }
+    inline float vArMaxQ3() const { return parse_int16_sunssf<8, 25>(); }
 
     /**
      * Setting for maximum reactive power in quadrant 4. Default to VArRtgQ4. [var]
      */
-    inline float vArMaxQ4() const { return parse_int16_sunssf(9, 25); }
+    inline float vArMaxQ4() const { return parse_int16_sunssf<9, 25>(); }
 
     /**
      * Default ramp rate of change of active power due to command or internal action. [% WMax/sec]
      */
-    inline float wGra() const { return parse_uint16_sunssf(10, 26); }
+    inline float wGra() const { return parse_uint16_sunssf<10, 26>(); }
 
     /**
      * Setpoint for minimum power factor value in quadrant 1. Default to PFRtgQ1. [cos()]
      */
-    inline float pFMinQ1() const { return parse_int16_sunssf(11, 27); }
+    inline float pFMinQ1() const { return parse_int16_sunssf<11, 27>(); }
 
     /**
      * Setpoint for minimum power factor value in quadrant 2. Default to PFRtgQ2. [cos()]
      */
-    inline float pFMinQ2() const { return parse_int16_sunssf(12, 27); }
+    inline float pFMinQ2() const { return parse_int16_sunssf<12, 27>(); }
 
     /**
      * Setpoint for minimum power factor value in quadrant 3. Default to PFRtgQ3. [cos()]
      */
-    inline float pFMinQ3() const { return parse_int16_sunssf(13, 27); }
+    inline float pFMinQ3() const { return parse_int16_sunssf<13, 27>(); }
 
     /**
      * Setpoint for minimum power factor value in quadrant 4. Default to PFRtgQ4. [cos()]
      */
-    inline float pFMinQ4() const { return parse_int16_sunssf(14, 27); }
+    inline float pFMinQ4() const { return parse_int16_sunssf<14, 27>(); }
 
     /**
      * VAR action on change between charging and discharging: 1=switch 2=maintain VAR characterization.
@@ -1780,12 +1881,12 @@ class BasicSettings : public SunSpecModel<121, 30> {
     /**
      * Setpoint for maximum ramp rate as percentage of nominal maximum ramp rate. This setting will limit the rate that watts delivery to the grid can increase or decrease in response to intermittent PV generation. [% WGra]
      */
-    inline float maxRmpRte() const { return parse_uint16_sunssf(17, 28); }
+    inline float maxRmpRte() const { return parse_uint16_sunssf<17, 28>(); }
 
     /**
      * Setpoint for nominal frequency at the ECP. [Hz]
      */
-    inline float eCPNomHz() const { return parse_uint16_sunssf(18, 29); }
+    inline float eCPNomHz() const { return parse_uint16_sunssf<18, 29>(); }
 
     /**
      * Identity of connected phase for single phase inverters. A=1 B=2 C=3.
@@ -1797,8 +1898,13 @@ class BasicSettings : public SunSpecModel<121, 30> {
 /**
  * Inverter Controls Extended Measurements and Status 
  */
-class Measurements_Status : public SunSpecModel<122, 44> {
+class Measurements_Status : public SunSpecModel<122, 44, 0, 28, 30, 43> {
   public:
+    /**
+     * Descriptors of all points, for generic access.
+     */
+    static SunSpecPointTable pointTable();
+
     /**
      * PV inverter present/available status. Enumerated value.
      */
@@ -1847,12 +1953,12 @@ class Measurements_Status : public SunSpecModel<122, 44> {
     /**
      * Amount of VARs available without impacting watts output. [var]
      */
-    inline float vArAval() const { return parse_int16_sunssf(27, 28); }
+    inline float vArAval() const { return parse_int16_sunssf<27, 28>(); }
 
     /**
      * Amount of Watts available. [var]
      */
-    inline float wAval() const { return parse_uint16_sunssf(29, 30); }
+    inline float wAval() const { return parse_uint16_sunssf<29, 30>(); }
 
     /**
      * Bit Mask indicating setpoint limit(s) reached.
@@ -1882,15 +1988,20 @@ class Measurements_Status : public SunSpecModel<122, 44> {
     /**
      * Isolation resistance. [ohms]
      */
-    inline float ris() const { return parse_uint16_sunssf(42, 43); }
+    inline float ris() const { return parse_uint16_sunssf<42, 43>(); }
 
 };
 
 /**
  * Immediate Inverter Controls 
  */
-class ImmediateControls : public SunSpecModel<123, 24> {
+class ImmediateControls : public SunSpecModel<123, 24, 0, 21, 22, 23> {
   public:
+    /**
+     * Descriptors of all points, for generic access.
+     */
+    static SunSpecPointTable pointTable();
+
     /**
      * Time window for connect/disconnect. [Secs]
      */
@@ -1909,7 +2020,7 @@ class ImmediateControls : public SunSpecModel<123, 24> {
     /**
      * Set power output to specified level. [% WMax]
      */
-    inline float wMaxLimPct() const { return parse_uint16_sunssf(3, 21); }
+    inline float wMaxLimPct() const { return parse_uint16_sunssf<3, 21>(); }
 
     /**
      * Time window for power limit change. [Secs]
@@ -1934,7 +2045,7 @@ class ImmediateControls : public SunSpecModel<123, 24> {
     /**
      * Set power factor to specific value - cosine of angle. [cos()]
      */
-    inline float outPFSet() const { return parse_int16_sunssf(8, 22); }
+    inline float outPFSet() const { return parse_int16_sunssf<8, 22>(); }
 
     /**
      * Time window for power factor change. [Secs]
@@ -1959,17 +2070,17 @@ class ImmediateControls : public SunSpecModel<123, 24> {
     /**
      * Reactive power in percent of WMax. [% WMax]
      */
-    inline float vArWMaxPct() const { return parse_int16_sunssf(13, 23); }
+    inline float vArWMaxPct() const { return parse_int16_sunssf<13, 23>(); }
 
     /**
      * Reactive power in percent of VArMax. [% VArMax]
      */
-    inline float vArMaxPct() const { return parse_int16_sunssf(14, 23); }
+    inline float vArMaxPct() const { return parse_int16_sunssf<14, 23>(); }
 
     /**
      * Reactive power in percent of VArAval. [% VArAval]
      */
-    inline float vArAvalPct() const { return parse_int16_sunssf(15, 23); }
+    inline float vArAvalPct() const { return parse_int16_sunssf<15, 23>(); }
 
     /**
      * Time window for VAR limit change. [Secs]
@@ -2001,22 +2112,27 @@ class ImmediateControls : public SunSpecModel<123, 24> {
 /**
  * Basic Storage Controls 
  */
-class Storage : public SunSpecModel<124, 24> {
+class Storage : public SunSpecModel<124, 24, 0, 16, 17, 18, 19, 20, 21, 22, 23> {
   public:
+    /**
+     * Descriptors of all points, for generic access.
+     */
+    static SunSpecPointTable pointTable();
+
     /**
      * Setpoint for maximum charge. [W]
      */
-    inline float wChaMax() const { return parse_uint16_sunssf(0, 16); }
+    inline float wChaMax() const { return parse_uint16_sunssf<0, 16>(); }
 
     /**
      * Setpoint for maximum charging rate. Default is MaxChaRte. [% WChaMax/sec]
      */
-    inline float wChaGra() const { return parse_uint16_sunssf(1, 17); }
+    inline float wChaGra() const { return parse_uint16_sunssf<1, 17>(); }
 
     /**
      * Setpoint for maximum discharge rate. Default is MaxDisChaRte. [% WChaMax/sec]
      */
-    inline float wDisChaGra() const { return parse_uint16_sunssf(2, 17); }
+    inline float wDisChaGra() const { return parse_uint16_sunssf<2, 17>(); }
 
     /**
      * Activate hold/discharge/charge storage control mode. Bitfield value.
@@ -2026,27 +2142,27 @@ class Storage : public SunSpecModel<124, 24> {
     /**
      * Setpoint for maximum charging VA. [VA]
      */
-    inline float vAChaMax() const { return parse_uint16_sunssf(4, 18); }
+    inline float vAChaMax() const { return parse_uint16_sunssf<4, 18>(); }
 
     /**
      * Setpoint for minimum reserve for storage as a percentage of the nominal maximum storage. [% WChaMax]
      */
-    inline float minRsvPct() const { return parse_uint16_sunssf(5, 19); }
+    inline float minRsvPct() const { return parse_uint16_sunssf<5, 19>(); }
 
     /**
      * Currently available energy as a percent of the capacity rating. [% AhrRtg]
      */
-    inline float chaState() const { return parse_uint16_sunssf(6, 20); }
+    inline float chaState() const { return parse_uint16_sunssf<6, 20>(); }
 
     /**
      * State of charge (ChaState) minus storage reserve (MinRsvPct) times capacity rating (AhrRtg). [AH]
      */
-    inline float storAval() const { return parse_uint16_sunssf(7, 21); }
+    inline float storAval() const { return parse_uint16_sunssf<7, 21>(); }
 
     /**
      * Internal battery voltage. [V]
      */
-    inline float inBatV() const { return parse_uint16_sunssf(8, 22); }
+    inline float inBatV() const { return parse_uint16_sunssf<8, 22>(); }
 
     /**
      * Charge status of storage device. Enumerated value.
@@ -2056,12 +2172,12 @@ class Storage : public SunSpecModel<124, 24> {
     /**
      * Percent of max discharge rate. [% WDisChaMax]
      */
-    inline float outWRte() const { return parse_int16_sunssf(10, 23); }
+    inline float outWRte() const { return parse_int16_sunssf<10, 23>(); }
 
     /**
      * Percent of max charging rate. [ % WChaMax]
      */
-    inline float inWRte() const { return parse_int16_sunssf(11, 23); }
+    inline float inWRte() const { return parse_int16_sunssf<11, 23>(); }
 
     /**
      * Time window for charge/discharge rate change. [Secs]
@@ -2085,8 +2201,13 @@ class Storage : public SunSpecModel<124, 24> {
 /**
  * Pricing Signal  
  */
-class Pricing : public SunSpecModel<125, 8> {
+class Pricing : public SunSpecModel<125, 8, 0, 6> {
   public:
+    /**
+     * Descriptors of all points, for generic access.
+     */
+    static SunSpecPointTable pointTable();
+
     /**
      * Is price-based charge/discharge mode active?
      */
@@ -2100,7 +2221,7 @@ class Pricing : public SunSpecModel<125, 8> {
     /**
      * Utility/ESP specific pricing signal. Content depends on pricing signal type. When H/M/L type is specified. Low=0; Med=1; High=2.
      */
-    inline float sig() const { return parse_int16_sunssf(2, 6); }
+    inline float sig() const { return parse_int16_sunssf<2, 6>(); }
 
     /**
      * Time window for charge/discharge pricing change. [Secs]
@@ -2122,22 +2243,27 @@ class Pricing : public SunSpecModel<125, 8> {
 /**
  * Parameterized Frequency-Watt 
  */
-class FreqWattParam : public SunSpecModel<127, 10> {
+class FreqWattParam : public SunSpecModel<127, 10, 0, 6, 7, 8> {
   public:
+    /**
+     * Descriptors of all points, for generic access.
+     */
+    static SunSpecPointTable pointTable();
+
     /**
      * The slope of the reduction in the maximum allowed watts output as a function of frequency. [% PM/Hz]
      */
-    inline float wGra() const { return parse_uint16_sunssf(0, 6); }
+    inline float wGra() const { return parse_uint16_sunssf<0, 6>(); }
 
     /**
      * The frequency deviation from nominal frequency (ECPNomHz) at which a snapshot of the instantaneous power output is taken to act as the CAPPED power level (PM) and above which reduction in power output occurs. [Hz]
      */
-    inline float hzStr() const { return parse_int16_sunssf(1, 7); }
+    inline float hzStr() const { return parse_int16_sunssf<1, 7>(); }
 
     /**
      * The frequency deviation from nominal frequency (ECPNomHz) at which curtailed power output may return to normal and the cap on the power level value is removed. [Hz]
      */
-    inline float hzStop() const { return parse_int16_sunssf(2, 7); }
+    inline float hzStop() const { return parse_int16_sunssf<2, 7>(); }
 
     /**
      * Enable hysteresis
@@ -2152,15 +2278,20 @@ class FreqWattParam : public SunSpecModel<127, 10> {
     /**
      * The maximum time-based rate of change at which power output returns to normal after having been capped by an over frequency event. [% WMax/min]
      */
-    inline float hzStopWGra() const { return parse_uint16_sunssf(5, 8); }
+    inline float hzStopWGra() const { return parse_uint16_sunssf<5, 8>(); }
 
 };
 
 /**
  * Dynamic Reactive Current 
  */
-class DynamicReactiveCurrent : public SunSpecModel<128, 14> {
+class DynamicReactiveCurrent : public SunSpecModel<128, 14, 0, 11, 12> {
   public:
+    /**
+     * Descriptors of all points, for generic access.
+     */
+    static SunSpecPointTable pointTable();
+
     /**
      * Indicates if gradients trend toward zero at the edges of the deadband or trend toward zero at the center of the deadband.
      */
@@ -2169,12 +2300,12 @@ class DynamicReactiveCurrent : public SunSpecModel<128, 14> {
     /**
      * The gradient used to increase capacitive dynamic current. A value of 0 indicates no additional reactive current support. [%ARtg/%dV]
      */
-    inline float arGraSag() const { return parse_uint16_sunssf(1, 11); }
+    inline float arGraSag() const { return parse_uint16_sunssf<1, 11>(); }
 
     /**
      * The gradient used to increase inductive dynamic current.  A value of 0 indicates no additional reactive current support. [%ARtg/%dV]
      */
-    inline float arGraSwell() const { return parse_uint16_sunssf(2, 11); }
+    inline float arGraSwell() const { return parse_uint16_sunssf<2, 11>(); }
 
     /**
      * Activate dynamic reactive current model
@@ -2189,22 +2320,22 @@ class DynamicReactiveCurrent : public SunSpecModel<128, 14> {
     /**
      * The lower delta voltage limit for which negative voltage deviations less than this value no dynamic vars are produced. [% VRef]
      */
-    inline float dbVMin() const { return parse_uint16_sunssf(5, 12); }
+    inline float dbVMin() const { return parse_uint16_sunssf<5, 12>(); }
 
     /**
      * The upper delta voltage limit for which positive voltage deviations less than this value no dynamic current produced. [% VRef]
      */
-    inline float dbVMax() const { return parse_uint16_sunssf(6, 12); }
+    inline float dbVMax() const { return parse_uint16_sunssf<6, 12>(); }
 
     /**
      * Block zone voltage which defines a lower voltage boundary below which no dynamic current is produced. [% VRef]
      */
-    inline float blkZnV() const { return parse_uint16_sunssf(7, 12); }
+    inline float blkZnV() const { return parse_uint16_sunssf<7, 12>(); }
 
     /**
      * Hysteresis voltage used with BlkZnV. [% VRef]
      */
-    inline float hysBlkZnV() const { return parse_uint16_sunssf(8, 12); }
+    inline float hysBlkZnV() const { return parse_uint16_sunssf<8, 12>(); }
 
     /**
      * Block zone time the time before which reactive current support remains active regardless of how low the voltage drops. [mSecs]
@@ -2221,354 +2352,465 @@ class DynamicReactiveCurrent : public SunSpecModel<128, 14> {
 /**
  * Inverter controls extended settings 
  */
-class ExtendedSettings : public SunSpecModel<145, 8> {
+class ExtendedSettings : public SunSpecModel<145, 8, 0, 7> {
   public:
+    /**
+     * Descriptors of all points, for generic access.
+     */
+    static SunSpecPointTable pointTable();
+
     /**
      * Ramp up rate as a percentage of max current. [Pct]
      */
-    inline float rampUpRate() const { return parse_uint16_sunssf(0, 7); }
+    inline float rampUpRate() const { return parse_uint16_sunssf<0, 7>(); }
 
     /**
      * Ramp down rate as a percentage of max current. [Pct]
      */
-    inline float nomRmpDnRte() const { return parse_uint16_sunssf(1, 7); }
+    inline float nomRmpDnRte() const { return parse_uint16_sunssf<1, 7>(); }
 
     /**
      * Emergency ramp up rate as a percentage of max current. [Pct]
      */
-    inline float emergencyRampUpRate() const { return parse_uint16_sunssf(2, 7); }
+    inline float emergencyRampUpRate() const { return parse_uint16_sunssf<2, 7>(); }
 
     /**
      * Emergency ramp down rate as a percentage of max current. [Pct]
      */
-    inline float emergencyRampDownRate() const { return parse_uint16_sunssf(3, 7); }
+    inline float emergencyRampDownRate() const { return parse_uint16_sunssf<3, 7>(); }
 
     /**
      * Connect ramp up rate as a percentage of max current. [Pct]
      */
-    inline float connectRampUpRate() const { return parse_uint16_sunssf(4, 7); }
+    inline float connectRampUpRate() const { return parse_uint16_sunssf<4, 7>(); }
 
     /**
      * Connect ramp down rate as a percentage of max current. [Pct]
      */
-    inline float connectRampDownRate() const { return parse_uint16_sunssf(5, 7); }
+    inline float connectRampDownRate() const { return parse_uint16_sunssf<5, 7>(); }
 
     /**
      * Ramp rate specified in percent of max current. [Pct]
      */
-    inline float defaultRampRate() const { return parse_uint16_sunssf(6, 7); }
+    inline float defaultRampRate() const { return parse_uint16_sunssf<6, 7>(); }
+
+};
+
+/**
+ * Multiple MPPT Inverter Extension Model
+ */
+class MultipleMPPTInverterExtensionModel : public SunSpecModel<160, 8, 20, 0, 1, 2, 3> {
+  public:
+    /**
+     * Descriptors of all points, for generic access.
+     */
+    static SunSpecPointTable pointTable();
+
+    /**
+     * Global Events
+     */
+    inline uint32_t globalEvents() const { return parse_bitfield32(4); }
+
+    /**
+     * Number of Modules
+     */
+    inline uint16_t numberOfModules() const { return parse_uint16(6); }
+
+    /**
+     * Timestamp Period
+     */
+    inline uint16_t timestampPeriod() const { return parse_uint16(7); }
+
+    /**
+     * Module
+     */
+    class Module : public SunSpecGroup<MultipleMPPTInverterExtensionModel, 20> {
+      public:
+        using SunSpecGroup::SunSpecGroup;
+
+        /**
+         * Input ID
+         */
+        inline uint16_t inputID() const { return groupModel().parse_uint16(groupOffset() + 0); }
+
+        /**
+         * Input ID Sting
+         */
+        inline String inputIDString() const { return groupModel().parse_string(groupOffset() + 1, 8); }
+
+        /**
+         * DC Current [A]
+         */
+        inline float DCCurrent() const { return groupModel().parse_uint16_sunssf<0>(groupOffset() + 9); }
+
+        /**
+         * DC Voltage [V]
+         */
+        inline float DCVoltage() const { return groupModel().parse_uint16_sunssf<1>(groupOffset() + 10); }
+
+        /**
+         * DC Power [W]
+         */
+        inline float DCPower() const { return groupModel().parse_uint16_sunssf<2>(groupOffset() + 11); }
+
+        /**
+         * Lifetime Energy [Wh]
+         */
+        inline double lifetimeEnergy() const { return groupModel().parse_acc32_sunssf<3>(groupOffset() + 12); }
+
+        /**
+         * Timestamp [Secs]
+         */
+        inline uint32_t timestamp() const { return groupModel().parse_uint32(groupOffset() + 14); }
+
+        /**
+         * Temperature [C]
+         */
+        inline int16_t temperature() const { return groupModel().parse_int16(groupOffset() + 16); }
+
+        /**
+         * Operating State
+         */
+        inline uint16_t operatingState() const { return groupModel().parse_enum16(groupOffset() + 17); }
+
+        /**
+         * Module Events
+         */
+        inline uint32_t moduleEvents() const { return groupModel().parse_bitfield32(groupOffset() + 18); }
+
+    };
+
+    /**
+     * Number of repeats of `Module`.
+     */
+    inline uint16_t numModules() const { return numRepeats(); }
+
+    /**
+     * The repeat of `Module` with the given index, which must be less than `numModules()`.
+     */
+    inline Module module(uint16_t index) const { return Module(this, repeatOffset(index)); }
+
+    /**
+     * All repeats of `Module`, for iteration.
+     */
+    inline SunSpecRepeats<Module> modules() const { return SunSpecRepeats<Module>(this, repeatOffset(0), numRepeats()); }
 
 };
 
 /**
  * Include this model for single phase (AN or AB) metering
  */
-class MeterSinglePhaseSinglePhaseANOrABMeter : public SunSpecModel<201, 105> {
+class MeterSinglePhaseSinglePhaseANOrABMeter : public SunSpecModel<201, 105, 0, 4, 13, 15, 20, 25, 30, 35, 52, 69, 102> {
   public:
+    /**
+     * Descriptors of all points, for generic access.
+     */
+    static SunSpecPointTable pointTable();
+
     /**
      * Total AC Current [A]
      */
-    inline float amps() const { return parse_int16_sunssf(0, 4); }
+    inline float amps() const { return parse_int16_sunssf<0, 4>(); }
 
     /**
      * Phase A Current [A]
      */
-    inline float ampsPhaseA() const { return parse_int16_sunssf(1, 4); }
+    inline float ampsPhaseA() const { return parse_int16_sunssf<1, 4>(); }
 
     /**
      * Phase B Current [A]
      */
-    inline float ampsPhaseB() const { return parse_int16_sunssf(2, 4); }
+    inline float ampsPhaseB() const { return parse_int16_sunssf<2, 4>(); }
 
     /**
      * Phase C Current [A]
      */
-    inline float ampsPhaseC() const { return parse_int16_sunssf(3, 4); }
+    inline float ampsPhaseC() const { return parse_int16_sunssf<3, 4>(); }
 
     /**
      * Line to Neutral AC Voltage (average of active phases) [V]
      */
-    inline float voltageLN() const { return parse_int16_sunssf(5, 13); }
+    inline float voltageLN() const { return parse_int16_sunssf<5, 13>(); }
 
     /**
      * Phase Voltage AN [V]
      */
-    inline float phaseVoltageAN() const { return parse_int16_sunssf(6, 13); }
+    inline float phaseVoltageAN() const { return parse_int16_sunssf<6, 13>(); }
 
     /**
      * Phase Voltage BN [V]
      */
-    inline float phaseVoltageBN() const { return parse_int16_sunssf(7, 13); }
+    inline float phaseVoltageBN() const { return parse_int16_sunssf<7, 13>(); }
 
     /**
      * Phase Voltage CN [V]
      */
-    inline float phaseVoltageCN() const { return parse_int16_sunssf(8, 13); }
+    inline float phaseVoltageCN() const { return parse_int16_sunssf<8, 13>(); }
 
     /**
      * Line to Line AC Voltage (average of active phases) [V]
      */
-    inline float voltageLL() const { return parse_int16_sunssf(9, 13); }
+    inline float voltageLL() const { return parse_int16_sunssf<9, 13>(); }
 
     /**
      * Phase Voltage AB [V]
      */
-    inline float phaseVoltageAB() const { return parse_int16_sunssf(10, 13); }
+    inline float phaseVoltageAB() const { return parse_int16_sunssf<10, 13>(); }
 
     /**
      * Phase Voltage BC [V]
      */
-    inline float phaseVoltageBC() const { return parse_int16_sunssf(11, 13); }
+    inline float phaseVoltageBC() const { return parse_int16_sunssf<11, 13>(); }
 
     /**
      * Phase Voltage CA [V]
      */
-    inline float phaseVoltageCA() const { return parse_int16_sunssf(12, 13); }
+    inline float phaseVoltageCA() const { return parse_int16_sunssf<12, 13>(); }
 
     /**
      * Frequency [Hz]
      */
-    inline float hz() const { return parse_int16_sunssf(14, 15); }
+    inline float hz() const { return parse_int16_sunssf<14, 15>(); }
 
     /**
      * Total Real Power [W]
      */
-    inline float watts() const { return parse_int16_sunssf(16, 20); }
+    inline float watts() const { return parse_int16_sunssf<16, 20>(); }
 
     /**
      * [W]
      */
-    inline float wattsPhaseA() const { return parse_int16_sunssf(17, 20); }
+    inline float wattsPhaseA() const { return parse_int16_sunssf<17, 20>(); }
 
     /**
      * [W]
      */
-    inline float wattsPhaseB() const { return parse_int16_sunssf(18, 20); }
+    inline float wattsPhaseB() const { return parse_int16_sunssf<18, 20>(); }
 
     /**
      * [W]
      */
-    inline float wattsPhaseC() const { return parse_int16_sunssf(19, 20); }
+    inline float wattsPhaseC() const { return parse_int16_sunssf<19, 20>(); }
 
     /**
      * AC Apparent Power [VA]
      */
-    inline float VA() const { return parse_int16_sunssf(21, 25); }
+    inline float VA() const { return parse_int16_sunssf<21, 25>(); }
 
     /**
      * [VA]
      */
-    inline float VAPhaseA() const { return parse_int16_sunssf(22, 25); }
+    inline float VAPhaseA() const { return parse_int16_sunssf<22, 25>(); }
 
     /**
      * [VA]
      */
-    inline float VAPhaseB() const { return parse_int16_sunssf(23, 25); }
+    inline float VAPhaseB() const { return parse_int16_sunssf<23, 25>(); }
 
     /**
      * [VA]
      */
-    inline float VAPhaseC() const { return parse_int16_sunssf(24, 25); }
+    inline float VAPhaseC() const { return parse_int16_sunssf<24, 25>(); }
 
     /**
      * Reactive Power [var]
      */
-    inline float VAR() const { return parse_int16_sunssf(26, 30); }
+    inline float VAR() const { return parse_int16_sunssf<26, 30>(); }
 
     /**
      * [var]
      */
-    inline float VARPhaseA() const { return parse_int16_sunssf(27, 30); }
+    inline float VARPhaseA() const { return parse_int16_sunssf<27, 30>(); }
 
     /**
      * [var]
      */
-    inline float VARPhaseB() const { return parse_int16_sunssf(28, 30); }
+    inline float VARPhaseB() const { return parse_int16_sunssf<28, 30>(); }
 
     /**
      * [var]
      */
-    inline float VARPhaseC() const { return parse_int16_sunssf(29, 30); }
+    inline float VARPhaseC() const { return parse_int16_sunssf<29, 30>(); }
 
     /**
      * Power Factor [Pct]
      */
-    inline float PF() const { return parse_int16_sunssf(31, 35); }
+    inline float PF() const { return parse_int16_sunssf<31, 35>(); }
 
     /**
      * [Pct]
      */
-    inline float PFPhaseA() const { return parse_int16_sunssf(32, 35); }
+    inline float PFPhaseA() const { return parse_int16_sunssf<32, 35>(); }
 
     /**
      * [Pct]
      */
-    inline float PFPhaseB() const { return parse_int16_sunssf(33, 35); }
+    inline float PFPhaseB() const { return parse_int16_sunssf<33, 35>(); }
 
     /**
      * [Pct]
      */
-    inline float PFPhaseC() const { return parse_int16_sunssf(34, 35); }
+    inline float PFPhaseC() const { return parse_int16_sunssf<34, 35>(); }
 
     /**
      * Total Real Energy Exported [Wh]
      */
-    inline double totalWattHoursExported() const { return parse_acc32_sunssf(36, 52); }
+    inline double totalWattHoursExported() const { return parse_acc32_sunssf<36, 52>(); }
 
     /**
      * [Wh]
      */
-    inline double totalWattHoursExportedPhaseA() const { return parse_acc32_sunssf(38, 52); }
+    inline double totalWattHoursExportedPhaseA() const { return parse_acc32_sunssf<38, 52>(); }
 
     /**
      * [Wh]
      */
-    inline double totalWattHoursExportedPhaseB() const { return parse_acc32_sunssf(40, 52); }
+    inline double totalWattHoursExportedPhaseB() const { return parse_acc32_sunssf<40, 52>(); }
 
     /**
      * [Wh]
      */
-    inline double totalWattHoursExportedPhaseC() const { return parse_acc32_sunssf(42, 52); }
+    inline double totalWattHoursExportedPhaseC() const { return parse_acc32_sunssf<42, 52>(); }
 
     /**
      * Total Real Energy Imported [Wh]
      */
-    inline double totalWattHoursImported() const { return parse_acc32_sunssf(44, 52); }
+    inline double totalWattHoursImported() const { return parse_acc32_sunssf<44, 52>(); }
 
     /**
      * [Wh]
      */
-    inline double totalWattHoursImportedPhaseA() const { return parse_acc32_sunssf(46, 52); }
+    inline double totalWattHoursImportedPhaseA() const { return parse_acc32_sunssf<46, 52>(); }
 
     /**
      * [Wh]
      */
-    inline double totalWattHoursImportedPhaseB() const { return parse_acc32_sunssf(48, 52); }
+    inline double totalWattHoursImportedPhaseB() const { return parse_acc32_sunssf<48, 52>(); }
 
     /**
      * [Wh]
      */
-    inline double totalWattHoursImportedPhaseC() const { return parse_acc32_sunssf(50, 52); }
+    inline double totalWattHoursImportedPhaseC() const { return parse_acc32_sunssf<50, 52>(); }
 
     /**
      * Total Apparent Energy Exported [VAh]
      */
-    inline double totalVAHoursExported() const { return parse_acc32_sunssf(53, 69); }
+    inline double totalVAHoursExported() const { return parse_acc32_sunssf<53, 69>(); }
 
     /**
      * [VAh]
      */
-    inline double totalVAHoursExportedPhaseA() const { return parse_acc32_sunssf(55, 69); }
+    inline double totalVAHoursExportedPhaseA() const { return parse_acc32_sunssf<55, 69>(); }
 
     /**
      * [VAh]
      */
-    inline double totalVAHoursExportedPhaseB() const { return parse_acc32_sunssf(57, 69); }
+    inline double totalVAHoursExportedPhaseB() const { return parse_acc32_sunssf<57, 69>(); }
 
     /**
      * [VAh]
      */
-    inline double totalVAHoursExportedPhaseC() const { return parse_acc32_sunssf(59, 69); }
+    inline double totalVAHoursExportedPhaseC() const { return parse_acc32_sunssf<59, 69>(); }
 
     /**
      * Total Apparent Energy Imported [VAh]
      */
-    inline double totalVAHoursImported() const { return parse_acc32_sunssf(61, 69); }
+    inline double totalVAHoursImported() const { return parse_acc32_sunssf<61, 69>(); }
 
     /**
      * [VAh]
      */
-    inline double totalVAHoursImportedPhaseA() const { return parse_acc32_sunssf(63, 69); }
+    inline double totalVAHoursImportedPhaseA() const { return parse_acc32_sunssf<63, 69>(); }
 
     /**
      * [VAh]
      */
-    inline double totalVAHoursImportedPhaseB() const { return parse_acc32_sunssf(65, 69); }
+    inline double totalVAHoursImportedPhaseB() const { return parse_acc32_sunssf<65, 69>(); }
 
     /**
      * [VAh]
      */
-    inline double totalVAHoursImportedPhaseC() const { return parse_acc32_sunssf(67, 69); }
+    inline double totalVAHoursImportedPhaseC() const { return parse_acc32_sunssf<67, 69>(); }
 
     /**
      * Total Reactive Energy Imported Quadrant 1 [varh]
      */
-    inline double totalVARHoursImportedQ1() const { return parse_acc32_sunssf(70, 102); }
+    inline double totalVARHoursImportedQ1() const { return parse_acc32_sunssf<70, 102>(); }
 
     /**
      * [varh]
      */
-    inline double totalVArHoursImportedQ1PhaseA() const { return parse_acc32_sunssf(72, 102); }
+    inline double totalVArHoursImportedQ1PhaseA() const { return parse_acc32_sunssf<72, 102>(); }
 
     /**
      * [varh]
      */
-    inline double totalVArHoursImportedQ1PhaseB() const { return parse_acc32_sunssf(74, 102); }
+    inline double totalVArHoursImportedQ1PhaseB() const { return parse_acc32_sunssf<74, 102>(); }
 
     /**
      * [varh]
      */
-    inline double totalVArHoursImportedQ1PhaseC() const { return parse_acc32_sunssf(76, 102); }
+    inline double totalVArHoursImportedQ1PhaseC() const { return parse_acc32_sunssf<76, 102>(); }
 
     /**
      * Total Reactive Power Imported Quadrant 2 [varh]
      */
-    inline double totalVArHoursImportedQ2() const { return parse_acc32_sunssf(78, 102); }
+    inline double totalVArHoursImportedQ2() const { return parse_acc32_sunssf<78, 102>(); }
 
     /**
      * [varh]
      */
-    inline double totalVArHoursImportedQ2PhaseA() const { return parse_acc32_sunssf(80, 102); }
+    inline double totalVArHoursImportedQ2PhaseA() const { return parse_acc32_sunssf<80, 102>(); }
 
     /**
      * [varh]
      */
-    inline double totalVArHoursImportedQ2PhaseB() const { return parse_acc32_sunssf(82, 102); }
+    inline double totalVArHoursImportedQ2PhaseB() const { return parse_acc32_sunssf<82, 102>(); }
 
     /**
      * [varh]
      */
-    inline double totalVArHoursImportedQ2PhaseC() const { return parse_acc32_sunssf(84, 102); }
+    inline double totalVArHoursImportedQ2PhaseC() const { return parse_acc32_sunssf<84, 102>(); }
 
     /**
      * Total Reactive Power Exported Quadrant 3 [varh]
      */
-    inline double totalVArHoursExportedQ3() const { return parse_acc32_sunssf(86, 102); }
+    inline double totalVArHoursExportedQ3() const { return parse_acc32_sunssf<86, 102>(); }
 
     /**
      * [varh]
      */
-    inline double totalVArHoursExportedQ3PhaseA() const { return parse_acc32_sunssf(88, 102); }
+    inline double totalVArHoursExportedQ3PhaseA() const { return parse_acc32_sunssf<88, 102>(); }
 
     /**
      * [varh]
      */
-    inline double totalVArHoursExportedQ3PhaseB() const { return parse_acc32_sunssf(90, 102); }
+    inline double totalVArHoursExportedQ3PhaseB() const { return parse_acc32_sunssf<90, 102>(); }
 
     /**
      * [varh]
      */
-    inline double totalVArHoursExportedQ3PhaseC() const { return parse_acc32_sunssf(92, 102); }
+    inline double totalVArHoursExportedQ3PhaseC() const { return parse_acc32_sunssf<92, 102>(); }
 
     /**
      * Total Reactive Power Exported Quadrant 4 [varh]
      */
-    inline double totalVArHoursExportedQ4() const { return parse_acc32_sunssf(94, 102); }
+    inline double totalVArHoursExportedQ4() const { return parse_acc32_sunssf<94, 102>(); }
 
     /**
      * [varh]
      */
-    inline double totalVArHoursExportedQ4ImportedPhaseA() const { return parse_acc32_sunssf(96, 102); }
+    inline double totalVArHoursExportedQ4ImportedPhaseA() const { return parse_acc32_sunssf<96, 102>(); }
 
     /**
      * [varh]
      */
-    inline double totalVArHoursExportedQ4ImportedPhaseB() const { return parse_acc32_sunssf(98, 102); }
+    inline double totalVArHoursExportedQ4ImportedPhaseB() const { return parse_acc32_sunssf<98, 102>(); }
 
     /**
      * [varh]
      */
-    inline double totalVArHoursExportedQ4ImportedPhaseC() const { return parse_acc32_sunssf(100, 102); }
+    inline double totalVArHoursExportedQ4ImportedPhaseC() const { return parse_acc32_sunssf<100, 102>(); }
 
     /**
      * Meter Event Flags
@@ -2577,312 +2819,317 @@ class MeterSinglePhaseSinglePhaseANOrABMeter : public SunSpecModel<201, 105> {
 
 };
 
-class SplitSinglePhaseABNMeter_202 : public SunSpecModel<202, 105> {
+class SplitSinglePhaseABNMeter_202 : public SunSpecModel<202, 105, 0, 4, 13, 15, 20, 25, 30, 35, 52, 69, 102> {
   public:
+    /**
+     * Descriptors of all points, for generic access.
+     */
+    static SunSpecPointTable pointTable();
+
     /**
      * Total AC Current [A]
      */
-    inline float amps() const { return parse_int16_sunssf(0, 4); }
+    inline float amps() const { return parse_int16_sunssf<0, 4>(); }
 
     /**
      * Phase A Current [A]
      */
-    inline float ampsPhaseA() const { return parse_int16_sunssf(1, 4); }
+    inline float ampsPhaseA() const { return parse_int16_sunssf<1, 4>(); }
 
     /**
      * Phase B Current [A]
      */
-    inline float ampsPhaseB() const { return parse_int16_sunssf(2, 4); }
+    inline float ampsPhaseB() const { return parse_int16_sunssf<2, 4>(); }
 
     /**
      * Phase C Current [A]
      */
-    inline float ampsPhaseC() const { return parse_int16_sunssf(3, 4); }
+    inline float ampsPhaseC() const { return parse_int16_sunssf<3, 4>(); }
 
     /**
      * Line to Neutral AC Voltage (average of active phases) [V]
      */
-    inline float voltageLN() const { return parse_int16_sunssf(5, 13); }
+    inline float voltageLN() const { return parse_int16_sunssf<5, 13>(); }
 
     /**
      * Phase Voltage AN [V]
      */
-    inline float phaseVoltageAN() const { return parse_int16_sunssf(6, 13); }
+    inline float phaseVoltageAN() const { return parse_int16_sunssf<6, 13>(); }
 
     /**
      * Phase Voltage BN [V]
      */
-    inline float phaseVoltageBN() const { return parse_int16_sunssf(7, 13); }
+    inline float phaseVoltageBN() const { return parse_int16_sunssf<7, 13>(); }
 
     /**
      * Phase Voltage CN [V]
      */
-    inline float phaseVoltageCN() const { return parse_int16_sunssf(8, 13); }
+    inline float phaseVoltageCN() const { return parse_int16_sunssf<8, 13>(); }
 
     /**
      * Line to Line AC Voltage (average of active phases) [V]
      */
-    inline float voltageLL() const { return parse_int16_sunssf(9, 13); }
+    inline float voltageLL() const { return parse_int16_sunssf<9, 13>(); }
 
     /**
      * Phase Voltage AB [V]
      */
-    inline float phaseVoltageAB() const { return parse_int16_sunssf(10, 13); }
+    inline float phaseVoltageAB() const { return parse_int16_sunssf<10, 13>(); }
 
     /**
      * Phase Voltage BC [V]
      */
-    inline float phaseVoltageBC() const { return parse_int16_sunssf(11, 13); }
+    inline float phaseVoltageBC() const { return parse_int16_sunssf<11, 13>(); }
 
     /**
      * Phase Voltage CA [V]
      */
-    inline float phaseVoltageCA() const { return parse_int16_sunssf(12, 13); }
+    inline float phaseVoltageCA() const { return parse_int16_sunssf<12, 13>(); }
 
     /**
      * Frequency [Hz]
      */
-    inline float hz() const { return parse_int16_sunssf(14, 15); }
+    inline float hz() const { return parse_int16_sunssf<14, 15>(); }
 
     /**
      * Total Real Power [W]
      */
-    inline float watts() const { return parse_int16_sunssf(16, 20); }
+    inline float watts() const { return parse_int16_sunssf<16, 20>(); }
 
     /**
      * [W]
      */
-    inline float wattsPhaseA() const { return parse_int16_sunssf(17, 20); }
+    inline float wattsPhaseA() const { return parse_int16_sunssf<17, 20>(); }
 
     /**
      * [W]
      */
-    inline float wattsPhaseB() const { return parse_int16_sunssf(18, 20); }
+    inline float wattsPhaseB() const { return parse_int16_sunssf<18, 20>(); }
 
     /**
      * [W]
      */
-    inline float wattsPhaseC() const { return parse_int16_sunssf(19, 20); }
+    inline float wattsPhaseC() const { return parse_int16_sunssf<19, 20>(); }
 
     /**
      * AC Apparent Power [VA]
      */
-    inline float VA() const { return parse_int16_sunssf(21, 25); }
+    inline float VA() const { return parse_int16_sunssf<21, 25>(); }
 
     /**
      * [VA]
      */
-    inline float VAPhaseA() const { return parse_int16_sunssf(22, 25); }
+    inline float VAPhaseA() const { return parse_int16_sunssf<22, 25>(); }
 
     /**
      * [VA]
      */
-    inline float VAPhaseB() const { return parse_int16_sunssf(23, 25); }
+    inline float VAPhaseB() const { return parse_int16_sunssf<23, 25>(); }
 
     /**
      * [VA]
      */
-    inline float VAPhaseC() const { return parse_int16_sunssf(24, 25); }
+    inline float VAPhaseC() const { return parse_int16_sunssf<24, 25>(); }
 
     /**
      * Reactive Power [var]
      */
-    inline float VAR() const { return parse_int16_sunssf(26, 30); }
+    inline float VAR() const { return parse_int16_sunssf<26, 30>(); }
 
     /**
      * [var]
      */
-    inline float VARPhaseA() const { return parse_int16_sunssf(27, 30); }
+    inline float VARPhaseA() const { return parse_int16_sunssf<27, 30>(); }
 
     /**
      * [var]
      */
-    inline float VARPhaseB() const { return parse_int16_sunssf(28, 30); }
+    inline float VARPhaseB() const { return parse_int16_sunssf<28, 30>(); }
 
     /**
      * [var]
      */
-    inline float VARPhaseC() const { return parse_int16_sunssf(29, 30); }
+    inline float VARPhaseC() const { return parse_int16_sunssf<29, 30>(); }
 
     /**
      * Power Factor [Pct]
      */
-    inline float PF() const { return parse_int16_sunssf(31, 35); }
+    inline float PF() const { return parse_int16_sunssf<31, 35>(); }
 
     /**
      * [Pct]
      */
-    inline float PFPhaseA() const { return parse_int16_sunssf(32, 35); }
+    inline float PFPhaseA() const { return parse_int16_sunssf<32, 35>(); }
 
     /**
      * [Pct]
      */
-    inline float PFPhaseB() const { return parse_int16_sunssf(33, 35); }
+    inline float PFPhaseB() const { return parse_int16_sunssf<33, 35>(); }
 
     /**
      * [Pct]
      */
-    inline float PFPhaseC() const { return parse_int16_sunssf(34, 35); }
+    inline float PFPhaseC() const { return parse_int16_sunssf<34, 35>(); }
 
     /**
      * Total Real Energy Exported [Wh]
      */
-    inline double totalWattHoursExported() const { return parse_acc32_sunssf(36, 52); }
+    inline double totalWattHoursExported() const { return parse_acc32_sunssf<36, 52>(); }
 
     /**
      * [Wh]
      */
-    inline double totalWattHoursExportedPhaseA() const { return parse_acc32_sunssf(38, 52); }
+    inline double totalWattHoursExportedPhaseA() const { return parse_acc32_sunssf<38, 52>(); }
 
     /**
      * [Wh]
      */
-    inline double totalWattHoursExportedPhaseB() const { return parse_acc32_sunssf(40, 52); }
+    inline double totalWattHoursExportedPhaseB() const { return parse_acc32_sunssf<40, 52>(); }
 
     /**
      * [Wh]
      */
-    inline double totalWattHoursExportedPhaseC() const { return parse_acc32_sunssf(42, 52); }
+    inline double totalWattHoursExportedPhaseC() const { return parse_acc32_sunssf<42, 52>(); }
 
     /**
      * Total Real Energy Imported [Wh]
      */
-    inline double totalWattHoursImported() const { return parse_acc32_sunssf(44, 52); }
+    inline double totalWattHoursImported() const { return parse_acc32_sunssf<44, 52>(); }
 
     /**
      * [Wh]
      */
-    inline double totalWattHoursImportedPhaseA() const { return parse_acc32_sunssf(46, 52); }
+    inline double totalWattHoursImportedPhaseA() const { return parse_acc32_sunssf<46, 52>(); }
 
     /**
      * [Wh]
      */
-    inline double totalWattHoursImportedPhaseB() const { return parse_acc32_sunssf(48, 52); }
+    inline double totalWattHoursImportedPhaseB() const { return parse_acc32_sunssf<48, 52>(); }
 
     /**
      * [Wh]
      */
-    inline double totalWattHoursImportedPhaseC() const { return parse_acc32_sunssf(50, 52); }
+    inline double totalWattHoursImportedPhaseC() const { return parse_acc32_sunssf<50, 52>(); }
 
     /**
      * Total Apparent Energy Exported [VAh]
      */
-    inline double totalVAHoursExported() const { return parse_acc32_sunssf(53, 69); }
+    inline double totalVAHoursExported() const { return parse_acc32_sunssf<53, 69>(); }
 
     /**
      * [VAh]
      */
-    inline double totalVAHoursExportedPhaseA() const { return parse_acc32_sunssf(55, 69); }
+    inline double totalVAHoursExportedPhaseA() const { return parse_acc32_sunssf<55, 69>(); }
 
     /**
      * [VAh]
      */
-    inline double totalVAHoursExportedPhaseB() const { return parse_acc32_sunssf(57, 69); }
+    inline double totalVAHoursExportedPhaseB() const { return parse_acc32_sunssf<57, 69>(); }
 
     /**
      * [VAh]
      */
-    inline double totalVAHoursExportedPhaseC() const { return parse_acc32_sunssf(59, 69); }
+    inline double totalVAHoursExportedPhaseC() const { return parse_acc32_sunssf<59, 69>(); }
 
     /**
      * Total Apparent Energy Imported [VAh]
      */
-    inline double totalVAHoursImported() const { return parse_acc32_sunssf(61, 69); }
+    inline double totalVAHoursImported() const { return parse_acc32_sunssf<61, 69>(); }
 
     /**
      * [VAh]
      */
-    inline double totalVAHoursImportedPhaseA() const { return parse_acc32_sunssf(63, 69); }
+    inline double totalVAHoursImportedPhaseA() const { return parse_acc32_sunssf<63, 69>(); }
 
     /**
      * [VAh]
      */
-    inline double totalVAHoursImportedPhaseB() const { return parse_acc32_sunssf(65, 69); }
+    inline double totalVAHoursImportedPhaseB() const { return parse_acc32_sunssf<65, 69>(); }
 
     /**
      * [VAh]
      */
-    inline double totalVAHoursImportedPhaseC() const { return parse_acc32_sunssf(67, 69); }
+    inline double totalVAHoursImportedPhaseC() const { return parse_acc32_sunssf<67, 69>(); }
 
     /**
      * Total Reactive Energy Imported Quadrant 1 [varh]
      */
-    inline double totalVARHoursImportedQ1() const { return parse_acc32_sunssf(70, 102); }
+    inline double totalVARHoursImportedQ1() const { return parse_acc32_sunssf<70, 102>(); }
 
     /**
      * [varh]
      */
-    inline double totalVArHoursImportedQ1PhaseA() const { return parse_acc32_sunssf(72, 102); }
+    inline double totalVArHoursImportedQ1PhaseA() const { return parse_acc32_sunssf<72, 102>(); }
 
     /**
      * [varh]
      */
-    inline double totalVArHoursImportedQ1PhaseB() const { return parse_acc32_sunssf(74, 102); }
+    inline double totalVArHoursImportedQ1PhaseB() const { return parse_acc32_sunssf<74, 102>(); }
 
     /**
      * [varh]
      */
-    inline double totalVArHoursImportedQ1PhaseC() const { return parse_acc32_sunssf(76, 102); }
+    inline double totalVArHoursImportedQ1PhaseC() const { return parse_acc32_sunssf<76, 102>(); }
 
     /**
      * Total Reactive Power Imported Quadrant 2 [varh]
      */
-    inline double totalVArHoursImportedQ2() const { return parse_acc32_sunssf(78, 102); }
+    inline double totalVArHoursImportedQ2() const { return parse_acc32_sunssf<78, 102>(); }
 
     /**
      * [varh]
      */
-    inline double totalVArHoursImportedQ2PhaseA() const { return parse_acc32_sunssf(80, 102); }
+    inline double totalVArHoursImportedQ2PhaseA() const { return parse_acc32_sunssf<80, 102>(); }
 
     /**
      * [varh]
      */
-    inline double totalVArHoursImportedQ2PhaseB() const { return parse_acc32_sunssf(82, 102); }
+    inline double totalVArHoursImportedQ2PhaseB() const { return parse_acc32_sunssf<82, 102>(); }
 
     /**
      * [varh]
      */
-    inline double totalVArHoursImportedQ2PhaseC() const { return parse_acc32_sunssf(84, 102); }
+    inline double totalVArHoursImportedQ2PhaseC() const { return parse_acc32_sunssf<84, 102>(); }
 
     /**
      * Total Reactive Power Exported Quadrant 3 [varh]
      */
-    inline double totalVArHoursExportedQ3() const { return parse_acc32_sunssf(86, 102); }
+    inline double totalVArHoursExportedQ3() const { return parse_acc32_sunssf<86, 102>(); }
 
     /**
      * [varh]
      */
-    inline double totalVArHoursExportedQ3PhaseA() const { return parse_acc32_sunssf(88, 102); }
+    inline double totalVArHoursExportedQ3PhaseA() const { return parse_acc32_sunssf<88, 102>(); }
 
     /**
      * [varh]
      */
-    inline double totalVArHoursExportedQ3PhaseB() const { return parse_acc32_sunssf(90, 102); }
+    inline double totalVArHoursExportedQ3PhaseB() const { return parse_acc32_sunssf<90, 102>(); }
 
     /**
      * [varh]
      */
-    inline double totalVArHoursExportedQ3PhaseC() const { return parse_acc32_sunssf(92, 102); }
+    inline double totalVArHoursExportedQ3PhaseC() const { return parse_acc32_sunssf<92, 102>(); }
 
     /**
      * Total Reactive Power Exported Quadrant 4 [varh]
      */
-    inline double totalVArHoursExportedQ4() const { return parse_acc32_sunssf(94, 102); }
+    inline double totalVArHoursExportedQ4() const { return parse_acc32_sunssf<94, 102>(); }
 
     /**
      * [varh]
      */
-    inline double totalVArHoursExportedQ4ImportedPhaseA() const { return parse_acc32_sunssf(96, 102); }
+    inline double totalVArHoursExportedQ4ImportedPhaseA() const { return parse_acc32_sunssf<96, 102>(); }
 
     /**
      * [varh]
      */
-    inline double totalVArHoursExportedQ4ImportedPhaseB() const { return parse_acc32_sunssf(98, 102); }
+    inline double totalVArHoursExportedQ4ImportedPhaseB() const { return parse_acc32_sunssf<98, 102>(); }
 
     /**
      * [varh]
      */
-    inline double totalVArHoursExportedQ4ImportedPhaseC() const { return parse_acc32_sunssf(100, 102); }
+    inline double totalVArHoursExportedQ4ImportedPhaseC() const { return parse_acc32_sunssf<100, 102>(); }
 
     /**
      * Meter Event Flags
@@ -2891,312 +3138,317 @@ class SplitSinglePhaseABNMeter_202 : public SunSpecModel<202, 105> {
 
 };
 
-class WyeConnectThreePhaseAbcnMeter_203 : public SunSpecModel<203, 105> {
+class WyeConnectThreePhaseAbcnMeter_203 : public SunSpecModel<203, 105, 0, 4, 13, 15, 20, 25, 30, 35, 52, 69, 102> {
   public:
+    /**
+     * Descriptors of all points, for generic access.
+     */
+    static SunSpecPointTable pointTable();
+
     /**
      * Total AC Current [A]
      */
-    inline float amps() const { return parse_int16_sunssf(0, 4); }
+    inline float amps() const { return parse_int16_sunssf<0, 4>(); }
 
     /**
      * Phase A Current [A]
      */
-    inline float ampsPhaseA() const { return parse_int16_sunssf(1, 4); }
+    inline float ampsPhaseA() const { return parse_int16_sunssf<1, 4>(); }
 
     /**
      * Phase B Current [A]
      */
-    inline float ampsPhaseB() const { return parse_int16_sunssf(2, 4); }
+    inline float ampsPhaseB() const { return parse_int16_sunssf<2, 4>(); }
 
     /**
      * Phase C Current [A]
      */
-    inline float ampsPhaseC() const { return parse_int16_sunssf(3, 4); }
+    inline float ampsPhaseC() const { return parse_int16_sunssf<3, 4>(); }
 
     /**
      * Line to Neutral AC Voltage (average of active phases) [V]
      */
-    inline float voltageLN() const { return parse_int16_sunssf(5, 13); }
+    inline float voltageLN() const { return parse_int16_sunssf<5, 13>(); }
 
     /**
      * Phase Voltage AN [V]
      */
-    inline float phaseVoltageAN() const { return parse_int16_sunssf(6, 13); }
+    inline float phaseVoltageAN() const { return parse_int16_sunssf<6, 13>(); }
 
     /**
      * Phase Voltage BN [V]
      */
-    inline float phaseVoltageBN() const { return parse_int16_sunssf(7, 13); }
+    inline float phaseVoltageBN() const { return parse_int16_sunssf<7, 13>(); }
 
     /**
      * Phase Voltage CN [V]
      */
-    inline float phaseVoltageCN() const { return parse_int16_sunssf(8, 13); }
+    inline float phaseVoltageCN() const { return parse_int16_sunssf<8, 13>(); }
 
     /**
      * Line to Line AC Voltage (average of active phases) [V]
      */
-    inline float voltageLL() const { return parse_int16_sunssf(9, 13); }
+    inline float voltageLL() const { return parse_int16_sunssf<9, 13>(); }
 
     /**
      * Phase Voltage AB [V]
      */
-    inline float phaseVoltageAB() const { return parse_int16_sunssf(10, 13); }
+    inline float phaseVoltageAB() const { return parse_int16_sunssf<10, 13>(); }
 
     /**
      * Phase Voltage BC [V]
      */
-    inline float phaseVoltageBC() const { return parse_int16_sunssf(11, 13); }
+    inline float phaseVoltageBC() const { return parse_int16_sunssf<11, 13>(); }
 
     /**
      * Phase Voltage CA [V]
      */
-    inline float phaseVoltageCA() const { return parse_int16_sunssf(12, 13); }
+    inline float phaseVoltageCA() const { return parse_int16_sunssf<12, 13>(); }
 
     /**
      * Frequency [Hz]
      */
-    inline float hz() const { return parse_int16_sunssf(14, 15); }
+    inline float hz() const { return parse_int16_sunssf<14, 15>(); }
 
     /**
      * Total Real Power [W]
      */
-    inline float watts() const { return parse_int16_sunssf(16, 20); }
+    inline float watts() const { return parse_int16_sunssf<16, 20>(); }
 
     /**
      * [W]
      */
-    inline float wattsPhaseA() const { return parse_int16_sunssf(17, 20); }
+    inline float wattsPhaseA() const { return parse_int16_sunssf<17, 20>(); }
 
     /**
      * [W]
      */
-    inline float wattsPhaseB() const { return parse_int16_sunssf(18, 20); }
+    inline float wattsPhaseB() const { return parse_int16_sunssf<18, 20>(); }
 
     /**
      * [W]
      */
-    inline float wattsPhaseC() const { return parse_int16_sunssf(19, 20); }
+    inline float wattsPhaseC() const { return parse_int16_sunssf<19, 20>(); }
 
     /**
      * AC Apparent Power [VA]
      */
-    inline float VA() const { return parse_int16_sunssf(21, 25); }
+    inline float VA() const { return parse_int16_sunssf<21, 25>(); }
 
     /**
      * [VA]
      */
-    inline float VAPhaseA() const { return parse_int16_sunssf(22, 25); }
+    inline float VAPhaseA() const { return parse_int16_sunssf<22, 25>(); }
 
     /**
      * [VA]
      */
-    inline float VAPhaseB() const { return parse_int16_sunssf(23, 25); }
+    inline float VAPhaseB() const { return parse_int16_sunssf<23, 25>(); }
 
     /**
      * [VA]
      */
-    inline float VAPhaseC() const { return parse_int16_sunssf(24, 25); }
+    inline float VAPhaseC() const { return parse_int16_sunssf<24, 25>(); }
 
     /**
      * Reactive Power [var]
      */
-    inline float VAR() const { return parse_int16_sunssf(26, 30); }
+    inline float VAR() const { return parse_int16_sunssf<26, 30>(); }
 
     /**
      * [var]
      */
-    inline float VARPhaseA() const { return parse_int16_sunssf(27, 30); }
+    inline float VARPhaseA() const { return parse_int16_sunssf<27, 30>(); }
 
     /**
      * [var]
      */
-    inline float VARPhaseB() const { return parse_int16_sunssf(28, 30); }
+    inline float VARPhaseB() const { return parse_int16_sunssf<28, 30>(); }
 
     /**
      * [var]
      */
-    inline float VARPhaseC() const { return parse_int16_sunssf(29, 30); }
+    inline float VARPhaseC() const { return parse_int16_sunssf<29, 30>(); }
 
     /**
      * Power Factor [Pct]
      */
-    inline float PF() const { return parse_int16_sunssf(31, 35); }
+    inline float PF() const { return parse_int16_sunssf<31, 35>(); }
 
     /**
      * [Pct]
      */
-    inline float PFPhaseA() const { return parse_int16_sunssf(32, 35); }
+    inline float PFPhaseA() const { return parse_int16_sunssf<32, 35>(); }
 
     /**
      * [Pct]
      */
-    inline float PFPhaseB() const { return parse_int16_sunssf(33, 35); }
+    inline float PFPhaseB() const { return parse_int16_sunssf<33, 35>(); }
 
     /**
      * [Pct]
      */
-    inline float PFPhaseC() const { return parse_int16_sunssf(34, 35); }
+    inline float PFPhaseC() const { return parse_int16_sunssf<34, 35>(); }
 
     /**
      * Total Real Energy Exported [Wh]
      */
-    inline double totalWattHoursExported() const { return parse_acc32_sunssf(36, 52); }
+    inline double totalWattHoursExported() const { return parse_acc32_sunssf<36, 52>(); }
 
     /**
      * [Wh]
      */
-    inline double totalWattHoursExportedPhaseA() const { return parse_acc32_sunssf(38, 52); }
+    inline double totalWattHoursExportedPhaseA() const { return parse_acc32_sunssf<38, 52>(); }
 
     /**
      * [Wh]
      */
-    inline double totalWattHoursExportedPhaseB() const { return parse_acc32_sunssf(40, 52); }
+    inline double totalWattHoursExportedPhaseB() const { return parse_acc32_sunssf<40, 52>(); }
 
     /**
      * [Wh]
      */
-    inline double totalWattHoursExportedPhaseC() const { return parse_acc32_sunssf(42, 52); }
+    inline double totalWattHoursExportedPhaseC() const { return parse_acc32_sunssf<42, 52>(); }
 
     /**
      * Total Real Energy Imported [Wh]
      */
-    inline double totalWattHoursImported() const { return parse_acc32_sunssf(44, 52); }
+    inline double totalWattHoursImported() const { return parse_acc32_sunssf<44, 52>(); }
 
     /**
      * [Wh]
      */
-    inline double totalWattHoursImportedPhaseA() const { return parse_acc32_sunssf(46, 52); }
+    inline double totalWattHoursImportedPhaseA() const { return parse_acc32_sunssf<46, 52>(); }
 
     /**
      * [Wh]
      */
-    inline double totalWattHoursImportedPhaseB() const { return parse_acc32_sunssf(48, 52); }
+    inline double totalWattHoursImportedPhaseB() const { return parse_acc32_sunssf<48, 52>(); }
 
     /**
      * [Wh]
      */
-    inline double totalWattHoursImportedPhaseC() const { return parse_acc32_sunssf(50, 52); }
+    inline double totalWattHoursImportedPhaseC() const { return parse_acc32_sunssf<50, 52>(); }
 
     /**
      * Total Apparent Energy Exported [VAh]
      */
-    inline double totalVAHoursExported() const { return parse_acc32_sunssf(53, 69); }
+    inline double totalVAHoursExported() const { return parse_acc32_sunssf<53, 69>(); }
 
     /**
      * [VAh]
      */
-    inline double totalVAHoursExportedPhaseA() const { return parse_acc32_sunssf(55, 69); }
+    inline double totalVAHoursExportedPhaseA() const { return parse_acc32_sunssf<55, 69>(); }
 
     /**
      * [VAh]
      */
-    inline double totalVAHoursExportedPhaseB() const { return parse_acc32_sunssf(57, 69); }
+    inline double totalVAHoursExportedPhaseB() const { return parse_acc32_sunssf<57, 69>(); }
 
     /**
      * [VAh]
      */
-    inline double totalVAHoursExportedPhaseC() const { return parse_acc32_sunssf(59, 69); }
+    inline double totalVAHoursExportedPhaseC() const { return parse_acc32_sunssf<59, 69>(); }
 
     /**
      * Total Apparent Energy Imported [VAh]
      */
-    inline double totalVAHoursImported() const { return parse_acc32_sunssf(61, 69); }
+    inline double totalVAHoursImported() const { return parse_acc32_sunssf<61, 69>(); }
 
     /**
      * [VAh]
      */
-    inline double totalVAHoursImportedPhaseA() const { return parse_acc32_sunssf(63, 69); }
+    inline double totalVAHoursImportedPhaseA() const { return parse_acc32_sunssf<63, 69>(); }
 
     /**
      * [VAh]
      */
-    inline double totalVAHoursImportedPhaseB() const { return parse_acc32_sunssf(65, 69); }
+    inline double totalVAHoursImportedPhaseB() const { return parse_acc32_sunssf<65, 69>(); }
 
     /**
      * [VAh]
      */
-    inline double totalVAHoursImportedPhaseC() const { return parse_acc32_sunssf(67, 69); }
+    inline double totalVAHoursImportedPhaseC() const { return parse_acc32_sunssf<67, 69>(); }
 
     /**
      * Total Reactive Energy Imported Quadrant 1 [varh]
      */
-    inline double totalVARHoursImportedQ1() const { return parse_acc32_sunssf(70, 102); }
+    inline double totalVARHoursImportedQ1() const { return parse_acc32_sunssf<70, 102>(); }
 
     /**
      * [varh]
      */
-    inline double totalVArHoursImportedQ1PhaseA() const { return parse_acc32_sunssf(72, 102); }
+    inline double totalVArHoursImportedQ1PhaseA() const { return parse_acc32_sunssf<72, 102>(); }
 
     /**
      * [varh]
      */
-    inline double totalVArHoursImportedQ1PhaseB() const { return parse_acc32_sunssf(74, 102); }
+    inline double totalVArHoursImportedQ1PhaseB() const { return parse_acc32_sunssf<74, 102>(); }
 
     /**
      * [varh]
      */
-    inline double totalVArHoursImportedQ1PhaseC() const { return parse_acc32_sunssf(76, 102); }
+    inline double totalVArHoursImportedQ1PhaseC() const { return parse_acc32_sunssf<76, 102>(); }
 
     /**
      * Total Reactive Power Imported Quadrant 2 [varh]
      */
-    inline double totalVArHoursImportedQ2() const { return parse_acc32_sunssf(78, 102); }
+    inline double totalVArHoursImportedQ2() const { return parse_acc32_sunssf<78, 102>(); }
 
     /**
      * [varh]
      */
-    inline double totalVArHoursImportedQ2PhaseA() const { return parse_acc32_sunssf(80, 102); }
+    inline double totalVArHoursImportedQ2PhaseA() const { return parse_acc32_sunssf<80, 102>(); }
 
     /**
      * [varh]
      */
-    inline double totalVArHoursImportedQ2PhaseB() const { return parse_acc32_sunssf(82, 102); }
+    inline double totalVArHoursImportedQ2PhaseB() const { return parse_acc32_sunssf<82, 102>(); }
 
     /**
      * [varh]
      */
-    inline double totalVArHoursImportedQ2PhaseC() const { return parse_acc32_sunssf(84, 102); }
+    inline double totalVArHoursImportedQ2PhaseC() const { return parse_acc32_sunssf<84, 102>(); }
 
     /**
      * Total Reactive Power Exported Quadrant 3 [varh]
      */
-    inline double totalVArHoursExportedQ3() const { return parse_acc32_sunssf(86, 102); }
+    inline double totalVArHoursExportedQ3() const { return parse_acc32_sunssf<86, 102>(); }
 
     /**
      * [varh]
      */
-    inline double totalVArHoursExportedQ3PhaseA() const { return parse_acc32_sunssf(88, 102); }
+    inline double totalVArHoursExportedQ3PhaseA() const { return parse_acc32_sunssf<88, 102>(); }
 
     /**
      * [varh]
      */
-    inline double totalVArHoursExportedQ3PhaseB() const { return parse_acc32_sunssf(90, 102); }
+    inline double totalVArHoursExportedQ3PhaseB() const { return parse_acc32_sunssf<90, 102>(); }
 
     /**
      * [varh]
      */
-    inline double totalVArHoursExportedQ3PhaseC() const { return parse_acc32_sunssf(92, 102); }
+    inline double totalVArHoursExportedQ3PhaseC() const { return parse_acc32_sunssf<92, 102>(); }
 
     /**
      * Total Reactive Power Exported Quadrant 4 [varh]
      */
-    inline double totalVArHoursExportedQ4() const { return parse_acc32_sunssf(94, 102); }
+    inline double totalVArHoursExportedQ4() const { return parse_acc32_sunssf<94, 102>(); }
 
     /**
      * [varh]
      */
-    inline double totalVArHoursExportedQ4ImportedPhaseA() const { return parse_acc32_sunssf(96, 102); }
+    inline double totalVArHoursExportedQ4ImportedPhaseA() const { return parse_acc32_sunssf<96, 102>(); }
 
     /**
      * [varh]
      */
-    inline double totalVArHoursExportedQ4ImportedPhaseB() const { return parse_acc32_sunssf(98, 102); }
+    inline double totalVArHoursExportedQ4ImportedPhaseB() const { return parse_acc32_sunssf<98, 102>(); }
 
     /**
      * [varh]
      */
-    inline double totalVArHoursExportedQ4ImportedPhaseC() const { return parse_acc32_sunssf(100, 102); }
+    inline double totalVArHoursExportedQ4ImportedPhaseC() const { return parse_acc32_sunssf<100, 102>(); }
 
     /**
      * Meter Event Flags
@@ -3205,312 +3457,317 @@ class WyeConnectThreePhaseAbcnMeter_203 : public SunSpecModel<203, 105> {
 
 };
 
-class DeltaConnectThreePhaseAbcMeter_204 : public SunSpecModel<204, 105> {
+class DeltaConnectThreePhaseAbcMeter_204 : public SunSpecModel<204, 105, 0, 4, 13, 15, 20, 25, 30, 35, 52, 69, 102> {
   public:
+    /**
+     * Descriptors of all points, for generic access.
+     */
+    static SunSpecPointTable pointTable();
+
     /**
      * Total AC Current [A]
      */
-    inline float amps() const { return parse_int16_sunssf(0, 4); }
+    inline float amps() const { return parse_int16_sunssf<0, 4>(); }
 
     /**
      * Phase A Current [A]
      */
-    inline float ampsPhaseA() const { return parse_int16_sunssf(1, 4); }
+    inline float ampsPhaseA() const { return parse_int16_sunssf<1, 4>(); }
 
     /**
      * Phase B Current [A]
      */
-    inline float ampsPhaseB() const { return parse_int16_sunssf(2, 4); }
+    inline float ampsPhaseB() const { return parse_int16_sunssf<2, 4>(); }
 
     /**
      * Phase C Current [A]
      */
-    inline float ampsPhaseC() const { return parse_int16_sunssf(3, 4); }
+    inline float ampsPhaseC() const { return parse_int16_sunssf<3, 4>(); }
 
     /**
      * Line to Neutral AC Voltage (average of active phases) [V]
      */
-    inline float voltageLN() const { return parse_int16_sunssf(5, 13); }
+    inline float voltageLN() const { return parse_int16_sunssf<5, 13>(); }
 
     /**
      * Phase Voltage AN [V]
      */
-    inline float phaseVoltageAN() const { return parse_int16_sunssf(6, 13); }
+    inline float phaseVoltageAN() const { return parse_int16_sunssf<6, 13>(); }
 
     /**
      * Phase Voltage BN [V]
      */
-    inline float phaseVoltageBN() const { return parse_int16_sunssf(7, 13); }
+    inline float phaseVoltageBN() const { return parse_int16_sunssf<7, 13>(); }
 
     /**
      * Phase Voltage CN [V]
      */
-    inline float phaseVoltageCN() const { return parse_int16_sunssf(8, 13); }
+    inline float phaseVoltageCN() const { return parse_int16_sunssf<8, 13>(); }
 
     /**
      * Line to Line AC Voltage (average of active phases) [V]
      */
-    inline float voltageLL() const { return parse_int16_sunssf(9, 13); }
+    inline float voltageLL() const { return parse_int16_sunssf<9, 13>(); }
 
     /**
      * Phase Voltage AB [V]
      */
-    inline float phaseVoltageAB() const { return parse_int16_sunssf(10, 13); }
+    inline float phaseVoltageAB() const { return parse_int16_sunssf<10, 13>(); }
 
     /**
      * Phase Voltage BC [V]
      */
-    inline float phaseVoltageBC() const { return parse_int16_sunssf(11, 13); }
+    inline float phaseVoltageBC() const { return parse_int16_sunssf<11, 13>(); }
 
     /**
      * Phase Voltage CA [V]
      */
-    inline float phaseVoltageCA() const { return parse_int16_sunssf(12, 13); }
+    inline float phaseVoltageCA() const { return parse_int16_sunssf<12, 13>(); }
 
     /**
      * Frequency [Hz]
      */
-    inline float hz() const { return parse_int16_sunssf(14, 15); }
+    inline float hz() const { return parse_int16_sunssf<14, 15>(); }
 
     /**
      * Total Real Power [W]
      */
-    inline float watts() const { return parse_int16_sunssf(16, 20); }
+    inline float watts() const { return parse_int16_sunssf<16, 20>(); }
 
     /**
      * [W]
      */
-    inline float wattsPhaseA() const { return parse_int16_sunssf(17, 20); }
+    inline float wattsPhaseA() const { return parse_int16_sunssf<17, 20>(); }
 
     /**
      * [W]
      */
-    inline float wattsPhaseB() const { return parse_int16_sunssf(18, 20); }
+    inline float wattsPhaseB() const { return parse_int16_sunssf<18, 20>(); }
 
     /**
      * [W]
      */
-    inline float wattsPhaseC() const { return parse_int16_sunssf(19, 20); }
+    inline float wattsPhaseC() const { return parse_int16_sunssf<19, 20>(); }
 
     /**
      * AC Apparent Power [VA]
      */
-    inline float VA() const { return parse_int16_sunssf(21, 25); }
+    inline float VA() const { return parse_int16_sunssf<21, 25>(); }
 
     /**
      * [VA]
      */
-    inline float VAPhaseA() const { return parse_int16_sunssf(22, 25); }
+    inline float VAPhaseA() const { return parse_int16_sunssf<22, 25>(); }
 
     /**
      * [VA]
      */
-    inline float VAPhaseB() const { return parse_int16_sunssf(23, 25); }
+    inline float VAPhaseB() const { return parse_int16_sunssf<23, 25>(); }
 
     /**
      * [VA]
      */
-    inline float VAPhaseC() const { return parse_int16_sunssf(24, 25); }
+    inline float VAPhaseC() const { return parse_int16_sunssf<24, 25>(); }
 
     /**
      * Reactive Power [var]
      */
-    inline float VAR() const { return parse_int16_sunssf(26, 30); }
+    inline float VAR() const { return parse_int16_sunssf<26, 30>(); }
 
     /**
      * [var]
      */
-    inline float VARPhaseA() const { return parse_int16_sunssf(27, 30); }
+    inline float VARPhaseA() const { return parse_int16_sunssf<27, 30>(); }
 
     /**
      * [var]
      */
-    inline float VARPhaseB() const { return parse_int16_sunssf(28, 30); }
+    inline float VARPhaseB() const { return parse_int16_sunssf<28, 30>(); }
 
     /**
      * [var]
      */
-    inline float VARPhaseC() const { return parse_int16_sunssf(29, 30); }
+    inline float VARPhaseC() const { return parse_int16_sunssf<29, 30>(); }
 
     /**
      * Power Factor [Pct]
      */
-    inline float PF() const { return parse_int16_sunssf(31, 35); }
+    inline float PF() const { return parse_int16_sunssf<31, 35>(); }
 
     /**
      * [Pct]
      */
-    inline float PFPhaseA() const { return parse_int16_sunssf(32, 35); }
+    inline float PFPhaseA() const { return parse_int16_sunssf<32, 35>(); }
 
     /**
      * [Pct]
      */
-    inline float PFPhaseB() const { return parse_int16_sunssf(33, 35); }
+    inline float PFPhaseB() const { return parse_int16_sunssf<33, 35>(); }
 
     /**
      * [Pct]
      */
-    inline float PFPhaseC() const { return parse_int16_sunssf(34, 35); }
+    inline float PFPhaseC() const { return parse_int16_sunssf<34, 35>(); }
 
     /**
      * Total Real Energy Exported [Wh]
      */
-    inline double totalWattHoursExported() const { return parse_acc32_sunssf(36, 52); }
+    inline double totalWattHoursExported() const { return parse_acc32_sunssf<36, 52>(); }
 
     /**
      * [Wh]
      */
-    inline double totalWattHoursExportedPhaseA() const { return parse_acc32_sunssf(38, 52); }
+    inline double totalWattHoursExportedPhaseA() const { return parse_acc32_sunssf<38, 52>(); }
 
     /**
      * [Wh]
      */
-    inline double totalWattHoursExportedPhaseB() const { return parse_acc32_sunssf(40, 52); }
+    inline double totalWattHoursExportedPhaseB() const { return parse_acc32_sunssf<40, 52>(); }
 
     /**
      * [Wh]
      */
-    inline double totalWattHoursExportedPhaseC() const { return parse_acc32_sunssf(42, 52); }
+    inline double totalWattHoursExportedPhaseC() const { return parse_acc32_sunssf<42, 52>(); }
 
     /**
      * Total Real Energy Imported [Wh]
      */
-    inline double totalWattHoursImported() const { return parse_acc32_sunssf(44, 52); }
+    inline double totalWattHoursImported() const { return parse_acc32_sunssf<44, 52>(); }
 
     /**
      * [Wh]
      */
-    inline double totalWattHoursImportedPhaseA() const { return parse_acc32_sunssf(46, 52); }
+    inline double totalWattHoursImportedPhaseA() const { return parse_acc32_sunssf<46, 52>(); }
 
     /**
      * [Wh]
      */
-    inline double totalWattHoursImportedPhaseB() const { return parse_acc32_sunssf(48, 52); }
+    inline double totalWattHoursImportedPhaseB() const { return parse_acc32_sunssf<48, 52>(); }
 
     /**
      * [Wh]
      */
-    inline double totalWattHoursImportedPhaseC() const { return parse_acc32_sunssf(50, 52); }
+    inline double totalWattHoursImportedPhaseC() const { return parse_acc32_sunssf<50, 52>(); }
 
     /**
      * Total Apparent Energy Exported [VAh]
      */
-    inline double totalVAHoursExported() const { return parse_acc32_sunssf(53, 69); }
+    inline double totalVAHoursExported() const { return parse_acc32_sunssf<53, 69>(); }
 
     /**
      * [VAh]
      */
-    inline double totalVAHoursExportedPhaseA() const { return parse_acc32_sunssf(55, 69); }
+    inline double totalVAHoursExportedPhaseA() const { return parse_acc32_sunssf<55, 69>(); }
 
     /**
      * [VAh]
      */
-    inline double totalVAHoursExportedPhaseB() const { return parse_acc32_sunssf(57, 69); }
+    inline double totalVAHoursExportedPhaseB() const { return parse_acc32_sunssf<57, 69>(); }
 
     /**
      * [VAh]
      */
-    inline double totalVAHoursExportedPhaseC() const { return parse_acc32_sunssf(59, 69); }
+    inline double totalVAHoursExportedPhaseC() const { return parse_acc32_sunssf<59, 69>(); }
 
     /**
      * Total Apparent Energy Imported [VAh]
      */
-    inline double totalVAHoursImported() const { return parse_acc32_sunssf(61, 69); }
+    inline double totalVAHoursImported() const { return parse_acc32_sunssf<61, 69>(); }
 
     /**
      * [VAh]
      */
-    inline double totalVAHoursImportedPhaseA() const { return parse_acc32_sunssf(63, 69); }
+    inline double totalVAHoursImportedPhaseA() const { return parse_acc32_sunssf<63, 69>(); }
 
     /**
      * [VAh]
      */
-    inline double totalVAHoursImportedPhaseB() const { return parse_acc32_sunssf(65, 69); }
+    inline double totalVAHoursImportedPhaseB() const { return parse_acc32_sunssf<65, 69>(); }
 
     /**
      * [VAh]
      */
-    inline double totalVAHoursImportedPhaseC() const { return parse_acc32_sunssf(67, 69); }
+    inline double totalVAHoursImportedPhaseC() const { return parse_acc32_sunssf<67, 69>(); }
 
     /**
      * Total Reactive Energy Imported Quadrant 1 [varh]
      */
-    inline double totalVARHoursImportedQ1() const { return parse_acc32_sunssf(70, 102); }
+    inline double totalVARHoursImportedQ1() const { return parse_acc32_sunssf<70, 102>(); }
 
     /**
      * [varh]
      */
-    inline double totalVArHoursImportedQ1PhaseA() const { return parse_acc32_sunssf(72, 102); }
+    inline double totalVArHoursImportedQ1PhaseA() const { return parse_acc32_sunssf<72, 102>(); }
 
     /**
      * [varh]
      */
-    inline double totalVArHoursImportedQ1PhaseB() const { return parse_acc32_sunssf(74, 102); }
+    inline double totalVArHoursImportedQ1PhaseB() const { return parse_acc32_sunssf<74, 102>(); }
 
     /**
      * [varh]
      */
-    inline double totalVArHoursImportedQ1PhaseC() const { return parse_acc32_sunssf(76, 102); }
+    inline double totalVArHoursImportedQ1PhaseC() const { return parse_acc32_sunssf<76, 102>(); }
 
     /**
      * Total Reactive Power Imported Quadrant 2 [varh]
      */
-    inline double totalVArHoursImportedQ2() const { return parse_acc32_sunssf(78, 102); }
+    inline double totalVArHoursImportedQ2() const { return parse_acc32_sunssf<78, 102>(); }
 
     /**
      * [varh]
      */
-    inline double totalVArHoursImportedQ2PhaseA() const { return parse_acc32_sunssf(80, 102); }
+    inline double totalVArHoursImportedQ2PhaseA() const { return parse_acc32_sunssf<80, 102>(); }
 
     /**
      * [varh]
      */
-    inline double totalVArHoursImportedQ2PhaseB() const { return parse_acc32_sunssf(82, 102); }
+    inline double totalVArHoursImportedQ2PhaseB() const { return parse_acc32_sunssf<82, 102>(); }
 
     /**
      * [varh]
      */
-    inline double totalVArHoursImportedQ2PhaseC() const { return parse_acc32_sunssf(84, 102); }
+    inline double totalVArHoursImportedQ2PhaseC() const { return parse_acc32_sunssf<84, 102>(); }
 
     /**
      * Total Reactive Power Exported Quadrant 3 [varh]
      */
-    inline double totalVArHoursExportedQ3() const { return parse_acc32_sunssf(86, 102); }
+    inline double totalVArHoursExportedQ3() const { return parse_acc32_sunssf<86, 102>(); }
 
     /**
      * [varh]
      */
-    inline double totalVArHoursExportedQ3PhaseA() const { return parse_acc32_sunssf(88, 102); }
+    inline double totalVArHoursExportedQ3PhaseA() const { return parse_acc32_sunssf<88, 102>(); }
 
     /**
      * [varh]
      */
-    inline double totalVArHoursExportedQ3PhaseB() const { return parse_acc32_sunssf(90, 102); }
+    inline double totalVArHoursExportedQ3PhaseB() const { return parse_acc32_sunssf<90, 102>(); }
 
     /**
      * [varh]
      */
-    inline double totalVArHoursExportedQ3PhaseC() const { return parse_acc32_sunssf(92, 102); }
+    inline double totalVArHoursExportedQ3PhaseC() const { return parse_acc32_sunssf<92, 102>(); }
 
     /**
      * Total Reactive Power Exported Quadrant 4 [varh]
      */
-    inline double totalVArHoursExportedQ4() const { return parse_acc32_sunssf(94, 102); }
+    inline double totalVArHoursExportedQ4() const { return parse_acc32_sunssf<94, 102>(); }
 
     /**
      * [varh]
      */
-    inline double totalVArHoursExportedQ4ImportedPhaseA() const { return parse_acc32_sunssf(96, 102); }
+    inline double totalVArHoursExportedQ4ImportedPhaseA() const { return parse_acc32_sunssf<96, 102>(); }
 
     /**
      * [varh]
      */
-    inline double totalVArHoursExportedQ4ImportedPhaseB() const { return parse_acc32_sunssf(98, 102); }
+    inline double totalVArHoursExportedQ4ImportedPhaseB() const { return parse_acc32_sunssf<98, 102>(); }
 
     /**
      * [varh]
      */
-    inline double totalVArHoursExportedQ4ImportedPhaseC() const { return parse_acc32_sunssf(100, 102); }
+    inline double totalVArHoursExportedQ4ImportedPhaseC() const { return parse_acc32_sunssf<100, 102>(); }
 
     /**
      * Meter Event Flags
@@ -3519,8 +3776,13 @@ class DeltaConnectThreePhaseAbcMeter_204 : public SunSpecModel<204, 105> {
 
 };
 
-class SinglePhaseANOrABMeter : public SunSpecModel<211, 124> {
+class SinglePhaseANOrABMeter : public SunSpecModel<211, 124, 0> {
   public:
+    /**
+     * Descriptors of all points, for generic access.
+     */
+    static SunSpecPointTable pointTable();
+
     /**
      * Total AC Current [A]
      */
@@ -3833,8 +4095,13 @@ class SinglePhaseANOrABMeter : public SunSpecModel<211, 124> {
 
 };
 
-class SplitSinglePhaseABNMeter_212 : public SunSpecModel<212, 124> {
+class SplitSinglePhaseABNMeter_212 : public SunSpecModel<212, 124, 0> {
   public:
+    /**
+     * Descriptors of all points, for generic access.
+     */
+    static SunSpecPointTable pointTable();
+
     /**
      * Total AC Current [A]
      */
@@ -4147,8 +4414,13 @@ class SplitSinglePhaseABNMeter_212 : public SunSpecModel<212, 124> {
 
 };
 
-class WyeConnectThreePhaseAbcnMeter_213 : public SunSpecModel<213, 124> {
+class WyeConnectThreePhaseAbcnMeter_213 : public SunSpecModel<213, 124, 0> {
   public:
+    /**
+     * Descriptors of all points, for generic access.
+     */
+    static SunSpecPointTable pointTable();
+
     /**
      * Total AC Current [A]
      */
@@ -4461,8 +4733,13 @@ class WyeConnectThreePhaseAbcnMeter_213 : public SunSpecModel<213, 124> {
 
 };
 
-class DeltaConnectThreePhaseAbcMeter_214 : public SunSpecModel<214, 124> {
+class DeltaConnectThreePhaseAbcMeter_214 : public SunSpecModel<214, 124, 0> {
   public:
+    /**
+     * Descriptors of all points, for generic access.
+     */
+    static SunSpecPointTable pointTable();
+
     /**
      * Total AC Current [A]
      */
@@ -4778,8 +5055,13 @@ class DeltaConnectThreePhaseAbcMeter_214 : public SunSpecModel<214, 124> {
 /**
  * Include to support location measurements
  */
-class GPS : public SunSpecModel<305, 36> {
+class GPS : public SunSpecModel<305, 36, 0> {
   public:
+    /**
+     * Descriptors of all points, for generic access.
+     */
+    static SunSpecPointTable pointTable();
+
     /**
      * UTC 24 hour time stamp to millisecond hhmmss.sssZ format [hhmmss.sssZ]
      */
@@ -4815,8 +5097,13 @@ class GPS : public SunSpecModel<305, 36> {
 /**
  * Include to support a standard reference point
  */
-class ReferencePointModel : public SunSpecModel<306, 4> {
+class ReferencePointModel : public SunSpecModel<306, 4, 0> {
   public:
+    /**
+     * Descriptors of all points, for generic access.
+     */
+    static SunSpecPointTable pointTable();
+
     /**
      * Global Horizontal Irradiance [W/m2]
      */
@@ -4842,8 +5129,13 @@ class ReferencePointModel : public SunSpecModel<306, 4> {
 /**
  * Base Meteorological Model
  */
-class BaseMet : public SunSpecModel<307, 11> {
+class BaseMet : public SunSpecModel<307, 11, 0> {
   public:
+    /**
+     * Descriptors of all points, for generic access.
+     */
+    static SunSpecPointTable pointTable();
+
     /**
      * [C]
      */
@@ -4904,8 +5196,13 @@ class BaseMet : public SunSpecModel<307, 11> {
 /**
  * Include to support a few basic measurements
  */
-class MiniMetModel : public SunSpecModel<308, 4> {
+class MiniMetModel : public SunSpecModel<308, 4, 0> {
   public:
+    /**
+     * Descriptors of all points, for generic access.
+     */
+    static SunSpecPointTable pointTable();
+
     /**
      * Global Horizontal Irradiance [W/m2]
      */
@@ -4931,8 +5228,13 @@ class MiniMetModel : public SunSpecModel<308, 4> {
 /**
  * A solar module model supporting DC-DC converter
  */
-class SolarModule_501 : public SunSpecModel<501, 31> {
+class SolarModule_501 : public SunSpecModel<501, 31, 0> {
   public:
+    /**
+     * Descriptors of all points, for generic access.
+     */
+    static SunSpecPointTable pointTable();
+
     /**
      * Enumerated value.  Module Status Code
      */
@@ -5023,8 +5325,13 @@ class SolarModule_501 : public SunSpecModel<501, 31> {
 /**
  * A solar module model supporting DC-DC converter
  */
-class SolarModule_502 : public SunSpecModel<502, 28> {
+class SolarModule_502 : public SunSpecModel<502, 28, 0, 0, 1, 2, 3> {
   public:
+    /**
+     * Descriptors of all points, for generic access.
+     */
+    static SunSpecPointTable pointTable();
+
     /**
      * Enumerated value.  Module Status Code
      */
@@ -5068,22 +5375,22 @@ class SolarModule_502 : public SunSpecModel<502, 28> {
     /**
      * Output Current [A]
      */
-    inline float outputCurrent() const { return parse_int16_sunssf(17, 0); }
+    inline float outputCurrent() const { return parse_int16_sunssf<17, 0>(); }
 
     /**
      * Output Voltage [V]
      */
-    inline float outputVoltage() const { return parse_int16_sunssf(18, 1); }
+    inline float outputVoltage() const { return parse_int16_sunssf<18, 1>(); }
 
     /**
      * Output Energy [Wh]
      */
-    inline double outputEnergy() const { return parse_acc32_sunssf(19, 3); }
+    inline double outputEnergy() const { return parse_acc32_sunssf<19, 3>(); }
 
     /**
      * Output Power [W]
      */
-    inline float outputPower() const { return parse_int16_sunssf(21, 2); }
+    inline float outputPower() const { return parse_int16_sunssf<21, 2>(); }
 
     /**
      * Module Temperature [C]
@@ -5093,30 +5400,35 @@ class SolarModule_502 : public SunSpecModel<502, 28> {
     /**
      * Input Current [A]
      */
-    inline float inputCurrent() const { return parse_int16_sunssf(23, 0); }
+    inline float inputCurrent() const { return parse_int16_sunssf<23, 0>(); }
 
     /**
      * Input Voltage [V]
      */
-    inline float inputVoltage() const { return parse_int16_sunssf(24, 1); }
+    inline float inputVoltage() const { return parse_int16_sunssf<24, 1>(); }
 
     /**
      * Input Energy [Wh]
      */
-    inline double inputEnergy() const { return parse_acc32_sunssf(25, 3); }
+    inline double inputEnergy() const { return parse_acc32_sunssf<25, 3>(); }
 
     /**
      * Input Power [W]
      */
-    inline float inputPower() const { return parse_int16_sunssf(27, 2); }
+    inline float inputPower() const { return parse_int16_sunssf<27, 2>(); }
 
 };
 
 /**
  * DER AC measurement model.
  */
-class DERACMeasurement : public SunSpecModel<701, 153> {
+class DERACMeasurement : public SunSpecModel<701, 153, 0, 111, 112, 113, 114, 115, 116, 117, 118, 119, 120> {
   public:
+    /**
+     * Descriptors of all points, for generic access.
+     */
+    static SunSpecPointTable pointTable();
+
     /**
      * AC wiring type.
      */
@@ -5150,257 +5462,257 @@ class DERACMeasurement : public SunSpecModel<701, 153> {
     /**
      * Total active power. Active power is positive for DER generation and negative for absorption. [W]
      */
-    inline float activePower() const { return parse_int16_sunssf(8, 114); }
+    inline float activePower() const { return parse_int16_sunssf<8, 114>(); }
 
     /**
      * Total apparent power. [VA]
      */
-    inline float apparentPower() const { return parse_int16_sunssf(9, 116); }
+    inline float apparentPower() const { return parse_int16_sunssf<9, 116>(); }
 
     /**
      * Total reactive power. [Var]
      */
-    inline float reactivePower() const { return parse_int16_sunssf(10, 117); }
+    inline float reactivePower() const { return parse_int16_sunssf<10, 117>(); }
 
     /**
      * Power factor. The sign of power factor should be the sign of active power.
      */
-    inline float powerFactor() const { return parse_int16_sunssf(11, 115); }
+    inline float powerFactor() const { return parse_int16_sunssf<11, 115>(); }
 
     /**
      * Total AC current. [A]
      */
-    inline float totalACCurrent() const { return parse_int16_sunssf(12, 111); }
+    inline float totalACCurrent() const { return parse_int16_sunssf<12, 111>(); }
 
     /**
      * Line to line AC voltage as an average of active phases. [V]
      */
-    inline float voltageLL() const { return parse_uint16_sunssf(13, 112); }
+    inline float voltageLL() const { return parse_uint16_sunssf<13, 112>(); }
 
     /**
      * Line to neutral AC voltage as an average of active phases. [V]
      */
-    inline float voltageLN() const { return parse_uint16_sunssf(14, 112); }
+    inline float voltageLN() const { return parse_uint16_sunssf<14, 112>(); }
 
     /**
      * AC frequency. [Hz]
      */
-    inline double frequency() const { return parse_uint32_sunssf(15, 113); }
+    inline double frequency() const { return parse_uint32_sunssf<15, 113>(); }
 
     /**
      * Total active energy injected (Quadrants 1 & 4). [Wh]
      */
-    inline double totalEnergyInjected() const { return parse_uint64_sunssf(17, 118); }
+    inline double totalEnergyInjected() const { return parse_uint64_sunssf<17, 118>(); }
 
     /**
      * Total active energy absorbed (Quadrants 2 & 3). [Wh]
      */
-    inline double totalEnergyAbsorbed() const { return parse_uint64_sunssf(21, 118); }
+    inline double totalEnergyAbsorbed() const { return parse_uint64_sunssf<21, 118>(); }
 
     /**
      * Total reactive energy injected (Quadrants 1 & 2). [Varh]
      */
-    inline double totalReactiveEnergyInj() const { return parse_uint64_sunssf(25, 119); }
+    inline double totalReactiveEnergyInj() const { return parse_uint64_sunssf<25, 119>(); }
 
     /**
      * Total reactive energy absorbed (Quadrants 3 & 4). [Varh]
      */
-    inline double totalReactiveEnergyAbs() const { return parse_uint64_sunssf(29, 119); }
+    inline double totalReactiveEnergyAbs() const { return parse_uint64_sunssf<29, 119>(); }
 
     /**
      * Ambient temperature. [C]
      */
-    inline float ambientTemperature() const { return parse_int16_sunssf(33, 120); }
+    inline float ambientTemperature() const { return parse_int16_sunssf<33, 120>(); }
 
     /**
      * Cabinet temperature. [C]
      */
-    inline float cabinetTemperature() const { return parse_int16_sunssf(34, 120); }
+    inline float cabinetTemperature() const { return parse_int16_sunssf<34, 120>(); }
 
     /**
      * Heat sink temperature. [C]
      */
-    inline float heatSinkTemperature() const { return parse_int16_sunssf(35, 120); }
+    inline float heatSinkTemperature() const { return parse_int16_sunssf<35, 120>(); }
 
     /**
      * Transformer temperature. [C]
      */
-    inline float transformerTemperature() const { return parse_int16_sunssf(36, 120); }
+    inline float transformerTemperature() const { return parse_int16_sunssf<36, 120>(); }
 
     /**
      * IGBT/MOSFET temperature. [C]
      */
-    inline float IGBTMOSFETTemperature() const { return parse_int16_sunssf(37, 120); }
+    inline float IGBTMOSFETTemperature() const { return parse_int16_sunssf<37, 120>(); }
 
     /**
      * Other temperature. [C]
      */
-    inline float otherTemperature() const { return parse_int16_sunssf(38, 120); }
+    inline float otherTemperature() const { return parse_int16_sunssf<38, 120>(); }
 
     /**
      * Active power L1. [W]
      */
-    inline float wattsL1() const { return parse_int16_sunssf(39, 114); }
+    inline float wattsL1() const { return parse_int16_sunssf<39, 114>(); }
 
     /**
      * Apparent power L1. [VA]
      */
-    inline float VAL1() const { return parse_int16_sunssf(40, 116); }
+    inline float VAL1() const { return parse_int16_sunssf<40, 116>(); }
 
     /**
      * Reactive power L1. [Var]
      */
-    inline float varL1() const { return parse_int16_sunssf(41, 117); }
+    inline float varL1() const { return parse_int16_sunssf<41, 117>(); }
 
     /**
      * Power factor phase L1.
      */
-    inline float PFL1() const { return parse_int16_sunssf(42, 115); }
+    inline float PFL1() const { return parse_int16_sunssf<42, 115>(); }
 
     /**
      * Current phase L1. [A]
      */
-    inline float ampsL1() const { return parse_int16_sunssf(43, 111); }
+    inline float ampsL1() const { return parse_int16_sunssf<43, 111>(); }
 
     /**
      * Phase voltage L1-L2. [V]
      */
-    inline float phaseVoltageL1L2() const { return parse_uint16_sunssf(44, 112); }
+    inline float phaseVoltageL1L2() const { return parse_uint16_sunssf<44, 112>(); }
 
     /**
      * Phase voltage L1-N. [V]
      */
-    inline float phaseVoltageL1N() const { return parse_uint16_sunssf(45, 112); }
+    inline float phaseVoltageL1N() const { return parse_uint16_sunssf<45, 112>(); }
 
     /**
      * Total active energy injected L1. [Wh]
      */
-    inline double totalWattHoursInjL1() const { return parse_uint64_sunssf(46, 118); }
+    inline double totalWattHoursInjL1() const { return parse_uint64_sunssf<46, 118>(); }
 
     /**
      * Total active energy absorbed L1. [Wh]
      */
-    inline double totalWattHoursAbsL1() const { return parse_uint64_sunssf(50, 118); }
+    inline double totalWattHoursAbsL1() const { return parse_uint64_sunssf<50, 118>(); }
 
     /**
      * Total reactive energy injected L1. [Varh]
      */
-    inline double totalVarHoursInjL1() const { return parse_uint64_sunssf(54, 119); }
+    inline double totalVarHoursInjL1() const { return parse_uint64_sunssf<54, 119>(); }
 
     /**
      * Total reactive energy absorbed L1. [Varh]
      */
-    inline double totalVarHoursAbsL1() const { return parse_uint64_sunssf(58, 119); }
+    inline double totalVarHoursAbsL1() const { return parse_uint64_sunssf<58, 119>(); }
 
     /**
      * Active power L2. [W]
      */
-    inline float wattsL2() const { return parse_int16_sunssf(62, 114); }
+    inline float wattsL2() const { return parse_int16_sunssf<62, 114>(); }
 
     /**
      * Apparent power L2. [VA]
      */
-    inline float VAL2() const { return parse_int16_sunssf(63, 116); }
+    inline float VAL2() const { return parse_int16_sunssf<63, 116>(); }
 
     /**
      * Reactive power L2. [Var]
      */
-    inline float varL2() const { return parse_int16_sunssf(64, 117); }
+    inline float varL2() const { return parse_int16_sunssf<64, 117>(); }
 
     /**
      * Power factor L2.
      */
-    inline float PFL2() const { return parse_int16_sunssf(65, 115); }
+    inline float PFL2() const { return parse_int16_sunssf<65, 115>(); }
 
     /**
      * Current L2. [A]
      */
-    inline float ampsL2() const { return parse_int16_sunssf(66, 111); }
+    inline float ampsL2() const { return parse_int16_sunssf<66, 111>(); }
 
     /**
      * Phase voltage L2-L3. [V]
      */
-    inline float phaseVoltageL2L3() const { return parse_uint16_sunssf(67, 112); }
+    inline float phaseVoltageL2L3() const { return parse_uint16_sunssf<67, 112>(); }
 
     /**
      * Phase voltage L2-N. [V]
      */
-    inline float phaseVoltageL2N() const { return parse_uint16_sunssf(68, 112); }
+    inline float phaseVoltageL2N() const { return parse_uint16_sunssf<68, 112>(); }
 
     /**
      * Total active energy injected L2. [Wh]
      */
-    inline double totalWattHoursInjL2() const { return parse_uint64_sunssf(69, 118); }
+    inline double totalWattHoursInjL2() const { return parse_uint64_sunssf<69, 118>(); }
 
     /**
      * Total active energy absorbed L2. [Wh]
      */
-    inline double totalWattHoursAbsL2() const { return parse_uint64_sunssf(73, 118); }
+    inline double totalWattHoursAbsL2() const { return parse_uint64_sunssf<73, 118>(); }
 
     /**
      * Total reactive energy injected L2. [Varh]
      */
-    inline double totalVarHoursInjL2() const { return parse_uint64_sunssf(77, 119); }
+    inline double totalVarHoursInjL2() const { return parse_uint64_sunssf<77, 119>(); }
 
     /**
      * Total reactive energy absorbed L2. [Varh]
      */
-    inline double totalVarHoursAbsL2() const { return parse_uint64_sunssf(81, 119); }
+    inline double totalVarHoursAbsL2() const { return parse_uint64_sunssf<81, 119>(); }
 
     /**
      * Active power L3. [W]
      */
-    inline float wattsL3() const { return parse_int16_sunssf(85, 114); }
+    inline float wattsL3() const { return parse_int16_sunssf<85, 114>(); }
 
     /**
      * Apparent power L3. [VA]
      */
-    inline float VAL3() const { return parse_int16_sunssf(86, 116); }
+    inline float VAL3() const { return parse_int16_sunssf<86, 116>(); }
 
     /**
      * Reactive power L3. [Var]
      */
-    inline float varL3() const { return parse_int16_sunssf(87, 117); }
+    inline float varL3() const { return parse_int16_sunssf<87, 117>(); }
 
     /**
      * Power factor L3.
      */
-    inline float PFL3() const { return parse_int16_sunssf(88, 115); }
+    inline float PFL3() const { return parse_int16_sunssf<88, 115>(); }
 
     /**
      * Current L3. [A]
      */
-    inline float ampsL3() const { return parse_int16_sunssf(89, 111); }
+    inline float ampsL3() const { return parse_int16_sunssf<89, 111>(); }
 
     /**
      * Phase voltage L3-L1. [V]
      */
-    inline float phaseVoltageL3L1() const { return parse_uint16_sunssf(90, 112); }
+    inline float phaseVoltageL3L1() const { return parse_uint16_sunssf<90, 112>(); }
 
     /**
      * Phase voltage L3-N. [V]
      */
-    inline float phaseVoltageL3N() const { return parse_uint16_sunssf(91, 112); }
+    inline float phaseVoltageL3N() const { return parse_uint16_sunssf<91, 112>(); }
 
     /**
      * Total active energy injected L3. [Wh]
      */
-    inline double totalWattHoursInjL3() const { return parse_uint64_sunssf(92, 118); }
+    inline double totalWattHoursInjL3() const { return parse_uint64_sunssf<92, 118>(); }
 
     /**
      * Total active energy absorbed L3. [Wh]
      */
-    inline double totalWattHoursAbsL3() const { return parse_uint64_sunssf(96, 118); }
+    inline double totalWattHoursAbsL3() const { return parse_uint64_sunssf<96, 118>(); }
 
     /**
      * Total reactive energy injected L3. [Varh]
      */
-    inline double totalVarHoursInjL3() const { return parse_uint64_sunssf(100, 119); }
+    inline double totalVarHoursInjL3() const { return parse_uint64_sunssf<100, 119>(); }
 
     /**
      * Total reactive energy absorbed L3. [Varh]
      */
-    inline double totalVarHoursAbsL3() const { return parse_uint64_sunssf(104, 119); }
+    inline double totalVarHoursAbsL3() const { return parse_uint64_sunssf<104, 119>(); }
 
     /**
      * Throttling in pct of maximum active power. [Pct]
@@ -5422,102 +5734,107 @@ class DERACMeasurement : public SunSpecModel<701, 153> {
 /**
  * DER capacity model.
  */
-class DERCapacity : public SunSpecModel<702, 50> {
+class DERCapacity : public SunSpecModel<702, 50, 0, 43, 44, 45, 46, 47, 48, 49> {
   public:
+    /**
+     * Descriptors of all points, for generic access.
+     */
+    static SunSpecPointTable pointTable();
+
     /**
      * Maximum active power rating at unity power factor in watts. [W]
      */
-    inline float activePowerMaxRating() const { return parse_uint16_sunssf(0, 43); }
+    inline float activePowerMaxRating() const { return parse_uint16_sunssf<0, 43>(); }
 
     /**
      * Active power rating at specified over-excited power factor in watts. [W]
      */
-    inline float activePowerOverExcitedRating() const { return parse_uint16_sunssf(1, 43); }
+    inline float activePowerOverExcitedRating() const { return parse_uint16_sunssf<1, 43>(); }
 
     /**
      * Specified over-excited power factor.
      */
-    inline float specifiedOverExcitedPF_2() const { return parse_uint16_sunssf(2, 44); }
+    inline float specifiedOverExcitedPF_2() const { return parse_uint16_sunssf<2, 44>(); }
 
     /**
      * Active power rating at specified under-excited power factor in watts. [W]
      */
-    inline float activePowerUnderExcitedRating() const { return parse_uint16_sunssf(3, 43); }
+    inline float activePowerUnderExcitedRating() const { return parse_uint16_sunssf<3, 43>(); }
 
     /**
      * Specified under-excited power factor.
      */
-    inline float specifiedUnderExcitedPF_4() const { return parse_uint16_sunssf(4, 44); }
+    inline float specifiedUnderExcitedPF_4() const { return parse_uint16_sunssf<4, 44>(); }
 
     /**
      * Maximum apparent power rating in voltamperes. [VA]
      */
-    inline float apparentPowerMaxRating() const { return parse_uint16_sunssf(5, 45); }
+    inline float apparentPowerMaxRating() const { return parse_uint16_sunssf<5, 45>(); }
 
     /**
      * Maximum injected reactive power rating in vars. [Var]
      */
-    inline float reactivePowerInjectedRating() const { return parse_uint16_sunssf(6, 46); }
+    inline float reactivePowerInjectedRating() const { return parse_uint16_sunssf<6, 46>(); }
 
     /**
      * Maximum absorbed reactive power rating in vars. [Var]
      */
-    inline float reactivePowerAbsorbedRating() const { return parse_uint16_sunssf(7, 46); }
+    inline float reactivePowerAbsorbedRating() const { return parse_uint16_sunssf<7, 46>(); }
 
     /**
      * Maximum active power charge rate in watts. [W]
      */
-    inline float chargeRateMaxRating() const { return parse_uint16_sunssf(8, 43); }
+    inline float chargeRateMaxRating() const { return parse_uint16_sunssf<8, 43>(); }
 
     /**
      * Maximum active power discharge rate in watts. [W]
      */
-    inline float dischargeRateMaxRating() const { return parse_uint16_sunssf(9, 43); }
+    inline float dischargeRateMaxRating() const { return parse_uint16_sunssf<9, 43>(); }
 
     /**
      * Maximum apparent power charge rate in voltamperes. [VA]
      */
-    inline float chargeRateMaxVARating() const { return parse_uint16_sunssf(10, 45); }
+    inline float chargeRateMaxVARating() const { return parse_uint16_sunssf<10, 45>(); }
 
     /**
      * Maximum apparent power discharge rate in voltamperes. [VA]
      */
-    inline float dischargeRateMaxVARating() const { return parse_uint16_sunssf(11, 45); }
+    inline float dischargeRateMaxVARating() const { return parse_uint16_sunssf<11, 45>(); }
 
     /**
      * AC voltage nominal rating. [V]
      */
-    inline float ACVoltageNominalRating() const { return parse_uint16_sunssf(12, 47); }
+    inline float ACVoltageNominalRating() const { return parse_uint16_sunssf<12, 47>(); }
 
     /**
      * AC voltage maximum rating. [V]
      */
-    inline float ACVoltageMaxRating() const { return parse_uint16_sunssf(13, 47); }
+    inline float ACVoltageMaxRating() const { return parse_uint16_sunssf<13, 47>(); }
 
     /**
      * AC voltage minimum rating. [V]
      */
-    inline float ACVoltageMinRating() const { return parse_uint16_sunssf(14, 47); }
+    inline float ACVoltageMinRating() const { return parse_uint16_sunssf<14, 47>(); }
 
     /**
      * AC current maximum rating in amps. [A]
      */
-    inline float ACCurrentMaxRating() const { return parse_uint16_sunssf(15, 48); }
+    inline float ACCurrentMaxRating() const { return parse_uint16_sunssf<15, 48>(); }
 
     /**
      * Power factor over-excited rating.
      */
-    inline float PFOverExcitedRating() const { return parse_uint16_sunssf(16, 44); }
+    inline float PFOverExcitedRating() const { return parse_uint16_sunssf<16, 44>(); }
 
     /**
      * Power factor under-excited rating.
      */
-    inline float PFUnderExcitedRating() const { return parse_uint16_sunssf(17, 44); }
+    inline float PFUnderExcitedRating() const { return parse_uint16_sunssf<17, 44>(); }
 
     /**
      * Reactive susceptance that remains connected to the Area EPS in the cease to energize and trip state. [S]
      */
-    inline float reactiveSusceptance() const { return parse_uint16_sunssf(18, 49); }
+    inline float reactiveSusceptance() const { return parse_uint16_sunssf<18, 49>(); }
 
     /**
      * Normal operating performance category as specified in IEEE 1547-2018.
@@ -5542,92 +5859,92 @@ class DERCapacity : public SunSpecModel<702, 50> {
     /**
      * Maximum active power setting used to adjust maximum active power setting. [W]
      */
-    inline float activePowerMaxSetting() const { return parse_uint16_sunssf(24, 43); }
+    inline float activePowerMaxSetting() const { return parse_uint16_sunssf<24, 43>(); }
 
     /**
      * Active power setting at specified over-excited power factor in watts. [W]
      */
-    inline float activePowerOverExcitedSetting() const { return parse_uint16_sunssf(25, 43); }
+    inline float activePowerOverExcitedSetting() const { return parse_uint16_sunssf<25, 43>(); }
 
     /**
      * Specified over-excited power factor.
      */
-    inline float specifiedOverExcitedPF_26() const { return parse_uint16_sunssf(26, 44); }
+    inline float specifiedOverExcitedPF_26() const { return parse_uint16_sunssf<26, 44>(); }
 
     /**
      * Active power setting at specified under-excited power factor in watts. [W]
      */
-    inline float activePowerUnderExcitedSetting() const { return parse_uint16_sunssf(27, 43); }
+    inline float activePowerUnderExcitedSetting() const { return parse_uint16_sunssf<27, 43>(); }
 
     /**
      * Specified under-excited power factor.
      */
-    inline float specifiedUnderExcitedPF_28() const { return parse_uint16_sunssf(28, 44); }
+    inline float specifiedUnderExcitedPF_28() const { return parse_uint16_sunssf<28, 44>(); }
 
     /**
      * Maximum apparent power setting used to adjust maximum apparent power rating. [VA]
      */
-    inline float apparentPowerMaxSetting() const { return parse_uint16_sunssf(29, 45); }
+    inline float apparentPowerMaxSetting() const { return parse_uint16_sunssf<29, 45>(); }
 
     /**
      * Maximum injected reactive power setting used to adjust maximum injected reactive power rating. [Var]
      */
-    inline float reactivePowerInjectedSetting() const { return parse_uint16_sunssf(30, 46); }
+    inline float reactivePowerInjectedSetting() const { return parse_uint16_sunssf<30, 46>(); }
 
     /**
      * Maximum absorbed reactive power setting used to adjust maximum absorbed reactive power rating. [Var]
      */
-    inline float reactivePowerAbsorbedSetting() const { return parse_uint16_sunssf(31, 46); }
+    inline float reactivePowerAbsorbedSetting() const { return parse_uint16_sunssf<31, 46>(); }
 
     /**
      * Maximum active power charge rate setting used to adjust maximum active power charge rate rating. [W]
      */
-    inline float chargeRateMaxSetting() const { return parse_uint16_sunssf(32, 43); }
+    inline float chargeRateMaxSetting() const { return parse_uint16_sunssf<32, 43>(); }
 
     /**
      * Maximum active power discharge rate setting used to adjust maximum active power discharge rate rating. [W]
      */
-    inline float dischargeRateMaxSetting() const { return parse_uint16_sunssf(33, 43); }
+    inline float dischargeRateMaxSetting() const { return parse_uint16_sunssf<33, 43>(); }
 
     /**
      * Maximum apparent power charge rate setting used to adjust maximum apparent power charge rate rating. [VA]
      */
-    inline float chargeRateMaxVASetting() const { return parse_uint16_sunssf(34, 45); }
+    inline float chargeRateMaxVASetting() const { return parse_uint16_sunssf<34, 45>(); }
 
     /**
      * Maximum apparent power discharge rate setting used to adjust maximum apparent power discharge rate rating. [VA]
      */
-    inline float dischargeRateMaxVASetting() const { return parse_uint16_sunssf(35, 45); }
+    inline float dischargeRateMaxVASetting() const { return parse_uint16_sunssf<35, 45>(); }
 
     /**
      * Nominal AC voltage setting. [V]
      */
-    inline float nominalACVoltageSetting() const { return parse_uint16_sunssf(36, 47); }
+    inline float nominalACVoltageSetting() const { return parse_uint16_sunssf<36, 47>(); }
 
     /**
      * AC voltage maximum setting used to adjust AC voltage maximum rating. [V]
      */
-    inline float ACVoltageMaxSetting() const { return parse_uint16_sunssf(37, 47); }
+    inline float ACVoltageMaxSetting() const { return parse_uint16_sunssf<37, 47>(); }
 
     /**
      * AC voltage minimum setting used to adjust AC voltage minimum rating. [V]
      */
-    inline float ACVoltageMinSetting() const { return parse_uint16_sunssf(38, 47); }
+    inline float ACVoltageMinSetting() const { return parse_uint16_sunssf<38, 47>(); }
 
     /**
      * Maximum AC current setting used to adjust maximum AC current rating. [A]
      */
-    inline float ACCurrentMaxSetting() const { return parse_uint16_sunssf(39, 48); }
+    inline float ACCurrentMaxSetting() const { return parse_uint16_sunssf<39, 48>(); }
 
     /**
      * Power factor over-excited setting.
      */
-    inline float PFOverExcitedSetting() const { return parse_uint16_sunssf(40, 44); }
+    inline float PFOverExcitedSetting() const { return parse_uint16_sunssf<40, 44>(); }
 
     /**
      * Power factor under-excited setting.
      */
-    inline float PFUnderExcitedSetting() const { return parse_uint16_sunssf(41, 44); }
+    inline float PFUnderExcitedSetting() const { return parse_uint16_sunssf<41, 44>(); }
 
     /**
      * Intentional island categories.
@@ -5639,8 +5956,13 @@ class DERCapacity : public SunSpecModel<702, 50> {
 /**
  * Enter service model.
  */
-class EnterService : public SunSpecModel<703, 17> {
+class EnterService : public SunSpecModel<703, 17, 0, 15, 16> {
   public:
+    /**
+     * Descriptors of all points, for generic access.
+     */
+    static SunSpecPointTable pointTable();
+
     /**
      * Permit enter service.
      */
@@ -5649,22 +5971,22 @@ class EnterService : public SunSpecModel<703, 17> {
     /**
      * Enter service voltage high threshold as percent of normal voltage. [Pct]
      */
-    inline float enterServiceVoltageHigh() const { return parse_uint16_sunssf(1, 15); }
+    inline float enterServiceVoltageHigh() const { return parse_uint16_sunssf<1, 15>(); }
 
     /**
      * Enter service voltage low threshold as percent of normal voltage. [Pct]
      */
-    inline float enterServiceVoltageLow() const { return parse_uint16_sunssf(2, 15); }
+    inline float enterServiceVoltageLow() const { return parse_uint16_sunssf<2, 15>(); }
 
     /**
      * Enter service frequency high threshold. [Hz]
      */
-    inline double enterServiceFrequencyHigh() const { return parse_uint32_sunssf(3, 16); }
+    inline double enterServiceFrequencyHigh() const { return parse_uint32_sunssf<3, 16>(); }
 
     /**
      * Enter service frequency low threshold. [Hz]
      */
-    inline double enterServiceFrequencyLow() const { return parse_uint32_sunssf(5, 16); }
+    inline double enterServiceFrequencyLow() const { return parse_uint32_sunssf<5, 16>(); }
 
     /**
      * Enter service delay time in seconds. [Secs]
@@ -5691,27 +6013,32 @@ class EnterService : public SunSpecModel<703, 17> {
 /**
  * DER storage capacity.
  */
-class DERStorageCapacity : public SunSpecModel<713, 7> {
+class DERStorageCapacity : public SunSpecModel<713, 7, 0, 5, 6> {
   public:
+    /**
+     * Descriptors of all points, for generic access.
+     */
+    static SunSpecPointTable pointTable();
+
     /**
      * Energy rating of the DER storage. [WH]
      */
-    inline float energyRating() const { return parse_uint16_sunssf(0, 5); }
+    inline float energyRating() const { return parse_uint16_sunssf<0, 5>(); }
 
     /**
      * Energy available of the DER storage (WHAvail = WHRtg * SoC * SoH) [WH]
      */
-    inline float energyAvailable() const { return parse_uint16_sunssf(1, 5); }
+    inline float energyAvailable() const { return parse_uint16_sunssf<1, 5>(); }
 
     /**
      * State of charge of the DER storage. [Pct]
      */
-    inline float stateOfCharge() const { return parse_uint16_sunssf(2, 6); }
+    inline float stateOfCharge() const { return parse_uint16_sunssf<2, 6>(); }
 
     /**
      * State of health of the DER storage. [Pct]
      */
-    inline float stateOfHealth() const { return parse_uint16_sunssf(3, 6); }
+    inline float stateOfHealth() const { return parse_uint16_sunssf<3, 6>(); }
 
     /**
      * Storage status.
@@ -5723,8 +6050,13 @@ class DERStorageCapacity : public SunSpecModel<713, 7> {
 /**
  * DER Control
  */
-class DERCtl : public SunSpecModel<715, 7> {
+class DERCtl : public SunSpecModel<715, 7, 0> {
   public:
+    /**
+     * Descriptors of all points, for generic access.
+     */
+    static SunSpecPointTable pointTable();
+
     /**
      * DER control mode. Enumeration.
      */
@@ -5755,8 +6087,13 @@ class DERCtl : public SunSpecModel<715, 7> {
 /**
  * This model has been deprecated.
  */
-class EnergyStorageBaseModelDEPRECATED : public SunSpecModel<801, 1> {
+class EnergyStorageBaseModelDEPRECATED : public SunSpecModel<801, 1, 0> {
   public:
+    /**
+     * Descriptors of all points, for generic access.
+     */
+    static SunSpecPointTable pointTable();
+
     /**
      * This model has been deprecated.
      */
@@ -5764,67 +6101,72 @@ class EnergyStorageBaseModelDEPRECATED : public SunSpecModel<801, 1> {
 
 };
 
-class BatteryBaseModel : public SunSpecModel<802, 62> {
+class BatteryBaseModel : public SunSpecModel<802, 62, 0, 50, 51, 52, 53, 54, 55, 56, 57, 58, 59, 60, 61> {
   public:
+    /**
+     * Descriptors of all points, for generic access.
+     */
+    static SunSpecPointTable pointTable();
+
     /**
      * Nameplate charge capacity in amp-hours. [Ah]
      */
-    inline float nameplateChargeCapacity() const { return parse_uint16_sunssf(0, 50); }
+    inline float nameplateChargeCapacity() const { return parse_uint16_sunssf<0, 50>(); }
 
     /**
      * Nameplate energy capacity in DC watt-hours. [Wh]
      */
-    inline float nameplateEnergyCapacity() const { return parse_uint16_sunssf(1, 51); }
+    inline float nameplateEnergyCapacity() const { return parse_uint16_sunssf<1, 51>(); }
 
     /**
      * Maximum rate of energy transfer into the storage device in DC watts. [W]
      */
-    inline float nameplateMaxChargeRate() const { return parse_uint16_sunssf(2, 52); }
+    inline float nameplateMaxChargeRate() const { return parse_uint16_sunssf<2, 52>(); }
 
     /**
      * Maximum rate of energy transfer out of the storage device in DC watts. [W]
      */
-    inline float nameplateMaxDischargeRate() const { return parse_uint16_sunssf(3, 52); }
+    inline float nameplateMaxDischargeRate() const { return parse_uint16_sunssf<3, 52>(); }
 
     /**
      * Self discharge rate.  Percentage of capacity (WHRtg) discharged per day. [%WHRtg]
      */
-    inline float selfDischargeRate() const { return parse_uint16_sunssf(4, 53); }
+    inline float selfDischargeRate() const { return parse_uint16_sunssf<4, 53>(); }
 
     /**
      * Manufacturer maximum state of charge, expressed as a percentage. [%WHRtg]
      */
-    inline float nameplateMaxSoC() const { return parse_uint16_sunssf(5, 54); }
+    inline float nameplateMaxSoC() const { return parse_uint16_sunssf<5, 54>(); }
 
     /**
      * Manufacturer minimum state of charge, expressed as a percentage. [%WHRtg]
      */
-    inline float nameplateMinSoC() const { return parse_uint16_sunssf(6, 54); }
+    inline float nameplateMinSoC() const { return parse_uint16_sunssf<6, 54>(); }
 
     /**
      * Setpoint for maximum reserve for storage as a percentage of the nominal maximum storage. [%WHRtg]
      */
-    inline float maxReservePercent() const { return parse_uint16_sunssf(7, 54); }
+    inline float maxReservePercent() const { return parse_uint16_sunssf<7, 54>(); }
 
     /**
      * Setpoint for minimum reserve for storage as a percentage of the nominal maximum storage. [%WHRtg]
      */
-    inline float minReservePercent() const { return parse_uint16_sunssf(8, 54); }
+    inline float minReservePercent() const { return parse_uint16_sunssf<8, 54>(); }
 
     /**
      * State of charge, expressed as a percentage. [%WHRtg]
      */
-    inline float stateOfCharge() const { return parse_uint16_sunssf(9, 54); }
+    inline float stateOfCharge() const { return parse_uint16_sunssf<9, 54>(); }
 
     /**
      * Depth of discharge, expressed as a percentage. [%]
      */
-    inline float depthOfDischarge() const { return parse_uint16_sunssf(10, 55); }
+    inline float depthOfDischarge() const { return parse_uint16_sunssf<10, 55>(); }
 
     /**
      * Percentage of battery life remaining. [%]
      */
-    inline float stateOfHealth() const { return parse_uint16_sunssf(11, 56); }
+    inline float stateOfHealth() const { return parse_uint16_sunssf<11, 56>(); }
 
     /**
      * Number of cycles executed in the battery.
@@ -5899,22 +6241,22 @@ class BatteryBaseModel : public SunSpecModel<802, 62> {
     /**
      * DC Bus Voltage. [V]
      */
-    inline float externalBatteryVoltage() const { return parse_uint16_sunssf(32, 57); }
+    inline float externalBatteryVoltage() const { return parse_uint16_sunssf<32, 57>(); }
 
     /**
      * Instantaneous maximum battery voltage. [V]
      */
-    inline float maxBatteryVoltage() const { return parse_uint16_sunssf(33, 57); }
+    inline float maxBatteryVoltage() const { return parse_uint16_sunssf<33, 57>(); }
 
     /**
      * Instantaneous minimum battery voltage. [V]
      */
-    inline float minBatteryVoltage() const { return parse_uint16_sunssf(34, 57); }
+    inline float minBatteryVoltage() const { return parse_uint16_sunssf<34, 57>(); }
 
     /**
      * Maximum voltage for all cells in the bank. [V]
      */
-    inline float maxCellVoltage() const { return parse_uint16_sunssf(35, 58); }
+    inline float maxCellVoltage() const { return parse_uint16_sunssf<35, 58>(); }
 
     /**
      * String containing the cell with maximum voltage.
@@ -5929,7 +6271,7 @@ class BatteryBaseModel : public SunSpecModel<802, 62> {
     /**
      * Minimum voltage for all cells in the bank. [V]
      */
-    inline float minCellVoltage() const { return parse_uint16_sunssf(38, 58); }
+    inline float minCellVoltage() const { return parse_uint16_sunssf<38, 58>(); }
 
     /**
      * String containing the cell with minimum voltage.
@@ -5944,27 +6286,27 @@ class BatteryBaseModel : public SunSpecModel<802, 62> {
     /**
      * Average cell voltage for all cells in the bank. [V]
      */
-    inline float averageCellVoltage() const { return parse_uint16_sunssf(41, 58); }
+    inline float averageCellVoltage() const { return parse_uint16_sunssf<41, 58>(); }
 
     /**
      * Total DC current flowing to/from the battery bank. [A]
      */
-    inline float totalDCCurrent() const { return parse_int16_sunssf(42, 59); }
+    inline float totalDCCurrent() const { return parse_int16_sunssf<42, 59>(); }
 
     /**
      * Instantaneous maximum DC charge current. [A]
      */
-    inline float maxChargeCurrent() const { return parse_uint16_sunssf(43, 60); }
+    inline float maxChargeCurrent() const { return parse_uint16_sunssf<43, 60>(); }
 
     /**
      * Instantaneous maximum DC discharge current. [A]
      */
-    inline float maxDischargeCurrent() const { return parse_uint16_sunssf(44, 60); }
+    inline float maxDischargeCurrent() const { return parse_uint16_sunssf<44, 60>(); }
 
     /**
      * Total power flowing to/from the battery bank. [W]
      */
-    inline float totalPower() const { return parse_int16_sunssf(45, 61); }
+    inline float totalPower() const { return parse_int16_sunssf<45, 61>(); }
 
     /**
      * Request from battery to start or stop the inverter.  Enumeration.
@@ -5974,7 +6316,7 @@ class BatteryBaseModel : public SunSpecModel<802, 62> {
     /**
      * AC Power requested by battery. [W]
      */
-    inline float batteryPowerRequest() const { return parse_int16_sunssf(47, 61); }
+    inline float batteryPowerRequest() const { return parse_int16_sunssf<47, 61>(); }
 
     /**
      * Instruct the battery bank to perform an operation such as connecting.  Enumeration.
@@ -5988,8 +6330,13 @@ class BatteryBaseModel : public SunSpecModel<802, 62> {
 
 };
 
-class VerisStatusAndConfiguration : public SunSpecModel<64001, 71> {
+class VerisStatusAndConfiguration : public SunSpecModel<64001, 71, 0> {
   public:
+    /**
+     * Descriptors of all points, for generic access.
+     */
+    static SunSpecPointTable pointTable();
+
     inline uint16_t commandCode() const { return parse_enum16(0); }
 
     inline uint16_t hardwareRevision() const { return parse_uint16(1); }
@@ -6068,8 +6415,13 @@ class VerisStatusAndConfiguration : public SunSpecModel<64001, 71> {
 
 };
 
-class EltekInverterExtension : public SunSpecModel<64101, 7> {
+class EltekInverterExtension : public SunSpecModel<64101, 7, 0> {
   public:
+    /**
+     * Descriptors of all points, for generic access.
+     */
+    static SunSpecPointTable pointTable();
+
     inline uint16_t eltek_Country_Code() const { return parse_uint16(0); }
 
     inline uint16_t eltek_Feeding_Phase() const { return parse_uint16(1); }
@@ -6086,8 +6438,13 @@ class EltekInverterExtension : public SunSpecModel<64101, 7> {
 
 };
 
-class OutBackAXSDevice : public SunSpecModel<64110, 282> {
+class OutBackAXSDevice : public SunSpecModel<64110, 282, 0, 278> {
   public:
+    /**
+     * Descriptors of all points, for generic access.
+     */
+    static SunSpecPointTable pointTable();
+
     inline uint16_t AXSMajorFirmwareNumber() const { return parse_uint16(0); }
 
     inline uint16_t AXSMidFirmwareNumber() const { return parse_uint16(1); }
@@ -6182,12 +6539,12 @@ class OutBackAXSDevice : public SunSpecModel<64110, 282> {
     /**
      * [C]
      */
-    inline float batteryTemperature() const { return parse_int16_sunssf(276, 278); }
+    inline float batteryTemperature() const { return parse_int16_sunssf<276, 278>(); }
 
     /**
      * [C]
      */
-    inline float ambientTemperature() const { return parse_int16_sunssf(277, 278); }
+    inline float ambientTemperature() const { return parse_int16_sunssf<277, 278>(); }
 
     inline uint16_t AXSError() const { return parse_bitfield16(279); }
 
@@ -6197,96 +6554,106 @@ class OutBackAXSDevice : public SunSpecModel<64110, 282> {
 
 };
 
-class BasicChargeController : public SunSpecModel<64111, 23> {
+class BasicChargeController : public SunSpecModel<64111, 23, 0, 1, 2, 3, 4, 5> {
   public:
+    /**
+     * Descriptors of all points, for generic access.
+     */
+    static SunSpecPointTable pointTable();
+
     inline uint16_t portNumber() const { return parse_uint16(0); }
 
     /**
      * [V]
      */
-    inline float batteryVoltage() const { return parse_uint16_sunssf(6, 1); }
+    inline float batteryVoltage() const { return parse_uint16_sunssf<6, 1>(); }
 
     /**
      * [V]
      */
-    inline float arrayVoltage() const { return parse_uint16_sunssf(7, 1); }
+    inline float arrayVoltage() const { return parse_uint16_sunssf<7, 1>(); }
 
     /**
      * [A]
      */
-    inline float outputCurrent() const { return parse_uint16_sunssf(8, 2); }
+    inline float outputCurrent() const { return parse_uint16_sunssf<8, 2>(); }
 
     /**
      * [A]
      */
-    inline float arrayCurrent() const { return parse_uint16_sunssf(9, 3); }
+    inline float arrayCurrent() const { return parse_uint16_sunssf<9, 3>(); }
 
     inline uint16_t operatingState() const { return parse_enum16(10); }
 
     /**
      * [W]
      */
-    inline float outputWattage() const { return parse_uint16_sunssf(11, 3); }
+    inline float outputWattage() const { return parse_uint16_sunssf<11, 3>(); }
 
     /**
      * [V]
      */
-    inline float todaySMinimumBatteryVoltage() const { return parse_uint16_sunssf(12, 1); }
+    inline float todaySMinimumBatteryVoltage() const { return parse_uint16_sunssf<12, 1>(); }
 
     /**
      * [V]
      */
-    inline float todaySMaximumBatteryVoltage() const { return parse_uint16_sunssf(13, 1); }
+    inline float todaySMaximumBatteryVoltage() const { return parse_uint16_sunssf<13, 1>(); }
 
     /**
      * [V]
      */
-    inline float VOC() const { return parse_uint16_sunssf(14, 1); }
+    inline float VOC() const { return parse_uint16_sunssf<14, 1>(); }
 
     /**
      * [V]
      */
-    inline float todaySMaximumVOC() const { return parse_uint16_sunssf(15, 1); }
+    inline float todaySMaximumVOC() const { return parse_uint16_sunssf<15, 1>(); }
 
     /**
      * [kWh]
      */
-    inline float todaySKWh() const { return parse_uint16_sunssf(16, 5); }
+    inline float todaySKWh() const { return parse_uint16_sunssf<16, 5>(); }
 
     /**
      * [AH]
      */
-    inline float todaySAH() const { return parse_uint16_sunssf(17, 4); }
+    inline float todaySAH() const { return parse_uint16_sunssf<17, 4>(); }
 
     /**
      * [kWh]
      */
-    inline float lifetimeKWh() const { return parse_uint16_sunssf(18, 3); }
+    inline float lifetimeKWh() const { return parse_uint16_sunssf<18, 3>(); }
 
     /**
      * [kAH]
      */
-    inline float lifetimeKAH() const { return parse_uint16_sunssf(19, 5); }
+    inline float lifetimeKAH() const { return parse_uint16_sunssf<19, 5>(); }
 
     /**
      * [W]
      */
-    inline float lifetimeMaximumOutputWattage() const { return parse_uint16_sunssf(20, 3); }
+    inline float lifetimeMaximumOutputWattage() const { return parse_uint16_sunssf<20, 3>(); }
 
     /**
      * [V]
      */
-    inline float lifetimeMaximumBatteryVoltage() const { return parse_uint16_sunssf(21, 1); }
+    inline float lifetimeMaximumBatteryVoltage() const { return parse_uint16_sunssf<21, 1>(); }
 
     /**
      * [V]
      */
-    inline float lifetimeMaximumVOCVoltage() const { return parse_uint16_sunssf(22, 1); }
+    inline float lifetimeMaximumVOCVoltage() const { return parse_uint16_sunssf<22, 1>(); }
 
 };
 
-class OutBackFMChargeController : public SunSpecModel<64112, 64> {
+class OutBackFMChargeController : public SunSpecModel<64112, 64, 0, 1, 3, 6> {
   public:
+    /**
+     * Descriptors of all points, for generic access.
+     */
+    static SunSpecPointTable pointTable();
+
     inline uint16_t portNumber() const { return parse_uint16(0); }
 
     inline uint16_t faults() const { return parse_bitfield16(7); }
@@ -6294,37 +6661,37 @@ class OutBackFMChargeController : public SunSpecModel<64112, 64> {
     /**
      * [V]
      */
-    inline float absorb() const { return parse_uint16_sunssf(8, 1); }
+    inline float absorb() const { return parse_uint16_sunssf<8, 1>(); }
 
     /**
      * [Tmh]
      */
-    inline float absorbTime() const { return parse_uint16_sunssf(9, 3); }
+    inline float absorbTime() const { return parse_uint16_sunssf<9, 3>(); }
 
     /**
      * [A]
      */
-    inline float absorbEnd() const { return parse_uint16_sunssf(10, 1); }
+    inline float absorbEnd() const { return parse_uint16_sunssf<10, 1>(); }
 
     /**
      * [V]
      */
-    inline float rebulk() const { return parse_uint16_sunssf(11, 1); }
+    inline float rebulk() const { return parse_uint16_sunssf<11, 1>(); }
 
     /**
      * [V]
      */
-    inline float float_() const { return parse_uint16_sunssf(12, 1); }
+    inline float float_() const { return parse_uint16_sunssf<12, 1>(); }
 
     /**
      * [A]
      */
-    inline float maximumCharge() const { return parse_uint16_sunssf(13, 1); }
+    inline float maximumCharge() const { return parse_uint16_sunssf<13, 1>(); }
 
     /**
      * [V]
      */
-    inline float equalize() const { return parse_uint16_sunssf(14, 1); }
+    inline float equalize() const { return parse_uint16_sunssf<14, 1>(); }
 
     /**
      * [Tmh]
@@ -6345,7 +6712,7 @@ class OutBackFMChargeController : public SunSpecModel<64112, 64> {
     /**
      * [Pct]
      */
-    inline float UPickPWMDutyCycle() const { return parse_uint16_sunssf(20, 1); }
+    inline float UPickPWMDutyCycle() const { return parse_uint16_sunssf<20, 1>(); }
 
     inline uint16_t gridTieMode() const { return parse_enum16(21); }
 
@@ -6354,24 +6721,24 @@ class OutBackFMChargeController : public SunSpecModel<64112, 64> {
     /**
      * [V]
      */
-    inline float tempCompLowerLimit() const { return parse_uint16_sunssf(23, 1); }
+    inline float tempCompLowerLimit() const { return parse_uint16_sunssf<23, 1>(); }
 
     /**
      * [V]
      */
-    inline float tempCompUpperLimit() const { return parse_uint16_sunssf(24, 1); }
+    inline float tempCompUpperLimit() const { return parse_uint16_sunssf<24, 1>(); }
 
     inline uint16_t autoRestartMode() const { return parse_enum16(25); }
 
     /**
      * [V]
      */
-    inline float wakeupVOCChange() const { return parse_uint16_sunssf(26, 1); }
+    inline float wakeupVOCChange() const { return parse_uint16_sunssf<26, 1>(); }
 
     /**
      * [A]
      */
-    inline float snoozeMode() const { return parse_uint16_sunssf(27, 1); }
+    inline float snoozeMode() const { return parse_uint16_sunssf<27, 1>(); }
 
     /**
      * [Tms]
@@ -6389,12 +6756,12 @@ class OutBackFMChargeController : public SunSpecModel<64112, 64> {
     /**
      * [V]
      */
-    inline float AUXLowBatteryDisconnect() const { return parse_uint16_sunssf(33, 1); }
+    inline float AUXLowBatteryDisconnect() const { return parse_uint16_sunssf<33, 1>(); }
 
     /**
      * [V]
      */
-    inline float AUXLowBatteryReconnect() const { return parse_uint16_sunssf(34, 1); }
+    inline float AUXLowBatteryReconnect() const { return parse_uint16_sunssf<34, 1>(); }
 
     /**
      * [Tms]
@@ -6404,12 +6771,12 @@ class OutBackFMChargeController : public SunSpecModel<64112, 64> {
     /**
      * [V]
      */
-    inline float AUXVentFan() const { return parse_uint16_sunssf(36, 1); }
+    inline float AUXVentFan() const { return parse_uint16_sunssf<36, 1>(); }
 
     /**
      * [V]
      */
-    inline float AUXPVTrigger() const { return parse_uint16_sunssf(37, 1); }
+    inline float AUXPVTrigger() const { return parse_uint16_sunssf<37, 1>(); }
 
     /**
      * [Tms]
@@ -6419,12 +6786,12 @@ class OutBackFMChargeController : public SunSpecModel<64112, 64> {
     /**
      * [V]
      */
-    inline float AUXNightLightThreshold() const { return parse_uint16_sunssf(39, 1); }
+    inline float AUXNightLightThreshold() const { return parse_uint16_sunssf<39, 1>(); }
 
     /**
      * [Tmh]
      */
-    inline float AUXNightLightOnTime() const { return parse_uint16_sunssf(40, 3); }
+    inline float AUXNightLightOnTime() const { return parse_uint16_sunssf<40, 3>(); }
 
     /**
      * [Tms]
@@ -6439,12 +6806,12 @@ class OutBackFMChargeController : public SunSpecModel<64112, 64> {
     /**
      * [V]
      */
-    inline float AUXErrorOutputLowBattery() const { return parse_uint16_sunssf(43, 1); }
+    inline float AUXErrorOutputLowBattery() const { return parse_uint16_sunssf<43, 1>(); }
 
     /**
      * [Tms]
      */
-    inline float AUXDivertHoldTime() const { return parse_uint16_sunssf(44, 1); }
+    inline float AUXDivertHoldTime() const { return parse_uint16_sunssf<44, 1>(); }
 
     /**
      * [Tms]
@@ -6454,12 +6821,12 @@ class OutBackFMChargeController : public SunSpecModel<64112, 64> {
     /**
      * [V]
      */
-    inline float AUXDivertRelative() const { return parse_uint16_sunssf(46, 1); }
+    inline float AUXDivertRelative() const { return parse_uint16_sunssf<46, 1>(); }
 
     /**
      * [V]
      */
-    inline float AUXDivertHysteresis() const { return parse_uint16_sunssf(47, 1); }
+    inline float AUXDivertHysteresis() const { return parse_uint16_sunssf<47, 1>(); }
 
     inline uint16_t FMCCMajorFirmwareNumber() const { return parse_uint16(48); }
 
@@ -6485,17 +6852,17 @@ class OutBackFMChargeController : public SunSpecModel<64112, 64> {
     /**
      * [kWh]
      */
-    inline float dataLogDailyKWh() const { return parse_uint16_sunssf(54, 6); }
+    inline float dataLogDailyKWh() const { return parse_uint16_sunssf<54, 6>(); }
 
     /**
      * [A]
      */
-    inline float dataLogDailyMaximumOutputA() const { return parse_uint16_sunssf(55, 1); }
+    inline float dataLogDailyMaximumOutputA() const { return parse_uint16_sunssf<55, 1>(); }
 
     /**
      * [W]
      */
-    inline float dataLogDailyMaximumOutputW() const { return parse_uint16_sunssf(56, 1); }
+    inline float dataLogDailyMaximumOutputW() const { return parse_uint16_sunssf<56, 1>(); }
 
     /**
      * [Tms]
@@ -6510,17 +6877,17 @@ class OutBackFMChargeController : public SunSpecModel<64112, 64> {
     /**
      * [V]
      */
-    inline float dataLogDailyMinimumBattery() const { return parse_uint16_sunssf(59, 1); }
+    inline float dataLogDailyMinimumBattery() const { return parse_uint16_sunssf<59, 1>(); }
 
     /**
      * [V]
      */
-    inline float dataLogDailyMaximumBattery() const { return parse_uint16_sunssf(60, 1); }
+    inline float dataLogDailyMaximumBattery() const { return parse_uint16_sunssf<60, 1>(); }
 
     /**
      * [V]
      */
-    inline float dataLogDailyMaximumInput() const { return parse_uint16_sunssf(61, 1); }
+    inline float dataLogDailyMaximumInput() const { return parse_uint16_sunssf<61, 1>(); }
 
     inline uint16_t dataLogClear() const { return parse_uint16(62); }
 
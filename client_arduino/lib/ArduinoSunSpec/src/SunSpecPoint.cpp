@@ -0,0 +1,152 @@
+#include "SunSpecPoint.h"
+
+#include "SunSpec.h"
+#include "SunSpecModel.h"
+
+namespace {
+
+uint64_t readRegisters(uint16_t const *registers, uint16_t count) {
+  uint64_t value = 0;
+  for (uint16_t i = 0; i < count; i++) {
+    value = value << 16 | registers[i];
+  }
+  return value;
+}
+
+SunSpecPointValue signedValue(int64_t value, int64_t notImplemented) {
+  SunSpecPointValue result;
+  if (value != notImplemented) {
+    result.kind = SunSpecPointValue::Kind::SIGNED;
+    result.i = value;
+  }
+  return result;
+}
+
+SunSpecPointValue unsignedValue(uint64_t value, uint64_t notImplemented) {
+  SunSpecPointValue result;
+  if (value != notImplemented) {
+    result.kind = SunSpecPointValue::Kind::UNSIGNED;
+    result.u = value;
+  }
+  return result;
+}
+
+SunSpecPointValue floatValue(double value) {
+  SunSpecPointValue result;
+  if (!std::isnan(value)) {
+    result.kind = SunSpecPointValue::Kind::FLOAT;
+    result.f = value;
+  }
+  return result;
+}
+
+}
+
+double SunSpecPointValue::toDouble() const {
+  switch (kind) {
+    case Kind::SIGNED:
+      return static_cast<double>(i) * SunSpecScaleFactor::pow10(exponent);
+    case Kind::UNSIGNED:
+      return static_cast<double>(u) * SunSpecScaleFactor::pow10(exponent);
+    case Kind::FLOAT:
+      return f;
+    default:
+      return NotImplemented::FLOAT64;
+  }
+}
+
+namespace SunSpecPoints {
+
+SunSpecPointDescriptor descriptor(SunSpecPointDescriptor const *progmemDescriptor) {
+  SunSpecPointDescriptor result;
+  memcpy_P(&result, progmemDescriptor, sizeof(result));
+  return result;
+}
+
+SunSpecPointValue decode(
+    uint16_t const *registers, uint16_t numRegisters,
+    SunSpecPointDescriptor const &point, uint16_t repeatOffset) {
+  uint16_t const offset = repeatOffset + point.offset;
+  if (offset + point.size > numRegisters) {
+    return SunSpecPointValue();
+  }
+  uint16_t const *const data = registers + offset;
+
+  SunSpecPointValue value;
+  switch (point.type) {
+    case SunSpecPointType::INT16:
+      value = signedValue(static_cast<int16_t>(data[0]), NotImplemented::INT16);
+      break;
+    case SunSpecPointType::INT32:
+      value = signedValue(static_cast<int32_t>(readRegisters(data, 2)), NotImplemented::INT32);
+      break;
+    case SunSpecPointType::INT64:
+      value = signedValue(static_cast<int64_t>(readRegisters(data, 4)), NotImplemented::INT64);
+      break;
+    case SunSpecPointType::RAW16:
+    case SunSpecPointType::UINT16:
+    case SunSpecPointType::BITFIELD16:
+    case SunSpecPointType::ENUM16:
+      value = unsignedValue(data[0], NotImplemented::UINT16);
+      break;
+    case SunSpecPointType::UINT32:
+    case SunSpecPointType::BITFIELD32:
+    case SunSpecPointType::ENUM32:
+      value = unsignedValue(readRegisters(data, 2), NotImplemented::UINT32);
+      break;
+    case SunSpecPointType::UINT64:
+    case SunSpecPointType::BITFIELD64:
+      value = unsignedValue(readRegisters(data, 4), NotImplemented::UINT64);
+      break;
+    case SunSpecPointType::ACC16:
+      value = unsignedValue(data[0], NotImplemented::ACC16);
+      break;
+    case SunSpecPointType::ACC32:
+    case SunSpecPointType::IPADDR:
+      value = unsignedValue(readRegisters(data, 2), NotImplemented::ACC32);
+      break;
+    case SunSpecPointType::ACC64:
+      value = unsignedValue(readRegisters(data, 4), NotImplemented::ACC64);
+      break;
+    case SunSpecPointType::EUI48:
+      value = unsignedValue(readRegisters(data, 3), NotImplemented::EUI48);
+      break;
+    case SunSpecPointType::FLOAT32:
+      value = floatValue(uint32_to_float(readRegisters(data, 2)));
+      break;
+    case SunSpecPointType::FLOAT64:
+      value = floatValue(uint64_to_double(readRegisters(data, 4)));
+      break;
+    case SunSpecPointType::STRING:
+      value.kind = SunSpecPointValue::Kind::STRING;
+      value.string = data;
+      value.length = point.size;
+      break;
+  }
+
+  if (point.scaleFactorOffset == SunSpecPointDescriptor::NO_SCALE_FACTOR || !value.isImplemented()) {
+    return value;
+  }
+  uint16_t const scaleFactorOffset = point.scaleFactorOffset & SunSpecPointDescriptor::SCALE_FACTOR_IN_GROUP ?
+    repeatOffset + (point.scaleFactorOffset & ~SunSpecPointDescriptor::SCALE_FACTOR_IN_GROUP) :
+    point.scaleFactorOffset;
+  int8_t const exponent = scaleFactorOffset < numRegisters ?
+    SunSpecScaleFactor::decode(registers[scaleFactorOffset]) :
+    SunSpecScaleFactor::INVALID_EXPONENT;
+  if (exponent == SunSpecScaleFactor::INVALID_EXPONENT) {
+    return SunSpecPointValue();
+  }
+  value.exponent = exponent;
+  return value;
+}
+
+SunSpecPointDescriptor const *find(SunSpecPointTable const &table, char const *name) {
+  for (uint16_t i = 0; i < table.numPoints; i++) {
+    if (!strcmp_P(name, descriptor(&table.points[i]).name)) {
+      return &table.points[i];
+    }
+  }
+  return nullptr;
+}
+
+}
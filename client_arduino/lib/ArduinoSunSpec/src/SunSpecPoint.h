@@ -0,0 +1,164 @@
+#pragma once
+
+#include <Arduino.h>
+
+/**
+ * The SunSpec point types that we can decode. Points of other types (`pad`,
+ * `ipv6addr`) and scale factors (`sunssf`) are not listed in point tables.
+ */
+enum class SunSpecPointType : uint8_t {
+  INT16,
+  INT32,
+  INT64,
+  RAW16,
+  UINT16,
+  UINT32,
+  UINT64,
+  ACC16,
+  ACC32,
+  ACC64,
+  BITFIELD16,
+  BITFIELD32,
+  BITFIELD64,
+  ENUM16,
+  ENUM32,
+  FLOAT32,
+  FLOAT64,
+  STRING,
+  IPADDR,
+  EUI48,
+};
+
+/**
+ * Describes a single point of a model or repeating group. Descriptors are
+ * generated into `SunSpecModels.cpp` and live in flash (`PROGMEM`), as do the
+ * strings they point to; use `SunSpecPoints::descriptor()` to copy one into
+ * RAM before accessing it.
+ */
+struct SunSpecPointDescriptor {
+  /**
+   * Marks a point without a scale factor.
+   */
+  static uint16_t const NO_SCALE_FACTOR = 0xffff;
+
+  /**
+   * Set in `scaleFactorOffset` of a point in a repeating group if the scale
+   * factor is in the same repeat; the remaining bits are then relative to
+   * the repeat. Otherwise, the scale factor is in the fixed part of the
+   * model.
+   */
+  static uint16_t const SCALE_FACTOR_IN_GROUP = 0x8000;
+
+  // The name of the point's getter in the model class, e.g. "watts" for the
+  // point that the SunSpec specification calls "W".
+  PGM_P name;
+  // Units from the specification, or `nullptr` if none.
+  PGM_P units;
+  // Offset from the start of the model body, or of the repeat.
+  uint16_t offset;
+  // Size in registers.
+  uint16_t size;
+  uint16_t scaleFactorOffset;
+  SunSpecPointType type;
+};
+
+/**
+ * Describes all points of a model, as returned by the static `pointTable()`
+ * function of each generated model class. The table itself is cheap to
+ * construct; the descriptors it points to are in flash.
+ *
+ * The descriptors and strings of all models take about 30 kB, but only those
+ * of models whose `pointTable()` is called are linked in.
+ */
+struct SunSpecPointTable {
+  uint16_t id;
+  // Length of the fixed part of the model, and of one repeat (or 0).
+  uint16_t length;
+  uint16_t repeatLength;
+  SunSpecPointDescriptor const *points;
+  uint16_t numPoints;
+  // Name of the repeating group, or `nullptr` if there is none.
+  PGM_P groupName;
+  SunSpecPointDescriptor const *groupPoints;
+  uint16_t numGroupPoints;
+};
+
+/**
+ * The decoded value of a single point. Integers keep their scale factor as a
+ * decimal exponent, so no floating-point arithmetic is needed to use them.
+ * Strings are not copied: they refer to the registers they were decoded from.
+ */
+struct SunSpecPointValue {
+  enum class Kind : uint8_t {
+    // Either the point or its scale factor is not implemented, or the
+    // registers do not contain it.
+    NOT_IMPLEMENTED,
+    SIGNED,
+    UNSIGNED,
+    FLOAT,
+    STRING,
+  };
+
+  Kind kind = Kind::NOT_IMPLEMENTED;
+  // Scale factor of `SIGNED` and `UNSIGNED` values; 0 if there is none.
+  int8_t exponent = 0;
+  union {
+    int64_t i;
+    uint64_t u;
+    double f;
+    // Two characters per register, up to `length` registers or the first
+    // NUL character.
+    uint16_t const *string;
+  };
+  uint16_t length = 0;
+
+  SunSpecPointValue() : u(0) {}
+
+  bool isImplemented() const {
+    return kind != Kind::NOT_IMPLEMENTED;
+  }
+
+  /**
+   * Returns the value with its scale factor applied, or NaN if it is not
+   * implemented or a string.
+   */
+  double toDouble() const;
+};
+
+namespace SunSpecPoints {
+
+  /**
+   * Copies the given descriptor out of flash.
+   */
+  SunSpecPointDescriptor descriptor(SunSpecPointDescriptor const *progmemDescriptor);
+
+  /**
+   * Decodes the given point from the registers of a model body. For points in
+   * a repeating group, `repeatOffset` is the offset of the repeat.
+   */
+  SunSpecPointValue decode(
+      uint16_t const *registers, uint16_t numRegisters,
+      SunSpecPointDescriptor const &point, uint16_t repeatOffset = 0);
+
+  /**
+   * Returns the descriptor, in flash, of the point in the fixed part of the
+   * table whose getter has the given name, or `nullptr` if there is none.
+   */
+  SunSpecPointDescriptor const *find(SunSpecPointTable const &table, char const *name);
+
+  /**
+   * Decodes the point in the fixed part of the model whose getter has the
+   * given name, e.g. `decode(model, "watts")`. Integers come with their
+   * scale factor as a decimal exponent, for callers that want to avoid
+   * floating-point arithmetic.
+   */
+  template<typename ModelType>
+  SunSpecPointValue decode(ModelType const &model, char const *name) {
+    SunSpecPointDescriptor const *point = find(ModelType::pointTable(), name);
+    if (!point || !model.isValid()) {
+      return SunSpecPointValue();
+    }
+    return decode(model.registers(), model.numRegisters(), descriptor(point));
+  }
+
+}
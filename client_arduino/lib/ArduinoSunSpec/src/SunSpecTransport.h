@@ -0,0 +1,68 @@
+#pragma once
+
+#include <Arduino.h>
+
+/**
+ * Non-blocking transport for reading holding registers, for example over
+ * Modbus TCP. Each read is a transaction identified by a nonzero ID. None of
+ * these methods may block; progress is made by calling `poll()` repeatedly.
+ *
+ * Transports may allow several transactions to be outstanding at the same
+ * time (pipelining), which saves round trips on high-latency links.
+ */
+class SunSpecTransport {
+  public:
+    /**
+     * Upper bound on `windowSize()` for any transport.
+     */
+    static size_t const MAX_WINDOW_SIZE = 4;
+
+    enum class Status {
+      // The transaction is still in progress.
+      PENDING,
+      // The registers have been received and can be retrieved.
+      DONE,
+      // The device responded with an error, or the transaction timed out, or
+      // the connection was lost.
+      FAILED,
+    };
+
+    virtual ~SunSpecTransport() {}
+
+    /**
+     * Returns how many transactions may currently be outstanding at the same
+     * time. This may drop to 1 if the device turns out not to handle
+     * pipelined requests.
+     */
+    virtual size_t windowSize() const { return 1; }
+
+    /**
+     * Sends a request to read `count` holding registers starting at `address`
+     * from server ID `serverId`. Returns the transaction ID, or 0 if the
+     * request could not be sent, for example because the window is full.
+     */
+    virtual uint16 request(uint8 serverId, uint16 address, uint16 count) = 0;
+
+    /**
+     * Processes any incoming data and checks for timeouts.
+     */
+    virtual void poll() = 0;
+
+    /**
+     * Returns the status of the given transaction. Unknown (e.g. released)
+     * transactions are reported as `FAILED`.
+     */
+    virtual Status status(uint16 transactionId) const = 0;
+
+    /**
+     * Returns the registers read by the given transaction, if it is `DONE`.
+     * The pointer remains valid until the transaction is released.
+     */
+    virtual uint16 const *registers(uint16 transactionId) const = 0;
+
+    /**
+     * Forgets about the given transaction, freeing up its resources. A late
+     * response to it is discarded.
+     */
+    virtual void release(uint16 transactionId) = 0;
+};
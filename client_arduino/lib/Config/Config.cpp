@@ -1,21 +1,23 @@
 #include <LittleFS.h>
 
 #include "Config.h"
+#include "Log.h"
+#include "Profiler.h"
 
 #define CONFIG_FILE_NAME "/prikmeter.json"
 
 ErrorCode Config::begin() {
+  PROFILE_ZONE("config.begin");
   File config = LittleFS.open(CONFIG_FILE_NAME, "r");
   if (!config) {
-    Serial.println("Failed to open " CONFIG_FILE_NAME);
+    LOG_ERROR("config", "Failed to open " CONFIG_FILE_NAME);
     return CONFIG_OPEN_ERROR;
   }
 
   DeserializationError error = deserializeJson(doc_, config);
   config.close();
   if (error) {
-    Serial.print("Failed to parse " CONFIG_FILE_NAME ": ");
-    Serial.println(error.c_str());
+    LOG_ERROR("config", "Failed to parse " CONFIG_FILE_NAME ": %s", error.c_str());
     return CONFIG_PARSE_ERROR;
   }
 
@@ -26,10 +28,39 @@ ErrorCode Config::begin() {
   serverPort_ = doc_["serverPort"] | 443;
   serverCertificateFingerprint_ = doc_["serverCertificateFingerprint"] | "";
   authToken_ = doc_["authToken"] | "";
+  uploadIntervalSeconds_ = doc_["uploadIntervalSeconds"] | 10;
+  uploadDeadbandWatts_ = doc_["uploadDeadbandWatts"] | 0;
+  uploadCounterThresholdWattHours_ = doc_["uploadCounterThresholdWattHours"] | 0;
+  uploadHeartbeatSeconds_ = doc_["uploadHeartbeatSeconds"] | 900;
 
-  inverterProtocol_ = doc_["inverterProtocol"] | "";
-  inverterHost_ = doc_["inverterHost"] | "";
-  inverterPort_ = doc_["inverterPort"] | 502;
+  numDevices_ = 0;
+  JsonArrayConst devices = doc_["devices"];
+  if (!devices.isNull()) {
+    for (JsonVariantConst device : devices) {
+      if (numDevices_ == MAX_DEVICES) {
+        LOG_WARNING("config", "Too many devices configured; using only the first %u", static_cast<unsigned>(MAX_DEVICES));
+        break;
+      }
+      char const *protocol = device["protocol"] | "";
+      if (!*protocol) {
+        continue;
+      }
+      devices_[numDevices_].protocol = protocol;
+      devices_[numDevices_].host = device["host"] | "";
+      devices_[numDevices_].port = device["port"] | 502;
+      numDevices_++;
+    }
+  } else {
+    char const *protocol = doc_["inverterProtocol"] | "";
+    if (*protocol) {
+      devices_[0].protocol = protocol;
+      devices_[0].host = doc_["inverterHost"] | "";
+      devices_[0].port = doc_["inverterPort"] | 502;
+      numDevices_ = 1;
+    }
+  }
+  devicePollMinIntervalSeconds_ = doc_["devicePollMinIntervalSeconds"] | 2;
+  devicePollMaxIntervalSeconds_ = doc_["devicePollMaxIntervalSeconds"] | 600;
 
   return NO_ERROR;
 }
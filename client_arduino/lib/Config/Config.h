@@ -4,6 +4,15 @@
 
 #include "errors.h"
 
+/**
+ * Connection settings for a single inverter or meter.
+ */
+struct DeviceConfig {
+  char const *protocol = "";
+  char const *host = "";
+  uint16 port = 0;
+};
+
 /**
  * Reads configuration file from /prikmeter.json and stores its values.
  * We use JSON because we depend on ArduinoJson anyway, for talking to
@@ -11,6 +20,8 @@
  */
 class Config {
   public:
+    static size_t const MAX_DEVICES = 4;
+
     ErrorCode begin();
 
     char const *wifiSsid() const { return wifiSsid_; }
@@ -21,12 +32,38 @@ class Config {
     char const *serverCertificateFingerprint() const { return serverCertificateFingerprint_; }
     char const *authToken() const { return authToken_; }
 
-    char const *inverterProtocol() const { return inverterProtocol_; }
-    char const *inverterHost() const { return inverterHost_; }
-    uint16 inverterPort() const { return inverterPort_; }
+    /**
+     * Inverters and meters to read power and energy from, configured either
+     * as a `devices` array of objects with `protocol`, `host` and `port`
+     * keys, or (for backwards compatibility) as a single device with
+     * `inverterProtocol`, `inverterHost` and `inverterPort` keys. Entries
+     * with an empty or missing protocol are left out.
+     */
+    size_t numDevices() const { return numDevices_; }
+    DeviceConfig const &device(size_t index) const { return devices_[index]; }
+
+    /**
+     * Bounds on the adaptive interval between polls of each device.
+     */
+    uint32 devicePollMinIntervalSeconds() const { return devicePollMinIntervalSeconds_; }
+    uint32 devicePollMaxIntervalSeconds() const { return devicePollMaxIntervalSeconds_; }
+
+    /**
+     * Minimum time between uploads to the server. Every telegram is still
+     * aggregated into rollups, which are uploaded with the next sample.
+     */
+    uint32 uploadIntervalSeconds() const { return uploadIntervalSeconds_; }
+
+    /**
+     * Change-driven uploads; see `UploadPolicy`. Zero disables the deadband
+     * and threshold.
+     */
+    uint32 uploadDeadbandWatts() const { return uploadDeadbandWatts_; }
+    uint32 uploadCounterThresholdWattHours() const { return uploadCounterThresholdWattHours_; }
+    uint32 uploadHeartbeatSeconds() const { return uploadHeartbeatSeconds_; }
 
   private:
-    StaticJsonDocument<1024> doc_;
+    StaticJsonDocument<1536> doc_;
 
     // Strings point into the above JSON document object.
     char const *wifiSsid_ = 0;
@@ -36,8 +73,13 @@ class Config {
     uint16 serverPort_ = 0;
     char const *serverCertificateFingerprint_ = 0;
     char const *authToken_ = 0;
+    uint32 uploadIntervalSeconds_ = 0;
+    uint32 uploadDeadbandWatts_ = 0;
+    uint32 uploadCounterThresholdWattHours_ = 0;
+    uint32 uploadHeartbeatSeconds_ = 0;
 
-    char const *inverterProtocol_ = 0;
-    char const *inverterHost_ = 0;
-    uint16 inverterPort_ = 0;
+    DeviceConfig devices_[MAX_DEVICES];
+    size_t numDevices_ = 0;
+    uint32 devicePollMinIntervalSeconds_ = 0;
+    uint32 devicePollMaxIntervalSeconds_ = 0;
 };
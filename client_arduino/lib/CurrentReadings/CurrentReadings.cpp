@@ -0,0 +1,185 @@
+#include "CurrentReadings.h"
+
+#include "ArrayPrint.h"
+#include "JsonWriter.h"
+#include "Profiler.h"
+
+namespace {
+
+class CurrentJsonWriter : public JsonWriter {
+  public:
+    explicit CurrentJsonWriter(Print &out) : JsonWriter(out) {}
+
+    void writeWatts(double const (&values)[P1Values::NUM_PHASES]) {
+      write("[");
+      for (size_t i = 0; i < P1Values::NUM_PHASES; i++) {
+        if (i) {
+          write(",");
+        }
+        writeNumber(values[i], 0);
+      }
+      write("]");
+    }
+
+    void writeCounter(uint32 value) {
+      if (value == P1Values::NO_COUNTER) {
+        write("null");
+      } else {
+        writeUnsigned(value);
+      }
+    }
+
+    void writeCounters(uint32 const (&values)[P1Values::NUM_TARIFFS]) {
+      write("[");
+      for (size_t i = 0; i < P1Values::NUM_TARIFFS; i++) {
+        if (i) {
+          write(",");
+        }
+        writeCounter(values[i]);
+      }
+      write("]");
+    }
+};
+
+/**
+ * Appends values to a byte array, in the byte order of the ESP8266, which is
+ * little-endian, like every host we run tests on.
+ */
+class BinaryWriter {
+  public:
+    explicit BinaryWriter(uint8 *buffer) : buffer_(buffer) {}
+
+    size_t size() const { return size_; }
+
+    template<typename T>
+    void write(T value) {
+      memcpy(buffer_ + size_, &value, sizeof(value));
+      size_ += sizeof(value);
+    }
+
+    void writeFloat(double value) {
+      write(static_cast<float>(value));
+    }
+
+  private:
+    uint8 *buffer_;
+    size_t size_ = 0;
+};
+
+}
+
+void CurrentReadings::setP1Values(P1Values const &values, unsigned long measuredMillis) {
+  p1Values_ = values;
+  p1Millis_ = measuredMillis;
+  hasP1_ = true;
+}
+
+void CurrentReadings::setDevices(Sample::Device const *devices, size_t numDevices) {
+  numDevices_ = numDevices < Sample::MAX_DEVICES ? numDevices : Sample::MAX_DEVICES;
+  memcpy(devices_, devices, numDevices_ * sizeof(Sample::Device));
+}
+
+void CurrentReadings::format(uint64_t nowEpochMillis, unsigned long nowMillis) {
+  PROFILE_ZONE("readings.format");
+  formatJson(nowEpochMillis, nowMillis);
+  formatBinary(nowEpochMillis, nowMillis);
+  version_++;
+}
+
+void CurrentReadings::formatJson(uint64_t nowEpochMillis, unsigned long nowMillis) {
+  ArrayPrint out(json_, sizeof(json_));
+  CurrentJsonWriter writer(out);
+  writer.write("{\"timestamp\":");
+  writer.writeUnsigned(nowEpochMillis);
+  if (hasP1_) {
+    writer.write(",\"p1\":{\"timestamp\":");
+    writer.writeUnsigned(nowEpochMillis - (nowMillis - p1Millis_));
+    writer.write(",\"importW\":");
+    writer.writeNumber(p1Values_.importWatts, 0);
+    writer.write(",\"exportW\":");
+    writer.writeNumber(p1Values_.exportWatts, 0);
+    writer.write(",\"phaseImportW\":");
+    writer.writeWatts(p1Values_.phaseImportWatts);
+    writer.write(",\"phaseExportW\":");
+    writer.writeWatts(p1Values_.phaseExportWatts);
+    writer.write(",\"importWh\":");
+    writer.writeCounters(p1Values_.importWattHours);
+    writer.write(",\"exportWh\":");
+    writer.writeCounters(p1Values_.exportWattHours);
+    writer.write(",\"gasL\":");
+    writer.writeCounter(p1Values_.gasLitres);
+    writer.write("}");
+  }
+  writer.write(",\"inverters\":[");
+  for (size_t i = 0; i < numDevices_; i++) {
+    Sample::Device const &device = devices_[i];
+    writer.write(i ? ",{\"device\":" : "{\"device\":");
+    writer.writeUnsigned(device.index);
+    writer.write(",\"timestamp\":");
+    writer.writeUnsigned(nowEpochMillis - (nowMillis - device.readMillis));
+    writer.write(",\"powerW\":");
+    writer.writeNumber(device.powerWatts, 0);
+    writer.write(",\"totalEnergyWh\":");
+    writer.writeNumber(device.totalEnergyWattHours, 0);
+    writer.write("}");
+  }
+  writer.write("],\"balance\":{\"netW\":");
+  writer.writeNumber(balance_.netWatts, 0);
+  writer.write(",\"productionW\":");
+  writer.writeNumber(balance_.productionWatts, 0);
+  writer.write(",\"consumptionW\":");
+  writer.writeNumber(balance_.consumptionWatts, 0);
+  writer.write(",\"selfConsumptionW\":");
+  writer.writeNumber(balance_.selfConsumptionWatts, 0);
+  writer.write(",\"selfConsumptionRatio\":");
+  writer.writeNumber(balance_.selfConsumptionRatio, 3);
+  writer.write("}}");
+  // The buffer is sized for the largest possible snapshot, so this doesn't
+  // happen, but if it does, an empty response is better than broken JSON.
+  jsonSize_ = out.overflowed() ? 0 : out.size();
+}
+
+void CurrentReadings::formatBinary(uint64_t nowEpochMillis, unsigned long nowMillis) {
+  BinaryWriter writer(binary_);
+  writer.write<uint8>(BINARY_VERSION);
+  writer.write<uint8>(numDevices_);
+  // Filled in at the end.
+  writer.write<uint16>(0);
+  writer.write<uint64_t>(nowEpochMillis);
+  writer.write<uint64_t>(hasP1_ ? nowEpochMillis - (nowMillis - p1Millis_) : 0);
+
+  P1Values const p1 = hasP1_ ? p1Values_ : P1Values();
+  writer.writeFloat(p1.importWatts);
+  writer.writeFloat(p1.exportWatts);
+  for (size_t i = 0; i < P1Values::NUM_PHASES; i++) {
+    writer.writeFloat(p1.phaseImportWatts[i]);
+  }
+  for (size_t i = 0; i < P1Values::NUM_PHASES; i++) {
+    writer.writeFloat(p1.phaseExportWatts[i]);
+  }
+  for (size_t i = 0; i < P1Values::NUM_TARIFFS; i++) {
+    writer.write<uint32>(p1.importWattHours[i]);
+  }
+  for (size_t i = 0; i < P1Values::NUM_TARIFFS; i++) {
+    writer.write<uint32>(p1.exportWattHours[i]);
+  }
+  writer.write<uint32>(p1.gasLitres);
+
+  writer.writeFloat(balance_.netWatts);
+  writer.writeFloat(balance_.productionWatts);
+  writer.writeFloat(balance_.consumptionWatts);
+  writer.writeFloat(balance_.selfConsumptionWatts);
+  writer.writeFloat(balance_.selfConsumptionRatio);
+
+  for (size_t i = 0; i < numDevices_; i++) {
+    Sample::Device const &device = devices_[i];
+    writer.write<uint8>(device.index);
+    writer.write<uint64_t>(nowEpochMillis - (nowMillis - device.readMillis));
+    writer.writeFloat(device.powerWatts);
+    writer.write<double>(device.totalEnergyWattHours);
+  }
+
+  binarySize_ = writer.size();
+  uint16 const size = binarySize_;
+  memcpy(binary_ + 2, &size, sizeof(size));
+}
@@ -0,0 +1,97 @@
+#pragma once
+
+#include <Arduino.h>
+
+#include "P1Values.h"
+#include "PowerBalance.h"
+#include "Sample.h"
+
+/**
+ * The latest readings, preformatted for the local HTTP API, so that serving
+ * them costs a single write to the socket, however often clients poll. The
+ * snapshot is formatted when the values change (once per telegram, and when
+ * an inverter has been read), never per request.
+ *
+ * `json()` looks like:
+ *
+ *   {"timestamp":1600000000000,
+ *    "p1":{"timestamp":..,"importW":..,"exportW":..,"phaseImportW":[..],
+ *          "phaseExportW":[..],"importWh":[..],"exportWh":[..],"gasL":..},
+ *    "inverters":[{"device":0,"timestamp":..,"powerW":..,"totalEnergyWh":..}],
+ *    "balance":{"netW":..,"productionW":..,"consumptionW":..,
+ *               "selfConsumptionW":..,"selfConsumptionRatio":..}}
+ *
+ * where timestamps are in milliseconds since the epoch, per-phase arrays have
+ * L1 to L3, and counter arrays have tariffs 1 and 2. Unknown values are
+ * `null`, and `p1` is left out until the first telegram.
+ *
+ * `binary()` holds the same values, little-endian, for clients that want to
+ * avoid parsing JSON:
+ *
+ *   uint8   format version, currently 1
+ *   uint8   number of inverters, N
+ *   uint16  size of the whole snapshot in bytes
+ *   uint64  timestamp
+ *   uint64  P1 timestamp, 0 if none
+ *   float32 import, export, phase import L1-L3, phase export L1-L3 (W)
+ *   uint32  import tariffs 1-2, export tariffs 1-2 (Wh), gas (L)
+ *   float32 net, production, consumption, self-consumption (W),
+ *           self-consumption ratio
+ *   N times:
+ *     uint8   device index
+ *     uint64  timestamp
+ *     float32 power (W)
+ *     float64 total energy (Wh)
+ *
+ * Floats are NaN and counters 0xffffffff if unknown.
+ */
+class CurrentReadings {
+  public:
+    static size_t const MAX_JSON_SIZE = 1024;
+    // The layout above: 92 bytes, and 21 per inverter.
+    static size_t const MAX_BINARY_SIZE = 92 + 21 * Sample::MAX_DEVICES;
+    static uint8 const BINARY_VERSION = 1;
+
+    void setP1Values(P1Values const &values, unsigned long measuredMillis);
+
+    /**
+     * Replaces the inverter values; `devices` has the same meaning as in
+     * `Sample`.
+     */
+    void setDevices(Sample::Device const *devices, size_t numDevices);
+
+    void setBalance(PowerSnapshot const &balance) { balance_ = balance; }
+
+    /**
+     * Formats the values set so far. `nowEpochMillis` is the wall-clock time
+     * at `nowMillis`.
+     */
+    void format(uint64_t nowEpochMillis, unsigned long nowMillis);
+
+    char const *json() const { return json_; }
+    size_t jsonSize() const { return jsonSize_; }
+    uint8 const *binary() const { return binary_; }
+    size_t binarySize() const { return binarySize_; }
+
+    /**
+     * Incremented on every `format()`.
+     */
+    uint32 version() const { return version_; }
+
+  private:
+    P1Values p1Values_;
+    unsigned long p1Millis_ = 0;
+    bool hasP1_ = false;
+    Sample::Device devices_[Sample::MAX_DEVICES];
+    size_t numDevices_ = 0;
+    PowerSnapshot balance_;
+
+    char json_[MAX_JSON_SIZE];
+    size_t jsonSize_ = 0;
+    uint8 binary_[MAX_BINARY_SIZE];
+    size_t binarySize_ = 0;
+    uint32 version_ = 0;
+
+    void formatJson(uint64_t nowEpochMillis, unsigned long nowMillis);
+    void formatBinary(uint64_t nowEpochMillis, unsigned long nowMillis);
+};
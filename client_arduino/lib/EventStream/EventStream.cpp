@@ -0,0 +1,145 @@
+#include "EventStream.h"
+
+#include "BufferedPrint.h"
+
+namespace {
+
+/**
+ * Calls `f(line, length)` for each line of `data`, without line terminators.
+ * A trailing line terminator doesn't start another line.
+ */
+template<typename F>
+void forEachLine(char const *data, size_t size, F f) {
+  size_t start = 0;
+  while (start < size) {
+    size_t end = start;
+    while (end < size && data[end] != '\n') {
+      end++;
+    }
+    size_t length = end - start;
+    if (length && data[start + length - 1] == '\r') {
+      length--;
+    }
+    f(data + start, length);
+    start = end + 1;
+  }
+}
+
+size_t const EVENT_PREFIX_LENGTH = strlen("event: ");
+size_t const DATA_PREFIX_LENGTH = strlen("data: ");
+
+/**
+ * Size of the event in the wire format:
+ *
+ *   event: <event>\n
+ *   data: <line 1>\n
+ *   data: <line 2>\n
+ *   \n
+ */
+size_t eventSize(char const *event, char const *data, size_t size) {
+  size_t total = EVENT_PREFIX_LENGTH + strlen(event) + 1;
+  forEachLine(data, size, [&](char const *, size_t length) {
+    total += DATA_PREFIX_LENGTH + length + 1;
+  });
+  return total + 1;
+}
+
+}
+
+bool EventStream::subscribe(WiFiClient &client, uint8 topics) {
+  for (Subscriber &subscriber : subscribers_) {
+    if (subscriber.active) {
+      continue;
+    }
+    subscriber.active = true;
+    subscriber.client = client;
+    subscriber.topics = topics;
+    subscriber.consecutiveDrops = 0;
+    subscriber.lastSendMillis = millis();
+    // Events are small and should arrive as soon as possible.
+    subscriber.client.setNoDelay(true);
+    subscriber.client.print(
+        "HTTP/1.1 200 OK\r\n"
+        "Content-Type: text/event-stream\r\n"
+        "Cache-Control: no-store\r\n"
+        "\r\n"
+        // How long browsers wait before reconnecting.
+        "retry: 2000\n"
+        "\n");
+    stats_.subscribed++;
+    return true;
+  }
+  stats_.rejected++;
+  return false;
+}
+
+void EventStream::publish(Topic topic, char const *event, char const *data, size_t size) {
+  size_t const total = eventSize(event, data, size);
+  for (Subscriber &subscriber : subscribers_) {
+    if (!subscriber.active || !(subscriber.topics & topic)) {
+      continue;
+    }
+    if (send(subscriber, event, data, size, total)) {
+      subscriber.consecutiveDrops = 0;
+      stats_.sent++;
+    } else {
+      stats_.dropped++;
+      if (++subscriber.consecutiveDrops >= MAX_CONSECUTIVE_DROPS) {
+        stats_.evicted++;
+        disconnect(subscriber);
+      }
+    }
+  }
+}
+
+void EventStream::update() {
+  unsigned long const now = millis();
+  for (Subscriber &subscriber : subscribers_) {
+    if (!subscriber.active) {
+      continue;
+    }
+    if (!subscriber.client.connected()) {
+      disconnect(subscriber);
+    } else if (now - subscriber.lastSendMillis >= KEEPALIVE_MILLIS &&
+        subscriber.client.availableForWrite() >= 2) {
+      // A comment line, which EventSource ignores.
+      subscriber.client.write(":\n", 2);
+      subscriber.lastSendMillis = now;
+    }
+  }
+}
+
+size_t EventStream::numSubscribers() const {
+  size_t count = 0;
+  for (Subscriber const &subscriber : subscribers_) {
+    count += subscriber.active;
+  }
+  return count;
+}
+
+bool EventStream::send(Subscriber &subscriber, char const *event, char const *data, size_t dataSize, size_t size) {
+  if (!subscriber.client.connected() || static_cast<size_t>(subscriber.client.availableForWrite()) < size) {
+    return false;
+  }
+  {
+    // Fits in the send buffer, so none of these writes block.
+    BufferedPrint<256> out(subscriber.client);
+    out.write("event: ", EVENT_PREFIX_LENGTH);
+    out.write(event, strlen(event));
+    out.write(static_cast<uint8_t>('\n'));
+    forEachLine(data, dataSize, [&](char const *line, size_t length) {
+      out.write("data: ", DATA_PREFIX_LENGTH);
+      out.write(line, length);
+      out.write(static_cast<uint8_t>('\n'));
+    });
+    out.write(static_cast<uint8_t>('\n'));
+  }
+  subscriber.lastSendMillis = millis();
+  return true;
+}
+
+void EventStream::disconnect(Subscriber &subscriber) {
+  subscriber.client.stop();
+  subscriber.client = WiFiClient();
+  subscriber.active = false;
+}
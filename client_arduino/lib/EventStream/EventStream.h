@@ -0,0 +1,80 @@
+#pragma once
+
+#include <ESP8266WiFi.h>
+
+/**
+ * Pushes events to a fixed number of clients that keep a connection open, in
+ * the Server-Sent Events format (text/event-stream), so that browsers can
+ * subscribe with a plain `EventSource`.
+ *
+ * Publishing never blocks: an event is only written to a subscriber whose TCP
+ * send buffer has room for all of it, and otherwise dropped for that
+ * subscriber. Clients that can't keep up thus miss events rather than
+ * holding up the main loop, and after `MAX_CONSECUTIVE_DROPS` they are
+ * disconnected, as they are unlikely to catch up.
+ */
+class EventStream {
+  public:
+    static size_t const MAX_SUBSCRIBERS = 4;
+    static uint8 const MAX_CONSECUTIVE_DROPS = 10;
+    // Comments are sent when there has been nothing else for this long, so
+    // that dead connections are noticed, and proxies don't time out.
+    static unsigned long const KEEPALIVE_MILLIS = 15000;
+
+    enum Topic : uint8 {
+      READINGS = 1 << 0,
+      TELEGRAMS = 1 << 1,
+    };
+
+    struct Stats {
+      uint32 subscribed = 0;
+      // Clients turned away because all slots were taken.
+      uint32 rejected = 0;
+      uint32 sent = 0;
+      uint32 dropped = 0;
+      // Subscribers disconnected because they fell behind.
+      uint32 evicted = 0;
+    };
+
+    /**
+     * Takes over the connection of a client that requested the stream, and
+     * sends it the response headers. Returns `false`, leaving the client
+     * alone, if there is no free slot.
+     */
+    bool subscribe(WiFiClient &client, uint8 topics);
+
+    /**
+     * Sends an event to the subscribers of the topic. `data` may contain
+     * several lines, separated by CRLF or LF, such as a telegram.
+     */
+    void publish(Topic topic, char const *event, char const *data, size_t size);
+
+    /**
+     * Forgets subscribers that have disconnected, and sends keepalives. Call
+     * this regularly.
+     */
+    void update();
+
+    size_t numSubscribers() const;
+    Stats const &stats() const { return stats_; }
+
+  private:
+    struct Subscriber {
+      bool active = false;
+      WiFiClient client;
+      uint8 topics = 0;
+      uint8 consecutiveDrops = 0;
+      unsigned long lastSendMillis = 0;
+    };
+
+    Subscriber subscribers_[MAX_SUBSCRIBERS];
+    Stats stats_;
+
+    /**
+     * Writes the event to the subscriber, if its send buffer has room for
+     * `size` bytes. Returns whether it did.
+     */
+    bool send(Subscriber &subscriber, char const *event, char const *data, size_t dataSize, size_t size);
+
+    void disconnect(Subscriber &subscriber);
+};
@@ -0,0 +1,297 @@
+#include "History.h"
+
+#include "JsonWriter.h"
+
+namespace {
+
+size_t const MAX_VARINT_SIZE = 10;
+
+/**
+ * Encodes a point as a varint: 0 if it is missing, otherwise the zigzagged
+ * difference from `previous` plus one. Returns the number of bytes.
+ */
+size_t encodePoint(bool valid, int32_t value, int32_t previous, uint8 out[MAX_VARINT_SIZE]) {
+  uint64_t code = 0;
+  if (valid) {
+    int64_t const delta = static_cast<int64_t>(value) - previous;
+    code = (static_cast<uint64_t>(delta) << 1 ^ static_cast<uint64_t>(delta >> 63)) + 1;
+  }
+  size_t size = 0;
+  do {
+    uint8 const byte = code & 0x7f;
+    code >>= 7;
+    out[size++] = code ? byte | 0x80 : byte;
+  } while (code);
+  return size;
+}
+
+/**
+ * Rounds half away from zero.
+ */
+int32_t roundedMean(int64_t sum, uint32 count) {
+  int64_t const half = count / 2;
+  return static_cast<int32_t>((sum < 0 ? sum - half : sum + half) / static_cast<int64_t>(count));
+}
+
+/**
+ * Writes 32 bits little-endian.
+ */
+void writeUint32(Print &out, uint32 value) {
+  uint8_t const bytes[4] = {
+    static_cast<uint8_t>(value),
+    static_cast<uint8_t>(value >> 8),
+    static_cast<uint8_t>(value >> 16),
+    static_cast<uint8_t>(value >> 24),
+  };
+  out.write(bytes, sizeof(bytes));
+}
+
+}
+
+History::Tier const History::TIERS[NUM_TIERS] = {
+  {10, 3600, 8},
+  {300, 24ul * 3600, 8},
+  {3600, 7ul * 24 * 3600, 6},
+};
+
+/**
+ * Decodes the points of a tier, oldest first.
+ */
+class History::Cursor {
+  public:
+    Cursor(History const &history, size_t tier) :
+      history_(history),
+      tier_(history.tiers_[tier]),
+      periodSeconds_(TIERS[tier].periodSeconds)
+    {
+    }
+
+    /**
+     * Returns the next point, or `false` after the last.
+     */
+    bool next(uint32 *epochSeconds, bool *valid, int32_t *value) {
+      while (blockIndex_ < tier_.numUsed) {
+        Block const &block = history_.block(tier_, blockIndex_);
+        if (point_ < block.numPoints) {
+          uint64_t code = 0;
+          for (int shift = 0; offset_ < block.size; shift += 7) {
+            uint8 const byte = block.data[offset_++];
+            code |= static_cast<uint64_t>(byte & 0x7f) << shift;
+            if (!(byte & 0x80)) {
+              break;
+            }
+          }
+          *epochSeconds = block.startEpochSeconds + point_ * periodSeconds_;
+          *valid = code;
+          if (code) {
+            code--;
+            int64_t const delta = static_cast<int64_t>(code >> 1) ^ -static_cast<int64_t>(code & 1);
+            last_ = static_cast<int32_t>(last_ + delta);
+          }
+          *value = last_;
+          point_++;
+          return true;
+        }
+        blockIndex_++;
+        point_ = 0;
+        offset_ = 0;
+        last_ = 0;
+      }
+      return false;
+    }
+
+  private:
+    History const &history_;
+    TierState const &tier_;
+    uint32 periodSeconds_;
+    size_t blockIndex_ = 0;
+    uint16 point_ = 0;
+    size_t offset_ = 0;
+    int32_t last_ = 0;
+};
+
+History::History() {
+  size_t firstBlock = 0;
+  for (size_t i = 0; i < NUM_TIERS; i++) {
+    tiers_[i].firstBlock = firstBlock;
+    tiers_[i].numBlocks = TIERS[i].numBlocks;
+    firstBlock += TIERS[i].numBlocks;
+  }
+}
+
+void History::add(int32_t watts, uint32 epochSeconds) {
+  for (size_t i = 0; i < NUM_TIERS; i++) {
+    TierState &tier = tiers_[i];
+    uint32 const period = TIERS[i].periodSeconds;
+    uint32 const periodStart = epochSeconds - epochSeconds % period;
+    if (tier.started && periodStart < tier.periodStart) {
+      continue;
+    }
+    if (tier.started && periodStart > tier.periodStart) {
+      append(i, true, roundedMean(tier.sum, tier.count));
+      uint32 const numMissing = (periodStart - tier.periodStart) / period - 1;
+      if (numMissing >= TIERS[i].retentionSeconds / period) {
+        clear(i);
+      } else {
+        for (uint32 j = 0; j < numMissing; j++) {
+          append(i, false, 0);
+        }
+      }
+      tier.sum = 0;
+      tier.count = 0;
+    }
+    tier.started = true;
+    tier.periodStart = periodStart;
+    tier.sum += watts;
+    tier.count++;
+  }
+}
+
+uint32 History::oldestEpochSeconds(size_t tier) const {
+  TierState const &state = tiers_[tier];
+  return state.numUsed ? block(state, 0).startEpochSeconds : 0;
+}
+
+size_t History::numPoints(size_t tier) const {
+  TierState const &state = tiers_[tier];
+  size_t count = 0;
+  for (size_t i = 0; i < state.numUsed; i++) {
+    count += block(state, i).numPoints;
+  }
+  return count;
+}
+
+size_t History::write(Print &out, Format format, uint32 fromEpochSeconds, uint32 toEpochSeconds, uint32 stepSeconds) const {
+  size_t const tier = chooseTier(fromEpochSeconds);
+  uint32 const period = TIERS[tier].periodSeconds;
+  uint32 const span = toEpochSeconds > fromEpochSeconds ? toEpochSeconds - fromEpochSeconds : 0;
+  if (stepSeconds < span / MAX_POINTS + 1) {
+    stepSeconds = span / MAX_POINTS + 1;
+  }
+  // A step beyond the span gives a single bucket anyway, and rounding one
+  // near the top of the range would wrap around to 0.
+  if (stepSeconds > span && stepSeconds > period) {
+    stepSeconds = span > period ? span : period;
+  }
+  uint64_t const roundedStep = (static_cast<uint64_t>(stepSeconds) + period - 1) / period * period;
+  stepSeconds = roundedStep > UINT32_MAX ? UINT32_MAX / period * period : static_cast<uint32>(roundedStep);
+  uint32 const from = fromEpochSeconds - fromEpochSeconds % stepSeconds;
+  uint32 const numBuckets = toEpochSeconds > from ?
+    (static_cast<uint64_t>(toEpochSeconds) - from + stepSeconds - 1) / stepSeconds : 0;
+
+  // Numbers in CSV are no different from those in JSON.
+  JsonWriter text(out);
+  size_t written = 0;
+  if (format == Format::CSV) {
+    text.write("timestamp,netW\n");
+  } else {
+    writeUint32(out, from);
+    writeUint32(out, stepSeconds);
+    writeUint32(out, numBuckets);
+    written += 12;
+  }
+
+  int32_t previous = 0;
+  uint32 bucket = 0;
+  int64_t sum = 0;
+  uint32 count = 0;
+  auto emit = [&]() {
+    if (format == Format::CSV) {
+      text.writeUnsigned(from + bucket * stepSeconds);
+      text.write(",");
+      if (count) {
+        text.writeSigned(roundedMean(sum, count));
+      }
+      text.write("\n");
+    } else {
+      int32_t const mean = count ? roundedMean(sum, count) : 0;
+      uint8 encoded[MAX_VARINT_SIZE];
+      written += out.write(encoded, encodePoint(count, mean, previous, encoded));
+      if (count) {
+        previous = mean;
+      }
+    }
+    bucket++;
+    sum = 0;
+    count = 0;
+  };
+
+  Cursor cursor(*this, tier);
+  uint32 epochSeconds;
+  bool valid;
+  int32_t value;
+  while (bucket < numBuckets && cursor.next(&epochSeconds, &valid, &value)) {
+    if (epochSeconds < from) {
+      continue;
+    }
+    uint32 const pointBucket = (epochSeconds - from) / stepSeconds;
+    while (bucket < pointBucket && bucket < numBuckets) {
+      emit();
+    }
+    if (valid && bucket < numBuckets) {
+      sum += value;
+      count++;
+    }
+  }
+  while (bucket < numBuckets) {
+    emit();
+  }
+  return written + text.written();
+}
+
+History::Block &History::block(TierState const &tier, size_t index) {
+  return blocks_[tier.firstBlock + (tier.oldest + index) % tier.numBlocks];
+}
+
+History::Block const &History::block(TierState const &tier, size_t index) const {
+  return blocks_[tier.firstBlock + (tier.oldest + index) % tier.numBlocks];
+}
+
+void History::append(size_t tierIndex, bool valid, int32_t value) {
+  TierState &tier = tiers_[tierIndex];
+  uint8 encoded[MAX_VARINT_SIZE];
+  size_t size = encodePoint(valid, value, tier.lastValue, encoded);
+  Block *newest = tier.numUsed ? &block(tier, tier.numUsed - 1) : nullptr;
+  if (!newest || newest->size + size > BLOCK_SIZE) {
+    uint32 const startEpochSeconds = newest ?
+      newest->startEpochSeconds + newest->numPoints * TIERS[tierIndex].periodSeconds :
+      tier.periodStart;
+    if (tier.numUsed == tier.numBlocks) {
+      tier.oldest = (tier.oldest + 1) % tier.numBlocks;
+      tier.numUsed--;
+    }
+    tier.numUsed++;
+    newest = &block(tier, tier.numUsed - 1);
+    newest->startEpochSeconds = startEpochSeconds;
+    newest->numPoints = 0;
+    newest->size = 0;
+    tier.lastValue = 0;
+    size = encodePoint(valid, value, 0, encoded);
+  }
+  memcpy(newest->data + newest->size, encoded, size);
+  newest->size += size;
+  newest->numPoints++;
+  if (valid) {
+    tier.lastValue = value;
+  }
+}
+
+void History::clear(size_t tier) {
+  tiers_[tier].oldest = 0;
+  tiers_[tier].numUsed = 0;
+  tiers_[tier].lastValue = 0;
+}
+
+size_t History::chooseTier(uint32 fromEpochSeconds) const {
+  size_t best = 0;
+  for (size_t i = 0; i < NUM_TIERS; i++) {
+    uint32 const oldest = oldestEpochSeconds(i);
+    if (tiers_[i].numUsed && oldest <= fromEpochSeconds) {
+      return i;
+    }
+    if (tiers_[i].numUsed && (!tiers_[best].numUsed || oldest < oldestEpochSeconds(best))) {
+      best = i;
+    }
+  }
+  return best;
+}
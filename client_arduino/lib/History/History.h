@@ -0,0 +1,111 @@
+#pragma once
+
+#include <Arduino.h>
+
+/**
+ * Keeps the recent history of net power in fixed memory, in tiers of
+ * decreasing resolution: by default means over 10 seconds for an hour, over 5
+ * minutes for a day, and over an hour for a week. That takes about 3 kB.
+ *
+ * Each tier is a ring of blocks. A block holds consecutive periods, starting
+ * at `startEpochSeconds`, each encoded as a varint of the zigzagged
+ * difference from the previous value in the block, plus one; 0 marks a period
+ * without telegrams. The first value in a block is relative to 0, so that
+ * dropping the oldest block never breaks the decoding of the next. Power
+ * usually changes little from one period to the next, so most periods take
+ * one or two bytes. How far back a tier reaches therefore depends on how
+ * much power varies; the block counts are chosen so that it is at least the
+ * nominal retention for typical households.
+ *
+ * Nothing is kept across restarts.
+ */
+class History {
+  public:
+    struct Tier {
+      uint16 periodSeconds;
+      uint32 retentionSeconds;
+      uint8 numBlocks;
+    };
+
+    static size_t const NUM_TIERS = 3;
+    static Tier const TIERS[NUM_TIERS];
+    // The total of the tiers' `numBlocks`.
+    static size_t const NUM_BLOCKS = 22;
+    static size_t const BLOCK_SIZE = 128;
+    // Responses are resampled to a coarser step rather than grow beyond this.
+    static size_t const MAX_POINTS = 1500;
+
+    enum class Format {
+      // "timestamp,netW" lines, with an empty value for missing periods.
+      CSV,
+      // Little-endian: uint32 start (epoch seconds), uint32 step (seconds),
+      // uint32 number of points, followed by the points, encoded as in the
+      // blocks, relative to the previous value that was not missing.
+      BINARY,
+    };
+
+    History();
+
+    /**
+     * Adds a measurement. Measurements must come in chronological order;
+     * ones from before the period of the previous one are ignored.
+     */
+    void add(int32_t watts, uint32 epochSeconds);
+
+    /**
+     * Writes the means over `stepSeconds` for the periods from `fromEpochSeconds`
+     * up to `toEpochSeconds`, from the finest tier that reaches back far
+     * enough. The step is limited to the span, rounded up to a multiple of
+     * that tier's period, and `fromEpochSeconds` down to a multiple of the
+     * step. Returns the number of
+     * bytes written.
+     *
+     * The output is decoded straight from the blocks, so it costs no memory
+     * besides what `out` buffers, and comes out the same until the next
+     * `add()`.
+     */
+    size_t write(Print &out, Format format, uint32 fromEpochSeconds, uint32 toEpochSeconds, uint32 stepSeconds) const;
+
+    /**
+     * Start of the oldest period in the tier, or 0 if it is empty.
+     */
+    uint32 oldestEpochSeconds(size_t tier) const;
+    size_t numPoints(size_t tier) const;
+
+  private:
+    struct Block {
+      uint32 startEpochSeconds = 0;
+      uint16 numPoints = 0;
+      uint16 size = 0;
+      uint8 data[BLOCK_SIZE];
+    };
+
+    struct TierState {
+      // The tier's blocks are `blocks_[firstBlock, firstBlock + numBlocks)`,
+      // used as a ring.
+      size_t firstBlock = 0;
+      size_t numBlocks = 0;
+      size_t oldest = 0;
+      size_t numUsed = 0;
+      // Last value that was not missing in the newest block.
+      int32_t lastValue = 0;
+
+      // The period being accumulated.
+      bool started = false;
+      uint32 periodStart = 0;
+      int64_t sum = 0;
+      uint32 count = 0;
+    };
+
+    class Cursor;
+
+    Block blocks_[NUM_BLOCKS];
+    TierState tiers_[NUM_TIERS];
+
+    Block &block(TierState const &tier, size_t index);
+    Block const &block(TierState const &tier, size_t index) const;
+
+    void append(size_t tier, bool valid, int32_t value);
+    void clear(size_t tier);
+    size_t chooseTier(uint32 fromEpochSeconds) const;
+};
@@ -0,0 +1,120 @@
+#include "HostCache.h"
+
+#include "Log.h"
+
+HostCache::Status HostCache::resolve(char const *host, IPAddress *ipAddress) {
+  if (ipAddress->fromString(host)) {
+    stats_.literals++;
+    return Status::DONE;
+  }
+
+  Entry *entry = entryFor(host);
+  if (!entry) {
+    return Status::FAILED;
+  }
+  if (entry->pending) {
+    return finishLookup(*entry, ipAddress);
+  }
+
+  if (millis() - entry->updatedMillis < entry->lifetimeMillis) {
+    if (!entry->hasAddress) {
+      // The last lookup failed less than `RETRY_MILLIS` ago.
+      return Status::FAILED;
+    }
+    *ipAddress = entry->ipAddress;
+    if (entry->stale) {
+      stats_.staleServed++;
+      return Status::STALE;
+    }
+    stats_.hits++;
+    return Status::DONE;
+  }
+
+  stats_.lookups++;
+  entry->pending = true;
+  entry->lookupStartMillis = millis();
+  entry->resolver.resolve(entry->host.c_str());
+  // lwIP may have answered from its own cache already.
+  return finishLookup(*entry, ipAddress);
+}
+
+void HostCache::logStats() const {
+  uint32 const succeeded = stats_.lookups - stats_.failures;
+  LOG_INFO("dns", "Cache: %u hits, %u literal, %u lookups (%u failed, %lu ms average, %lu ms max), %u stale",
+      stats_.hits, stats_.literals, stats_.lookups, stats_.failures,
+      succeeded ? stats_.totalLookupMillis / succeeded : 0, stats_.maxLookupMillis, stats_.staleServed);
+}
+
+HostCache::Entry *HostCache::entryFor(char const *host) {
+  unsigned long const now = millis();
+  Entry *replaced = nullptr;
+  for (Entry &entry : entries_) {
+    if (entry.host == host) {
+      return &entry;
+    }
+    if (entry.pending) {
+      continue;
+    }
+    // Prefer a free entry, then the one updated longest ago.
+    bool const better = !replaced || (replaced->host.length() &&
+      (!entry.host.length() || now - entry.updatedMillis > now - replaced->updatedMillis));
+    if (better) {
+      replaced = &entry;
+    }
+  }
+  if (replaced) {
+    replaced->host = host;
+    replaced->hasAddress = false;
+    replaced->stale = false;
+    replaced->lifetimeMillis = 0;
+  }
+  return replaced;
+}
+
+HostCache::Status HostCache::finishLookup(Entry &entry, IPAddress *ipAddress) {
+  HostResolver::Status const status = entry.resolver.poll();
+  if (status == HostResolver::Status::PENDING) {
+    return Status::PENDING;
+  }
+
+  unsigned long const now = millis();
+  entry.pending = false;
+  entry.updatedMillis = now;
+
+  if (status == HostResolver::Status::DONE) {
+    unsigned long const lookupMillis = now - entry.lookupStartMillis;
+    stats_.lastLookupMillis = lookupMillis;
+    stats_.totalLookupMillis += lookupMillis;
+    if (lookupMillis > stats_.maxLookupMillis) {
+      stats_.maxLookupMillis = lookupMillis;
+    }
+    IPAddress const &resolved = entry.resolver.ipAddress();
+    if (!entry.hasAddress || entry.stale || resolved != entry.ipAddress) {
+      LOG_INFO("dns", "Resolved %s to %s in %lu ms", entry.host.c_str(), resolved.toString().c_str(), lookupMillis);
+      logStats();
+    }
+    entry.ipAddress = resolved;
+    entry.hasAddress = true;
+    entry.stale = false;
+    entry.lifetimeMillis = ttlMillis_;
+    *ipAddress = entry.ipAddress;
+    return Status::DONE;
+  }
+
+  stats_.failures++;
+  entry.stale = entry.hasAddress;
+  entry.lifetimeMillis = RETRY_MILLIS;
+  if (entry.hasAddress) {
+    LOG_WARNING("dns", "Failed to resolve %s; using last known address %s",
+        entry.host.c_str(), entry.ipAddress.toString().c_str());
+  } else {
+    LOG_WARNING("dns", "Failed to resolve %s", entry.host.c_str());
+  }
+  logStats();
+  if (!entry.hasAddress) {
+    return Status::FAILED;
+  }
+  stats_.staleServed++;
+  *ipAddress = entry.ipAddress;
+  return Status::STALE;
+}
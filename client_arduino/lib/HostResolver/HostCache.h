@@ -0,0 +1,105 @@
+#pragma once
+
+#include <ESP8266WiFi.h>
+
+#include "HostResolver.h"
+
+/**
+ * Caches resolved host names, so that reconnecting to a device or server
+ * doesn't cost a DNS round trip every time, and so that a DNS outage doesn't
+ * stop us from reaching hosts whose address we already know. A single cache
+ * is shared by everything that connects to a host by name.
+ *
+ * lwIP does not tell us the TTL of the records it receives, but it does
+ * cache them for exactly that long and answers repeated lookups from its own
+ * cache without a round trip. So we keep entries for a short `ttlMillis`
+ * only, and then ask lwIP again; this costs nothing while the record is
+ * still valid, and honours the record's TTL to within `ttlMillis`.
+ *
+ * If a lookup fails, the last known address keeps being served, if there is
+ * one, and the next lookup is attempted after `RETRY_MILLIS`. Literal IP
+ * addresses are parsed on the spot and never enter the cache.
+ */
+class HostCache {
+  public:
+    enum class Status {
+      // A lookup is in progress; call `resolve()` again later.
+      PENDING,
+      // The address is known and fresh.
+      DONE,
+      // The lookup failed, but the last known address is available.
+      STALE,
+      // The lookup failed, now or less than `RETRY_MILLIS` ago, and no
+      // address is known.
+      FAILED,
+    };
+
+    struct Stats {
+      // Calls to `resolve()` answered from the cache, and those for literal
+      // addresses.
+      uint32 hits = 0;
+      uint32 literals = 0;
+      // Lookups started, and of those, the ones that failed.
+      uint32 lookups = 0;
+      uint32 failures = 0;
+      // Calls to `resolve()` that returned `STALE`.
+      uint32 staleServed = 0;
+      // Duration of successful lookups.
+      unsigned long lastLookupMillis = 0;
+      unsigned long maxLookupMillis = 0;
+      unsigned long totalLookupMillis = 0;
+    };
+
+    static size_t const MAX_ENTRIES = 4;
+    static unsigned long const DEFAULT_TTL_MILLIS = 60ul * 1000;
+    static unsigned long const RETRY_MILLIS = 30ul * 1000;
+
+    void setTtl(unsigned long ttlMillis) { ttlMillis_ = ttlMillis; }
+
+    /**
+     * Returns the address of the given host through `ipAddress`, if known,
+     * and starts a lookup if the cached address is missing or expired. Never
+     * blocks; while this returns `PENDING`, keep calling it with the same host
+     * to advance the lookup.
+     */
+    Status resolve(char const *host, IPAddress *ipAddress);
+
+    Stats const &stats() const { return stats_; }
+
+    /**
+     * Logs the statistics.
+     */
+    void logStats() const;
+
+  private:
+    struct Entry {
+      String host;
+      IPAddress ipAddress;
+      bool hasAddress = false;
+      // Whether the last refresh failed.
+      bool stale = false;
+      bool pending = false;
+      unsigned long lookupStartMillis = 0;
+      // When the address was last resolved, or the last lookup failed.
+      unsigned long updatedMillis = 0;
+      // How long after `updatedMillis` to look up the host again.
+      unsigned long lifetimeMillis = 0;
+      HostResolver resolver;
+    };
+
+    unsigned long ttlMillis_ = DEFAULT_TTL_MILLIS;
+    Entry entries_[MAX_ENTRIES];
+    Stats stats_;
+
+    /**
+     * Returns the entry for the given host, or a new one, replacing the least
+     * recently updated entry that has no lookup in progress. Returns `nullptr`
+     * if all entries are busy.
+     */
+    Entry *entryFor(char const *host);
+
+    /**
+     * Handles the outcome of the lookup in progress for the entry, if any.
+     */
+    Status finishLookup(Entry &entry, IPAddress *ipAddress);
+};
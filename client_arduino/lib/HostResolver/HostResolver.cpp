@@ -0,0 +1,69 @@
+#include "HostResolver.h"
+
+#include <lwip/dns.h>
+
+namespace {
+
+/**
+ * Context for a lookup in progress. lwIP may call back after we've given up
+ * waiting, so this is allocated separately and deleted by the callback. It
+ * points back into the `HostResolver`, which must therefore outlive the
+ * lookup; in practice, resolvers live as long as the program.
+ */
+struct Lookup {
+  HostResolver::Status *status;
+  IPAddress *ipAddress;
+  uint32 generation;
+  uint32 const *currentGeneration;
+};
+
+}
+
+void HostResolver::resolve(char const *host) {
+  generation_++;
+  startMillis_ = millis();
+
+  // Literal IP addresses need no lookup.
+  if (ipAddress_.fromString(host)) {
+    status_ = Status::DONE;
+    return;
+  }
+
+  Lookup *lookup = new Lookup{&status_, &ipAddress_, generation_, &generation_};
+  ip_addr_t addr;
+  err_t const err = dns_gethostbyname(host, &addr, &HostResolver::dnsFoundCallback, lookup);
+  if (err == ERR_OK) {
+    // Answered from lwIP's own cache.
+    delete lookup;
+    ipAddress_ = IPAddress(addr);
+    status_ = Status::DONE;
+  } else if (err == ERR_INPROGRESS) {
+    // The callback now owns `lookup`.
+    status_ = Status::PENDING;
+  } else {
+    delete lookup;
+    status_ = Status::FAILED;
+  }
+}
+
+HostResolver::Status HostResolver::poll() {
+  if (status_ == Status::PENDING && millis() - startMillis_ >= TIMEOUT_MILLIS) {
+    // Abandon this lookup; a late callback will see a different generation.
+    generation_++;
+    status_ = Status::FAILED;
+  }
+  return status_;
+}
+
+void HostResolver::dnsFoundCallback(char const *, ip_addr_t const *ipAddr, void *arg) {
+  Lookup *lookup = static_cast<Lookup *>(arg);
+  if (lookup->generation == *lookup->currentGeneration) {
+    if (ipAddr) {
+      *lookup->ipAddress = IPAddress(*ipAddr);
+      *lookup->status = Status::DONE;
+    } else {
+      *lookup->status = Status::FAILED;
+    }
+  }
+  delete lookup;
+}
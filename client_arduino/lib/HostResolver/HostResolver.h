@@ -0,0 +1,47 @@
+#pragma once
+
+#include <ESP8266WiFi.h>
+
+/**
+ * Resolves a host name to an IP address without blocking, using lwIP's
+ * asynchronous DNS API directly. (`WiFi.hostByName()` waits for the answer,
+ * which can take seconds if the DNS server is slow or unreachable.)
+ */
+class HostResolver {
+  public:
+    enum class Status {
+      IDLE,
+      PENDING,
+      DONE,
+      FAILED,
+    };
+
+    static unsigned long const TIMEOUT_MILLIS = 5000;
+
+    /**
+     * Starts resolving the given host name. The string must remain valid
+     * until the lookup is done.
+     */
+    void resolve(char const *host);
+
+    /**
+     * Checks whether the lookup has completed.
+     */
+    Status poll();
+
+    /**
+     * The resolved address, if `poll()` returned `DONE`.
+     */
+    IPAddress const &ipAddress() const { return ipAddress_; }
+
+  private:
+    Status status_ = Status::IDLE;
+    unsigned long startMillis_ = 0;
+    IPAddress ipAddress_;
+
+    // Incremented for every lookup, so that callbacks from abandoned lookups
+    // can be recognized and ignored.
+    uint32 generation_ = 0;
+
+    static void dnsFoundCallback(char const *name, ip_addr_t const *ipAddr, void *arg);
+};
@@ -0,0 +1,308 @@
+#include "HttpRequestParser.h"
+
+namespace {
+
+char toLower(char c) {
+  return c >= 'A' && c <= 'Z' ? c - 'A' + 'a' : c;
+}
+
+StringRef trim(char const *data, size_t length) {
+  while (length && (*data == ' ' || *data == '\t')) {
+    data++;
+    length--;
+  }
+  while (length && (data[length - 1] == ' ' || data[length - 1] == '\t')) {
+    length--;
+  }
+  StringRef result;
+  result.data = data;
+  result.length = length;
+  return result;
+}
+
+/**
+ * Whether the parameters of an `Accept-Encoding` element, everything after
+ * its first `;`, include a quality of 0, such as `q=0` or `q=0.000`.
+ */
+bool hasZeroQuality(char const *data, size_t length) {
+  size_t start = 0;
+  while (start < length) {
+    size_t end = start;
+    while (end < length && data[end] != ';') {
+      end++;
+    }
+    StringRef const parameter = trim(data + start, end - start);
+    if (parameter.length >= 3 && toLower(parameter.data[0]) == 'q' && parameter.data[1] == '=') {
+      for (size_t i = 2; i < parameter.length; i++) {
+        if (parameter.data[i] != '0' && parameter.data[i] != '.') {
+          return false;
+        }
+      }
+      return true;
+    }
+    start = end + 1;
+  }
+  return false;
+}
+
+}
+
+bool StringRef::equals(char const *s) const {
+  return strlen(s) == length && memcmp(s, data, length) == 0;
+}
+
+bool StringRef::equalsIgnoreCase(char const *s) const {
+  if (strlen(s) != length) {
+    return false;
+  }
+  for (size_t i = 0; i < length; i++) {
+    if (toLower(s[i]) != toLower(data[i])) {
+      return false;
+    }
+  }
+  return true;
+}
+
+bool StringRef::hasToken(char const *token) const {
+  size_t start = 0;
+  while (start < length) {
+    size_t end = start;
+    while (end < length && data[end] != ',') {
+      end++;
+    }
+    if (trim(data + start, end - start).equalsIgnoreCase(token)) {
+      return true;
+    }
+    start = end + 1;
+  }
+  return false;
+}
+
+bool StringRef::toUnsigned(uint32 *value) const {
+  if (!length || length > 10) {
+    return false;
+  }
+  uint64_t result = 0;
+  for (size_t i = 0; i < length; i++) {
+    if (data[i] < '0' || data[i] > '9') {
+      return false;
+    }
+    result = result * 10 + (data[i] - '0');
+  }
+  if (result > 0xffffffffu) {
+    return false;
+  }
+  *value = result;
+  return true;
+}
+
+StringRef HttpRequestParser::queryParameter(char const *name) const {
+  size_t const nameLength = strlen(name);
+  size_t start = 0;
+  while (start < query_.length) {
+    size_t end = start;
+    while (end < query_.length && query_.data[end] != '&') {
+      end++;
+    }
+    char const *const parameter = query_.data + start;
+    size_t const length = end - start;
+    if (length >= nameLength && memcmp(parameter, name, nameLength) == 0 &&
+        (length == nameLength || parameter[nameLength] == '=')) {
+      StringRef value;
+      value.data = parameter + nameLength + (length > nameLength);
+      value.length = length - nameLength - (length > nameLength);
+      return value;
+    }
+    start = end + 1;
+  }
+  return StringRef();
+}
+
+bool HttpRequestParser::matchesETag(char const *etag) const {
+  size_t start = 0;
+  while (start < ifNoneMatch_.length) {
+    size_t end = start;
+    while (end < ifNoneMatch_.length && ifNoneMatch_.data[end] != ',') {
+      end++;
+    }
+    StringRef candidate = trim(ifNoneMatch_.data + start, end - start);
+    // If-None-Match uses weak comparison, so W/ makes no difference.
+    if (candidate.length >= 2 && candidate.data[0] == 'W' && candidate.data[1] == '/') {
+      candidate.data += 2;
+      candidate.length -= 2;
+    }
+    if (candidate.equals("*") || candidate.equals(etag)) {
+      return true;
+    }
+    start = end + 1;
+  }
+  return false;
+}
+
+bool HttpRequestParser::acceptsEncoding(char const *coding) const {
+  if (!acceptEncoding_.data) {
+    return true;
+  }
+  // A coding that is named takes precedence over `*`.
+  bool wildcard = false;
+  size_t start = 0;
+  while (start < acceptEncoding_.length) {
+    size_t end = start;
+    while (end < acceptEncoding_.length && acceptEncoding_.data[end] != ',') {
+      end++;
+    }
+    size_t nameEnd = start;
+    while (nameEnd < end && acceptEncoding_.data[nameEnd] != ';') {
+      nameEnd++;
+    }
+    StringRef const name = trim(acceptEncoding_.data + start, nameEnd - start);
+    bool const acceptable = !hasZeroQuality(acceptEncoding_.data + nameEnd, end - nameEnd);
+    if (name.equalsIgnoreCase(coding)) {
+      return acceptable;
+    }
+    if (name.equals("*")) {
+      wildcard = acceptable;
+    }
+    start = end + 1;
+  }
+  return wildcard;
+}
+
+void HttpRequestParser::reset() {
+  size_ = 0;
+  requestEnd_ = 0;
+  lineStart_ = 0;
+  state_ = State::REQUEST_LINE;
+  errorStatus_ = 0;
+  method_ = path_ = query_ = ifNoneMatch_ = acceptEncoding_ = connection_ = StringRef();
+  http11_ = false;
+  keepAlive_ = false;
+}
+
+void HttpRequestParser::nextRequest() {
+  size_t const leftover = state_ == State::COMPLETE ? size_ - requestEnd_ : 0;
+  memmove(buffer_, buffer_ + requestEnd_, leftover);
+  reset();
+  size_ = leftover;
+  parseLines();
+}
+
+char *HttpRequestParser::space(size_t *available) {
+  *available = state_ == State::COMPLETE || state_ == State::ERROR ? 0 : BUFFER_SIZE - size_;
+  return buffer_ + size_;
+}
+
+void HttpRequestParser::received(size_t count) {
+  size_ += count;
+  parseLines();
+}
+
+void HttpRequestParser::parseLines() {
+  size_t scan = lineStart_;
+  while (state_ == State::REQUEST_LINE || state_ == State::HEADERS) {
+    char *const newline = static_cast<char *>(memchr(buffer_ + scan, '\n', size_ - scan));
+    if (!newline) {
+      if (size_ == BUFFER_SIZE) {
+        fail(state_ == State::REQUEST_LINE ? 414 : 431);
+      }
+      return;
+    }
+    size_t const lineEnd = newline - buffer_ + 1;
+    size_t length = newline - (buffer_ + lineStart_);
+    if (length && newline[-1] == '\r') {
+      length--;
+    }
+    char *const line = buffer_ + lineStart_;
+    if (state_ == State::REQUEST_LINE) {
+      if (length) {
+        parseRequestLine(line, length);
+        lineStart_ = lineEnd;
+      } else {
+        // Empty lines before the request line are to be ignored.
+        memmove(line, buffer_ + lineEnd, size_ - lineEnd);
+        size_ -= lineEnd - lineStart_;
+      }
+    } else if (!length) {
+      requestEnd_ = lineEnd;
+      keepAlive_ = http11_ ? !connection_.hasToken("close") : connection_.hasToken("keep-alive");
+      state_ = State::COMPLETE;
+    } else {
+      parseHeader(line, length, lineEnd);
+    }
+    scan = lineStart_;
+  }
+}
+
+void HttpRequestParser::parseRequestLine(char *line, size_t length) {
+  // "GET /path?query HTTP/1.1"
+  char *const methodEnd = static_cast<char *>(memchr(line, ' ', length));
+  if (!methodEnd) {
+    fail(400);
+    return;
+  }
+  char *const target = methodEnd + 1;
+  char *const targetEnd = static_cast<char *>(memchr(target, ' ', line + length - target));
+  if (!targetEnd || target[0] != '/') {
+    fail(400);
+    return;
+  }
+  StringRef version;
+  version.data = targetEnd + 1;
+  version.length = line + length - version.data;
+  if (version.equals("HTTP/1.1")) {
+    http11_ = true;
+  } else if (!version.equals("HTTP/1.0")) {
+    fail(505);
+    return;
+  }
+
+  method_.data = line;
+  method_.length = methodEnd - line;
+  char *const question = static_cast<char *>(memchr(target, '?', targetEnd - target));
+  path_.data = target;
+  path_.length = (question ? question : targetEnd) - target;
+  if (question) {
+    query_.data = question + 1;
+    query_.length = targetEnd - query_.data;
+  }
+  state_ = State::HEADERS;
+}
+
+void HttpRequestParser::parseHeader(char *line, size_t length, size_t lineEnd) {
+  char *const colon = static_cast<char *>(memchr(line, ':', length));
+  if (!colon) {
+    fail(400);
+    return;
+  }
+  StringRef name;
+  name.data = line;
+  name.length = colon - line;
+  StringRef const value = trim(colon + 1, line + length - colon - 1);
+
+  StringRef *keep = nullptr;
+  if (name.equalsIgnoreCase("Connection")) {
+    keep = &connection_;
+  } else if (name.equalsIgnoreCase("If-None-Match")) {
+    keep = &ifNoneMatch_;
+  } else if (name.equalsIgnoreCase("Accept-Encoding")) {
+    keep = &acceptEncoding_;
+  } else if (name.equalsIgnoreCase("Transfer-Encoding") ||
+      (name.equalsIgnoreCase("Content-Length") && !trim(value.data, value.length).equals("0"))) {
+    fail(413);
+    return;
+  }
+
+  if (keep) {
+    *keep = value;
+    lineStart_ = lineEnd;
+  } else {
+    // Make room by dropping the line; nothing refers to it, or beyond it.
+    memmove(line, buffer_ + lineEnd, size_ - lineEnd);
+    size_ -= lineEnd - lineStart_;
+  }
+}
+
+void HttpRequestParser::fail(int status) {
+  state_ = State::ERROR;
+  errorStatus_ = status;
+}
@@ -0,0 +1,146 @@
+#pragma once
+
+#include <Arduino.h>
+
+/**
+ * A slice of a buffer that someone else owns; not NUL-terminated.
+ */
+struct StringRef {
+  char const *data = nullptr;
+  size_t length = 0;
+
+  bool isEmpty() const { return !length; }
+  bool equals(char const *s) const;
+  bool equalsIgnoreCase(char const *s) const;
+
+  /**
+   * Whether this is a comma-separated list, like the value of a `Connection`
+   * header, that contains the given token, ignoring case.
+   */
+  bool hasToken(char const *token) const;
+
+  /**
+   * Parses a decimal number that fits in 32 bits. Returns `false` if this is
+   * anything else.
+   */
+  bool toUnsigned(uint32 *value) const;
+};
+
+/**
+ * Parses an HTTP/1.x request head incrementally, as bytes trickle in, so that
+ * a slow client never makes us wait. Bytes are received straight into the
+ * parser's own buffer, and the parsed parts of the request refer into it
+ * rather than being copied. Header lines we have no use for are dropped from
+ * the buffer as soon as they are complete, so the buffer only needs to hold
+ * the request line, the headers we keep, and the longest header line.
+ *
+ * Requests with a body are not supported. Pipelined requests are: bytes after
+ * the end of a request are kept for `nextRequest()`.
+ *
+ * Usage:
+ *
+ *   size_t available;
+ *   char *space = parser.space(&available);
+ *   parser.received(client.read(space, available));
+ *   if (parser.state() == HttpRequestParser::State::COMPLETE) ...
+ */
+class HttpRequestParser {
+  public:
+    static size_t const BUFFER_SIZE = 512;
+
+    enum class State {
+      // Waiting for more bytes.
+      REQUEST_LINE,
+      HEADERS,
+      COMPLETE,
+      ERROR,
+    };
+
+    HttpRequestParser() { reset(); }
+
+    /**
+     * Forgets everything, including any bytes of a next request.
+     */
+    void reset();
+
+    /**
+     * Starts on the next request, with the bytes that were received after the
+     * end of the current one.
+     */
+    void nextRequest();
+
+    /**
+     * Returns where to receive more bytes, and how many fit. The parser will
+     * be in the `ERROR` state before this returns 0.
+     */
+    char *space(size_t *available);
+
+    /**
+     * Parses `count` bytes that were written to `space()`.
+     */
+    void received(size_t count);
+
+    State state() const { return state_; }
+
+    /**
+     * The status code to reply with in the `ERROR` state.
+     */
+    int errorStatus() const { return errorStatus_; }
+
+    /**
+     * Whether any bytes of a request have been received, so that closing the
+     * connection would cut it off.
+     */
+    bool hasPartialRequest() const { return size_ > 0; }
+
+    // Valid in the `COMPLETE` state, until `nextRequest()` or `reset()`.
+    StringRef method() const { return method_; }
+    StringRef path() const { return path_; }
+    StringRef query() const { return query_; }
+    StringRef ifNoneMatch() const { return ifNoneMatch_; }
+    StringRef acceptEncoding() const { return acceptEncoding_; }
+    bool keepAlive() const { return keepAlive_; }
+
+    /**
+     * Returns the value of the parameter from the query string, without
+     * percent-decoding, or `nullptr` data if it is not there.
+     */
+    StringRef queryParameter(char const *name) const;
+
+    /**
+     * Whether the client's `If-None-Match` header lists the given ETag
+     * (quotes included), or `*`, so that 304 Not Modified will do.
+     */
+    bool matchesETag(char const *etag) const;
+
+    /**
+     * Whether the client's `Accept-Encoding` header allows the given content
+     * coding, by name or through `*`, and not with `q=0`. Without the header,
+     * any coding is allowed.
+     */
+    bool acceptsEncoding(char const *coding) const;
+
+  private:
+    char buffer_[BUFFER_SIZE];
+    // Bytes in the buffer, and the start of the line being received.
+    size_t size_;
+    size_t lineStart_;
+    // Where the next request starts, once this one is complete.
+    size_t requestEnd_;
+
+    State state_;
+    int errorStatus_;
+    StringRef method_;
+    StringRef path_;
+    StringRef query_;
+    StringRef ifNoneMatch_;
+    StringRef acceptEncoding_;
+    bool http11_;
+    StringRef connection_;
+    bool keepAlive_;
+
+    void parseLines();
+    void parseRequestLine(char *line, size_t length);
+    void parseHeader(char *line, size_t length, size_t lineEnd);
+    void fail(int status);
+};
@@ -0,0 +1,103 @@
+#include "HttpResponse.h"
+
+HttpResponse::HttpResponse(WiFiClient &client, bool keepAlive) :
+  client_(client),
+  buffer_(client),
+  keepAlive_(keepAlive)
+{
+}
+
+void HttpResponse::sendStatus(int code, char const *text) {
+  // These never have a body, so nothing needs to mark where it ends.
+  if (code == 204 || code == 304) {
+    hasContentLength_ = true;
+  }
+  buffer_.print("HTTP/1.1 ");
+  buffer_.print(code);
+  buffer_.print(" ");
+  buffer_.print(text);
+  buffer_.print("\r\n");
+}
+
+void HttpResponse::sendHeader(char const *name, char const *value) {
+  buffer_.print(name);
+  buffer_.print(": ");
+  buffer_.print(value);
+  buffer_.print("\r\n");
+}
+
+void HttpResponse::sendContentLength(size_t length) {
+  buffer_.print("Content-Length: ");
+  buffer_.print(static_cast<unsigned>(length));
+  buffer_.print("\r\n");
+  hasContentLength_ = true;
+}
+
+void HttpResponse::sendData(char const *data) {
+  endHeaders();
+  buffer_.print(data);
+}
+
+void HttpResponse::sendData(uint8_t const *data, size_t length) {
+  endHeaders();
+  buffer_.flush();
+  client_.write(data, length);
+}
+
+void HttpResponse::sendData_P(PGM_P data, size_t length) {
+  endHeaders();
+  buffer_.flush();
+  client_.write_P(data, length);
+}
+
+Print &HttpResponse::body() {
+  endHeaders();
+  return buffer_;
+}
+
+void HttpResponse::sendError(int code, char const *text) {
+  char status[4];
+  snprintf(status, sizeof(status), "%d", code);
+  sendStatus(code, text);
+  sendHeader("Content-Type", "text/plain; charset=UTF-8");
+  sendContentLength(strlen(status) + 1 + strlen(text));
+  sendData(status);
+  sendData(" ");
+  sendData(text);
+}
+
+void HttpResponse::finish() {
+  if (detached_) {
+    return;
+  }
+  endHeaders();
+  buffer_.flush();
+}
+
+char const *HttpResponse::statusText(int code) {
+  switch (code) {
+    case 200: return "OK";
+    case 304: return "Not Modified";
+    case 400: return "Bad Request";
+    case 404: return "Not Found";
+    case 405: return "Method Not Allowed";
+    case 408: return "Request Timeout";
+    case 413: return "Payload Too Large";
+    case 414: return "URI Too Long";
+    case 431: return "Request Header Fields Too Large";
+    case 503: return "Service Unavailable";
+    case 505: return "HTTP Version Not Supported";
+    default: return "";
+  }
+}
+
+void HttpResponse::endHeaders() {
+  if (headersEnded_) {
+    return;
+  }
+  // Without a length, only closing the connection marks the end of the body.
+  keepAlive_ = keepAlive_ && hasContentLength_;
+  sendHeader("Connection", keepAlive_ ? "keep-alive" : "close");
+  buffer_.print("\r\n");
+  headersEnded_ = true;
+}
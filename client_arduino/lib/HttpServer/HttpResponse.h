@@ -0,0 +1,81 @@
+#pragma once
+
+#include <ESP8266WiFi.h>
+
+#include "BufferedPrint.h"
+
+/**
+ * Writes an HTTP response to a client. The status line and headers are
+ * collected and sent in one go, together with a short body, rather than as a
+ * TCP segment each.
+ *
+ * The connection can only be kept alive for the next request if the response
+ * has a `Content-Length`; the `Connection` header is chosen accordingly when
+ * the headers end.
+ */
+class HttpResponse {
+  public:
+    HttpResponse(WiFiClient &client, bool keepAlive);
+
+    ~HttpResponse() {
+      finish();
+    }
+
+    void sendStatus(int code, char const *text);
+    void sendHeader(char const *name, char const *value);
+    void sendContentLength(size_t length);
+
+    void sendData(char const *data);
+    void sendData(uint8_t const *data, size_t length);
+    void sendData_P(PGM_P data, size_t length);
+
+    /**
+     * Ends the headers, and returns where to write the body. Writes are
+     * buffered, and sent when the buffer is full or the response finishes.
+     */
+    Print &body();
+
+    /**
+     * Sends a complete plain text response for the given status.
+     */
+    void sendError(int code, char const *text);
+    void sendError(int code) { sendError(code, statusText(code)); }
+
+    /**
+     * Ends the response, if it hasn't been already.
+     */
+    void finish();
+
+    WiFiClient &client() { return client_; }
+
+    /**
+     * Leaves the connection to whoever took over `client()`, such as an
+     * `EventStream`. Nothing more is sent on it, and the server forgets
+     * about it.
+     */
+    void detach() {
+      detached_ = true;
+    }
+
+    bool detached() const { return detached_; }
+
+    /**
+     * Whether the connection can be used for another request.
+     */
+    bool keepAlive() const { return keepAlive_ && !detached_; }
+
+    /**
+     * The reason phrase for the status codes we send.
+     */
+    static char const *statusText(int code);
+
+  private:
+    WiFiClient &client_;
+    BufferedPrint<256> buffer_;
+    bool keepAlive_;
+    bool hasContentLength_ = false;
+    bool headersEnded_ = false;
+    bool detached_ = false;
+
+    void endHeaders();
+};
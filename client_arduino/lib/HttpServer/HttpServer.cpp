@@ -0,0 +1,151 @@
+#include "HttpServer.h"
+
+#include "Profiler.h"
+
+void HttpServer::begin(Handler handler) {
+  handler_ = handler;
+  server_.begin();
+}
+
+void HttpServer::update() {
+  PROFILE_ZONE("http.update");
+  unsigned long const start = millis();
+  accept();
+  for (size_t i = 0; i < MAX_CONNECTIONS; i++) {
+    unsigned long const now = millis();
+    if (now - start >= BUDGET_MILLIS) {
+      break;
+    }
+    Connection &connection = connections_[next_];
+    next_ = (next_ + 1) % MAX_CONNECTIONS;
+    if (connection.active) {
+      serve(connection, now);
+    }
+  }
+}
+
+size_t HttpServer::numConnections() const {
+  size_t count = 0;
+  for (Connection const &connection : connections_) {
+    count += connection.active;
+  }
+  return count;
+}
+
+void HttpServer::accept() {
+  for (WiFiClient client = server_.available(); client; client = server_.available()) {
+    Connection *const connection = freeConnection();
+    if (!connection) {
+      stats_.rejected++;
+      HttpResponse response(client, false);
+      response.sendError(503);
+      response.finish();
+      client.stop();
+      continue;
+    }
+    stats_.accepted++;
+    connection->active = true;
+    connection->client = client;
+    // Responses are written in as few pieces as we can manage; don't let them
+    // wait for the acknowledgement of the previous one.
+    connection->client.setNoDelay(true);
+    connection->parser.reset();
+    connection->numRequests = 0;
+    connection->lastActivityMillis = millis();
+  }
+}
+
+HttpServer::Connection *HttpServer::freeConnection() {
+  unsigned long const now = millis();
+  Connection *idlest = nullptr;
+  for (Connection &connection : connections_) {
+    if (!connection.active) {
+      return &connection;
+    }
+    if (!connection.parser.hasPartialRequest() &&
+        (!idlest || now - connection.lastActivityMillis > now - idlest->lastActivityMillis)) {
+      idlest = &connection;
+    }
+  }
+  if (idlest) {
+    disconnect(*idlest);
+  }
+  return idlest;
+}
+
+void HttpServer::serve(Connection &connection, unsigned long now) {
+  HttpRequestParser &parser = connection.parser;
+  WiFiClient &client = connection.client;
+
+  size_t available;
+  char *const space = parser.space(&available);
+  int const pending = client.available();
+  if (available && pending > 0) {
+    size_t const count = client.read(
+        reinterpret_cast<uint8_t *>(space), available < static_cast<size_t>(pending) ? available : pending);
+    parser.received(count);
+    connection.lastActivityMillis = now;
+  }
+
+  switch (parser.state()) {
+    case HttpRequestParser::State::COMPLETE:
+      respond(connection);
+      break;
+    case HttpRequestParser::State::ERROR: {
+      stats_.badRequests++;
+      HttpResponse response(client, false);
+      response.sendError(parser.errorStatus());
+      response.finish();
+      disconnect(connection);
+      break;
+    }
+    default:
+      if (!client.connected() && !client.available()) {
+        disconnect(connection);
+      } else if (parser.hasPartialRequest() && now - connection.lastActivityMillis >= REQUEST_MILLIS) {
+        stats_.timeouts++;
+        HttpResponse response(client, false);
+        response.sendError(408);
+        response.finish();
+        disconnect(connection);
+      } else if (!parser.hasPartialRequest() && now - connection.lastActivityMillis >= IDLE_MILLIS) {
+        disconnect(connection);
+      }
+      break;
+  }
+}
+
+void HttpServer::respond(Connection &connection) {
+  HttpRequestParser &parser = connection.parser;
+  stats_.requests++;
+  if (connection.numRequests++) {
+    stats_.reused++;
+  }
+
+  bool keepAlive;
+  bool detached;
+  {
+    HttpResponse response(connection.client, parser.keepAlive());
+    handler_(parser, response);
+    response.finish();
+    keepAlive = response.keepAlive();
+    detached = response.detached();
+  }
+
+  if (detached) {
+    // Someone else owns the connection now; just forget about it.
+    connection.client = WiFiClient();
+    connection.active = false;
+  } else if (keepAlive) {
+    parser.nextRequest();
+    connection.lastActivityMillis = millis();
+  } else {
+    disconnect(connection);
+  }
+}
+
+void HttpServer::disconnect(Connection &connection) {
+  connection.client.stop();
+  connection.client = WiFiClient();
+  connection.active = false;
+}
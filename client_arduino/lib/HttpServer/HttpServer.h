@@ -0,0 +1,86 @@
+#pragma once
+
+#include <ESP8266WiFi.h>
+
+#include "HttpRequestParser.h"
+#include "HttpResponse.h"
+
+/**
+ * Serves HTTP/1.1 to a fixed number of concurrent connections without ever
+ * waiting for a client. Each call to `update()` reads whatever bytes have
+ * arrived into the connection's request parser, and handles the requests
+ * that are complete; a client that sends its request slowly, or keeps its
+ * connection open between requests, doesn't hold up the main loop or the
+ * other clients.
+ *
+ * Connections are kept alive between requests for up to `IDLE_MILLIS`. When
+ * all slots are taken, a new client replaces the connection that has been
+ * idle the longest, or is turned away with 503 if none is idle.
+ *
+ * Writing a response still blocks until it fits in the TCP send buffer, which
+ * for the larger static files means until part of it has been acknowledged.
+ */
+class HttpServer {
+  public:
+    static size_t const MAX_CONNECTIONS = 4;
+    // How long a client may take to send the rest of a request it started.
+    static unsigned long const REQUEST_MILLIS = 5000;
+    static unsigned long const IDLE_MILLIS = 15000;
+    // After this long, `update()` leaves the remaining connections for the
+    // next call.
+    static unsigned long const BUDGET_MILLIS = 20;
+
+    typedef void (*Handler)(HttpRequestParser const &request, HttpResponse &response);
+
+    struct Stats {
+      uint32 accepted = 0;
+      // Clients turned away because all connections were busy.
+      uint32 rejected = 0;
+      uint32 requests = 0;
+      // Requests answered with an error by the server itself, and connections
+      // closed because the client took too long.
+      uint32 badRequests = 0;
+      uint32 timeouts = 0;
+      // Requests after the first on a connection.
+      uint32 reused = 0;
+    };
+
+    explicit HttpServer(uint16 port) : server_(port) {}
+
+    void begin(Handler handler);
+
+    /**
+     * Accepts new connections and handles requests. Call this regularly.
+     */
+    void update();
+
+    size_t numConnections() const;
+    Stats const &stats() const { return stats_; }
+
+  private:
+    struct Connection {
+      bool active = false;
+      WiFiClient client;
+      HttpRequestParser parser;
+      uint32 numRequests = 0;
+      unsigned long lastActivityMillis = 0;
+    };
+
+    WiFiServer server_;
+    Handler handler_ = nullptr;
+    Connection connections_[MAX_CONNECTIONS];
+    // Where the next `update()` starts, so that all connections get a turn.
+    size_t next_ = 0;
+    Stats stats_;
+
+    void accept();
+    Connection *freeConnection();
+
+    /**
+     * Reads from the connection and handles at most one request.
+     */
+    void serve(Connection &connection, unsigned long now);
+
+    void respond(Connection &connection);
+    void disconnect(Connection &connection);
+};
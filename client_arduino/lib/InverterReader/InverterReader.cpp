@@ -1,23 +1,105 @@
 #include <cstring>
 
 #include "InverterReader.h"
+#include "Log.h"
 #include "SunSpecInverterReader.h"
 
+void NullInverterReader::requestUpdate() {
+  // Made-up zeros would end up in samples and the power balance.
+}
+
 ErrorCode NullInverterReader::update() {
   return NO_ERROR;
 }
 
-ErrorCode InverterReader::begin(Config const &config) {
-  char const *const inverterProtocol = config.inverterProtocol();
-  if (!strcmp(inverterProtocol, "sunspec")) {
-    impl_.reset(new SunSpecInverterReader(config.inverterHost(), config.inverterPort()));
-  } else if (!strcmp(inverterProtocol, "")) {
-    impl_.reset(new NullInverterReader());
-  } else {
-    Serial.print("Unknown inverter protocol: ");
-    Serial.println(inverterProtocol);
-    impl_.reset(new NullInverterReader());
-    return CONFIG_VALUE_ERROR;
+ErrorCode InverterReader::begin(Config const &config, HostCache *hostCache) {
+  ErrorCode result = NO_ERROR;
+  numDevices_ = config.numDevices();
+  for (size_t i = 0; i < numDevices_; i++) {
+    DeviceConfig const &device = config.device(i);
+    if (!strcmp(device.protocol, "sunspec")) {
+      if (!arena_) {
+        // Each connection owns one register buffer; the arena holds the extra
+        // ones for pipelining, shared between all of them.
+        arena_.reset(new RegisterArena(2 * (SunSpecTransport::MAX_WINDOW_SIZE - 1)));
+      }
+      devices_[i].reset(new SunSpecInverterReader(device.host, device.port, arena_.get(), hostCache));
+    } else {
+      LOG_ERROR("inverter", "Unknown inverter protocol: %s", device.protocol);
+      devices_[i].reset(new NullInverterReader());
+      result = CONFIG_VALUE_ERROR;
+    }
+    schedulers_[i].begin(
+        1000 * config.devicePollMinIntervalSeconds(),
+        1000 * config.devicePollMaxIntervalSeconds());
+    polling_[i] = false;
+    hasValues_[i] = false;
   }
-  return NO_ERROR;
+  return result;
+}
+
+ErrorCode InverterReader::update() {
+  unsigned long const now = millis();
+  ErrorCode result = NO_ERROR;
+  for (size_t i = 0; i < numDevices_; i++) {
+    InverterReaderImpl &device = *devices_[i];
+    PollScheduler &scheduler = schedulers_[i];
+    if (!polling_[i] && scheduler.isDue(now)) {
+      device.requestUpdate();
+      scheduler.started(now);
+      polling_[i] = true;
+    }
+
+    ErrorCode const error = device.update();
+    if (error) {
+      LOG_WARNING("inverter", "Failed to read device %u: %s", static_cast<unsigned>(i), errorName(error));
+      result = error;
+    }
+
+    if (!polling_[i]) {
+      continue;
+    }
+    if (error) {
+      scheduler.failed();
+      polling_[i] = false;
+    } else if (device.ready_) {
+      scheduler.succeeded(device.powerWatts_);
+      polling_[i] = false;
+      hasValues_[i] = true;
+      readMillis_[i] = millis();
+      newValues_ = true;
+    }
+  }
+  return result;
+}
+
+bool InverterReader::takeNewValues() {
+  bool const newValues = newValues_;
+  newValues_ = false;
+  return newValues;
+}
+
+bool InverterReader::isReady() const {
+  for (size_t i = 0; i < numDevices_; i++) {
+    if (!hasValues_[i]) {
+      return false;
+    }
+  }
+  return true;
+}
+
+double InverterReader::powerWatts() const {
+  double sum = 0;
+  for (size_t i = 0; i < numDevices_; i++) {
+    sum += devices_[i]->powerWatts_;
+  }
+  return sum;
+}
+
+double InverterReader::totalEnergyWattHours() const {
+  double sum = 0;
+  for (size_t i = 0; i < numDevices_; i++) {
+    sum += devices_[i]->totalEnergyWattHours_;
+  }
+  return sum;
 }
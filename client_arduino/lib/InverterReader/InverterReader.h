@@ -4,17 +4,35 @@
 
 #include "Config.h"
 #include "errors.h"
+#include "HostCache.h"
+#include "ModbusTcpTransport.h"
+#include "PollScheduler.h"
+#include "RegisterArena.h"
 
 class InverterReaderImpl {
   public:
     /**
-     * Implementations should write into the appropriate protected fields.
+     * Starts reading new values from the inverter, unless a read is already
+     * in progress.
+     */
+    virtual void requestUpdate() = 0;
+
+    /**
+     * Advances the read in progress, if any. Must not block. Implementations
+     * should write into the appropriate protected fields, and set `ready_`
+     * once a read has completed successfully.
      */
     virtual ErrorCode update() = 0;
 
+    /**
+     * Counts of the Modbus requests made, if the device speaks Modbus.
+     */
+    virtual ModbusTcpTransport::Stats modbusStats() const { return ModbusTcpTransport::Stats(); }
+
   protected:
     InverterReaderImpl() {}
 
+    bool ready_ = false;
     double powerWatts_ = 0;
     double totalEnergyWattHours_ = 0;
 
@@ -25,25 +43,89 @@ class InverterReaderImpl {
     friend class InverterReader;
 };
 
+/**
+ * Stands in for a device with an unknown protocol. It is never ready.
+ */
 class NullInverterReader : public InverterReaderImpl {
   public:
     NullInverterReader() {}
 
+    void requestUpdate() override;
     ErrorCode update() override;
 };
 
+/**
+ * Reads all configured inverters and meters. Each device has its own
+ * connection and state machine, and all of them are advanced by every
+ * `update()` call, so reading N devices takes about as long as reading the
+ * slowest one. Each device is polled on its own adaptive schedule; see
+ * `PollScheduler`.
+ */
 class InverterReader {
   public:
     /**
-     * Must be called before any other methods on this object.
+     * Must be called before any other methods on this object. Host names of
+     * devices are resolved through `hostCache`.
+     */
+    ErrorCode begin(Config const &config, HostCache *hostCache);
+
+    /**
+     * Starts reading devices whose next poll is due, and advances the reads in
+     * progress. Never blocks, so this can be called on every iteration of the
+     * main loop. Returns the error that caused a read to be abandoned, if
+     * any.
      */
-    ErrorCode begin(Config const &config);
+    ErrorCode update();
 
-    ErrorCode update() { return impl_->update(); }
+    /**
+     * Returns whether any device has been read successfully since the last
+     * call, and clears the flag.
+     */
+    bool takeNewValues();
 
-    double powerWatts() const { return impl_->powerWatts_; }
-    double totalEnergyWattHours() const { return impl_->totalEnergyWattHours_; }
+    /**
+     * Whether each device has been read successfully at least once, so that
+     * `powerWatts()` and `totalEnergyWattHours()` are meaningful. Values of a
+     * device that can't be reached anymore are kept as they were.
+     */
+    bool isReady() const;
+
+    /**
+     * Sums over all devices.
+     */
+    double powerWatts() const;
+    double totalEnergyWattHours() const;
+
+    size_t numDevices() const { return numDevices_; }
+    bool isReady(size_t device) const { return hasValues_[device]; }
+    double powerWatts(size_t device) const { return devices_[device]->powerWatts_; }
+    double totalEnergyWattHours(size_t device) const { return devices_[device]->totalEnergyWattHours_; }
+
+    /**
+     * The `millis()` at which the given device was last read successfully.
+     */
+    unsigned long readMillis(size_t device) const { return readMillis_[device]; }
+
+    /**
+     * Poll counts, failure counts and current interval of the given device.
+     */
+    PollScheduler const &scheduler(size_t device) const { return schedulers_[device]; }
+
+    /**
+     * Modbus request counts of the given device.
+     */
+    ModbusTcpTransport::Stats modbusStats(size_t device) const { return devices_[device]->modbusStats(); }
 
   private:
-    std::unique_ptr<InverterReaderImpl> impl_;
+    // Register buffers shared by the Modbus connections of all devices.
+    // Declared first, so that it outlives the devices borrowing from it.
+    std::unique_ptr<RegisterArena> arena_;
+
+    std::unique_ptr<InverterReaderImpl> devices_[Config::MAX_DEVICES];
+    PollScheduler schedulers_[Config::MAX_DEVICES];
+    bool polling_[Config::MAX_DEVICES] = {};
+    bool hasValues_[Config::MAX_DEVICES] = {};
+    unsigned long readMillis_[Config::MAX_DEVICES] = {};
+    size_t numDevices_ = 0;
+    bool newValues_ = false;
 };
@@ -0,0 +1,330 @@
+#include "ModbusTcpTransport.h"
+
+#include <include/ClientContext.h>
+
+#include "Log.h"
+#include "Profiler.h"
+
+namespace {
+
+uint8 const READ_HOLDING_REGISTERS = 0x03;
+uint8 const EXCEPTION_FLAG = 0x80;
+
+size_t const MBAP_HEADER_SIZE = 7;
+
+uint16 readUint16(uint8 const *bytes) {
+  return static_cast<uint16>(bytes[0]) << 8 | bytes[1];
+}
+
+void writeUint16(uint8 *bytes, uint16 value) {
+  bytes[0] = value >> 8;
+  bytes[1] = value & 0xff;
+}
+
+/**
+ * `WiFiClient` only lets subclasses wrap an established connection.
+ */
+class AdoptingClient : public WiFiClient {
+  public:
+    explicit AdoptingClient(ClientContext *context) : WiFiClient(context) {}
+};
+
+}
+
+ModbusTcpTransport::ModbusTcpTransport(RegisterArena *arena) :
+  arena_(arena)
+{
+}
+
+void ModbusTcpTransport::setWindowSize(size_t windowSize) {
+  windowSize_ = windowSize < 1 ? 1 : windowSize > MAX_WINDOW_SIZE ? MAX_WINDOW_SIZE : windowSize;
+}
+
+ModbusTcpTransport::~ModbusTcpTransport() {
+  // lwIP must not call back into a destroyed object.
+  abortConnect();
+}
+
+bool ModbusTcpTransport::connect(IPAddress const &ipAddress, uint16 port) {
+  stop();
+  tcp_pcb *const pcb = tcp_new();
+  if (!pcb) {
+    return false;
+  }
+  tcp_arg(pcb, this);
+  tcp_err(pcb, &ModbusTcpTransport::connectErrorCallback);
+  ip_addr_t const address = ipAddress;
+  if (tcp_connect(pcb, &address, port, &ModbusTcpTransport::connectedCallback) != ERR_OK) {
+    tcp_abort(pcb);
+    return false;
+  }
+  connectPcb_ = pcb;
+  connectStartMillis_ = millis();
+  return true;
+}
+
+err_t ModbusTcpTransport::connectedCallback(void *arg, tcp_pcb *pcb, err_t) {
+  ModbusTcpTransport *const transport = static_cast<ModbusTcpTransport *>(arg);
+  // Adopt the connection right away, so that lwIP never frees it behind our
+  // back. The context installs its own callbacks.
+  transport->tcpClient_ = AdoptingClient(new ClientContext(pcb, nullptr, nullptr));
+  transport->connectPcb_ = nullptr;
+  // Requests are tiny; don't let Nagle hold them back.
+  transport->tcpClient_.setNoDelay(true);
+  return ERR_OK;
+}
+
+void ModbusTcpTransport::connectErrorCallback(void *arg, err_t) {
+  // lwIP has already freed the connection.
+  static_cast<ModbusTcpTransport *>(arg)->connectPcb_ = nullptr;
+}
+
+void ModbusTcpTransport::abortConnect() {
+  if (!connectPcb_) {
+    return;
+  }
+  tcp_arg(connectPcb_, nullptr);
+  tcp_err(connectPcb_, nullptr);
+  tcp_abort(connectPcb_);
+  connectPcb_ = nullptr;
+}
+
+bool ModbusTcpTransport::connected() {
+  return tcpClient_.connected();
+}
+
+void ModbusTcpTransport::stop() {
+  abortConnect();
+  tcpClient_.stop();
+  frameSize_ = 0;
+  for (Transaction &transaction : transactions_) {
+    if (transaction.id) {
+      releaseTransaction(transaction);
+    }
+  }
+}
+
+uint16 ModbusTcpTransport::request(uint8 serverId, uint16 address, uint16 count) {
+  if (count == 0 || count > MAX_REGISTERS || !connected()) {
+    return 0;
+  }
+  Transaction *transaction = nullptr;
+  size_t outstanding = 0;
+  for (Transaction &slot : transactions_) {
+    if (slot.id) {
+      outstanding++;
+    } else if (!transaction) {
+      transaction = &slot;
+    }
+  }
+  if (!transaction || outstanding >= windowSize_) {
+    return 0;
+  }
+  uint16 *const registers = acquireRegisters();
+  if (!registers) {
+    return 0;
+  }
+
+  uint16 const id = nextTransactionId_++;
+  if (!nextTransactionId_) {
+    nextTransactionId_ = 1;
+  }
+
+  uint8 frame[12];
+  writeUint16(frame + 0, id);
+  writeUint16(frame + 2, 0); // Protocol ID.
+  writeUint16(frame + 4, 6); // Length of the remainder.
+  frame[6] = serverId;
+  frame[7] = READ_HOLDING_REGISTERS;
+  writeUint16(frame + 8, address);
+  writeUint16(frame + 10, count);
+  if (tcpClient_.write(frame, sizeof(frame)) != sizeof(frame)) {
+    transaction->registers = registers;
+    releaseTransaction(*transaction);
+    fail();
+    return 0;
+  }
+
+  transaction->pipelined = numPending() > 0;
+  transaction->id = id;
+  transaction->serverId = serverId;
+  transaction->count = count;
+  transaction->status = Status::PENDING;
+  transaction->startMillis = millis();
+  transaction->registers = registers;
+  stats_.requests++;
+  return id;
+}
+
+void ModbusTcpTransport::poll() {
+  PROFILE_ZONE("modbus.poll");
+  unsigned long const now = millis();
+  if (connectPcb_ && now - connectStartMillis_ >= CONNECT_TIMEOUT_MILLIS) {
+    abortConnect();
+  }
+  for (Transaction &transaction : transactions_) {
+    if (transaction.id && transaction.status == Status::PENDING &&
+        now - transaction.startMillis >= timeoutMillis_) {
+      stats_.timeouts++;
+      failTransaction(transaction);
+    }
+  }
+
+  while (true) {
+    size_t const expected = expectedFrameSize();
+    if (expected > MAX_FRAME_SIZE || (expected && expected <= MBAP_HEADER_SIZE)) {
+      fail();
+      return;
+    }
+    if (expected && frameSize_ == expected) {
+      if (!handleFrame()) {
+        fail();
+        return;
+      }
+      frameSize_ = 0;
+      continue;
+    }
+    if (!tcpClient_.available()) {
+      break;
+    }
+    size_t const wanted = (expected ? expected : MBAP_HEADER_SIZE) - frameSize_;
+    int const read = tcpClient_.read(frame_ + frameSize_, wanted);
+    if (read <= 0) {
+      break;
+    }
+    frameSize_ += read;
+  }
+
+  if (!tcpClient_.connected()) {
+    for (Transaction &transaction : transactions_) {
+      if (transaction.id && transaction.status == Status::PENDING) {
+        failTransaction(transaction);
+      }
+    }
+  }
+}
+
+SunSpecTransport::Status ModbusTcpTransport::status(uint16 transactionId) const {
+  Transaction const *transaction = find(transactionId);
+  return transaction ? transaction->status : Status::FAILED;
+}
+
+uint16 const *ModbusTcpTransport::registers(uint16 transactionId) const {
+  Transaction const *transaction = find(transactionId);
+  return transaction && transaction->status == Status::DONE ? transaction->registers : nullptr;
+}
+
+void ModbusTcpTransport::release(uint16 transactionId) {
+  Transaction *transaction = find(transactionId);
+  if (transaction) {
+    releaseTransaction(*transaction);
+  }
+}
+
+ModbusTcpTransport::Transaction *ModbusTcpTransport::find(uint16 transactionId) {
+  if (transactionId) {
+    for (Transaction &transaction : transactions_) {
+      if (transaction.id == transactionId) {
+        return &transaction;
+      }
+    }
+  }
+  return nullptr;
+}
+
+ModbusTcpTransport::Transaction const *ModbusTcpTransport::find(uint16 transactionId) const {
+  return const_cast<ModbusTcpTransport *>(this)->find(transactionId);
+}
+
+size_t ModbusTcpTransport::numPending() const {
+  size_t count = 0;
+  for (Transaction const &transaction : transactions_) {
+    if (transaction.id && transaction.status == Status::PENDING) {
+      count++;
+    }
+  }
+  return count;
+}
+
+uint16 *ModbusTcpTransport::acquireRegisters() {
+  if (!ownRegistersInUse_) {
+    ownRegistersInUse_ = true;
+    return ownRegisters_;
+  }
+  return arena_ ? arena_->acquire() : nullptr;
+}
+
+void ModbusTcpTransport::releaseTransaction(Transaction &transaction) {
+  if (transaction.registers == ownRegisters_) {
+    ownRegistersInUse_ = false;
+  } else if (arena_) {
+    arena_->release(transaction.registers);
+  }
+  transaction.registers = nullptr;
+  transaction.id = 0;
+}
+
+void ModbusTcpTransport::failTransaction(Transaction &transaction) {
+  transaction.status = Status::FAILED;
+  stats_.failed++;
+  if (transaction.pipelined && windowSize_ > 1) {
+    LOG_WARNING("modbus", "Pipelined Modbus request failed; sending one request at a time from now on");
+    windowSize_ = 1;
+  }
+}
+
+size_t ModbusTcpTransport::expectedFrameSize() const {
+  if (frameSize_ < MBAP_HEADER_SIZE) {
+    return 0;
+  }
+  // The length field counts the unit ID byte, which is part of the header.
+  return MBAP_HEADER_SIZE - 1 + readUint16(frame_ + 4);
+}
+
+bool ModbusTcpTransport::handleFrame() {
+  PROFILE_ZONE("modbus.handleFrame");
+  if (readUint16(frame_ + 2) != 0) {
+    // Not Modbus; we've lost sync.
+    return false;
+  }
+
+  Transaction *transaction = find(readUint16(frame_));
+  if (!transaction || transaction->status != Status::PENDING) {
+    // Response to a request that was released or timed out.
+    return true;
+  }
+
+  uint8 const function = frame_[MBAP_HEADER_SIZE];
+  if (function == (READ_HOLDING_REGISTERS | EXCEPTION_FLAG)) {
+    transaction->status = Status::FAILED;
+    stats_.exceptions++;
+    return true;
+  }
+
+  uint8 const byteCount = frame_[MBAP_HEADER_SIZE + 1];
+  if (function != READ_HOLDING_REGISTERS ||
+      byteCount != 2 * transaction->count ||
+      frameSize_ != MBAP_HEADER_SIZE + 2 + byteCount) {
+    transaction->status = Status::FAILED;
+    stats_.failed++;
+    return true;
+  }
+
+  uint8 const *data = frame_ + MBAP_HEADER_SIZE + 2;
+  for (uint16 i = 0; i < transaction->count; i++) {
+    transaction->registers[i] = readUint16(data + 2 * i);
+  }
+  transaction->status = Status::DONE;
+  stats_.succeeded++;
+  return true;
+}
+
+void ModbusTcpTransport::fail() {
+  for (Transaction &transaction : transactions_) {
+    if (transaction.id && transaction.status == Status::PENDING) {
+      failTransaction(transaction);
+    }
+  }
+  tcpClient_.stop();
+  frameSize_ = 0;
+}
@@ -0,0 +1,173 @@
+#pragma once
+
+#include <ArduinoSunSpec.h>
+#include <ESP8266WiFi.h>
+#include <lwip/tcp.h>
+
+#include "RegisterArena.h"
+
+/**
+ * Non-blocking Modbus TCP client that implements just enough of the protocol
+ * (function 0x03, Read Holding Registers) to talk SunSpec.
+ *
+ * Requests are written to the socket immediately, and responses are parsed
+ * incrementally from whatever bytes are available during `poll()`, so no call
+ * ever waits for the network. Responses are matched to requests by their
+ * transaction ID, so a late response to a request that already timed out is
+ * recognized and discarded.
+ *
+ * Several requests can be outstanding at the same time, as Modbus TCP allows.
+ * Not all devices handle that well, though: some only answer the first
+ * request, others drop the connection. If a pipelined request fails like
+ * that, we fall back to sending one request at a time, for as long as this
+ * object lives.
+ *
+ * Responses to pipelined requests are stored in blocks borrowed from a
+ * `RegisterArena`, which may be shared with other transports. If none is
+ * available, the request is simply sent later.
+ *
+ * Connecting doesn't wait either. `WiFiClient::connect()` blocks until the
+ * connection is established, so we start it with lwIP directly, and hand the
+ * connection to a `WiFiClient` once it's up. `connect()` only starts it;
+ * afterwards `connecting()` is true until `connected()` is, or until it
+ * failed or took longer than `CONNECT_TIMEOUT_MILLIS`, as noticed by `poll()`.
+ */
+class ModbusTcpTransport : public SunSpecTransport {
+  public:
+    static unsigned long const CONNECT_TIMEOUT_MILLIS = 2000;
+    static unsigned long const DEFAULT_TIMEOUT_MILLIS = 2000;
+
+    struct Stats {
+      uint32 requests = 0;
+      uint32 succeeded = 0;
+      // Requests the device answered with a Modbus exception.
+      uint32 exceptions = 0;
+      // Requests that timed out, lost their connection, or got a malformed
+      // response; and of those, the ones that timed out.
+      uint32 failed = 0;
+      uint32 timeouts = 0;
+    };
+
+    /**
+     * The arena is optional; without it, only one request is outstanding at a
+     * time.
+     */
+    explicit ModbusTcpTransport(RegisterArena *arena = nullptr);
+    ~ModbusTcpTransport();
+
+    /**
+     * Sets the time after which an unanswered request is considered failed.
+     */
+    void setTimeout(unsigned long timeoutMillis) { timeoutMillis_ = timeoutMillis; }
+
+    /**
+     * Sets the maximum number of outstanding requests, between 1 and
+     * `SunSpecTransport::MAX_WINDOW_SIZE`.
+     */
+    void setWindowSize(size_t windowSize);
+
+    /**
+     * Closes any existing connection and starts connecting. Returns `false`
+     * if the connection could not even be started.
+     */
+    bool connect(IPAddress const &ipAddress, uint16 port);
+    bool connecting() const { return connectPcb_ != nullptr; }
+    bool connected();
+    void stop();
+
+    size_t windowSize() const override { return windowSize_; }
+    uint16 request(uint8 serverId, uint16 address, uint16 count) override;
+    void poll() override;
+    Status status(uint16 transactionId) const override;
+    uint16 const *registers(uint16 transactionId) const override;
+    void release(uint16 transactionId) override;
+
+    Stats const &stats() const { return stats_; }
+
+  private:
+    static uint16 const MAX_REGISTERS = RegisterArena::BLOCK_REGISTERS;
+
+    // MBAP header (7 bytes) + function code + byte count + register data.
+    static size_t const MAX_FRAME_SIZE = 7 + 2 + 2 * MAX_REGISTERS;
+
+    struct Transaction {
+      uint16 id = 0;
+      uint8 serverId = 0;
+      uint16 count = 0;
+      Status status = Status::FAILED;
+      unsigned long startMillis = 0;
+      // Whether other requests were outstanding when this one was sent.
+      bool pipelined = false;
+      // Either `ownRegisters_` or a block from `arena_`, if `id` is nonzero.
+      uint16 *registers = nullptr;
+    };
+
+    RegisterArena *const arena_;
+    WiFiClient tcpClient_;
+
+    // The connection being set up, until lwIP reports back.
+    tcp_pcb *connectPcb_ = nullptr;
+    unsigned long connectStartMillis_ = 0;
+    unsigned long timeoutMillis_ = DEFAULT_TIMEOUT_MILLIS;
+    size_t windowSize_ = MAX_WINDOW_SIZE;
+    uint16 nextTransactionId_ = 1;
+    Stats stats_;
+
+    // Slots for outstanding requests. A slot is free if its ID is 0.
+    Transaction transactions_[MAX_WINDOW_SIZE];
+
+    // The one register buffer that is always available to us.
+    uint16 ownRegisters_[MAX_REGISTERS];
+    bool ownRegistersInUse_ = false;
+
+    // Partially received response frame.
+    uint8 frame_[MAX_FRAME_SIZE];
+    size_t frameSize_ = 0;
+
+    ModbusTcpTransport(ModbusTcpTransport const &) = delete;
+    ModbusTcpTransport &operator=(ModbusTcpTransport const &) = delete;
+
+    static err_t connectedCallback(void *arg, tcp_pcb *pcb, err_t err);
+    static void connectErrorCallback(void *arg, err_t err);
+
+    /**
+     * Gives up on the connection being set up, if any.
+     */
+    void abortConnect();
+
+    Transaction *find(uint16 transactionId);
+    Transaction const *find(uint16 transactionId) const;
+    size_t numPending() const;
+
+    /**
+     * Returns a buffer for a new transaction, or `nullptr` if none is free.
+     */
+    uint16 *acquireRegisters();
+
+    /**
+     * Frees up the slot and its register buffer.
+     */
+    void releaseTransaction(Transaction &transaction);
+
+    /**
+     * Marks the transaction as failed. If it was pipelined, stops pipelining.
+     */
+    void failTransaction(Transaction &transaction);
+
+    /**
+     * Returns the total size of the frame being received, once its header is
+     * complete, or 0 if the header has not been received yet.
+     */
+    size_t expectedFrameSize() const;
+
+    /**
+     * Handles a completely received frame. Returns `false` if the stream
+     * cannot be trusted anymore.
+     */
+    bool handleFrame();
+
+    /**
+     * Fails all outstanding transactions and closes the connection.
+     */
+    void fail();
+};
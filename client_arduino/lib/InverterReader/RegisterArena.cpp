@@ -0,0 +1,31 @@
+#include "RegisterArena.h"
+
+RegisterArena::RegisterArena(size_t numBlocks) :
+  numBlocks_(numBlocks < MAX_BLOCKS ? numBlocks : MAX_BLOCKS)
+{
+  blocks_ = numBlocks_ ? new uint16[numBlocks_ * BLOCK_REGISTERS] : nullptr;
+}
+
+RegisterArena::~RegisterArena() {
+  delete[] blocks_;
+}
+
+uint16 *RegisterArena::acquire() {
+  for (size_t i = 0; i < numBlocks_; i++) {
+    if (!(used_ & (1 << i))) {
+      used_ |= 1 << i;
+      return blocks_ + i * BLOCK_REGISTERS;
+    }
+  }
+  return nullptr;
+}
+
+void RegisterArena::release(uint16 *block) {
+  if (owns(block)) {
+    used_ &= ~(1 << ((block - blocks_) / BLOCK_REGISTERS));
+  }
+}
+
+bool RegisterArena::owns(uint16 const *block) const {
+  return block >= blocks_ && block < blocks_ + numBlocks_ * BLOCK_REGISTERS;
+}
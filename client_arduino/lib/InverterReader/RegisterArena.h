@@ -0,0 +1,44 @@
+#pragma once
+
+#include <Arduino.h>
+
+/**
+ * Fixed-size pool of register buffers, shared between the transports of all
+ * devices. Each transport owns a single buffer, which is enough to make
+ * progress, and borrows from the arena to pipeline further requests. This way
+ * RAM use doesn't grow with (number of devices) × (window size).
+ */
+class RegisterArena {
+  public:
+    // Maximum number of registers in a single Modbus read.
+    static uint16 const BLOCK_REGISTERS = 125;
+    static size_t const MAX_BLOCKS = 8;
+
+    explicit RegisterArena(size_t numBlocks);
+    ~RegisterArena();
+
+    /**
+     * Returns a free block of `BLOCK_REGISTERS` registers, or `nullptr` if
+     * all of them are in use.
+     */
+    uint16 *acquire();
+
+    /**
+     * Returns a block previously handed out by `acquire()` to the pool.
+     */
+    void release(uint16 *block);
+
+    /**
+     * Whether the given pointer is one of our blocks.
+     */
+    bool owns(uint16 const *block) const;
+
+  private:
+    uint16 *blocks_;
+    size_t numBlocks_;
+    // Bit i is set if block i is in use.
+    uint8 used_ = 0;
+
+    RegisterArena(RegisterArena const &) = delete;
+    RegisterArena &operator=(RegisterArena const &) = delete;
+};
@@ -1,77 +1,235 @@
 #include "SunSpecInverterReader.h"
 
-SunSpecInverterReader::SunSpecInverterReader(String const &host, uint16 port) :
+#include "Log.h"
+
+SunSpecInverterReader::SunSpecInverterReader(String const &host, uint16 port, RegisterArena *arena, HostCache *hostCache) :
   host_(host),
   port_(port),
-  tcpClient_(),
-  modbusClient_(tcpClient_),
-  sunSpec_(&modbusClient_)
+  hostCache_(hostCache),
+  transport_(arena),
+  cache_(),
+  sunSpec_(&transport_)
 {
+  sunSpec_.setCache(&cache_);
 }
 
-ErrorCode SunSpecInverterReader::connect() {
-  // TODO if the host is a dotted quad, parse it into an IP address
-  IPAddress ipAddress;
-  if (!WiFi.hostByName(host_.c_str(), ipAddress)) {
-    return MODBUS_DNS_ERROR;
+void SunSpecInverterReader::requestUpdate() {
+  if (state_ != State::IDLE) {
+    return;
   }
-  Serial.print("Resolved ");
-  Serial.print(host_.c_str());
-  Serial.print(" to ");
-  Serial.println(ipAddress);
-
-  if (!modbusClient_.begin(ipAddress, port_)) {
-    Serial.print("Failed to connect to ");
-    Serial.println(ipAddress);
-    return MODBUS_CONNECT_ERROR;
-  }
-
-  sunSpec_.begin();
+  ready_ = false;
 
-  SunSpecModels::Common model = sunSpec_.findModel<SunSpecModels::Common>();
-  if (!model.isValid()) {
-    Serial.println("Failed to parse SunSpec common model");
-    return SUNSPEC_PROTOCOL_ERROR;
+  if (!transport_.connected()) {
+    inverterModelAddress_ = 0;
+    state_ = State::RESOLVING;
+  } else if (inverterModelAddress_) {
+    // Once we know where the inverter model lives, go there directly instead
+    // of walking the entire model list on every poll, and read its header and
+    // contents in one go.
+    sunSpec_.seekAndRead(inverterModelAddress_, inverterModelLength_);
+    state_ = State::SEEKING_INVERTER_MODEL;
+  } else {
+    sunSpec_.restart();
+    state_ = State::SCANNING;
   }
-  Serial.print("Connected to inverter: ");
-  Serial.print(model.manufacturer());
-  Serial.print(" ");
-  Serial.println(model.model());
-
-  return NO_ERROR;
-}
-
-bool SunSpecInverterReader::isConnected() {
-  return modbusClient_.connected();
 }
 
 ErrorCode SunSpecInverterReader::update() {
-  if (!isConnected()) {
-    ErrorCode error = connect();
+  // Keep stepping for as long as that doesn't involve waiting for the
+  // network.
+  State previousState;
+  do {
+    previousState = state_;
+    ErrorCode error = step();
     if (error) {
       return error;
     }
+  } while (state_ != previousState);
+  return NO_ERROR;
+}
+
+ErrorCode SunSpecInverterReader::step() {
+  if (state_ == State::IDLE) {
+    return NO_ERROR;
   }
 
-  sunSpec_.restart();
-  while (sunSpec_.hasCurrentModel()) {
-    // Serial.print("Found model ");
-    // Serial.println(sunSpec.currentModelId());
+  if (state_ == State::RESOLVING) {
+    switch (hostCache_->resolve(host_.c_str(), &ipAddress_)) {
+      case HostCache::Status::DONE:
+      case HostCache::Status::STALE:
+        return connect();
+      case HostCache::Status::FAILED:
+        return fail(MODBUS_DNS_ERROR);
+      default:
+        return NO_ERROR;
+    }
+  }
 
-    if (sunSpec_.currentModelIs<SunSpecModels::InverterSinglePhase>()) {
-      SunSpecModels::InverterSinglePhase model = sunSpec_.currentModelAs<SunSpecModels::InverterSinglePhase>();
-      if (!model.isValid()) {
-        continue;
-      }
-      powerWatts_ = model.watts();
-      totalEnergyWattHours_ = model.wattHours();
+  if (state_ == State::CONNECTING) {
+    transport_.poll();
+    if (transport_.connected()) {
+      sunSpec_.begin();
+      state_ = State::DISCOVERING;
+    } else if (!transport_.connecting()) {
+      LOG_WARNING("inverter", "Failed to connect to %s", ipAddress_.toString().c_str());
+      return fail(MODBUS_CONNECT_ERROR);
     }
-    // TODO add split-phase and three-phase inverters as well as all their FLOAT counterparts
+    return NO_ERROR;
+  }
+
+  SunSpec::Status const status = sunSpec_.poll();
+  if (status == SunSpec::Status::BUSY) {
+    return NO_ERROR;
+  }
+
+  switch (state_) {
+    case State::DISCOVERING:
+      if (status != SunSpec::Status::DONE) {
+        return fail(SUNSPEC_PROTOCOL_ERROR);
+      }
+      if (cache_.aggregatorAddress()) {
+        // The cached common model is only served once the update number
+        // shows that the layout is unchanged.
+        sunSpec_.seekAndRead(cache_.aggregatorAddress(), cache_.aggregatorLength());
+        state_ = State::CHECKING_AGGREGATOR_MODEL;
+      } else {
+        sunSpec_.readCurrentModel();
+        state_ = State::READING_COMMON_MODEL;
+      }
+      break;
+
+    case State::CHECKING_AGGREGATOR_MODEL:
+      if (status != SunSpec::Status::DONE) {
+        return fail(SUNSPEC_PROTOCOL_ERROR);
+      }
+      if (!cache_.updateNumberChecked()) {
+        // It moved; the scan will find it again.
+        cache_.clear();
+      }
+      sunSpec_.restart();
+      state_ = State::RETURNING_TO_COMMON_MODEL;
+      break;
+
+    case State::RETURNING_TO_COMMON_MODEL:
+      if (status != SunSpec::Status::DONE) {
+        return fail(SUNSPEC_PROTOCOL_ERROR);
+      }
+      sunSpec_.readCurrentModel();
+      state_ = State::READING_COMMON_MODEL;
+      break;
 
-    if (!sunSpec_.nextModel()) {
+    case State::READING_COMMON_MODEL: {
+      SunSpecModels::Common model = sunSpec_.currentModelAs<SunSpecModels::Common>();
+      if (status != SunSpec::Status::DONE || !model.isValid()) {
+        LOG_WARNING("inverter", "Failed to parse SunSpec common model");
+        return fail(SUNSPEC_PROTOCOL_ERROR);
+      }
+      LOG_INFO("inverter", "Connected to inverter: %s %s", model.manufacturer().c_str(), model.model().c_str());
+      sunSpec_.nextModel();
+      state_ = State::SCANNING;
       break;
     }
+
+    case State::SEEKING_INVERTER_MODEL:
+      if (status != SunSpec::Status::DONE) {
+        return fail(SUNSPEC_PROTOCOL_ERROR);
+      }
+      if (isSupportedModel()) {
+        if (readInverterModel()) {
+          ready_ = true;
+          state_ = State::IDLE;
+        } else {
+          // The length changed, so the contents were not read along.
+          inverterModelLength_ = sunSpec_.currentModelLength();
+          sunSpec_.readCurrentModel();
+          state_ = State::READING_INVERTER_MODEL;
+        }
+      } else {
+        // The model layout changed under us; scan again.
+        inverterModelAddress_ = 0;
+        sunSpec_.restart();
+        state_ = State::SCANNING;
+      }
+      break;
+
+    case State::SCANNING:
+      if (status != SunSpec::Status::DONE) {
+        return fail(SUNSPEC_PROTOCOL_ERROR);
+      }
+      if (!sunSpec_.hasCurrentModel()) {
+        LOG_WARNING("inverter", "No SunSpec inverter or meter model found");
+        state_ = State::IDLE;
+        return SUNSPEC_PROTOCOL_ERROR;
+      }
+      if (isSupportedModel()) {
+        inverterModelAddress_ = sunSpec_.currentModelAddress();
+        inverterModelLength_ = sunSpec_.currentModelLength();
+        sunSpec_.readCurrentModel();
+        state_ = State::READING_INVERTER_MODEL;
+      } else if (sunSpec_.currentModelIs<SunSpecModels::BasicAggregator>()) {
+        sunSpec_.readCurrentModel();
+        state_ = State::READING_AGGREGATOR_MODEL;
+      } else {
+        sunSpec_.nextModel();
+      }
+      break;
+
+    case State::READING_AGGREGATOR_MODEL:
+      // Reading it was enough to update the cache; we don't need its
+      // contents otherwise.
+      if (status != SunSpec::Status::DONE) {
+        return fail(SUNSPEC_PROTOCOL_ERROR);
+      }
+      sunSpec_.nextModel();
+      state_ = State::SCANNING;
+      break;
+
+    case State::READING_INVERTER_MODEL:
+      if (status != SunSpec::Status::DONE || !readInverterModel()) {
+        return fail(SUNSPEC_PROTOCOL_ERROR);
+      }
+      ready_ = true;
+      state_ = State::IDLE;
+      break;
+
+    case State::IDLE:
+    case State::RESOLVING:
+    case State::CONNECTING:
+      break;
   }
+  return NO_ERROR;
+}
 
+ErrorCode SunSpecInverterReader::connect() {
+  if (!transport_.connect(ipAddress_, port_)) {
+    LOG_WARNING("inverter", "Failed to connect to %s", ipAddress_.toString().c_str());
+    return fail(MODBUS_CONNECT_ERROR);
+  }
+  state_ = State::CONNECTING;
   return NO_ERROR;
 }
+
+bool SunSpecInverterReader::isSupportedModel() {
+  uint16 const id = sunSpec_.currentModelId();
+  return InverterModels::contains(id) || MeterModels::contains(id);
+}
+
+bool SunSpecInverterReader::readInverterModel() {
+  // All inverter models have the same points with the same names, so a single
+  // generic lambda can handle each of them. Same for meter models.
+  return sunSpec_.visit(InverterModels(), [this](auto const &model) {
+    powerWatts_ = model.watts();
+    totalEnergyWattHours_ = model.wattHours();
+  }) || sunSpec_.visit(MeterModels(), [this](auto const &model) {
+    // Meters count power flowing towards the grid as negative.
+    powerWatts_ = -model.watts();
+    totalEnergyWattHours_ = model.totalWattHoursExported();
+  });
+}
+
+ErrorCode SunSpecInverterReader::fail(ErrorCode error) {
+  transport_.stop();
+  inverterModelAddress_ = 0;
+  state_ = State::IDLE;
+  return error;
+}
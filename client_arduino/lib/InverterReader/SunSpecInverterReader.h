@@ -1,29 +1,113 @@
 #pragma once
 
 #include "errors.h"
+#include "HostCache.h"
 #include "InverterReader.h"
+#include "ModbusTcpTransport.h"
 
-#include <ArduinoModbus.h>
 #include <ArduinoSunSpec.h>
 #include <ESP8266WiFi.h>
 
 /**
- * InverterReaderImpl for inverters supporting the SunSpec TCP protocol.
+ * InverterReaderImpl for inverters and meters supporting the SunSpec TCP
+ * protocol. Meters (e.g. a production meter in the PV circuit) are read like
+ * inverters: energy leaving the PV side counts as produced.
+ *
+ * Each read is a state machine that is advanced by `update()`: resolve the
+ * host name, connect, discover the SunSpec models, and finally read the
+ * inverter model. Once connected, only the last step is repeated.
+ *
+ * Models that rarely change, like the common model, are cached across
+ * reconnects. If the device has an aggregator model, it is read during the
+ * scan so that its update number can invalidate the cache. On reconnect, it is
+ * read again before the common model, so that a stale one is never served.
  */
 class SunSpecInverterReader : public InverterReaderImpl {
   public:
-    SunSpecInverterReader(String const &host, uint16 port);
+    /**
+     * Register buffers for pipelined requests are borrowed from `arena`, and
+     * host names are resolved through `hostCache`; both may be shared with
+     * other readers.
+     */
+    SunSpecInverterReader(String const &host, uint16 port, RegisterArena *arena, HostCache *hostCache);
 
+    void requestUpdate() override;
     ErrorCode update() override;
+    ModbusTcpTransport::Stats modbusStats() const override { return transport_.stats(); }
 
   private:
+    enum class State {
+      IDLE,
+      RESOLVING,
+      CONNECTING,
+      DISCOVERING,
+      CHECKING_AGGREGATOR_MODEL,
+      RETURNING_TO_COMMON_MODEL,
+      READING_COMMON_MODEL,
+      SEEKING_INVERTER_MODEL,
+      SCANNING,
+      READING_AGGREGATOR_MODEL,
+      READING_INVERTER_MODEL,
+    };
+
+    using InverterModels = SunSpecModelList<
+      SunSpecModels::InverterSinglePhase,
+      SunSpecModels::InverterSplitPhase,
+      SunSpecModels::InverterThreePhase,
+      SunSpecModels::InverterSinglePhaseFLOAT,
+      SunSpecModels::InverterSplitPhaseFLOAT,
+      SunSpecModels::InverterThreePhaseFLOAT>;
+
+    using MeterModels = SunSpecModelList<
+      SunSpecModels::MeterSinglePhaseSinglePhaseANOrABMeter,
+      SunSpecModels::SplitSinglePhaseABNMeter_202,
+      SunSpecModels::WyeConnectThreePhaseAbcnMeter_203,
+      SunSpecModels::DeltaConnectThreePhaseAbcMeter_204,
+      SunSpecModels::SinglePhaseANOrABMeter,
+      SunSpecModels::SplitSinglePhaseABNMeter_212,
+      SunSpecModels::WyeConnectThreePhaseAbcnMeter_213,
+      SunSpecModels::DeltaConnectThreePhaseAbcMeter_214>;
+
     String host_;
     uint16 port_;
 
-    WiFiClient tcpClient_;
-    ModbusTCPClient modbusClient_;
+    HostCache *const hostCache_;
+    IPAddress ipAddress_;
+    ModbusTcpTransport transport_;
+    SunSpecCache cache_;
     SunSpec sunSpec_;
 
-    bool isConnected();
+    State state_ = State::IDLE;
+
+    // Address of the inverter or meter model found during the last scan, or 0
+    // if not yet known.
+    uint16 inverterModelAddress_ = 0;
+    uint16 inverterModelLength_ = 0;
+
+    /**
+     * Advances the current state. Returns an error if the read must be
+     * abandoned.
+     */
+    ErrorCode step();
+
+    /**
+     * Starts connecting to `ipAddress_`.
+     */
     ErrorCode connect();
+
+    /**
+     * Whether the current model is one we can read power and energy from.
+     */
+    bool isSupportedModel();
+
+    /**
+     * Reads power and energy from the current model, which must be one of
+     * `InverterModels` or `MeterModels` and have been read completely.
+     */
+    bool readInverterModel();
+
+    /**
+     * Abandons the read in progress and closes the connection.
+     */
+    ErrorCode fail(ErrorCode error);
 };
@@ -0,0 +1,113 @@
+#include "LatencyTrace.h"
+
+#include "JsonWriter.h"
+
+void LatencyTrace::begin(unsigned long firstByteMillis) {
+  marked_ = 0;
+  mark(Stage::FIRST_BYTE, firstByteMillis);
+}
+
+void LatencyTrace::mark(Stage stage, unsigned long nowMillis) {
+  millis_[static_cast<size_t>(stage)] = nowMillis;
+  marked_ |= 1u << static_cast<size_t>(stage);
+}
+
+bool LatencyTrace::span(size_t i, uint32 *millis) const {
+  Stage const from = static_cast<Stage>(i);
+  Stage const to = static_cast<Stage>(i + 1);
+  if (i >= NUM_SPANS || !has(from) || !has(to)) {
+    return false;
+  }
+  *millis = at(to) - at(from);
+  return true;
+}
+
+bool LatencyTrace::total(uint32 *millis) const {
+  if (!has(Stage::FIRST_BYTE) || !has(Stage::STATUS_RECEIVED)) {
+    return false;
+  }
+  *millis = at(Stage::STATUS_RECEIVED) - at(Stage::FIRST_BYTE);
+  return true;
+}
+
+uint64_t LatencyTrace::captureEpochMillis(uint64_t nowEpochMillis, unsigned long nowMillis) const {
+  return nowEpochMillis - (nowMillis - at(Stage::FIRST_BYTE));
+}
+
+void LatencyTrace::writeSpans(Print &out) const {
+  JsonWriter writer(out);
+  bool first = true;
+  for (size_t i = 0; i < NUM_SPANS; i++) {
+    uint32 millis;
+    if (!span(i, &millis)) {
+      continue;
+    }
+    if (!first) {
+      writer.write(",");
+    }
+    first = false;
+    writer.write(spanName(i));
+    writer.write("=");
+    writer.writeUnsigned(millis);
+  }
+}
+
+char const *LatencyTrace::spanName(size_t i) {
+  switch (i) {
+    // From the first to the last byte of the telegram.
+    case 0: return "read";
+    // Parsing and deciding whether to upload.
+    case 1: return "queue";
+    case 2: return "resolve";
+    case 3: return "connect";
+    case 4: return "send";
+    // Until the server's status line.
+    case 5: return "response";
+  }
+  return "unknown";
+}
+
+void LatencyStats::add(LatencyTrace const &trace) {
+  for (size_t i = 0; i < LatencyTrace::NUM_SPANS; i++) {
+    uint32 millis;
+    if (trace.span(i, &millis)) {
+      addValue(i, millis);
+    }
+  }
+  uint32 millis;
+  if (trace.total(&millis)) {
+    addValue(TOTAL, millis);
+  }
+}
+
+bool LatencyStats::percentile(size_t series, uint8 percent, uint32 *millis) const {
+  size_t const count = counts_[series];
+  if (count == 0) {
+    return false;
+  }
+  // Insertion sort; the window is small.
+  uint16 sorted[WINDOW];
+  for (size_t i = 0; i < count; i++) {
+    uint16 const value = values_[series][i];
+    size_t j = i;
+    for (; j > 0 && sorted[j - 1] > value; j--) {
+      sorted[j] = sorted[j - 1];
+    }
+    sorted[j] = value;
+  }
+  size_t const rank = (percent * count + 99) / 100;
+  *millis = sorted[rank > 0 ? rank - 1 : 0];
+  return true;
+}
+
+char const *LatencyStats::seriesName(size_t series) {
+  return series == TOTAL ? "total" : LatencyTrace::spanName(series);
+}
+
+void LatencyStats::addValue(size_t series, uint32 millis) {
+  values_[series][next_[series]] = millis > 0xffff ? 0xffff : millis;
+  next_[series] = (next_[series] + 1) % WINDOW;
+  if (counts_[series] < WINDOW) {
+    counts_[series]++;
+  }
+}
@@ -0,0 +1,105 @@
+#pragma once
+
+#include <Arduino.h>
+
+/**
+ * The times at which a telegram passed each stage on its way from the P1 port
+ * to the server, in `millis()`. A span is the time between two consecutive
+ * stages; the spans say which stage dominates the latency of an upload.
+ *
+ * The TLS client connects and does the handshake in a single call, so TCP
+ * connect and TLS handshake make up a single span.
+ */
+class LatencyTrace {
+  public:
+    enum class Stage {
+      FIRST_BYTE,
+      LAST_BYTE,
+      UPLOAD_START,
+      RESOLVED,
+      // TCP connected and TLS established.
+      CONNECTED,
+      REQUEST_SENT,
+      STATUS_RECEIVED,
+    };
+    static size_t const NUM_STAGES = 7;
+    // Span `i` runs from stage `i` to stage `i + 1`.
+    static size_t const NUM_SPANS = NUM_STAGES - 1;
+
+    /**
+     * Starts a new trace at the first byte of a telegram, forgetting the
+     * stages of the previous one.
+     */
+    void begin(unsigned long firstByteMillis);
+
+    void mark(Stage stage, unsigned long nowMillis);
+
+    bool has(Stage stage) const { return marked_ & (1u << static_cast<size_t>(stage)); }
+    unsigned long at(Stage stage) const { return millis_[static_cast<size_t>(stage)]; }
+
+    /**
+     * Returns the duration of span `i` through `millis`, if both of its stages
+     * have been marked.
+     */
+    bool span(size_t i, uint32 *millis) const;
+
+    /**
+     * Returns the time from the first byte until the server's status code, if
+     * the upload got that far.
+     */
+    bool total(uint32 *millis) const;
+
+    /**
+     * Returns the wall-clock time of the first byte, in milliseconds since
+     * the epoch, given the current time in both clocks.
+     */
+    uint64_t captureEpochMillis(uint64_t nowEpochMillis, unsigned long nowMillis) const;
+
+    /**
+     * Writes the spans that are known as `read=850,queue=12`, in order, for
+     * use in an HTTP header. Writes nothing if none are known.
+     */
+    void writeSpans(Print &out) const;
+
+    static char const *spanName(size_t i);
+
+  private:
+    unsigned long millis_[NUM_STAGES] = {};
+    uint8 marked_ = 0;
+};
+
+/**
+ * Percentiles of the spans of the latest `WINDOW` traces, and of their total.
+ * Each series keeps its own window, because failed uploads only have some of
+ * the spans. Durations are kept in 16 bits, so anything above a minute is
+ * counted as 65535 ms.
+ */
+class LatencyStats {
+  public:
+    static size_t const WINDOW = 32;
+    // The spans, then the total.
+    static size_t const NUM_SERIES = LatencyTrace::NUM_SPANS + 1;
+    static size_t const TOTAL = LatencyTrace::NUM_SPANS;
+
+    /**
+     * Adds the spans of the trace that are known.
+     */
+    void add(LatencyTrace const &trace);
+
+    size_t count(size_t series) const { return counts_[series]; }
+
+    /**
+     * Returns the nearest-rank `percent`th percentile of the series through
+     * `millis`, if it has any values.
+     */
+    bool percentile(size_t series, uint8 percent, uint32 *millis) const;
+
+    static char const *seriesName(size_t series);
+
+  private:
+    uint16 values_[NUM_SERIES][WINDOW] = {};
+    uint8 counts_[NUM_SERIES] = {};
+    uint8 next_[NUM_SERIES] = {};
+
+    void addValue(size_t series, uint32 millis);
+};
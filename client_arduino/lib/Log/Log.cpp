@@ -0,0 +1,118 @@
+#include "Log.h"
+
+#include <stdarg.h>
+#include <stdio.h>
+
+void LogBuffer::append(char const *line, size_t length, bool truncated) {
+  // Make room by dropping whole lines, so that the buffer always starts at
+  // the beginning of one.
+  while (end_ + length - start_ > SIZE) {
+    uint32 lineEnd = start_;
+    while (lineEnd != end_ && buffer_[lineEnd++ % SIZE] != '\n') {
+    }
+    if (drained_ < lineEnd) {
+      stats_.dropped++;
+      drained_ = lineEnd;
+    }
+    start_ = lineEnd;
+  }
+  for (size_t i = 0; i < length; i++) {
+    buffer_[(end_ + i) % SIZE] = line[i];
+  }
+  end_ += length;
+  stats_.lines++;
+  if (truncated) {
+    stats_.truncated++;
+  }
+}
+
+size_t LogBuffer::drain(Print &out, size_t maxBytes) {
+  size_t const length = numUndrained() < maxBytes ? numUndrained() : maxBytes;
+  writeRange(out, drained_, drained_ + length);
+  drained_ += length;
+  return length;
+}
+
+void LogBuffer::write(Print &out) const {
+  writeRange(out, start_, end_);
+}
+
+void LogBuffer::writeRange(Print &out, uint32 from, uint32 to) const {
+  size_t const offset = from % SIZE;
+  size_t const length = to - from;
+  size_t const firstRun = SIZE - offset < length ? SIZE - offset : length;
+  out.write(reinterpret_cast<uint8_t const *>(buffer_ + offset), firstRun);
+  if (firstRun < length) {
+    out.write(reinterpret_cast<uint8_t const *>(buffer_), length - firstRun);
+  }
+}
+
+namespace {
+
+LogBuffer logBuffer;
+
+#ifndef ARDUINO_ARCH_ESP8266
+/**
+ * Natively, `Serial` is not a `Print`.
+ */
+class NativeSerialPrint : public Print {
+  public:
+    size_t write(uint8_t c) override {
+      Serial.print(static_cast<char>(c));
+      return 1;
+    }
+};
+#endif
+
+}
+
+namespace Log {
+
+void write(uint8 level, PGM_P tag, PGM_P format, ...) {
+  char line[MAX_LINE];
+  unsigned long const now = millis();
+  size_t length = snprintf_P(line, sizeof(line), PSTR("%lu.%03lu %c "),
+      now / 1000, now % 1000, level >= LOG_LEVEL_DEBUG && level <= LOG_LEVEL_ERROR ? "DIWE"[level - LOG_LEVEL_DEBUG] : '?');
+
+  size_t const tagLength = strlen_P(tag);
+  if (length + tagLength + 2 < sizeof(line) / 2) {
+    memcpy_P(line + length, tag, tagLength);
+    length += tagLength;
+    line[length++] = ':';
+    line[length++] = ' ';
+  }
+
+  // The newline replaces the terminating null.
+  va_list args;
+  va_start(args, format);
+  int const messageLength = vsnprintf_P(line + length, sizeof(line) - length, format, args);
+  va_end(args);
+  bool const truncated = messageLength < 0 || length + messageLength > sizeof(line) - 1;
+  if (truncated) {
+    length = sizeof(line) - 1;
+    memcpy(line + length - 3, "...", 3);
+  } else {
+    length += messageLength;
+  }
+  line[length++] = '\n';
+
+  logBuffer.append(line, length, truncated);
+}
+
+LogBuffer &buffer() {
+  return logBuffer;
+}
+
+void drainToSerial() {
+#ifdef ARDUINO_ARCH_ESP8266
+  int const available = Serial.availableForWrite();
+  if (available > 0) {
+    logBuffer.drain(Serial, available);
+  }
+#else
+  NativeSerialPrint out;
+  logBuffer.drain(out, logBuffer.numUndrained());
+#endif
+}
+
+}
@@ -0,0 +1,129 @@
+#pragma once
+
+#include <Arduino.h>
+
+// Levels for LOG_LEVEL, which sets the lowest level that is compiled in. They
+// start at 1, so that an empty LOG_LEVEL, as passed by an unset environment
+// variable, means the default.
+#define LOG_LEVEL_DEBUG 1
+#define LOG_LEVEL_INFO 2
+#define LOG_LEVEL_WARNING 3
+#define LOG_LEVEL_ERROR 4
+#define LOG_LEVEL_NONE 5
+
+#if !defined(LOG_LEVEL) || (LOG_LEVEL + 0) == 0
+#  undef LOG_LEVEL
+#  define LOG_LEVEL LOG_LEVEL_INFO
+#endif
+
+/**
+ * Appends a line to the log, with a printf-style `format`. The tag says where
+ * it comes from, such as "p1" or "upload". Both must be string literals, and
+ * are kept in flash. Messages below LOG_LEVEL compile to nothing, arguments
+ * included, so those must not have side effects.
+ *
+ *   LOG_INFO("p1", "Received telegram of %u bytes", size);
+ */
+#define LOG_AT(level, tag, format, ...) \
+  Log::write((level), PSTR(tag), PSTR(format), ##__VA_ARGS__)
+
+#if LOG_LEVEL <= LOG_LEVEL_DEBUG
+#  define LOG_DEBUG(tag, format, ...) LOG_AT(LOG_LEVEL_DEBUG, tag, format, ##__VA_ARGS__)
+#else
+#  define LOG_DEBUG(tag, format, ...) do {} while (0)
+#endif
+#if LOG_LEVEL <= LOG_LEVEL_INFO
+#  define LOG_INFO(tag, format, ...) LOG_AT(LOG_LEVEL_INFO, tag, format, ##__VA_ARGS__)
+#else
+#  define LOG_INFO(tag, format, ...) do {} while (0)
+#endif
+#if LOG_LEVEL <= LOG_LEVEL_WARNING
+#  define LOG_WARNING(tag, format, ...) LOG_AT(LOG_LEVEL_WARNING, tag, format, ##__VA_ARGS__)
+#else
+#  define LOG_WARNING(tag, format, ...) do {} while (0)
+#endif
+#if LOG_LEVEL <= LOG_LEVEL_ERROR
+#  define LOG_ERROR(tag, format, ...) LOG_AT(LOG_LEVEL_ERROR, tag, format, ##__VA_ARGS__)
+#else
+#  define LOG_ERROR(tag, format, ...) do {} while (0)
+#endif
+
+/**
+ * A ring buffer of log lines. Appending never blocks: when the buffer is
+ * full, the oldest lines make way, whether or not they have been drained to
+ * the serial port yet. What is left can be read in full at any time, for
+ * /log.
+ */
+class LogBuffer {
+  public:
+    static size_t const SIZE = 2048;
+
+    struct Stats {
+      uint32 lines = 0;
+      // Lines that were overwritten before they were drained.
+      uint32 dropped = 0;
+      // Lines that were cut off at `Log::MAX_LINE`.
+      uint32 truncated = 0;
+    };
+
+    /**
+     * Appends a line, which must end in a newline and be at most `SIZE`
+     * bytes long. `truncated` says whether it had to be cut off, for the
+     * statistics.
+     */
+    void append(char const *line, size_t length, bool truncated = false);
+
+    /**
+     * Writes at most `maxBytes` of what has not been drained yet. Pass what
+     * the output can take without blocking, such as
+     * `Serial.availableForWrite()`. Returns the number of bytes written.
+     */
+    size_t drain(Print &out, size_t maxBytes);
+
+    size_t numUndrained() const { return end_ - drained_; }
+
+    /**
+     * Writes all lines in the buffer, oldest first. Writes exactly `size()`
+     * bytes, as long as nothing is appended in the meantime.
+     */
+    void write(Print &out) const;
+
+    size_t size() const { return end_ - start_; }
+
+    Stats const &stats() const { return stats_; }
+
+  private:
+    char buffer_[SIZE];
+    // Positions in the stream of everything ever appended, which index the
+    // buffer modulo `SIZE`. `start_` is the oldest byte still present.
+    uint32 start_ = 0;
+    uint32 drained_ = 0;
+    uint32 end_ = 0;
+    Stats stats_;
+
+    /**
+     * Writes the bytes from `from` up to `to` to `out`, in at most two runs.
+     */
+    void writeRange(Print &out, uint32 from, uint32 to) const;
+};
+
+namespace Log {
+
+// Longer lines are cut off, and end in "...".
+static size_t const MAX_LINE = 160;
+
+/**
+ * Formats a line as `12.345 I tag: message`, with the time since startup,
+ * and appends it to the buffer. Use the LOG_* macros instead.
+ */
+void write(uint8 level, PGM_P tag, PGM_P format, ...) __attribute__((format(printf, 3, 4)));
+
+LogBuffer &buffer();
+
+/**
+ * Drains the buffer to the serial port, as far as it can take without
+ * blocking.
+ */
+void drainToSerial();
+
+}
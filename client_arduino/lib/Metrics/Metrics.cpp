@@ -0,0 +1,116 @@
+#include "Metrics.h"
+
+void Histogram::observe(uint32 value) {
+  for (size_t i = 0; i < numBounds_; i++) {
+    if (value <= bounds_[i]) {
+      counts_[i]++;
+      break;
+    }
+  }
+  count_++;
+  sum_ += value;
+}
+
+void PrometheusWriter::family(char const *name, char const *type, char const *help) {
+  out_.write("# HELP ");
+  out_.write(name);
+  out_.write(" ");
+  out_.write(help);
+  out_.write("\n# TYPE ");
+  out_.write(name);
+  out_.write(" ");
+  out_.write(type);
+  out_.write("\n");
+}
+
+void PrometheusWriter::sample(char const *name, uint64_t value) {
+  out_.write(name);
+  endSample(value);
+}
+
+void PrometheusWriter::sample(char const *name, char const *label, char const *labelValue, uint64_t value) {
+  out_.write(name);
+  out_.write("{");
+  out_.write(label);
+  out_.write("=\"");
+  out_.write(labelValue);
+  out_.write("\"}");
+  endSample(value);
+}
+
+void PrometheusWriter::sample(char const *name, char const *label, uint64_t labelValue, uint64_t value) {
+  out_.write(name);
+  out_.write("{");
+  out_.write(label);
+  out_.write("=\"");
+  out_.writeUnsigned(labelValue);
+  out_.write("\"}");
+  endSample(value);
+}
+
+void PrometheusWriter::sampleNumber(char const *name, double value) {
+  out_.write(name);
+  endSampleNumber(value);
+}
+
+void PrometheusWriter::sampleNumber(char const *name, char const *label, char const *labelValue, double value) {
+  out_.write(name);
+  out_.write("{");
+  out_.write(label);
+  out_.write("=\"");
+  out_.write(labelValue);
+  out_.write("\"}");
+  endSampleNumber(value);
+}
+
+void PrometheusWriter::endSampleNumber(double value) {
+  out_.write(" ");
+  if (std::isfinite(value)) {
+    out_.writeNumber(value);
+  } else {
+    out_.write("NaN");
+  }
+  out_.write("\n");
+}
+
+void PrometheusWriter::quantile(char const *name, char const *label, char const *labelValue, double quantile, double value) {
+  out_.write(name);
+  out_.write("{");
+  out_.write(label);
+  out_.write("=\"");
+  out_.write(labelValue);
+  out_.write("\",quantile=\"");
+  out_.writeNumber(quantile, 2);
+  out_.write("\"} ");
+  out_.writeNumber(value);
+  out_.write("\n");
+}
+
+void PrometheusWriter::histogram(char const *name, char const *help, Histogram const &histogram, double scale, int decimals) {
+  family(name, "histogram", help);
+  uint64_t cumulative = 0;
+  for (size_t i = 0; i < histogram.numBounds(); i++) {
+    cumulative += histogram.bucketCount(i);
+    out_.write(name);
+    out_.write("_bucket{le=\"");
+    out_.writeNumber(histogram.bound(i) * scale, decimals);
+    out_.write("\"}");
+    endSample(cumulative);
+  }
+  out_.write(name);
+  out_.write("_bucket{le=\"+Inf\"}");
+  endSample(histogram.count());
+  out_.write(name);
+  out_.write("_sum ");
+  out_.writeNumber(histogram.sum() * scale, decimals);
+  out_.write("\n");
+  out_.write(name);
+  out_.write("_count");
+  endSample(histogram.count());
+}
+
+void PrometheusWriter::endSample(uint64_t value) {
+  out_.write(" ");
+  out_.writeUnsigned(value);
+  out_.write("\n");
+}
@@ -0,0 +1,93 @@
+#pragma once
+
+#include <Arduino.h>
+
+#include "JsonWriter.h"
+
+/**
+ * Counts observations into buckets with fixed upper bounds, for exposition as
+ * a Prometheus histogram. Observing is a few comparisons and increments, so
+ * it can be done on every loop iteration.
+ */
+class Histogram {
+  public:
+    static size_t const MAX_BOUNDS = 12;
+
+    /**
+     * `bounds` are the inclusive upper bounds of the buckets, in increasing
+     * order, and must outlive the histogram. Values above the last bound only
+     * count towards the implicit +Inf bucket.
+     */
+    template<size_t N>
+    explicit Histogram(uint32 const (&bounds)[N]) :
+      bounds_(bounds),
+      numBounds_(N)
+    {
+      static_assert(N <= MAX_BOUNDS, "Too many buckets");
+    }
+
+    void observe(uint32 value);
+
+    size_t numBounds() const { return numBounds_; }
+    uint32 bound(size_t i) const { return bounds_[i]; }
+    // Observations of at most `bound(i)`, excluding those in lower buckets.
+    uint32 bucketCount(size_t i) const { return counts_[i]; }
+    uint32 count() const { return count_; }
+    uint64_t sum() const { return sum_; }
+
+  private:
+    uint32 const *bounds_;
+    size_t numBounds_;
+    uint32 counts_[MAX_BOUNDS] = {};
+    uint32 count_ = 0;
+    uint64_t sum_ = 0;
+};
+
+/**
+ * Writes metrics in the Prometheus text exposition format, straight to a
+ * `Print`, without allocating. Names and label values are taken as they are,
+ * so they must not need escaping.
+ *
+ *   writer.family("prikmeter_uploads_total", "counter", "Uploads attempted.");
+ *   writer.sample("prikmeter_uploads_total", "reason", "heartbeat", 12);
+ */
+class PrometheusWriter {
+  public:
+    explicit PrometheusWriter(Print &out) : out_(out) {}
+
+    size_t written() const { return out_.written(); }
+
+    /**
+     * Writes the HELP and TYPE lines that precede the samples of a metric.
+     */
+    void family(char const *name, char const *type, char const *help);
+
+    void sample(char const *name, uint64_t value);
+    void sample(char const *name, char const *label, char const *labelValue, uint64_t value);
+    void sample(char const *name, char const *label, uint64_t labelValue, uint64_t value);
+
+    /**
+     * Writes a number with 3 decimals, or NaN.
+     */
+    void sampleNumber(char const *name, double value);
+    void sampleNumber(char const *name, char const *label, char const *labelValue, double value);
+
+    /**
+     * Writes a quantile of a summary, with a number with 3 decimals, such as
+     * `name{label="value",quantile="0.9"} 0.431`.
+     */
+    void quantile(char const *name, char const *label, char const *labelValue, double quantile, double value);
+
+    /**
+     * Writes the family and samples of a histogram. Bounds and sum are
+     * multiplied by `scale`, to convert them to the base unit, such as
+     * seconds, and written with the given number of decimals.
+     */
+    void histogram(char const *name, char const *help, Histogram const &histogram, double scale, int decimals = 3);
+
+  private:
+    JsonWriter out_;
+
+    void endSample(uint64_t value);
+    void endSampleNumber(double value);
+};
@@ -0,0 +1,32 @@
+#include "Arduino.h"
+
+NativeSerial Serial;
+
+namespace {
+
+unsigned long currentMillis = 0;
+
+}
+
+namespace NativeArduino {
+
+void setMillis(unsigned long millis) {
+  currentMillis = millis;
+}
+
+void advanceMillis(unsigned long millis) {
+  currentMillis += millis;
+}
+
+}
+
+unsigned long millis() {
+  return currentMillis;
+}
+
+void delay(unsigned long ms) {
+  currentMillis += ms;
+}
+
+void yield() {
+}
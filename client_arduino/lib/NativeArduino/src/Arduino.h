@@ -0,0 +1,112 @@
+#pragma once
+
+// Just enough of the Arduino (ESP8266) API to build our platform-independent
+// libraries for the native environment, so they can be tested and benchmarked
+// on the host. Time is simulated: it only advances when a test says so.
+
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <iostream>
+#include <string>
+
+typedef uint8_t uint8;
+typedef uint16_t uint16;
+typedef uint32_t uint32;
+typedef int8_t sint8;
+typedef int16_t sint16;
+typedef int32_t sint32;
+typedef uint8_t byte;
+typedef uint16_t word;
+
+// There is no separate flash address space on the host.
+#define PROGMEM
+#define PGM_P char const *
+#define PSTR(s) (s)
+#define pgm_read_byte(addr) (*reinterpret_cast<uint8_t const *>(addr))
+#define memcpy_P memcpy
+#define strlen_P strlen
+#define strcmp_P strcmp
+#define snprintf_P snprintf
+#define vsnprintf_P vsnprintf
+
+class String : public std::string {
+  public:
+    String() {}
+    String(char const *s) : std::string(s) {}
+    String(std::string const &s) : std::string(s) {}
+
+    unsigned int length() const { return size(); }
+    String &operator+=(char c) { push_back(c); return *this; }
+};
+
+/**
+ * Output stream, which subclasses implement byte by byte.
+ */
+class Print {
+  public:
+    virtual ~Print() {}
+
+    virtual size_t write(uint8_t c) = 0;
+
+    virtual size_t write(uint8_t const *buffer, size_t size) {
+      size_t written = 0;
+      while (size--) {
+        written += write(*buffer++);
+      }
+      return written;
+    }
+
+    size_t write(char const *buffer, size_t size) {
+      return write(reinterpret_cast<uint8_t const *>(buffer), size);
+    }
+};
+
+/**
+ * Prints to standard output, unless muted, which benchmarks will want.
+ */
+class NativeSerial {
+  public:
+    void begin(unsigned long) {}
+    void setMuted(bool muted) { muted_ = muted; }
+
+    template<typename T>
+    void print(T const &value) {
+      if (!muted_) {
+        std::cout << value;
+      }
+    }
+
+    template<typename T>
+    void println(T const &value) {
+      print(value);
+      println();
+    }
+
+    void println() {
+      if (!muted_) {
+        std::cout << std::endl;
+      }
+    }
+
+  private:
+    bool muted_ = false;
+};
+
+extern NativeSerial Serial;
+
+namespace NativeArduino {
+
+/**
+ * Sets or advances the simulated time returned by `millis()`.
+ */
+void setMillis(unsigned long millis);
+void advanceMillis(unsigned long millis);
+
+}
+
+unsigned long millis();
+void delay(unsigned long ms);
+void yield();
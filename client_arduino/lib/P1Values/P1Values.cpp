@@ -0,0 +1,210 @@
+#include "P1Values.h"
+
+#include "Profiler.h"
+
+namespace {
+
+enum class Field {
+  IMPORT_POWER,
+  EXPORT_POWER,
+  PHASE_IMPORT_POWER,
+  PHASE_EXPORT_POWER,
+  IMPORT_ENERGY,
+  EXPORT_ENERGY,
+  GAS,
+};
+
+struct ObisField {
+  // The medium and channel before the colon; a trailing '*' matches any
+  // channel.
+  char const *prefix;
+  // The part of the code after the colon.
+  char const *code;
+  Field field;
+  // Phase or tariff.
+  size_t index;
+};
+
+ObisField const FIELDS[] = {
+  {"1-0", "1.7.0", Field::IMPORT_POWER, 0},
+  {"1-0", "2.7.0", Field::EXPORT_POWER, 0},
+  {"1-0", "21.7.0", Field::PHASE_IMPORT_POWER, 0},
+  {"1-0", "41.7.0", Field::PHASE_IMPORT_POWER, 1},
+  {"1-0", "61.7.0", Field::PHASE_IMPORT_POWER, 2},
+  {"1-0", "22.7.0", Field::PHASE_EXPORT_POWER, 0},
+  {"1-0", "42.7.0", Field::PHASE_EXPORT_POWER, 1},
+  {"1-0", "62.7.0", Field::PHASE_EXPORT_POWER, 2},
+  {"1-0", "1.8.1", Field::IMPORT_ENERGY, 0},
+  {"1-0", "1.8.2", Field::IMPORT_ENERGY, 1},
+  {"1-0", "2.8.1", Field::EXPORT_ENERGY, 0},
+  {"1-0", "2.8.2", Field::EXPORT_ENERGY, 1},
+  {"0-*", "24.2.1", Field::GAS, 0},
+  {"0-*", "24.2.3", Field::GAS, 0},
+};
+
+bool matches(char const *pattern, char const *text, size_t length) {
+  size_t const patternLength = strlen(pattern);
+  if (pattern[patternLength - 1] == '*') {
+    return length >= patternLength - 1 && memcmp(pattern, text, patternLength - 1) == 0;
+  }
+  return length == patternLength && memcmp(pattern, text, length) == 0;
+}
+
+/**
+ * A value like "01.234*kW", split into its digits and its unit.
+ */
+struct Decimal {
+  uint32 mantissa = 0;
+  uint8 decimals = 0;
+  char const *unit = nullptr;
+  size_t unitLength = 0;
+
+  bool hasUnit(char const *expected) const {
+    return unitLength == strlen(expected) && memcmp(unit, expected, unitLength) == 0;
+  }
+
+  /**
+   * Returns the value times 10^`exponent`, or `NO_COUNTER` if it doesn't fit.
+   */
+  uint32 scaled(uint8 exponent) const {
+    uint64_t value = mantissa;
+    for (uint8 i = decimals; i < exponent; i++) {
+      value *= 10;
+    }
+    for (uint8 i = exponent; i < decimals; i++) {
+      value /= 10;
+    }
+    return value < P1Values::NO_COUNTER ? value : P1Values::NO_COUNTER;
+  }
+};
+
+/**
+ * Parses the value between the parentheses. We parse by hand rather than with
+ * strtod(), because the value isn't terminated and we want exactly the DSMR
+ * format: digits, optionally a point and more digits, an asterisk and a unit.
+ */
+bool parseDecimal(char const *begin, char const *end, Decimal *decimal) {
+  bool seenDigit = false;
+  bool seenPoint = false;
+  char const *p = begin;
+  for (; p < end && *p != '*'; p++) {
+    if (*p == '.' && !seenPoint) {
+      seenPoint = true;
+    } else if (isdigit(*p) && decimal->mantissa <= (0xffffffffu - 9) / 10) {
+      decimal->mantissa = decimal->mantissa * 10 + (*p - '0');
+      seenDigit = true;
+      if (seenPoint) {
+        decimal->decimals++;
+      }
+    } else {
+      return false;
+    }
+  }
+  if (!seenDigit || p == end) {
+    return false;
+  }
+  decimal->unit = p + 1;
+  decimal->unitLength = end - decimal->unit;
+  return true;
+}
+
+double watts(Decimal const &decimal) {
+  double value = decimal.mantissa;
+  for (uint8 i = 0; i < decimal.decimals; i++) {
+    value /= 10;
+  }
+  if (decimal.hasUnit("kW")) {
+    return value * 1000;
+  }
+  if (decimal.hasUnit("W")) {
+    return value;
+  }
+  return NAN;
+}
+
+uint32 wattHours(Decimal const &decimal) {
+  if (decimal.hasUnit("kWh")) {
+    return decimal.scaled(3);
+  }
+  if (decimal.hasUnit("Wh")) {
+    return decimal.scaled(0);
+  }
+  return P1Values::NO_COUNTER;
+}
+
+uint32 litres(Decimal const &decimal) {
+  return decimal.hasUnit("m3") ? decimal.scaled(3) : P1Values::NO_COUNTER;
+}
+
+}
+
+bool P1Values::parse(byte const *telegram, size_t size) {
+  PROFILE_ZONE("p1.parse");
+  *this = P1Values();
+  char const *const text = reinterpret_cast<char const *>(telegram);
+  char const *const textEnd = text + size;
+  char const *line = text;
+  while (line < textEnd) {
+    char const *lineEnd = static_cast<char const *>(memchr(line, '\n', textEnd - line));
+    if (!lineEnd) {
+      lineEnd = textEnd;
+    }
+    // "1-0:1.7.0(00.330*kW)", or with several values like
+    // "0-1:24.2.1(101209110000W)(12785.123*m3)", of which we want the last.
+    char const *const colon = static_cast<char const *>(memchr(line, ':', lineEnd - line));
+    char const *const open = colon ? static_cast<char const *>(memchr(colon, '(', lineEnd - colon)) : nullptr;
+    if (open) {
+      char const *lastOpen = open;
+      char const *close = nullptr;
+      for (char const *p = open; p < lineEnd; p++) {
+        if (*p == '(') {
+          lastOpen = p;
+        } else if (*p == ')') {
+          close = p;
+        }
+      }
+      for (ObisField const &field : FIELDS) {
+        Decimal decimal;
+        if (!close || close < lastOpen ||
+            !matches(field.prefix, line, colon - line) ||
+            !matches(field.code, colon + 1, open - colon - 1)) {
+          continue;
+        }
+        bool const parsed = parseDecimal(lastOpen + 1, close, &decimal);
+        switch (field.field) {
+          case Field::IMPORT_POWER:
+            importWatts = parsed ? watts(decimal) : NAN;
+            break;
+          case Field::EXPORT_POWER:
+            exportWatts = parsed ? watts(decimal) : NAN;
+            break;
+          case Field::PHASE_IMPORT_POWER:
+            phaseImportWatts[field.index] = parsed ? watts(decimal) : NAN;
+            break;
+          case Field::PHASE_EXPORT_POWER:
+            phaseExportWatts[field.index] = parsed ? watts(decimal) : NAN;
+            break;
+          case Field::IMPORT_ENERGY:
+            importWattHours[field.index] = parsed ? wattHours(decimal) : NO_COUNTER;
+            break;
+          case Field::EXPORT_ENERGY:
+            exportWattHours[field.index] = parsed ? wattHours(decimal) : NO_COUNTER;
+            break;
+          case Field::GAS:
+            // Only the first gas meter, if there are several.
+            if (gasLitres == NO_COUNTER && parsed) {
+              gasLitres = litres(decimal);
+            }
+            break;
+        }
+        break;
+      }
+    }
+    line = lineEnd + 1;
+  }
+  return !std::isnan(importWatts) || !std::isnan(exportWatts);
+}
+
+double P1Values::netWatts() const {
+  return importWatts - (std::isnan(exportWatts) ? 0 : exportWatts);
+}
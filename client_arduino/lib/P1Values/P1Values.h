@@ -0,0 +1,48 @@
+#pragma once
+
+#include <Arduino.h>
+
+/**
+ * The values we use from a P1 telegram. Power is reported by the meter in kW
+ * with watt resolution, energy in kWh with watt-hour resolution, and gas in
+ * m³ with litre resolution, so we keep counters as integers of the smallest
+ * unit:
+ *
+ *   1-0:1.7.0   power delivered to us (import)
+ *   1-0:2.7.0   power received from us (export)
+ *   1-0:21.7.0  import on L1, and 41.7.0 and 61.7.0 on L2 and L3
+ *   1-0:22.7.0  export on L1, and 42.7.0 and 62.7.0 on L2 and L3
+ *   1-0:1.8.1   energy imported at tariff 1, and 1.8.2 at tariff 2
+ *   1-0:2.8.1   energy exported at tariff 1, and 2.8.2 at tariff 2
+ *   0-n:24.2.1  gas delivered, as last reported by the gas meter on M-Bus
+ *               channel n (24.2.3 on Belgian meters)
+ *
+ * Values missing from the telegram are NaN or `NO_COUNTER`; single-phase
+ * meters only report L1, and DSMR 2 meters report no per-phase values at all.
+ */
+struct P1Values {
+  static size_t const NUM_PHASES = 3;
+  static size_t const NUM_TARIFFS = 2;
+  static uint32 const NO_COUNTER = 0xffffffff;
+
+  double importWatts = NAN;
+  double exportWatts = NAN;
+  double phaseImportWatts[NUM_PHASES] = {NAN, NAN, NAN};
+  double phaseExportWatts[NUM_PHASES] = {NAN, NAN, NAN};
+
+  uint32 importWattHours[NUM_TARIFFS] = {NO_COUNTER, NO_COUNTER};
+  uint32 exportWattHours[NUM_TARIFFS] = {NO_COUNTER, NO_COUNTER};
+  uint32 gasLitres = NO_COUNTER;
+
+  /**
+   * Extracts the values from the given telegram. Returns `false` if the
+   * telegram contains neither total import nor total export power.
+   */
+  bool parse(byte const *telegram, size_t size);
+
+  /**
+   * Import minus export, or NaN if import is unknown. Meters that never
+   * export may leave out 2.7.0.
+   */
+  double netWatts() const;
+};
@@ -0,0 +1,65 @@
+#include <math.h>
+
+#include "PollScheduler.h"
+
+void PollScheduler::begin(unsigned long minIntervalMillis, unsigned long maxIntervalMillis) {
+  minIntervalMillis_ = minIntervalMillis;
+  maxIntervalMillis_ = maxIntervalMillis < minIntervalMillis ? minIntervalMillis : maxIntervalMillis;
+  defaultIntervalMillis_ =
+    DEFAULT_INTERVAL_MILLIS < minIntervalMillis_ ? minIntervalMillis_ :
+    DEFAULT_INTERVAL_MILLIS > maxIntervalMillis_ ? maxIntervalMillis_ :
+    DEFAULT_INTERVAL_MILLIS;
+  intervalMillis_ = defaultIntervalMillis_;
+  started_ = false;
+  hasLastPower_ = false;
+}
+
+bool PollScheduler::isDue(unsigned long nowMillis) const {
+  return !started_ || nowMillis - lastStartMillis_ >= intervalMillis_;
+}
+
+void PollScheduler::started(unsigned long nowMillis) {
+  started_ = true;
+  lastStartMillis_ = nowMillis;
+  numPolls_++;
+}
+
+void PollScheduler::succeeded(double powerWatts) {
+  if (fabs(powerWatts) < IDLE_POWER_WATTS) {
+    slowDown();
+  } else if (hasLastPower_) {
+    double const change = fabs(powerWatts - lastPowerWatts_);
+    double const threshold = fmax(FAST_CHANGE_WATTS, FAST_CHANGE_FRACTION * fabs(lastPowerWatts_));
+    if (change >= threshold) {
+      speedUp();
+    } else {
+      relax();
+    }
+  } else {
+    relax();
+  }
+  hasLastPower_ = true;
+  lastPowerWatts_ = powerWatts;
+}
+
+void PollScheduler::failed() {
+  numFailures_++;
+  hasLastPower_ = false;
+  slowDown();
+}
+
+void PollScheduler::slowDown() {
+  intervalMillis_ = intervalMillis_ > maxIntervalMillis_ / 2 ? maxIntervalMillis_ : 2 * intervalMillis_;
+}
+
+void PollScheduler::speedUp() {
+  intervalMillis_ = intervalMillis_ / 2 < minIntervalMillis_ ? minIntervalMillis_ : intervalMillis_ / 2;
+}
+
+void PollScheduler::relax() {
+  if (intervalMillis_ > defaultIntervalMillis_) {
+    intervalMillis_ = intervalMillis_ / 2 < defaultIntervalMillis_ ? defaultIntervalMillis_ : intervalMillis_ / 2;
+  } else if (intervalMillis_ < defaultIntervalMillis_) {
+    intervalMillis_ = intervalMillis_ > defaultIntervalMillis_ / 2 ? defaultIntervalMillis_ : 2 * intervalMillis_;
+  }
+}
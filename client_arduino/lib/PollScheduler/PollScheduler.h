@@ -0,0 +1,67 @@
+#pragma once
+
+#include <Arduino.h>
+
+/**
+ * Decides when to poll a device next, based on what the previous polls
+ * returned. The interval is doubled while the device is unreachable or idle
+ * (e.g. an inverter at night), and halved while its power is changing quickly
+ * (e.g. under passing clouds). Otherwise it returns to the default interval
+ * step by step. It always stays between the configured minimum and maximum.
+ */
+class PollScheduler {
+  public:
+    static unsigned long const DEFAULT_INTERVAL_MILLIS = 10000;
+
+    // Below this, the device is considered idle.
+    static constexpr double IDLE_POWER_WATTS = 1.0;
+    // A change in power of at least this many watts, or this fraction of the
+    // previous value, whichever is larger, counts as fast.
+    static constexpr double FAST_CHANGE_WATTS = 100.0;
+    static constexpr double FAST_CHANGE_FRACTION = 0.2;
+
+    /**
+     * The default interval is clamped to the given range.
+     */
+    void begin(unsigned long minIntervalMillis, unsigned long maxIntervalMillis);
+
+    /**
+     * Whether it's time to start the next poll. The first poll is due
+     * immediately.
+     */
+    bool isDue(unsigned long nowMillis) const;
+
+    /**
+     * Records the start of a poll.
+     */
+    void started(unsigned long nowMillis);
+
+    /**
+     * Records the outcome of the poll that was last started.
+     */
+    void succeeded(double powerWatts);
+    void failed();
+
+    uint32 numPolls() const { return numPolls_; }
+    uint32 numFailures() const { return numFailures_; }
+    unsigned long intervalMillis() const { return intervalMillis_; }
+
+  private:
+    unsigned long minIntervalMillis_ = DEFAULT_INTERVAL_MILLIS;
+    unsigned long maxIntervalMillis_ = DEFAULT_INTERVAL_MILLIS;
+    unsigned long defaultIntervalMillis_ = DEFAULT_INTERVAL_MILLIS;
+    unsigned long intervalMillis_ = DEFAULT_INTERVAL_MILLIS;
+
+    bool started_ = false;
+    unsigned long lastStartMillis_ = 0;
+
+    bool hasLastPower_ = false;
+    double lastPowerWatts_ = 0;
+
+    uint32 numPolls_ = 0;
+    uint32 numFailures_ = 0;
+
+    void slowDown();
+    void speedUp();
+    void relax();
+};
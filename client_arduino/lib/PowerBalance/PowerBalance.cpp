@@ -0,0 +1,115 @@
+#include "PowerBalance.h"
+
+namespace {
+
+/**
+ * Signed difference `a - b` of two `millis()` values, correct across
+ * wraparound as long as they are less than 24 days apart.
+ */
+long millisBetween(unsigned long a, unsigned long b) {
+  return static_cast<long>(a - b);
+}
+
+unsigned long distance(unsigned long a, unsigned long b) {
+  long const difference = millisBetween(a, b);
+  return difference < 0 ? -difference : difference;
+}
+
+}
+
+void PowerBalance::setP1Values(P1Values const &values, unsigned long measuredMillis) {
+  p1Values_ = values;
+  p1Millis_ = measuredMillis;
+  hasP1_ = true;
+  publish();
+}
+
+void PowerBalance::addProduction(size_t device, double watts, unsigned long readMillis) {
+  if (device >= MAX_DEVICES) {
+    return;
+  }
+  Device &d = devices_[device];
+  if (d.numReadings && d.last.millis == readMillis) {
+    return;
+  }
+  d.previous = d.last;
+  d.last = {watts, readMillis};
+  if (d.numReadings < 2) {
+    d.numReadings++;
+  }
+  if (device >= numDevices_) {
+    numDevices_ = device + 1;
+  }
+  publish();
+}
+
+double PowerBalance::productionAt(Device const &device, unsigned long atMillis, unsigned long *skew) const {
+  Reading const &last = device.last;
+  if (device.numReadings >= 2) {
+    Reading const &previous = device.previous;
+    long const sincePrevious = millisBetween(atMillis, previous.millis);
+    long const untilLast = millisBetween(last.millis, atMillis);
+    if (sincePrevious >= 0 && untilLast >= 0) {
+      // Bracketed by two readings.
+      long const interval = sincePrevious + untilLast;
+      *skew = sincePrevious < untilLast ? sincePrevious : untilLast;
+      if (!interval || std::isnan(previous.watts) || std::isnan(last.watts)) {
+        return last.watts;
+      }
+      return previous.watts + (last.watts - previous.watts) * sincePrevious / interval;
+    }
+    if (sincePrevious < 0) {
+      // Both readings are newer than the P1 measurement.
+      *skew = -sincePrevious;
+      return previous.watts;
+    }
+  }
+  *skew = distance(atMillis, last.millis);
+  return last.watts;
+}
+
+void PowerBalance::publish() {
+  PowerSnapshot s;
+  if (hasP1_) {
+    s.p1Millis = p1Millis_;
+    s.importWatts = p1Values_.importWatts;
+    s.exportWatts = std::isnan(p1Values_.exportWatts) ? 0 : p1Values_.exportWatts;
+    s.netWatts = p1Values_.netWatts();
+    for (size_t i = 0; i < P1Values::NUM_PHASES; i++) {
+      double const phaseExport = std::isnan(p1Values_.phaseExportWatts[i]) ? 0 : p1Values_.phaseExportWatts[i];
+      s.phaseNetWatts[i] = p1Values_.phaseImportWatts[i] - phaseExport;
+    }
+  }
+
+  if (hasP1_ && numDevices_) {
+    double production = 0;
+    for (size_t i = 0; i < numDevices_ && !std::isnan(production); i++) {
+      Device const &device = devices_[i];
+      unsigned long skew = 0;
+      double const watts = device.numReadings ? productionAt(device, p1Millis_, &skew) : NAN;
+      if (skew > MAX_SKEW_MILLIS) {
+        production = NAN;
+      } else {
+        production += watts;
+        if (skew > s.skewMillis) {
+          s.skewMillis = skew;
+        }
+      }
+    }
+    s.productionWatts = production;
+  }
+
+  if (!std::isnan(s.productionWatts)) {
+    s.consumptionWatts = s.netWatts + s.productionWatts;
+    // Production and export are measured separately, so their difference can
+    // briefly come out negative while the inverter ramps down.
+    double const selfConsumption = s.productionWatts - s.exportWatts;
+    s.selfConsumptionWatts = selfConsumption > 0 ? selfConsumption : 0;
+    if (s.productionWatts > 0) {
+      double const ratio = s.selfConsumptionWatts / s.productionWatts;
+      s.selfConsumptionRatio = ratio < 1 ? ratio : 1;
+    }
+  }
+
+  snapshot_.write(s);
+}
@@ -0,0 +1,109 @@
+#pragma once
+
+#include <Arduino.h>
+
+#include "P1Values.h"
+#include "SeqLock.h"
+
+/**
+ * Power flows of the house at one point in time, in watts. Values that can't
+ * be known, for example production before any inverter has been read, are
+ * NaN.
+ */
+struct PowerSnapshot {
+  // The `millis()` of the P1 measurement this is based on. Zero if there is
+  // none yet.
+  unsigned long p1Millis = 0;
+  // The largest distance in time between the P1 measurement and the inverter
+  // readings that production was estimated from.
+  unsigned long skewMillis = 0;
+
+  // Import and export at the grid connection, and their difference, which is
+  // negative while exporting.
+  double importWatts = NAN;
+  double exportWatts = NAN;
+  double netWatts = NAN;
+  double phaseNetWatts[P1Values::NUM_PHASES] = {NAN, NAN, NAN};
+
+  // Sum over all inverters.
+  double productionWatts = NAN;
+  // What the house uses: net import plus production.
+  double consumptionWatts = NAN;
+  // The part of production that is used in the house rather than exported.
+  double selfConsumptionWatts = NAN;
+  // `selfConsumptionWatts / productionWatts`, or NaN while not producing.
+  double selfConsumptionRatio = NAN;
+};
+
+/**
+ * Combines the grid power from the P1 port with the production of the
+ * inverters into a `PowerSnapshot`, updated as soon as either source has a new
+ * value.
+ *
+ * The two sources are measured at different times: telegrams arrive every 1
+ * or 10 seconds, and inverters are polled on their own schedule. We take the
+ * P1 measurement as the reference, and estimate each inverter's power at that
+ * moment by interpolating between its readings just before and just after. If
+ * there is no reading after it yet, the last one is used, and replaced by the
+ * interpolated value as soon as the next reading arrives. Readings further than
+ * `MAX_SKEW_MILLIS` from the P1 measurement are not used at all.
+ *
+ * The snapshot is published through a `SeqLock`, so readers never block the
+ * writer or see a half-updated snapshot, and never need to parse anything.
+ */
+class PowerBalance {
+  public:
+    static size_t const MAX_DEVICES = 4;
+    static unsigned long const MAX_SKEW_MILLIS = 60ul * 1000;
+
+    /**
+     * Sets the grid power, as measured at `measuredMillis`.
+     */
+    void setP1Values(P1Values const &values, unsigned long measuredMillis);
+
+    /**
+     * Adds a reading of the given inverter. Repeated readings with the same
+     * `readMillis` are ignored, so this can be called for all devices
+     * whenever any of them has a new value.
+     */
+    void addProduction(size_t device, double watts, unsigned long readMillis);
+
+    /**
+     * Returns the latest snapshot. Call only from loop context; see
+     * `SeqLock`.
+     */
+    PowerSnapshot snapshot() const { return snapshot_.read(); }
+
+    /**
+     * Changes whenever a new snapshot is published.
+     */
+    uint32_t sequence() const { return snapshot_.sequence(); }
+
+  private:
+    struct Reading {
+      double watts;
+      unsigned long millis;
+    };
+
+    struct Device {
+      // The two most recent readings, `last` being the latest.
+      Reading previous;
+      Reading last;
+      uint8 numReadings = 0;
+    };
+
+    P1Values p1Values_;
+    unsigned long p1Millis_ = 0;
+    bool hasP1_ = false;
+    Device devices_[MAX_DEVICES];
+    size_t numDevices_ = 0;
+    SeqLock<PowerSnapshot> snapshot_;
+
+    /**
+     * Estimates the production of the device at the P1 measurement time, and
+     * returns the distance to the reading(s) it is based on through `skew`.
+     */
+    double productionAt(Device const &device, unsigned long atMillis, unsigned long *skew) const;
+
+    void publish();
+};
@@ -0,0 +1,62 @@
+#include "Profiler.h"
+
+#include "JsonWriter.h"
+
+ProfileZone *ProfileZone::first_ = nullptr;
+
+void ProfileZone::record(uint32 cycles) {
+  if (!registered_) {
+    registered_ = true;
+    next_ = first_;
+    first_ = this;
+  }
+  count_++;
+  totalCycles_ += cycles;
+  if (cycles > maxCycles_) {
+    maxCycles_ = cycles;
+  }
+}
+
+void ProfileZone::reset() {
+  count_ = 0;
+  totalCycles_ = 0;
+  maxCycles_ = 0;
+}
+
+namespace Profiler {
+
+uint32 cyclesPerMicrosecond() {
+#ifdef ARDUINO_ARCH_ESP8266
+  return ESP.getCpuFreqMHz();
+#else
+  return 1000;
+#endif
+}
+
+size_t write(Print &out) {
+  // Numbers in this table are no different from those in JSON.
+  JsonWriter writer(out);
+  uint32 const perMicrosecond = cyclesPerMicrosecond();
+  writer.write("zone count total_us mean_us max_us\n");
+  for (ProfileZone const *zone = ProfileZone::first(); zone; zone = zone->next()) {
+    writer.write(zone->name());
+    writer.write(" ");
+    writer.writeUnsigned(zone->count());
+    writer.write(" ");
+    writer.writeUnsigned(zone->totalCycles() / perMicrosecond);
+    writer.write(" ");
+    writer.writeUnsigned(zone->count() ? zone->totalCycles() / zone->count() / perMicrosecond : 0);
+    writer.write(" ");
+    writer.writeUnsigned(zone->maxCycles() / perMicrosecond);
+    writer.write("\n");
+  }
+  return writer.written();
+}
+
+void reset() {
+  for (ProfileZone *zone = ProfileZone::first(); zone; zone = const_cast<ProfileZone *>(zone->next())) {
+    zone->reset();
+  }
+}
+
+}
@@ -0,0 +1,108 @@
+#pragma once
+
+#include <Arduino.h>
+
+#ifndef ARDUINO_ARCH_ESP8266
+#  include <chrono>
+#endif
+
+#if defined(PROFILING) && (PROFILING + 0)
+#  define PROFILE_ZONE_CONCAT_(a, b) a##b
+#  define PROFILE_ZONE_CONCAT(a, b) PROFILE_ZONE_CONCAT_(a, b)
+/**
+ * Measures the time from here to the end of the enclosing scope, as part of
+ * the zone with the given name, which must be a string literal. Compiles to
+ * nothing unless built with PROFILING=1.
+ */
+#  define PROFILE_ZONE(name) \
+    static ProfileZone PROFILE_ZONE_CONCAT(profileZone_, __LINE__)(name); \
+    ProfileScope PROFILE_ZONE_CONCAT(profileScope_, __LINE__)(PROFILE_ZONE_CONCAT(profileZone_, __LINE__))
+#else
+#  define PROFILE_ZONE(name) do {} while (0)
+#endif
+
+/**
+ * Time spent in a named piece of code, in CPU cycles: the number of times it
+ * ran, the total and the maximum.
+ *
+ * Zones are constant-initialized, so that declaring one as a function-local
+ * static costs no initialization check, and they add themselves to the list
+ * of zones the first time they are used. Only ever declare them as statics.
+ */
+class ProfileZone {
+  public:
+    constexpr explicit ProfileZone(char const *name) : name_(name) {}
+
+    void record(uint32 cycles);
+    void reset();
+
+    char const *name() const { return name_; }
+    uint32 count() const { return count_; }
+    uint64_t totalCycles() const { return totalCycles_; }
+    uint32 maxCycles() const { return maxCycles_; }
+
+    ProfileZone const *next() const { return next_; }
+
+    /**
+     * The zones used so far, most recently added first.
+     */
+    static ProfileZone *first() { return first_; }
+
+  private:
+    static ProfileZone *first_;
+
+    char const *name_;
+    bool registered_ = false;
+    ProfileZone *next_ = nullptr;
+    uint32 count_ = 0;
+    uint64_t totalCycles_ = 0;
+    uint32 maxCycles_ = 0;
+};
+
+namespace Profiler {
+
+/**
+ * A free running 32-bit cycle counter: the CPU's on the ESP8266, and
+ * nanoseconds of a steady clock natively. It wraps, so only differences of
+ * less than 2^32 cycles (53 seconds at 80 MHz) are meaningful.
+ */
+inline uint32 cycleCount();
+
+uint32 cyclesPerMicrosecond();
+
+/**
+ * Writes a table of all zones, with times in microseconds. Returns the number
+ * of bytes written.
+ */
+size_t write(Print &out);
+
+void reset();
+
+}
+
+/**
+ * Records the cycles from construction to destruction in a zone.
+ */
+class ProfileScope {
+  public:
+    explicit ProfileScope(ProfileZone &zone) : zone_(zone), start_(Profiler::cycleCount()) {}
+
+    ~ProfileScope() {
+      zone_.record(Profiler::cycleCount() - start_);
+    }
+
+  private:
+    ProfileZone &zone_;
+    uint32 const start_;
+};
+
+#ifdef ARDUINO_ARCH_ESP8266
+inline uint32 Profiler::cycleCount() {
+  return ESP.getCycleCount();
+}
+#else
+inline uint32 Profiler::cycleCount() {
+  return static_cast<uint32>(std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::steady_clock::now().time_since_epoch()).count());
+}
+#endif
@@ -0,0 +1,97 @@
+#include "Rollup.h"
+
+namespace {
+
+void updateFirstAndLast(uint32 value, uint32 *first, uint32 *last) {
+  if (value == P1Values::NO_COUNTER) {
+    return;
+  }
+  if (*first == P1Values::NO_COUNTER) {
+    *first = value;
+  }
+  *last = value;
+}
+
+}
+
+uint16 const RollupAggregator::PERIOD_SECONDS[NUM_PERIODS] = {60, 15 * 60};
+
+void RollupAggregator::add(P1Values const &values, uint32 epochSeconds) {
+  advance(epochSeconds);
+  double const netWatts = values.netWatts();
+  for (size_t i = 0; i < NUM_PERIODS; i++) {
+    Accumulator &accumulator = accumulators_[i];
+    Rollup &rollup = accumulator.rollup;
+    if (!accumulator.active) {
+      uint32 const previousGasLitres = accumulator.previousGasLitres;
+      accumulator = Accumulator();
+      accumulator.active = true;
+      accumulator.previousGasLitres = previousGasLitres;
+      rollup.periodSeconds = PERIOD_SECONDS[i];
+      rollup.startEpochSeconds = epochSeconds - epochSeconds % PERIOD_SECONDS[i];
+    }
+
+    rollup.numTelegrams++;
+    if (!std::isnan(netWatts)) {
+      int32_t const watts = lround(netWatts);
+      if (!accumulator.numPowerValues || watts < rollup.minWatts) {
+        rollup.minWatts = watts;
+      }
+      if (!accumulator.numPowerValues || watts > rollup.maxWatts) {
+        rollup.maxWatts = watts;
+      }
+      accumulator.sumWatts += watts;
+      accumulator.numPowerValues++;
+    }
+    for (size_t tariff = 0; tariff < P1Values::NUM_TARIFFS; tariff++) {
+      updateFirstAndLast(values.importWattHours[tariff],
+          &rollup.firstImportWattHours[tariff], &rollup.lastImportWattHours[tariff]);
+      updateFirstAndLast(values.exportWattHours[tariff],
+          &rollup.firstExportWattHours[tariff], &rollup.lastExportWattHours[tariff]);
+    }
+    if (values.gasLitres != P1Values::NO_COUNTER) {
+      rollup.lastGasLitres = values.gasLitres;
+    }
+  }
+}
+
+void RollupAggregator::advance(uint32 epochSeconds) {
+  for (size_t i = 0; i < NUM_PERIODS; i++) {
+    Accumulator &accumulator = accumulators_[i];
+    uint32 const start = epochSeconds - epochSeconds % PERIOD_SECONDS[i];
+    // Also when the clock was set back.
+    if (accumulator.active && start != accumulator.rollup.startEpochSeconds) {
+      complete(accumulator);
+    }
+  }
+}
+
+void RollupAggregator::removePending(size_t count) {
+  if (count >= numPending_) {
+    numPending_ = 0;
+    return;
+  }
+  memmove(pending_, pending_ + count, (numPending_ - count) * sizeof(Rollup));
+  numPending_ -= count;
+}
+
+void RollupAggregator::complete(Accumulator &accumulator) {
+  Rollup &rollup = accumulator.rollup;
+  if (accumulator.numPowerValues) {
+    rollup.meanWatts = lround(static_cast<double>(accumulator.sumWatts) / accumulator.numPowerValues);
+  }
+  if (rollup.lastGasLitres != P1Values::NO_COUNTER) {
+    if (accumulator.previousGasLitres != P1Values::NO_COUNTER &&
+        rollup.lastGasLitres >= accumulator.previousGasLitres) {
+      rollup.gasDeltaLitres = rollup.lastGasLitres - accumulator.previousGasLitres;
+    }
+    accumulator.previousGasLitres = rollup.lastGasLitres;
+  }
+
+  if (numPending_ == MAX_PENDING) {
+    removePending(1);
+    numDropped_++;
+  }
+  pending_[numPending_++] = rollup;
+  accumulator.active = false;
+}
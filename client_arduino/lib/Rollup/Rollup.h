@@ -0,0 +1,95 @@
+#pragma once
+
+#include <Arduino.h>
+
+#include "P1Values.h"
+
+/**
+ * Summary of the telegrams received in one period of wall-clock time, such as
+ * a minute or a quarter of an hour. Counters that no telegram in the period
+ * reported are `P1Values::NO_COUNTER`, and power is `NO_POWER` if no telegram
+ * reported it.
+ */
+struct Rollup {
+  static int32_t const NO_POWER = INT32_MIN;
+
+  // Start of the period, in seconds since the epoch, a multiple of
+  // `periodSeconds`.
+  uint32 startEpochSeconds = 0;
+  uint16 periodSeconds = 0;
+  uint16 numTelegrams = 0;
+
+  // Net power (import minus export) over the telegrams in the period.
+  int32_t minWatts = NO_POWER;
+  int32_t meanWatts = NO_POWER;
+  int32_t maxWatts = NO_POWER;
+
+  // Energy counters per tariff, from the first and last telegram.
+  uint32 firstImportWattHours[P1Values::NUM_TARIFFS] = {P1Values::NO_COUNTER, P1Values::NO_COUNTER};
+  uint32 lastImportWattHours[P1Values::NUM_TARIFFS] = {P1Values::NO_COUNTER, P1Values::NO_COUNTER};
+  uint32 firstExportWattHours[P1Values::NUM_TARIFFS] = {P1Values::NO_COUNTER, P1Values::NO_COUNTER};
+  uint32 lastExportWattHours[P1Values::NUM_TARIFFS] = {P1Values::NO_COUNTER, P1Values::NO_COUNTER};
+
+  // The gas meter only reports every 5 minutes (DSMR 5) or every hour (DSMR
+  // 4), so rather than the change within the period, `gasDeltaLitres` is the
+  // change since the last value seen in an earlier period.
+  uint32 lastGasLitres = P1Values::NO_COUNTER;
+  uint32 gasDeltaLitres = P1Values::NO_COUNTER;
+};
+
+/**
+ * Aggregates every telegram into rollups of 1 and 15 minutes, aligned to the
+ * wall clock. Completed rollups are queued until they have been uploaded; if
+ * uploads keep failing, the oldest ones are dropped to make room.
+ */
+class RollupAggregator {
+  public:
+    static size_t const NUM_PERIODS = 2;
+    static uint16 const PERIOD_SECONDS[NUM_PERIODS];
+    // Enough for half an hour of failed uploads.
+    static size_t const MAX_PENDING = 32;
+
+    /**
+     * Adds the values from a telegram, measured at `epochSeconds`.
+     */
+    void add(P1Values const &values, uint32 epochSeconds);
+
+    /**
+     * Completes the rollups of periods that ended before `epochSeconds`,
+     * even if no telegram has arrived since. Call this before uploading.
+     */
+    void advance(uint32 epochSeconds);
+
+    /**
+     * Completed rollups, oldest first.
+     */
+    Rollup const *pending() const { return pending_; }
+    size_t numPending() const { return numPending_; }
+
+    /**
+     * Removes the oldest `count` rollups, once they have been uploaded.
+     */
+    void removePending(size_t count);
+
+    /**
+     * Rollups that were completed but dropped before they could be uploaded.
+     */
+    uint32 numDropped() const { return numDropped_; }
+
+  private:
+    struct Accumulator {
+      bool active = false;
+      Rollup rollup;
+      int64_t sumWatts = 0;
+      uint16 numPowerValues = 0;
+      // The last gas value of earlier periods.
+      uint32 previousGasLitres = P1Values::NO_COUNTER;
+    };
+
+    Accumulator accumulators_[NUM_PERIODS];
+    Rollup pending_[MAX_PENDING];
+    size_t numPending_ = 0;
+    uint32 numDropped_ = 0;
+
+    void complete(Accumulator &accumulator);
+};
@@ -0,0 +1,135 @@
+#include "Sample.h"
+
+#include "CountingPrint.h"
+#include "JsonWriter.h"
+
+namespace {
+
+class SampleJsonWriter : public JsonWriter {
+  public:
+    explicit SampleJsonWriter(Print &out) : JsonWriter(out) {}
+
+    void writeCounter(uint32 value) {
+      if (value == P1Values::NO_COUNTER) {
+        write("null");
+      } else {
+        writeUnsigned(value);
+      }
+    }
+
+    void writePower(int32_t value) {
+      if (value == Rollup::NO_POWER) {
+        write("null");
+      } else {
+        writeSigned(value);
+      }
+    }
+
+    /**
+     * Writes the counters of all tariffs as an array.
+     */
+    void writeCounters(uint32 const (&values)[P1Values::NUM_TARIFFS]) {
+      write("[");
+      for (size_t i = 0; i < P1Values::NUM_TARIFFS; i++) {
+        if (i) {
+          write(",");
+        }
+        writeCounter(values[i]);
+      }
+      write("]");
+    }
+
+    void writeRollup(Rollup const &rollup) {
+      write("{\"start\":");
+      writeUnsigned(static_cast<uint64_t>(rollup.startEpochSeconds) * 1000);
+      write(",\"periodSeconds\":");
+      writeUnsigned(rollup.periodSeconds);
+      write(",\"telegrams\":");
+      writeUnsigned(rollup.numTelegrams);
+      write(",\"minPowerW\":");
+      writePower(rollup.minWatts);
+      write(",\"meanPowerW\":");
+      writePower(rollup.meanWatts);
+      write(",\"maxPowerW\":");
+      writePower(rollup.maxWatts);
+      write(",\"firstImportWh\":");
+      writeCounters(rollup.firstImportWattHours);
+      write(",\"lastImportWh\":");
+      writeCounters(rollup.lastImportWattHours);
+      write(",\"firstExportWh\":");
+      writeCounters(rollup.firstExportWattHours);
+      write(",\"lastExportWh\":");
+      writeCounters(rollup.lastExportWattHours);
+      write(",\"lastGasL\":");
+      writeCounter(rollup.lastGasLitres);
+      write(",\"gasDeltaL\":");
+      writeCounter(rollup.gasDeltaLitres);
+      write("}");
+    }
+};
+
+}
+
+void Sample::setTelegram(byte const *buffer, uint16 size, unsigned long receivedMillis) {
+  telegram_ = buffer;
+  telegramSize_ = size;
+  telegramMillis_ = receivedMillis;
+}
+
+void Sample::setRollups(Rollup const *rollups, size_t count) {
+  rollups_ = rollups;
+  numRollups_ = count;
+}
+
+bool Sample::addDevice(Device const &device) {
+  if (numDevices_ >= MAX_DEVICES) {
+    return false;
+  }
+  devices_[numDevices_++] = device;
+  return true;
+}
+
+size_t Sample::writeJson(Print &out, uint64_t nowEpochMillis, unsigned long nowMillis) const {
+  SampleJsonWriter writer(out);
+  writer.write("{\"timestamp\":");
+  writer.writeUnsigned(nowEpochMillis);
+  if (telegram_) {
+    writer.write(",\"telegram\":{\"timestamp\":");
+    writer.writeUnsigned(nowEpochMillis - (nowMillis - telegramMillis_));
+    writer.write(",\"raw\":");
+    writer.writeString(telegram_, telegramSize_);
+    writer.write("}");
+  }
+  writer.write(",\"inverters\":[");
+  for (size_t i = 0; i < numDevices_; i++) {
+    Device const &device = devices_[i];
+    writer.write(i ? ",{\"device\":" : "{\"device\":");
+    writer.writeUnsigned(device.index);
+    writer.write(",\"timestamp\":");
+    writer.writeUnsigned(nowEpochMillis - (nowMillis - device.readMillis));
+    writer.write(",\"powerW\":");
+    writer.writeNumber(device.powerWatts);
+    writer.write(",\"totalEnergyWh\":");
+    writer.writeNumber(device.totalEnergyWattHours);
+    writer.write("}");
+  }
+  writer.write("]");
+  if (numRollups_) {
+    writer.write(",\"rollups\":[");
+    for (size_t i = 0; i < numRollups_; i++) {
+      if (i) {
+        writer.write(",");
+      }
+      writer.writeRollup(rollups_[i]);
+    }
+    writer.write("]");
+  }
+  writer.write("}");
+  return writer.written();
+}
+
+size_t Sample::jsonLength(uint64_t nowEpochMillis, unsigned long nowMillis) const {
+  CountingPrint counter;
+  writeJson(counter, nowEpochMillis, nowMillis);
+  return counter.count();
+}
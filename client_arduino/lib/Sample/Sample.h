@@ -0,0 +1,67 @@
+#pragma once
+
+#include <Arduino.h>
+
+#include "Rollup.h"
+
+/**
+ * Everything we measured at one point in time, uploaded to the server in a
+ * single request: the raw P1 telegram, the latest values of each inverter or
+ * meter that has been read successfully, and the rollups completed since the
+ * last upload. Uploading these together costs only one TLS connection.
+ *
+ * Measurement times are kept as `millis()` values, and only converted to
+ * wall-clock timestamps when the sample is written, so they are unaffected by
+ * the clock being adjusted in between. The telegram carries its own
+ * timestamp from the meter as well; ours is when it was received.
+ *
+ * The sample refers to the telegram buffer and the rollups instead of copying
+ * them, so they must remain valid for as long as the sample is in use.
+ */
+class Sample {
+  public:
+    static size_t const MAX_DEVICES = 4;
+
+    struct Device {
+      // Index of the device in the configuration.
+      uint8 index;
+      unsigned long readMillis;
+      double powerWatts;
+      double totalEnergyWattHours;
+    };
+
+    void setTelegram(byte const *buffer, uint16 size, unsigned long receivedMillis);
+
+    /**
+     * Adds the values of a device. Returns `false` if there is no room.
+     */
+    bool addDevice(Device const &device);
+
+    size_t numDevices() const { return numDevices_; }
+
+    void setRollups(Rollup const *rollups, size_t count);
+
+    size_t numRollups() const { return numRollups_; }
+
+    /**
+     * Writes the sample as JSON, in small pieces. `nowEpochMillis` is the
+     * wall-clock time at `nowMillis`. Returns the number of bytes written.
+     */
+    size_t writeJson(Print &out, uint64_t nowEpochMillis, unsigned long nowMillis) const;
+
+    /**
+     * Returns the number of bytes `writeJson()` would write.
+     */
+    size_t jsonLength(uint64_t nowEpochMillis, unsigned long nowMillis) const;
+
+  private:
+    byte const *telegram_ = nullptr;
+    uint16 telegramSize_ = 0;
+    unsigned long telegramMillis_ = 0;
+
+    Device devices_[MAX_DEVICES];
+    size_t numDevices_ = 0;
+
+    Rollup const *rollups_ = nullptr;
+    size_t numRollups_ = 0;
+};
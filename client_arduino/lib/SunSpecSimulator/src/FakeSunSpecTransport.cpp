@@ -0,0 +1,106 @@
+#include "FakeSunSpecTransport.h"
+
+FakeSunSpecTransport::FakeSunSpecTransport(SunSpecDeviceSimulator *device) :
+  device_(device)
+{
+}
+
+void FakeSunSpecTransport::reconnect() {
+  transactions_.clear();
+  connected_ = true;
+}
+
+uint16 FakeSunSpecTransport::request(uint8 serverId, uint16 address, uint16 count) {
+  if (!connected_ || count == 0 || transactions_.size() >= windowSize_) {
+    return 0;
+  }
+  if (disconnectAfter_ && !--disconnectAfter_) {
+    disconnect();
+    return 0;
+  }
+
+  Transaction transaction;
+  transaction.id = nextTransactionId_++;
+  if (!nextTransactionId_) {
+    nextTransactionId_ = 1;
+  }
+  transaction.status = Status::PENDING;
+  transaction.startMillis = millis();
+  stats_.requests++;
+  stats_.registers += count;
+  transaction.dropped = dropEvery_ && stats_.requests % dropEvery_ == 0;
+  transaction.registers.resize(count);
+  // The device is read at request time; the response just arrives later.
+  transaction.exception = !device_->read(serverId, address, count, transaction.registers.data());
+  transactions_.push_back(transaction);
+  if (transactions_.size() > stats_.maxOutstanding) {
+    stats_.maxOutstanding = transactions_.size();
+  }
+  return transaction.id;
+}
+
+void FakeSunSpecTransport::poll() {
+  unsigned long const now = millis();
+  for (Transaction &transaction : transactions_) {
+    if (transaction.status != Status::PENDING) {
+      continue;
+    }
+    unsigned long const elapsed = now - transaction.startMillis;
+    if (transaction.dropped) {
+      if (elapsed >= timeoutMillis_) {
+        transaction.status = Status::FAILED;
+        stats_.timeouts++;
+      }
+    } else if (elapsed >= latencyMillis_) {
+      if (transaction.exception) {
+        transaction.status = Status::FAILED;
+        stats_.exceptions++;
+      } else {
+        transaction.status = Status::DONE;
+        stats_.responses++;
+      }
+    }
+  }
+}
+
+SunSpecTransport::Status FakeSunSpecTransport::status(uint16 transactionId) const {
+  Transaction const *transaction = find(transactionId);
+  return transaction ? transaction->status : Status::FAILED;
+}
+
+uint16 const *FakeSunSpecTransport::registers(uint16 transactionId) const {
+  Transaction const *transaction = find(transactionId);
+  return transaction && transaction->status == Status::DONE ? transaction->registers.data() : nullptr;
+}
+
+void FakeSunSpecTransport::release(uint16 transactionId) {
+  for (auto it = transactions_.begin(); it != transactions_.end(); ++it) {
+    if (it->id == transactionId) {
+      transactions_.erase(it);
+      return;
+    }
+  }
+}
+
+FakeSunSpecTransport::Transaction *FakeSunSpecTransport::find(uint16 transactionId) {
+  for (Transaction &transaction : transactions_) {
+    if (transaction.id == transactionId) {
+      return &transaction;
+    }
+  }
+  return nullptr;
+}
+
+FakeSunSpecTransport::Transaction const *FakeSunSpecTransport::find(uint16 transactionId) const {
+  return const_cast<FakeSunSpecTransport *>(this)->find(transactionId);
+}
+
+void FakeSunSpecTransport::disconnect() {
+  connected_ = false;
+  for (Transaction &transaction : transactions_) {
+    if (transaction.status == Status::PENDING) {
+      transaction.status = Status::FAILED;
+      stats_.disconnects++;
+    }
+  }
+}
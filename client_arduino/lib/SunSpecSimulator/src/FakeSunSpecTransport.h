@@ -0,0 +1,93 @@
+#pragma once
+
+#include <ArduinoSunSpec.h>
+
+#include <vector>
+
+#include "SunSpecDeviceSimulator.h"
+
+/**
+ * `SunSpecTransport` that talks to a `SunSpecDeviceSimulator` in memory,
+ * while simulating the network: responses arrive after a configurable
+ * latency (in `millis()` time), some requests can be made to go unanswered
+ * until they time out, and the connection can be made to drop. Every
+ * transaction is counted, so tests and benchmarks can tell exactly what went
+ * over the wire.
+ */
+class FakeSunSpecTransport : public SunSpecTransport {
+  public:
+    struct Stats {
+      // Requests that were accepted.
+      uint32 requests = 0;
+      // Registers requested in total.
+      uint32 registers = 0;
+      // Requests that were answered with registers.
+      uint32 responses = 0;
+      // Requests that were answered with a Modbus exception.
+      uint32 exceptions = 0;
+      // Requests that were never answered and failed after the timeout.
+      uint32 timeouts = 0;
+      // Requests that failed because the connection was dropped.
+      uint32 disconnects = 0;
+      // Highest number of requests that were outstanding at the same time.
+      size_t maxOutstanding = 0;
+    };
+
+    explicit FakeSunSpecTransport(SunSpecDeviceSimulator *device);
+
+    void setWindowSize(size_t windowSize) { windowSize_ = windowSize; }
+    void setLatencyMillis(unsigned long latencyMillis) { latencyMillis_ = latencyMillis; }
+    void setTimeoutMillis(unsigned long timeoutMillis) { timeoutMillis_ = timeoutMillis; }
+
+    /**
+     * Leaves every `n`th request unanswered, so it times out. 0 disables this.
+     */
+    void setDropEvery(uint32 n) { dropEvery_ = n; }
+
+    /**
+     * Drops the connection when the `n`th request from now is sent, failing
+     * everything outstanding. Until `reconnect()` is called, requests fail to
+     * send.
+     */
+    void disconnectAfter(uint32 n) { disconnectAfter_ = n; }
+
+    bool connected() const { return connected_; }
+    void reconnect();
+
+    Stats const &stats() const { return stats_; }
+    void resetStats() { stats_ = Stats(); }
+
+    size_t windowSize() const override { return windowSize_; }
+    uint16 request(uint8 serverId, uint16 address, uint16 count) override;
+    void poll() override;
+    Status status(uint16 transactionId) const override;
+    uint16 const *registers(uint16 transactionId) const override;
+    void release(uint16 transactionId) override;
+
+  private:
+    struct Transaction {
+      uint16 id;
+      Status status;
+      unsigned long startMillis;
+      bool dropped;
+      bool exception;
+      std::vector<uint16> registers;
+    };
+
+    SunSpecDeviceSimulator *const device_;
+
+    size_t windowSize_ = 1;
+    unsigned long latencyMillis_ = 0;
+    unsigned long timeoutMillis_ = 2000;
+    uint32 dropEvery_ = 0;
+    uint32 disconnectAfter_ = 0;
+
+    bool connected_ = true;
+    uint16 nextTransactionId_ = 1;
+    std::vector<Transaction> transactions_;
+    Stats stats_;
+
+    Transaction *find(uint16 transactionId);
+    Transaction const *find(uint16 transactionId) const;
+    void disconnect();
+};
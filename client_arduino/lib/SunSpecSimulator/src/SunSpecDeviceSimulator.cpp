@@ -0,0 +1,152 @@
+#include "SunSpecDeviceSimulator.h"
+
+namespace {
+
+uint16 const START_ADDRESS_MARKER_A = 0x5375;
+uint16 const START_ADDRESS_MARKER_B = 0x6e53;
+uint16 const LAST_MODEL_ID = 0xffff;
+
+uint8 const SMA_UNIT_ID_SERVER_ID = 1;
+uint16 const SMA_UNIT_ID_ADDRESS = 42109;
+uint16 const SMA_SERVER_ID_OFFSET = 123;
+
+// Offsets of the points we fill in, within the model contents.
+uint16 const COMMON_LENGTH = 66;
+uint16 const COMMON_MANUFACTURER = 0;
+uint16 const COMMON_MODEL = 16;
+
+uint16 const NAMEPLATE_LENGTH = 26;
+uint16 const NAMEPLATE_DER_TYPE = 0;
+uint16 const NAMEPLATE_DER_TYPE_PV = 4;
+uint16 const NAMEPLATE_WATTS_RATING = 1;
+
+uint16 const AGGREGATOR_LENGTH = 14;
+uint16 const AGGREGATOR_UPDATE_NUMBER = 2;
+
+uint16 const INVERTER_LENGTH = 50;
+uint16 const INVERTER_WATTS = 12;
+uint16 const INVERTER_WATT_HOURS = 22;
+
+uint16 const METER_LENGTH = 105;
+uint16 const METER_WATTS = 16;
+uint16 const METER_WATT_HOURS_EXPORTED = 36;
+
+}
+
+SunSpecDeviceSimulator::SunSpecDeviceSimulator(uint8 serverId, uint16 baseAddress) :
+  serverId_(serverId),
+  baseAddress_(baseAddress),
+  endAddress_(baseAddress + 2)
+{
+  setRegister(baseAddress_, START_ADDRESS_MARKER_A);
+  setRegister(baseAddress_ + 1, START_ADDRESS_MARKER_B);
+  writeEndMarker();
+}
+
+void SunSpecDeviceSimulator::enableSmaServerIdQuirk(uint8 unitId) {
+  smaQuirk_ = true;
+  smaUnitId_ = unitId;
+  serverId_ = unitId + SMA_SERVER_ID_OFFSET;
+}
+
+uint16 SunSpecDeviceSimulator::addModel(uint16 id, uint16 length) {
+  uint16 const address = endAddress_;
+  setRegister(address, id);
+  setRegister(address + 1, length);
+  for (uint16 i = 0; i < length; i++) {
+    setRegister(address + 2 + i, 0);
+  }
+  endAddress_ = address + 2 + length;
+  writeEndMarker();
+  return address;
+}
+
+uint16 SunSpecDeviceSimulator::addCommonModel(char const *manufacturer, char const *model) {
+  uint16 const address = addModel(1, COMMON_LENGTH);
+  setString(address + 2 + COMMON_MANUFACTURER, 16, manufacturer);
+  setString(address + 2 + COMMON_MODEL, 16, model);
+  return address;
+}
+
+uint16 SunSpecDeviceSimulator::addNameplateModel(uint16 ratedWatts) {
+  uint16 const address = addModel(120, NAMEPLATE_LENGTH);
+  setRegister(address + 2 + NAMEPLATE_DER_TYPE, NAMEPLATE_DER_TYPE_PV);
+  setRegister(address + 2 + NAMEPLATE_WATTS_RATING, ratedWatts);
+  return address;
+}
+
+uint16 SunSpecDeviceSimulator::addAggregatorModel(uint16 updateNumber) {
+  uint16 const address = addModel(2, AGGREGATOR_LENGTH);
+  setRegister(address + 2 + AGGREGATOR_UPDATE_NUMBER, updateNumber);
+  return address;
+}
+
+uint16 SunSpecDeviceSimulator::addInverterModel(uint16 id) {
+  return addModel(id, INVERTER_LENGTH);
+}
+
+uint16 SunSpecDeviceSimulator::addMeterModel(uint16 id) {
+  return addModel(id, METER_LENGTH);
+}
+
+void SunSpecDeviceSimulator::setInverterValues(uint16 address, int16_t watts, uint32 wattHours) {
+  // Scale factors (the registers following each value) are left at 0.
+  setRegister(address + 2 + INVERTER_WATTS, static_cast<uint16>(watts));
+  setRegister(address + 2 + INVERTER_WATT_HOURS, wattHours >> 16);
+  setRegister(address + 2 + INVERTER_WATT_HOURS + 1, wattHours & 0xffff);
+}
+
+void SunSpecDeviceSimulator::setMeterValues(uint16 address, int16_t watts, uint32 wattHoursExported) {
+  setRegister(address + 2 + METER_WATTS, static_cast<uint16>(watts));
+  setRegister(address + 2 + METER_WATT_HOURS_EXPORTED, wattHoursExported >> 16);
+  setRegister(address + 2 + METER_WATT_HOURS_EXPORTED + 1, wattHoursExported & 0xffff);
+}
+
+void SunSpecDeviceSimulator::setRegister(uint16 address, uint16 value) {
+  registers_[address] = value;
+}
+
+uint16 SunSpecDeviceSimulator::getRegister(uint16 address) const {
+  auto it = registers_.find(address);
+  return it == registers_.end() ? 0 : it->second;
+}
+
+bool SunSpecDeviceSimulator::read(uint8 serverId, uint16 address, uint16 count, uint16 *registers) const {
+  if (smaQuirk_ && serverId == SMA_UNIT_ID_SERVER_ID) {
+    // Only the full block of four registers can be read.
+    if (address != SMA_UNIT_ID_ADDRESS || count != 4) {
+      return false;
+    }
+    registers[0] = 0;
+    registers[1] = 0;
+    registers[2] = 0;
+    registers[3] = smaUnitId_;
+    return true;
+  }
+
+  if (serverId != serverId_) {
+    return false;
+  }
+  for (uint16 i = 0; i < count; i++) {
+    auto it = registers_.find(address + i);
+    if (it == registers_.end()) {
+      return false;
+    }
+    registers[i] = it->second;
+  }
+  return true;
+}
+
+void SunSpecDeviceSimulator::setString(uint16 address, uint16 length, char const *value) {
+  size_t const size = strlen(value);
+  for (uint16 i = 0; i < length; i++) {
+    uint8 const high = 2u * i < size ? value[2 * i] : 0;
+    uint8 const low = 2u * i + 1 < size ? value[2 * i + 1] : 0;
+    setRegister(address + i, static_cast<uint16>(high) << 8 | low);
+  }
+}
+
+void SunSpecDeviceSimulator::writeEndMarker() {
+  setRegister(endAddress_, LAST_MODEL_ID);
+  setRegister(endAddress_ + 1, 0);
+}
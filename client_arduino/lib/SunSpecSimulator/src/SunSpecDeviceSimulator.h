@@ -0,0 +1,81 @@
+#pragma once
+
+#include <Arduino.h>
+
+#include <map>
+
+/**
+ * In-memory register map of a SunSpec device. Models are laid out one after
+ * the other from the base address, just like on a real device, and the end
+ * marker is kept after the last one.
+ *
+ * Values of the points we care about (power, energy) can be changed at any
+ * time to simulate a live device.
+ */
+class SunSpecDeviceSimulator {
+  public:
+    static uint16 const DEFAULT_BASE_ADDRESS = 40000;
+
+    /**
+     * Starts a device with no models at the given server ID and base
+     * address.
+     */
+    explicit SunSpecDeviceSimulator(uint8 serverId = 0, uint16 baseAddress = DEFAULT_BASE_ADDRESS);
+
+    /**
+     * Makes the device behave like an SMA inverter: the SunSpec models are
+     * only available at server ID `unitId + 123`, and the unit ID can be read
+     * from registers 42109-42112 at server ID 1.
+     */
+    void enableSmaServerIdQuirk(uint8 unitId);
+
+    /**
+     * Appends a model with the given ID and length, with all registers set to
+     * 0. Returns the address of the model header.
+     */
+    uint16 addModel(uint16 id, uint16 length);
+
+    uint16 addCommonModel(char const *manufacturer, char const *model);
+    uint16 addNameplateModel(uint16 ratedWatts);
+    uint16 addAggregatorModel(uint16 updateNumber);
+
+    /**
+     * Appends an integer inverter model (101-103).
+     */
+    uint16 addInverterModel(uint16 id);
+
+    /**
+     * Appends an integer meter model (201-204).
+     */
+    uint16 addMeterModel(uint16 id);
+
+    /**
+     * Sets power and energy on the inverter or meter model at the given
+     * address, as returned by `addInverterModel()` or `addMeterModel()`.
+     */
+    void setInverterValues(uint16 address, int16_t watts, uint32 wattHours);
+    void setMeterValues(uint16 address, int16_t watts, uint32 wattHoursExported);
+
+    void setRegister(uint16 address, uint16 value);
+    uint16 getRegister(uint16 address) const;
+
+    /**
+     * Reads `count` registers into `registers`, as the given server ID would
+     * respond. Returns `false` if any of them does not exist (Modbus
+     * exception 2, illegal data address).
+     */
+    bool read(uint8 serverId, uint16 address, uint16 count, uint16 *registers) const;
+
+  private:
+    uint8 serverId_;
+    uint16 baseAddress_;
+    uint16 endAddress_;
+
+    bool smaQuirk_ = false;
+    uint8 smaUnitId_ = 0;
+
+    std::map<uint16, uint16> registers_;
+
+    void setString(uint16 address, uint16 length, char const *value);
+    void writeEndMarker();
+};
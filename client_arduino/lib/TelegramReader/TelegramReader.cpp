@@ -1,5 +1,8 @@
 #include "TelegramReader.h"
 
+#include "Log.h"
+#include "Profiler.h"
+
 TelegramReader::TelegramReader() {
   reset();
 }
@@ -15,6 +18,7 @@ void TelegramReader::reset() {
 }
 
 bool TelegramReader::addByte(unsigned char b) {
+  PROFILE_ZONE("p1.addByte");
   if (complete || error) {
     return false;
   }
@@ -46,9 +50,7 @@ bool TelegramReader::addByte(unsigned char b) {
   }
 
   if (size >= MAX_TELEGRAM_SIZE) {
-    // Serial.print("Telegram buffer overflow after ");
-    // Serial.print(MAX_TELEGRAM_SIZE);
-    // Serial.println(" bytes");
+    LOG_WARNING("p1", "Telegram buffer overflow after %u bytes", static_cast<unsigned>(MAX_TELEGRAM_SIZE));
     error = true;
     return false;
   }
@@ -0,0 +1,126 @@
+#include "TlsTuning.h"
+
+#include "Log.h"
+
+namespace {
+
+// Overheads that BearSSL adds to the plaintext capacity of its buffers, and
+// the sizes it uses if not told otherwise, from WiFiClientSecureBearSSL.cpp.
+uint32 const RECEIVE_OVERHEAD = 325;
+uint32 const SEND_OVERHEAD = 85;
+uint32 const DEFAULT_BUFFERS_SIZE = TlsTuning::MAX_FRAGMENT_LENGTH + RECEIVE_OVERHEAD + 837;
+
+}
+
+uint16 const TlsTuning::CIPHER_SUITES[NUM_CIPHER_SUITES] = {
+  BR_TLS_ECDHE_ECDSA_WITH_AES_128_GCM_SHA256,
+  BR_TLS_ECDHE_RSA_WITH_AES_128_GCM_SHA256,
+  BR_TLS_ECDHE_ECDSA_WITH_CHACHA20_POLY1305_SHA256,
+  BR_TLS_ECDHE_RSA_WITH_CHACHA20_POLY1305_SHA256,
+};
+
+uint16 const TlsTuning::FRAGMENT_LENGTHS[NUM_FRAGMENT_LENGTHS] = {512, 1024};
+
+bool TlsTuning::probe(char const *host, uint16 port, char const *fingerprint) {
+  attempted_ = true;
+  attemptMillis_ = millis();
+
+  Result result;
+  for (uint16 length : FRAGMENT_LENGTHS) {
+    if (WiFiClientSecure::probeMaxFragmentLength(host, port, length)) {
+      result.mfln = true;
+      result.receiveBufferSize = length;
+      break;
+    }
+  }
+  LOG_INFO("tls", "Server %s maximum fragment length negotiation; receive buffer %u bytes",
+      result.mfln ? "supports" : "does not support", result.receiveBufferSize);
+
+  // Agreeing on a fragment length takes an answer from the server, too.
+  bool reached = result.mfln;
+  bool connected = probeCipherSuites(host, port, fingerprint, &result, &reached);
+  if (!connected && result.mfln) {
+    LOG_WARNING("tls", "No handshake fit in the negotiated fragment length; trying full size buffers");
+    result = Result();
+    connected = probeCipherSuites(host, port, fingerprint, &result, &reached);
+  }
+  if (!connected && !reached) {
+    LOG_WARNING("tls", "Could not connect to probe the server; keeping default TLS settings for now");
+    return false;
+  }
+  if (!connected) {
+    // Probing again won't change the server's mind.
+    LOG_WARNING("tls", "Server rejected all probed cipher suites; keeping default TLS settings");
+    result = Result();
+  }
+
+  result_ = result;
+  done_ = true;
+  LOG_INFO("tls", "Using %s, buffers of %u and %u bytes, %u bytes less heap than the defaults",
+      cipherSuiteName(result_.cipherSuite), result_.receiveBufferSize, result_.sendBufferSize, heapFreedBytes());
+  return true;
+}
+
+bool TlsTuning::probeCipherSuites(char const *host, uint16 port, char const *fingerprint, Result *result, bool *reached) {
+  bool anyConnected = false;
+  unsigned long fastestMillis = 0;
+  for (size_t i = 0; i < NUM_CIPHER_SUITES; i++) {
+    WiFiClientSecure client;
+    client.setFingerprint(fingerprint);
+    client.setBufferSizes(result->receiveBufferSize, result->sendBufferSize);
+    client.setCiphers(&CIPHER_SUITES[i], 1);
+    unsigned long const startMillis = millis();
+    if (!client.connect(host, port)) {
+      // BearSSL only records an error once the handshake has started.
+      int const error = client.getLastSSLError();
+      if (error) {
+        *reached = true;
+      }
+      LOG_INFO("tls", "Could not connect with %s (error %d)", cipherSuiteName(CIPHER_SUITES[i]), error);
+      continue;
+    }
+    unsigned long const handshakeMillis = millis() - startMillis;
+    result->handshakeMillis[i] = handshakeMillis;
+    uint32 const freeHeap = ESP.getFreeHeap();
+    if (!anyConnected || freeHeap < result->connectedFreeHeap) {
+      result->connectedFreeHeap = freeHeap;
+      result->connectedMaxFreeBlockSize = ESP.getMaxFreeBlockSize();
+    }
+    anyConnected = true;
+    if (result->mfln && !client.getMFLNStatus()) {
+      // The handshake fit, but later records might not.
+      LOG_WARNING("tls", "Server did not apply the maximum fragment length it agreed to");
+      result->mfln = false;
+      result->receiveBufferSize = MAX_FRAGMENT_LENGTH;
+    }
+    client.stop();
+    LOG_INFO("tls", "Handshake with %s took %lu ms", cipherSuiteName(CIPHER_SUITES[i]), handshakeMillis);
+    if (result->cipherSuite == 0 || handshakeMillis < fastestMillis) {
+      result->cipherSuite = CIPHER_SUITES[i];
+      fastestMillis = handshakeMillis;
+    }
+  }
+  return anyConnected;
+}
+
+void TlsTuning::apply(WiFiClientSecure &client) const {
+  client.setBufferSizes(result_.receiveBufferSize, result_.sendBufferSize);
+  if (result_.cipherSuite) {
+    client.setCiphers(&result_.cipherSuite, 1);
+  }
+}
+
+uint32 TlsTuning::heapFreedBytes() const {
+  return DEFAULT_BUFFERS_SIZE -
+    (result_.receiveBufferSize + RECEIVE_OVERHEAD + result_.sendBufferSize + SEND_OVERHEAD);
+}
+
+char const *TlsTuning::cipherSuiteName(uint16 suite) {
+  switch (suite) {
+    case BR_TLS_ECDHE_ECDSA_WITH_AES_128_GCM_SHA256: return "ECDHE-ECDSA-AES128-GCM-SHA256";
+    case BR_TLS_ECDHE_RSA_WITH_AES_128_GCM_SHA256: return "ECDHE-RSA-AES128-GCM-SHA256";
+    case BR_TLS_ECDHE_ECDSA_WITH_CHACHA20_POLY1305_SHA256: return "ECDHE-ECDSA-CHACHA20-POLY1305";
+    case BR_TLS_ECDHE_RSA_WITH_CHACHA20_POLY1305_SHA256: return "ECDHE-RSA-CHACHA20-POLY1305";
+  }
+  return "default";
+}
@@ -0,0 +1,104 @@
+#pragma once
+
+#include <ESP8266WiFi.h>
+#include <WiFiClientSecure.h>
+
+/**
+ * Shrinks the TLS buffers of a client and restricts it to a single cipher
+ * suite, as far as the server allows, to free heap and make handshakes
+ * cheaper. Finding out takes a few handshakes, so it is done once, before the
+ * first upload.
+ *
+ * BearSSL's receive buffer must hold a whole TLS record, up to 16 kB, unless
+ * the server agrees to a smaller maximum fragment length (MFLN, RFC 6066).
+ * The records we send are ours to size, so the send buffer is always small.
+ *
+ * Of `CIPHER_SUITES`, which all have forward secrecy and authenticated
+ * encryption, the one with the fastest full handshake is chosen. Which of
+ * them the server supports depends on its certificate, which is pinned by
+ * the configured fingerprint, so it doesn't change without a restart. If the
+ * server rejects all of them, BearSSL's default suites are kept for good.
+ */
+class TlsTuning {
+  public:
+    static size_t const NUM_CIPHER_SUITES = 4;
+    static uint16 const CIPHER_SUITES[NUM_CIPHER_SUITES];
+    // Proposed to the server in this order; the first one it accepts is used.
+    static size_t const NUM_FRAGMENT_LENGTHS = 2;
+    static uint16 const FRAGMENT_LENGTHS[NUM_FRAGMENT_LENGTHS];
+    static uint16 const MAX_FRAGMENT_LENGTH = 16384;
+    static uint16 const SEND_BUFFER_SIZE = 512;
+    static unsigned long const RETRY_MILLIS = 10ul * 60 * 1000;
+
+    struct Result {
+      // Whether the server agreed to a maximum fragment length of
+      // `receiveBufferSize`.
+      bool mfln = false;
+      // Plaintext capacity of the buffers; BearSSL adds its overhead.
+      uint16 receiveBufferSize = MAX_FRAGMENT_LENGTH;
+      uint16 sendBufferSize = SEND_BUFFER_SIZE;
+      // The chosen suite, or 0 if none of them worked and BearSSL's defaults
+      // stay in place.
+      uint16 cipherSuite = 0;
+      // Duration of a full handshake, TCP connect included, with each of
+      // `CIPHER_SUITES`, or 0 if it failed.
+      unsigned long handshakeMillis[NUM_CIPHER_SUITES] = {};
+      // The least free heap, and the largest free block at that time, while
+      // connected with the tuned buffers.
+      uint32 connectedFreeHeap = 0;
+      uint32 connectedMaxFreeBlockSize = 0;
+    };
+
+    /**
+     * Whether a probe has reached the server, so that the configuration is
+     * settled.
+     */
+    bool isDone() const { return done_; }
+
+    /**
+     * Whether to probe now: if no probe has reached the server yet, and the
+     * last one failed at least `RETRY_MILLIS` ago.
+     */
+    bool isDue(unsigned long nowMillis) const {
+      return !done_ && (!attempted_ || nowMillis - attemptMillis_ >= RETRY_MILLIS);
+    }
+
+    /**
+     * Probes the server with the given fingerprint. Blocks for a handshake
+     * per cipher suite. Returns whether the server could be reached; if it
+     * was, but rejected every suite, the defaults are kept.
+     */
+    bool probe(char const *host, uint16 port, char const *fingerprint);
+
+    /**
+     * Configures the client with the outcome of the last successful probe.
+     * Takes effect on its next connection.
+     */
+    void apply(WiFiClientSecure &client) const;
+
+    Result const &result() const { return result_; }
+
+    /**
+     * Heap that the tuned buffers take less than BearSSL's defaults.
+     */
+    uint32 heapFreedBytes() const;
+
+    /**
+     * Returns the OpenSSL name of one of `CIPHER_SUITES`.
+     */
+    static char const *cipherSuiteName(uint16 suite);
+
+  private:
+    bool done_ = false;
+    bool attempted_ = false;
+    unsigned long attemptMillis_ = 0;
+    Result result_;
+
+    /**
+     * Connects with each cipher suite in turn, with the buffer sizes in
+     * `result`, and fills in the rest of it. Returns whether any of them
+     * connected. Sets `reached` if the server answered a handshake it then
+     * failed.
+     */
+    static bool probeCipherSuites(char const *host, uint16 port, char const *fingerprint, Result *result, bool *reached);
+};
@@ -0,0 +1,99 @@
+#include "UploadPolicy.h"
+
+namespace {
+
+/**
+ * Sum of the energy counters that the telegram reports.
+ */
+uint64_t sumCounters(P1Values const &values) {
+  uint64_t sum = 0;
+  for (size_t i = 0; i < P1Values::NUM_TARIFFS; i++) {
+    if (values.importWattHours[i] != P1Values::NO_COUNTER) {
+      sum += values.importWattHours[i];
+    }
+    if (values.exportWattHours[i] != P1Values::NO_COUNTER) {
+      sum += values.exportWattHours[i];
+    }
+  }
+  return sum;
+}
+
+bool hasPassed(unsigned long sinceMillis, unsigned long intervalMillis, unsigned long nowMillis) {
+  // This works even if the clock wrapped around.
+  return nowMillis - sinceMillis + UploadPolicy::TOLERANCE_MILLIS >= intervalMillis;
+}
+
+}
+
+UploadPolicy::Reason UploadPolicy::check(P1Values const &values, size_t numPendingRollups, unsigned long nowMillis) {
+  Reason const reason = decide(values, numPendingRollups, nowMillis);
+  if (reason == Reason::NONE) {
+    stats_.suppressed++;
+    stats_.suppressedSinceUpload++;
+  } else {
+    pendingReason_ = reason;
+  }
+  return reason;
+}
+
+UploadPolicy::Reason UploadPolicy::decide(P1Values const &values, size_t numPendingRollups, unsigned long nowMillis) const {
+  if (hasAttempted_ && !hasPassed(lastAttemptMillis_, settings_.minIntervalMillis, nowMillis)) {
+    return Reason::NONE;
+  }
+  if (!hasUploaded_) {
+    return Reason::FIRST;
+  }
+  if (!settings_.deadbandWatts && !settings_.counterThresholdWattHours) {
+    return Reason::INTERVAL;
+  }
+
+  double const netWatts = values.netWatts();
+  if (settings_.deadbandWatts &&
+      (std::isnan(netWatts) != std::isnan(lastNetWatts_) ||
+       fabs(netWatts - lastNetWatts_) >= settings_.deadbandWatts)) {
+    return Reason::POWER;
+  }
+  if (settings_.counterThresholdWattHours) {
+    uint64_t const counters = sumCounters(values);
+    uint64_t const change = counters > lastCounterWattHours_ ?
+      counters - lastCounterWattHours_ : lastCounterWattHours_ - counters;
+    if (change >= settings_.counterThresholdWattHours) {
+      return Reason::COUNTER;
+    }
+  }
+  if (settings_.rollupQueueSize && numPendingRollups >= settings_.rollupQueueSize / 2) {
+    return Reason::ROLLUPS;
+  }
+  if (hasPassed(lastUploadMillis_, settings_.heartbeatMillis, nowMillis)) {
+    return Reason::HEARTBEAT;
+  }
+  return Reason::NONE;
+}
+
+void UploadPolicy::uploaded(P1Values const &values, unsigned long nowMillis, bool success) {
+  hasAttempted_ = true;
+  lastAttemptMillis_ = nowMillis;
+  if (!success) {
+    stats_.failures++;
+    return;
+  }
+  stats_.uploads[static_cast<size_t>(pendingReason_)]++;
+  hasUploaded_ = true;
+  lastUploadMillis_ = nowMillis;
+  lastNetWatts_ = values.netWatts();
+  lastCounterWattHours_ = sumCounters(values);
+  stats_.suppressedSinceUpload = 0;
+}
+
+char const *UploadPolicy::reasonName(Reason reason) {
+  switch (reason) {
+    case Reason::NONE: return "none";
+    case Reason::FIRST: return "first";
+    case Reason::INTERVAL: return "interval";
+    case Reason::POWER: return "power";
+    case Reason::COUNTER: return "counter";
+    case Reason::ROLLUPS: return "rollups";
+    case Reason::HEARTBEAT: return "heartbeat";
+  }
+  return "unknown";
+}
@@ -0,0 +1,94 @@
+#pragma once
+
+#include <Arduino.h>
+
+#include "P1Values.h"
+
+/**
+ * Decides for each telegram whether to upload it now, or to let it be
+ * coalesced into the next upload; it still goes into the rollups either way.
+ * Most telegrams differ from the previous upload by only a few watts, so
+ * skipping those saves radio time and server load without losing much.
+ *
+ * Never more often than every `minIntervalMillis`, a telegram is uploaded if:
+ * - net power moved by at least `deadbandWatts` since the last upload,
+ * - the energy counters, summed over all tariffs and directions, moved by at
+ *   least `counterThresholdWattHours`,
+ * - half of the rollup queue is full, so none need to be dropped, or
+ * - nothing has been uploaded for `heartbeatMillis`.
+ * If both the deadband and the counter threshold are zero, every telegram
+ * after `minIntervalMillis` is uploaded, as if there were no policy.
+ *
+ * Uploads that fail don't count as uploads for the triggers above, so they
+ * are retried after `minIntervalMillis`.
+ */
+class UploadPolicy {
+  public:
+    enum class Reason {
+      // Don't upload.
+      NONE,
+      FIRST,
+      INTERVAL,
+      POWER,
+      COUNTER,
+      ROLLUPS,
+      HEARTBEAT,
+    };
+    static size_t const NUM_REASONS = 7;
+
+    // Telegrams arrive at intervals of about, not exactly, 1 or 10 seconds,
+    // so intervals are considered to have passed a little early.
+    static unsigned long const TOLERANCE_MILLIS = 500;
+
+    struct Settings {
+      unsigned long minIntervalMillis = 10000;
+      unsigned long heartbeatMillis = 15ul * 60 * 1000;
+      uint32 deadbandWatts = 0;
+      uint32 counterThresholdWattHours = 0;
+      size_t rollupQueueSize = 0;
+    };
+
+    struct Stats {
+      // Successful uploads, by reason.
+      uint32 uploads[NUM_REASONS] = {};
+      // Telegrams that were not uploaded, in total and since the last
+      // successful upload.
+      uint32 suppressed = 0;
+      uint32 suppressedSinceUpload = 0;
+      // Failed uploads, whatever the reason.
+      uint32 failures = 0;
+    };
+
+    void begin(Settings const &settings) { settings_ = settings; }
+
+    /**
+     * Returns why the telegram with the given values should be uploaded now,
+     * or `NONE` if it shouldn't. Counts suppressed telegrams, so call this
+     * exactly once per telegram.
+     */
+    Reason check(P1Values const &values, size_t numPendingRollups, unsigned long nowMillis);
+
+    /**
+     * Records the outcome of an upload that `check()` asked for.
+     */
+    void uploaded(P1Values const &values, unsigned long nowMillis, bool success);
+
+    Stats const &stats() const { return stats_; }
+
+    static char const *reasonName(Reason reason);
+
+  private:
+    Settings settings_;
+    Stats stats_;
+    // What `check()` last asked to upload for.
+    Reason pendingReason_ = Reason::NONE;
+    bool hasAttempted_ = false;
+    bool hasUploaded_ = false;
+    unsigned long lastAttemptMillis_ = 0;
+    unsigned long lastUploadMillis_ = 0;
+    // Values at the last successful upload.
+    double lastNetWatts_ = NAN;
+    uint64_t lastCounterWattHours_ = 0;
+
+    Reason decide(P1Values const &values, size_t numPendingRollups, unsigned long nowMillis) const;
+};
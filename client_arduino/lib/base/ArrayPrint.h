@@ -0,0 +1,36 @@
+#pragma once
+
+#include <Arduino.h>
+
+/**
+ * Prints into a fixed array. Writes beyond the end of the array are dropped,
+ * and remembered, so that the caller can tell the output was truncated.
+ */
+class ArrayPrint : public Print {
+  public:
+    ArrayPrint(char *buffer, size_t capacity) : buffer_(buffer), capacity_(capacity) {}
+
+    size_t write(uint8_t c) override {
+      return write(&c, 1);
+    }
+
+    size_t write(uint8_t const *data, size_t size) override {
+      size_t const available = capacity_ - size_;
+      if (size > available) {
+        overflowed_ = true;
+        size = available;
+      }
+      memcpy(buffer_ + size_, data, size);
+      size_ += size;
+      return size;
+    }
+
+    size_t size() const { return size_; }
+    bool overflowed() const { return overflowed_; }
+
+  private:
+    char *buffer_;
+    size_t capacity_;
+    size_t size_ = 0;
+    bool overflowed_ = false;
+};
@@ -0,0 +1,47 @@
+#pragma once
+
+#include <Arduino.h>
+
+/**
+ * Collects small writes into larger ones before passing them on. Writing to a
+ * `WiFiClientSecure` byte by byte would otherwise send a TLS record (and
+ * likely a TCP segment) for every single write.
+ */
+template<size_t SIZE>
+class BufferedPrint : public Print {
+  public:
+    explicit BufferedPrint(Print &out) : out_(out) {}
+
+    ~BufferedPrint() {
+      flush();
+    }
+
+    using Print::write;
+
+    size_t write(uint8_t c) override {
+      if (size_ == SIZE) {
+        flush();
+      }
+      buffer_[size_++] = c;
+      return 1;
+    }
+
+    size_t write(uint8_t const *buffer, size_t size) override {
+      for (size_t i = 0; i < size; i++) {
+        write(buffer[i]);
+      }
+      return size;
+    }
+
+    void flush() override {
+      if (size_) {
+        out_.write(buffer_, size_);
+        size_ = 0;
+      }
+    }
+
+  private:
+    Print &out_;
+    uint8_t buffer_[SIZE];
+    size_t size_ = 0;
+};
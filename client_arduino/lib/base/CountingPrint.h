@@ -0,0 +1,28 @@
+#pragma once
+
+#include <Arduino.h>
+
+/**
+ * Counts the bytes written to it, and drops them. Writing a response twice,
+ * first to one of these, gives its Content-Length without keeping it in
+ * memory.
+ */
+class CountingPrint : public Print {
+  public:
+    using Print::write;
+
+    size_t write(uint8_t) override {
+      count_++;
+      return 1;
+    }
+
+    size_t write(uint8_t const *, size_t size) override {
+      count_ += size;
+      return size;
+    }
+
+    size_t count() const { return count_; }
+
+  private:
+    size_t count_ = 0;
+};
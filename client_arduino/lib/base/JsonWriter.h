@@ -0,0 +1,86 @@
+#pragma once
+
+#include <Arduino.h>
+
+/**
+ * Writes JSON tokens to a `Print`, in small pieces, without building a
+ * document in memory. Keeps count of the bytes written. Structure (braces,
+ * keys and commas) is up to the caller, through `write()`.
+ */
+class JsonWriter {
+  public:
+    explicit JsonWriter(Print &out) : out_(out) {}
+
+    size_t written() const { return written_; }
+
+    void write(char const *s) {
+      written_ += out_.write(s, strlen(s));
+    }
+
+    void writeUnsigned(uint64_t value) {
+      char buffer[21];
+      size_t length = sizeof(buffer);
+      do {
+        buffer[--length] = '0' + value % 10;
+        value /= 10;
+      } while (value);
+      written_ += out_.write(buffer + length, sizeof(buffer) - length);
+    }
+
+    void writeSigned(int64_t value) {
+      if (value < 0) {
+        write("-");
+        // Negate in unsigned arithmetic, so that INT64_MIN survives.
+        writeUnsigned(-static_cast<uint64_t>(value));
+      } else {
+        writeUnsigned(value);
+      }
+    }
+
+    /**
+     * Writes the number with the given number of decimals, or `null` if it is
+     * NaN or infinite, which JSON has no representation for.
+     */
+    void writeNumber(double value, int decimals = 3) {
+      if (!std::isfinite(value)) {
+        write("null");
+        return;
+      }
+      char buffer[32];
+      int const length = snprintf(buffer, sizeof(buffer), "%.*f", decimals, value);
+      written_ += out_.write(buffer, length);
+    }
+
+    /**
+     * Writes the bytes as a JSON string. Runs of bytes that need no escaping
+     * are written in one go.
+     */
+    void writeString(byte const *bytes, size_t size) {
+      write("\"");
+      size_t start = 0;
+      for (size_t i = 0; i < size; i++) {
+        char escape[7] = {};
+        switch (bytes[i]) {
+          case '"': strcpy(escape, "\\\""); break;
+          case '\\': strcpy(escape, "\\\\"); break;
+          case '\r': strcpy(escape, "\\r"); break;
+          case '\n': strcpy(escape, "\\n"); break;
+          default:
+            if (bytes[i] < 0x20 || bytes[i] >= 0x7f) {
+              snprintf(escape, sizeof(escape), "\\u%04x", bytes[i]);
+            }
+        }
+        if (escape[0]) {
+          written_ += out_.write(bytes + start, i - start);
+          write(escape);
+          start = i + 1;
+        }
+      }
+      written_ += out_.write(bytes + start, size - start);
+      write("\"");
+    }
+
+  private:
+    Print &out_;
+    size_t written_ = 0;
+};
@@ -0,0 +1,55 @@
+#pragma once
+
+#include <atomic>
+
+/**
+ * Holds a copy of a small, trivially copyable value that one writer updates
+ * and any number of readers read, without either side ever waiting for the
+ * other. Readers that overlap with a write notice from the sequence number
+ * and read again, so a reader never sees half of an update.
+ *
+ * Read only from loop context. The writer may be in the loop too, or in a
+ * callback that interrupts a reader. A reader that interrupts the writer
+ * instead, such as a callback on the single-core ESP8266, would wait for a
+ * write that can't finish until it returns, and spin forever.
+ *
+ * There must be only one writer. Only plain atomic loads and stores are used,
+ * no read-modify-write operations, which the ESP8266 has no instructions for.
+ */
+template<typename T>
+class SeqLock {
+  public:
+    SeqLock() : value_() {}
+
+    void write(T const &value) {
+      uint32_t const sequence = sequence_.load(std::memory_order_relaxed);
+      // An odd sequence number means a write is in progress.
+      sequence_.store(sequence + 1, std::memory_order_relaxed);
+      std::atomic_thread_fence(std::memory_order_release);
+      value_ = value;
+      std::atomic_thread_fence(std::memory_order_release);
+      sequence_.store(sequence + 2, std::memory_order_relaxed);
+    }
+
+    T read() const {
+      while (true) {
+        uint32_t const before = sequence_.load(std::memory_order_acquire);
+        T const value = value_;
+        std::atomic_thread_fence(std::memory_order_acquire);
+        uint32_t const after = sequence_.load(std::memory_order_relaxed);
+        if (before == after && !(before & 1)) {
+          return value;
+        }
+      }
+    }
+
+    /**
+     * Incremented by two on every write, so readers can tell cheaply whether
+     * anything changed since they last looked.
+     */
+    uint32_t sequence() const { return sequence_.load(std::memory_order_acquire) & ~1u; }
+
+  private:
+    std::atomic<uint32_t> sequence_{0};
+    T value_;
+};
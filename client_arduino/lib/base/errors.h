@@ -1,5 +1,7 @@
 #pragma once
 
+#include <stddef.h>
+
 enum ErrorCode {
   NO_ERROR = 0,
   WIFI_CONNECT_ERROR = 1,
@@ -18,4 +20,35 @@ enum ErrorCode {
   MODBUS_DNS_ERROR = 14,
   MODBUS_CONNECT_ERROR = 15,
   SUNSPEC_PROTOCOL_ERROR = 16,
+  SERVER_DNS_ERROR = 17,
 };
+
+// One more than the highest error code; keep it up to date.
+size_t const NUM_ERROR_CODES = SERVER_DNS_ERROR + 1;
+
+/**
+ * The name of the error code as it appears above, for logs and metrics.
+ */
+inline char const *errorName(ErrorCode error) {
+  switch (error) {
+    case NO_ERROR: return "NO_ERROR";
+    case WIFI_CONNECT_ERROR: return "WIFI_CONNECT_ERROR";
+    case NTP_ERROR: return "NTP_ERROR";
+    case TELEGRAM_READ_ERROR: return "TELEGRAM_READ_ERROR";
+    case TELEGRAM_READ_TIMEOUT: return "TELEGRAM_READ_TIMEOUT";
+    case TELEGRAM_CHECKSUM_ERROR: return "TELEGRAM_CHECKSUM_ERROR";
+    case SERVER_CONNECT_ERROR: return "SERVER_CONNECT_ERROR";
+    case SERVER_SSL_ERROR: return "SERVER_SSL_ERROR";
+    case SERVER_READ_ERROR: return "SERVER_READ_ERROR";
+    case SERVER_PROTOCOL_ERROR: return "SERVER_PROTOCOL_ERROR";
+    case SERVER_RESPONSE_ERROR: return "SERVER_RESPONSE_ERROR";
+    case CONFIG_OPEN_ERROR: return "CONFIG_OPEN_ERROR";
+    case CONFIG_PARSE_ERROR: return "CONFIG_PARSE_ERROR";
+    case CONFIG_VALUE_ERROR: return "CONFIG_VALUE_ERROR";
+    case MODBUS_DNS_ERROR: return "MODBUS_DNS_ERROR";
+    case MODBUS_CONNECT_ERROR: return "MODBUS_CONNECT_ERROR";
+    case SUNSPEC_PROTOCOL_ERROR: return "SUNSPEC_PROTOCOL_ERROR";
+    case SERVER_DNS_ERROR: return "SERVER_DNS_ERROR";
+  }
+  return "UNKNOWN_ERROR";
+}
@@ -1,17 +1,35 @@
 #include <Arduino.h>
-#include <ArduinoHttpServer.h>
 #include <ESP8266WiFi.h>
 #include <InverterReader.h>
 #include <LittleFS.h>
 #include <SoftwareSerial.h>
+#include <sys/time.h>
 #include <time.h>
 #include <WiFiClientSecure.h>
 
 #include "Config.h"
+#include "ArrayPrint.h"
+#include "BufferedPrint.h"
+#include "CountingPrint.h"
+#include "CurrentReadings.h"
 #include "errors.h"
+#include "EventStream.h"
+#include "History.h"
+#include "HostCache.h"
+#include "HttpServer.h"
 #include "InverterReader.h"
+#include "JsonWriter.h"
+#include "LatencyTrace.h"
 #include "Led.h"
+#include "Log.h"
+#include "Metrics.h"
+#include "PowerBalance.h"
+#include "Profiler.h"
+#include "Rollup.h"
+#include "Sample.h"
 #include "TelegramReader.h"
+#include "TlsTuning.h"
+#include "UploadPolicy.h"
 
 #include "dist_files.cpp" // Headers? We don't need no stinkin' headers!
 
@@ -26,18 +44,22 @@
 // https://github.com/plerup/espsoftwareserial#resource-optimization
 // because there is a second buffer, the signal edge detection buffer, which is
 // probably the one that fills up between read() calls. We'd need about
-// 10*1024*4 = 40 kB for that to hold an entire telegram.
+// 10*1024*4 = 40 kB for that to hold an entire telegram. The TLS buffers are
+// much smaller now if the server supports MFLN; prikmeter_p1_buffer_max_bytes
+// in /metrics says how much room that leaves.
 #define P1_BUFFER_SIZE_BYTES 128
+// Heap taken by each byte of that buffer: the byte itself, and 10 signal edge
+// timestamps of 4 bytes each.
+#define P1_HEAP_BYTES_PER_BUFFER_BYTE 41
 
 #define TELEGRAM_READ_TIMEOUT_MILLIS 5000
-#define MIN_TELEGRAM_INTERVAL_MILLIS 9500
-
-#define INVERTER_READ_INTERVAL_MILLIS 10000
-
 #define USER_AGENT "prikmeter"
 
 #define HTTP_PORT 80
 
+// How often the profile is printed, if built with PROFILING=1.
+#define PROFILE_INTERVAL_MILLIS 60000
+
 #ifdef READ_FROM_SERIAL
 #  define P1_INPUT Serial // Debugging aid.
 #else
@@ -48,59 +70,215 @@ Led led;
 SoftwareSerial p1;
 Config config;
 TelegramReader telegramReader;
+HostCache hostCache;
 InverterReader inverterReader;
+PowerBalance powerBalance;
+RollupAggregator rollups;
+History history;
+UploadPolicy uploadPolicy;
+CurrentReadings currentReadings;
+EventStream eventStream;
 Session tlsSession;
 WiFiClientSecure httpsClient;
-WiFiServer httpServer(HTTP_PORT);
+TlsTuning tlsTuning;
+HttpServer httpServer(HTTP_PORT);
+
+void handleRequest(HttpRequestParser const &request, HttpResponse &response);
+
+// Counters for /metrics that the libraries don't keep themselves.
+uint32 numTelegramsReceived = 0;
+uint32 numErrors[NUM_ERROR_CODES] = {};
+uint32 numTlsHandshakes = 0;
+uint32 numTlsResumptions = 0;
+uint32 const UPLOAD_MILLIS_BOUNDS[] = {100, 250, 500, 1000, 2500, 5000, 10000};
+Histogram uploadMillis(UPLOAD_MILLIS_BOUNDS);
+uint32 const LOOP_MICROS_BOUNDS[] = {100, 500, 1000, 5000, 10000, 50000, 100000, 500000, 1000000};
+Histogram loopMicros(LOOP_MICROS_BOUNDS);
+// The trace of the telegram being read or uploaded, and that of the last
+// upload, whose later spans are only known after it was sent.
+LatencyTrace telegramTrace;
+LatencyTrace lastUploadTrace;
+LatencyStats latencyStats;
+uint8 const LATENCY_PERCENTILES[] = {50, 90, 99};
 
-// TODO store all strings in PROGMEM using the F() macro:
-// https://arduino-esp8266.readthedocs.io/en/3.0.2/PROGMEM.html
+/**
+ * Counts the error, and flashes its code on the LED.
+ */
+void reportError(ErrorCode error) {
+  numErrors[error]++;
+  led.flashNumber(error);
+}
 
 void printTelegram(byte const *buffer, unsigned int size) {
   Serial.write(buffer, size);
 }
 
 /**
- * Uploads the telegram in the given `buffer` of `size` bytes to the server.
- * Returns `true` on success.
+ * Probes the server for the smallest TLS buffers and the fastest cipher suite
+ * it allows, and configures the upload client accordingly. Blocks for a few
+ * handshakes.
+ */
+void tuneTls() {
+  if (!tlsTuning.probe(config.serverHost(), config.serverPort(), config.serverCertificateFingerprint())) {
+    return;
+  }
+  tlsTuning.apply(httpsClient);
+  TlsTuning::Result const &result = tlsTuning.result();
+  if (!result.cipherSuite) {
+    // No probe connection to report on.
+    return;
+  }
+  // What the heap could still spare for the P1 port while uploading. The P1
+  // buffer that is already allocated would come on top of this.
+  LOG_INFO("tls", "Free heap during TLS connection: %u bytes, largest block %u bytes; "
+      "room for a P1 buffer of %u bytes, besides the current %u",
+      result.connectedFreeHeap, result.connectedMaxFreeBlockSize,
+      result.connectedMaxFreeBlockSize / P1_HEAP_BYTES_PER_BUFFER_BYTE, P1_BUFFER_SIZE_BYTES);
+}
+
+/**
+ * Returns the wall-clock time, in milliseconds since the epoch.
+ */
+uint64_t epochMillis() {
+  timeval now;
+  gettimeofday(&now, nullptr);
+  return static_cast<uint64_t>(now.tv_sec) * 1000 + now.tv_usec / 1000;
+}
+
+/**
+ * Fills `devices` with the latest values of the inverters that have been read
+ * successfully, and returns how many there are.
  */
-ErrorCode uploadTelegram(byte const *buffer, uint16 size) {
-  if (!httpsClient.connect(config.serverHost(), config.serverPort())) {
-    Serial.print("Failed to connect to ");
-    Serial.print(config.serverHost());
-    Serial.print(":");
-    Serial.print(config.serverPort());
+size_t readyDevices(Sample::Device (&devices)[Sample::MAX_DEVICES]) {
+  size_t count = 0;
+  for (size_t i = 0; i < inverterReader.numDevices() && count < Sample::MAX_DEVICES; i++) {
+    if (inverterReader.isReady(i)) {
+      devices[count++] = {
+          static_cast<uint8>(i),
+          inverterReader.readMillis(i),
+          inverterReader.powerWatts(i),
+          inverterReader.totalEnergyWattHours(i)};
+    }
+  }
+  return count;
+}
+
+/**
+ * Reformats the snapshot served by the local API from the latest values, and
+ * pushes it to stream subscribers.
+ */
+void updateCurrentReadings() {
+  Sample::Device devices[Sample::MAX_DEVICES];
+  currentReadings.setDevices(devices, readyDevices(devices));
+  currentReadings.setBalance(powerBalance.snapshot());
+  unsigned long const nowMillis = millis();
+  currentReadings.format(epochMillis(), nowMillis);
+  eventStream.publish(EventStream::READINGS, "reading", currentReadings.json(), currentReadings.jsonSize());
+}
+
+/**
+ * Uploads the telegram in the given `buffer` of `size` bytes, which started
+ * arriving at `receivedMillis`, to the server, together with the latest
+ * values of the inverters and the completed rollups, as a single sample.
+ * `resolved` and `serverAddress` are what the host cache returned for the
+ * server, other than `PENDING`. Marks the stages of the upload in `trace`,
+ * and sends the spans known so far along, as well as those of the previous
+ * upload. Returns the error that made the upload fail, or `NO_ERROR`.
+ */
+ErrorCode uploadTelegram(byte const *buffer, uint16 size, unsigned long receivedMillis,
+    HostCache::Status resolved, IPAddress const &serverAddress, LatencyTrace *trace) {
+  PROFILE_ZONE("upload");
+  Sample sample;
+  sample.setTelegram(buffer, size, receivedMillis);
+  rollups.advance(time(nullptr));
+  sample.setRollups(rollups.pending(), rollups.numPending());
+  Sample::Device devices[Sample::MAX_DEVICES];
+  size_t const numDevices = readyDevices(devices);
+  for (size_t i = 0; i < numDevices; i++) {
+    sample.addDevice(devices[i]);
+  }
+
+  if (resolved == HostCache::Status::FAILED) {
+    return SERVER_DNS_ERROR;
+  }
+  trace->mark(LatencyTrace::Stage::RESOLVED, millis());
+
+  // If the server resumes the session, its parameters stay the same;
+  // otherwise the full handshake replaces them. `Session` doesn't let us look
+  // inside, so compare its bytes.
+  uint8 previousSession[sizeof(tlsSession)];
+  memcpy(previousSession, &tlsSession, sizeof(tlsSession));
+  static bool hasSession = false;
+
+  // Connecting by name sends the name for SNI. The lookup that implies is
+  // answered from lwIP's cache, which our own cache entry never outlives by
+  // much. If DNS is down, fall back to the last known address, without SNI;
+  // the certificate fingerprint is checked either way.
+  bool connected;
+  {
+    PROFILE_ZONE("upload.connect");
+    connected = resolved == HostCache::Status::DONE ?
+      httpsClient.connect(config.serverHost(), config.serverPort()) :
+      httpsClient.connect(serverAddress, config.serverPort());
+  }
+  if (!connected) {
     if (httpsClient.getLastSSLError()) {
-      char sslError[256];
+      char sslError[96];
       httpsClient.getLastSSLError(sslError, sizeof(sslError) / sizeof(char));
-      Serial.print(" due to SSL error: ");
-      Serial.print(sslError);
-      Serial.println();
+      LOG_ERROR("upload", "Failed to connect to %s:%u due to SSL error: %s",
+          config.serverHost(), config.serverPort(), sslError);
       return SERVER_SSL_ERROR;
     } else {
-      Serial.println();
+      LOG_ERROR("upload", "Failed to connect to %s:%u", config.serverHost(), config.serverPort());
       return SERVER_CONNECT_ERROR;
     }
   }
+  trace->mark(LatencyTrace::Stage::CONNECTED, millis());
+  if (hasSession && memcmp(previousSession, &tlsSession, sizeof(tlsSession)) == 0) {
+    numTlsResumptions++;
+  } else {
+    numTlsHandshakes++;
+  }
+  hasSession = true;
+
+  unsigned long const nowMillis = millis();
+  uint64_t const nowEpochMillis = epochMillis();
+  size_t const contentLength = sample.jsonLength(nowEpochMillis, nowMillis);
 
   httpsClient.print(
-      "POST /telegrams HTTP/1.1\r\n"
+      "POST /samples HTTP/1.1\r\n"
       "Host: ");
   httpsClient.print(config.serverHost());
   httpsClient.print("\r\n"
       "User-Agent: " USER_AGENT " ");
   httpsClient.print(GIT_VERSION);
   httpsClient.print("\r\n"
-      "Content-Type: text/plain\r\n"
+      "Content-Type: application/json\r\n"
       "Content-Length: ");
-  httpsClient.print(size);
+  httpsClient.print(contentLength);
   httpsClient.print("\r\n"
       "X-Auth-Token: ");
   httpsClient.print(config.authToken());
+  httpsClient.print("\r\n"
+      "X-Trace-Captured: ");
+  JsonWriter(httpsClient).writeUnsigned(trace->captureEpochMillis(nowEpochMillis, nowMillis));
+  httpsClient.print("\r\n"
+      "X-Trace-Spans: ");
+  trace->writeSpans(httpsClient);
+  if (lastUploadTrace.has(LatencyTrace::Stage::STATUS_RECEIVED)) {
+    httpsClient.print("\r\n"
+        "X-Trace-Previous-Spans: ");
+    lastUploadTrace.writeSpans(httpsClient);
+  }
   httpsClient.print("\r\n"
       "Connection: close\r\n"
       "\r\n");
-  httpsClient.write(buffer, size);
+  {
+    PROFILE_ZONE("upload.body");
+    BufferedPrint<256> body(httpsClient);
+    sample.writeJson(body, nowEpochMillis, nowMillis);
+  }
+  trace->mark(LatencyTrace::Stage::REQUEST_SENT, millis());
 
   // "HTTPS/1.1 ", we stop reading after the space.
   while (true) {
@@ -130,11 +308,11 @@ ErrorCode uploadTelegram(byte const *buffer, uint16 size) {
       return SERVER_PROTOCOL_ERROR;
     }
   }
+  trace->mark(LatencyTrace::Stage::STATUS_RECEIVED, millis());
   if (statusCode != 200) {
-    Serial.print("Non-success HTTP response code from server: ");
-    Serial.print(statusCode);
-    Serial.print(" ");
-    // "OK" or whatever descriptive message there is.
+    // "OK" or whatever descriptive message there is, as far as it fits.
+    char reason[64];
+    size_t reasonLength = 0;
     while (true) {
       int b = httpsClient.read();
       if (b < 0) {
@@ -144,9 +322,12 @@ ErrorCode uploadTelegram(byte const *buffer, uint16 size) {
       if (b == '\r') {
         break;
       }
-      Serial.write((byte) b);
+      if (reasonLength < sizeof(reason) - 1) {
+        reason[reasonLength++] = b;
+      }
     }
-    Serial.println();
+    reason[reasonLength] = '\0';
+    LOG_ERROR("upload", "Non-success HTTP response code from server: %d %s", statusCode, reason);
     httpsClient.stop();
     if (statusCode == 400) {
       return TELEGRAM_CHECKSUM_ERROR;
@@ -155,9 +336,15 @@ ErrorCode uploadTelegram(byte const *buffer, uint16 size) {
     }
   }
 
-  Serial.print("Uploaded telegram of ");
-  Serial.print(size);
-  Serial.println(" bytes");
+  LOG_INFO("upload", "Uploaded sample of %u bytes with %u inverter readings and %u rollups",
+      static_cast<unsigned>(contentLength), static_cast<unsigned>(sample.numDevices()),
+      static_cast<unsigned>(sample.numRollups()));
+  // Rollups that were uploaded but not acknowledged are sent again; the
+  // server ignores the duplicates.
+  rollups.removePending(sample.numRollups());
+  // Free the TLS buffers until the next upload; the session stays for
+  // resumption.
+  httpsClient.stop();
   return NO_ERROR;
 }
 
@@ -167,72 +354,108 @@ void setup() {
 
   Serial.begin(115200);
 
-  Serial.println("Mounting file system");
+  LOG_INFO("setup", "Mounting file system");
   LittleFSConfig fsConfig;
   fsConfig.setAutoFormat(false); // TODO set to true once we have a configuration UI
   LittleFS.setConfig(fsConfig);
   LittleFS.begin();
 
-  Serial.println("Reading configuration");
+  LOG_INFO("setup", "Reading configuration");
   ErrorCode error = config.begin();
   if (error) {
-    led.flashNumber(error);
+    reportError(error);
     return;
   }
 
+  UploadPolicy::Settings uploadSettings;
+  uploadSettings.minIntervalMillis = config.uploadIntervalSeconds() * 1000;
+  uploadSettings.heartbeatMillis = config.uploadHeartbeatSeconds() * 1000;
+  uploadSettings.deadbandWatts = config.uploadDeadbandWatts();
+  uploadSettings.counterThresholdWattHours = config.uploadCounterThresholdWattHours();
+  uploadSettings.rollupQueueSize = RollupAggregator::MAX_PENDING;
+  uploadPolicy.begin(uploadSettings);
+
   httpsClient.setSession(&tlsSession);
   httpsClient.setFingerprint(config.serverCertificateFingerprint());
 
-  Serial.println("Opening P1 port");
+  LOG_INFO("setup", "Opening P1 port");
   p1.begin(P1_BAUD, P1_CONFIG, P1_PIN, -1, P1_INVERT, P1_BUFFER_SIZE_BYTES);
 
-  Serial.print("Connecting to wifi access point \"");
-  Serial.print(config.wifiSsid());
-  Serial.print("\" [");
+  LOG_INFO("setup", "Connecting to wifi access point \"%s\"", config.wifiSsid());
   WiFi.mode(WIFI_STA);
   WiFi.begin(config.wifiSsid(), config.wifiPassword());
   while (WiFi.status() != WL_CONNECTED) {
     led.flash(250);
     delay(250);
-    Serial.print(".");
+    Log::drainToSerial();
   }
-  Serial.println("]");
-  Serial.print("Connected, IP address: ");
-  Serial.println(WiFi.localIP());
+  LOG_INFO("setup", "Connected, IP address: %s", WiFi.localIP().toString().c_str());
 
-  Serial.print("Synchronizing system clock to NTP server [");
+  LOG_INFO("setup", "Synchronizing system clock to NTP server");
   configTime(0, 0, "pool.ntp.org", "time.nist.gov");
   time_t now = time(nullptr);
   while (now < 1000) {
     led.flash(125);
     delay(125);
-    Serial.print(".");
+    Log::drainToSerial();
     now = time(nullptr);
   }
-  Serial.println("]");
   now = time(nullptr);
-  Serial.print("Current time: ");
-  Serial.print(ctime(&now));
+  // Without the newline that `ctime()` ends with.
+  LOG_INFO("setup", "Current time: %.24s", ctime(&now));
+
+  LOG_INFO("setup", "Tuning TLS to the server");
+  tuneTls();
 
-  Serial.println("Setting up inverter reader");
-  inverterReader.begin(config);
+  LOG_INFO("setup", "Setting up inverter reader");
+  inverterReader.begin(config, &hostCache);
 
-  Serial.print("Starting to listen on http://");
-  Serial.print(WiFi.localIP());
-  Serial.print(":");
-  Serial.println(HTTP_PORT);
-  httpServer.begin();
+  LOG_INFO("setup", "Starting to listen on http://%s:%d", WiFi.localIP().toString().c_str(), HTTP_PORT);
+  httpServer.begin(handleRequest);
 
-  Serial.println("Enabling auto sleep");
+  updateCurrentReadings();
+
+  LOG_INFO("setup", "Enabling auto sleep");
   WiFi.setSleepMode(WIFI_MODEM_SLEEP);
 
-  Serial.println("Up and running");
+  LOG_INFO("setup", "Up and running; free heap %u bytes, largest block %u bytes",
+      ESP.getFreeHeap(), ESP.getMaxFreeBlockSize());
 
   led.set(false);
 
-  // Serial.println("Sending test telegram");
+  // LOG_INFO("setup", "Sending test telegram");
   // char const *testTelegram = "/hello\r\n!world\r\n";
-  // uploadTelegram((byte const *) testTelegram, strlen(testTelegram));
+  // telegramTrace.begin(millis());
+  // uploadTelegram((byte const *) testTelegram, strlen(testTelegram), &telegramTrace);
+}
+
+/**
+ * Parses the telegram into `values`, and feeds them to the power balance and
+ * the rollups. The meter measures at the start of the telegram, so that is
+ * the time we attribute the values to, rather than when the telegram was
+ * complete.
+ */
+void processTelegram(byte const *buffer, unsigned int size, unsigned long measuredMillis, P1Values *values) {
+  PROFILE_ZONE("telegram.process");
+  if (!values->parse(buffer, size)) {
+    return;
+  }
+  uint32 const epochSeconds = time(nullptr) - (millis() - measuredMillis) / 1000;
+  rollups.add(*values, epochSeconds);
+  if (!std::isnan(values->importWatts)) {
+    history.add(lround(values->netWatts()), epochSeconds);
+  }
+  powerBalance.setP1Values(*values, measuredMillis);
+  currentReadings.setP1Values(*values, measuredMillis);
+  updateCurrentReadings();
+
+  PowerSnapshot const snapshot = powerBalance.snapshot();
+  if (std::isnan(snapshot.productionWatts)) {
+    LOG_INFO("p1", "Net power (W): %.2f", snapshot.netWatts);
+  } else {
+    LOG_INFO("p1", "Net power (W): %.2f, production (W): %.2f, self-consumption (W): %.2f",
+        snapshot.netWatts, snapshot.productionWatts, snapshot.selfConsumptionWatts);
+  }
 }
 
 void readP1() {
@@ -240,11 +463,9 @@ void readP1() {
   // read error and reset the reader for the next one.
   static unsigned long telegramStartTime = millis();
   if (!telegramReader.isEmpty() && millis() - telegramStartTime > TELEGRAM_READ_TIMEOUT_MILLIS) {
-    Serial.print("Telegram still not completed after ");
-    Serial.print(TELEGRAM_READ_TIMEOUT_MILLIS);
-    Serial.println(" ms");
+    LOG_WARNING("p1", "Telegram still not completed after %d ms", TELEGRAM_READ_TIMEOUT_MILLIS);
     telegramReader.reset();
-    led.flashNumber(TELEGRAM_READ_TIMEOUT);
+    reportError(TELEGRAM_READ_TIMEOUT);
   }
 
   // Read as many bytes as we can at once, so that the buffer is empty again
@@ -261,12 +482,13 @@ void readP1() {
 
     if (wasEmpty && !telegramReader.isEmpty()) {
       telegramStartTime = millis();
+      telegramTrace.begin(telegramStartTime);
     }
 
     if (telegramReader.hasError()) {
-      Serial.println("Telegram read error");
+      LOG_WARNING("p1", "Telegram read error");
       telegramReader.reset();
-      led.flashNumber(TELEGRAM_READ_ERROR);
+      reportError(TELEGRAM_READ_ERROR);
     }
 
     if (telegramReader.isComplete()) {
@@ -277,33 +499,62 @@ void readP1() {
 
       byte const *buffer = telegramReader.getBuffer();
       unsigned int size = telegramReader.getSize();
-      Serial.print("Received telegram of ");
-      Serial.print(size);
-      Serial.println(" bytes");
+      telegramTrace.mark(LatencyTrace::Stage::LAST_BYTE, millis());
+      numTelegramsReceived++;
+      LOG_INFO("p1", "Received telegram of %u bytes", size);
 
 #ifdef PRINT_TELEGRAM
       printTelegram(buffer, size);
 #endif
+      // Before the upload, which can take seconds.
+      eventStream.publish(EventStream::TELEGRAMS, "telegram", reinterpret_cast<char const *>(buffer), size);
+      P1Values values;
+      processTelegram(buffer, size, telegramStartTime, &values);
 #ifndef DONT_SEND_TELEGRAM
-      ErrorCode uploadError = uploadTelegram(buffer, size);
-      if (uploadError) {
-        led.flashNumber(static_cast<uint16>(uploadError));
+      // Every telegram goes into the rollups, but only some are uploaded.
+      UploadPolicy::Reason const uploadReason = uploadPolicy.check(values, rollups.numPending(), millis());
+      if (uploadReason != UploadPolicy::Reason::NONE && tlsTuning.isDue(millis())) {
+        // The server was unreachable at startup. Probing blocks for a few
+        // handshakes, which is fine here, with RX disabled.
+        tuneTls();
+      }
+      unsigned long const uploadStartMillis = millis();
+      IPAddress serverAddress;
+      HostCache::Status resolved = HostCache::Status::PENDING;
+      if (uploadReason != UploadPolicy::Reason::NONE) {
+        resolved = hostCache.resolve(config.serverHost(), &serverAddress);
+      }
+      if (uploadReason == UploadPolicy::Reason::NONE) {
+        LOG_DEBUG("upload", "Upload suppressed");
+      } else if (resolved == HostCache::Status::PENDING) {
+        // Rather than wait for DNS, upload the next telegram instead. The
+        // policy still asks for it, because this one wasn't attempted.
+        LOG_INFO("upload", "Still resolving %s; uploading a later telegram", config.serverHost());
       } else {
-        led.flash(50);
+        LOG_INFO("upload", "Uploading (%s), %u telegrams coalesced, %u suppressed in total",
+            UploadPolicy::reasonName(uploadReason),
+            uploadPolicy.stats().suppressedSinceUpload, uploadPolicy.stats().suppressed);
+        telegramTrace.mark(LatencyTrace::Stage::UPLOAD_START, uploadStartMillis);
+        ErrorCode uploadError = uploadTelegram(buffer, size, telegramStartTime, resolved, serverAddress, &telegramTrace);
+        uploadMillis.observe(millis() - uploadStartMillis);
+        latencyStats.add(telegramTrace);
+        lastUploadTrace = telegramTrace;
+        char spans[96];
+        ArrayPrint spansOut(spans, sizeof(spans) - 1);
+        telegramTrace.writeSpans(spansOut);
+        spans[spansOut.size()] = '\0';
+        LOG_DEBUG("upload", "Upload trace: %s", spans);
+        uploadPolicy.uploaded(values, millis(), !uploadError);
+        if (uploadError) {
+          reportError(uploadError);
+        } else {
+          led.flash(50);
+        }
       }
 #endif
 
       telegramReader.reset();
 
-      // This works even if the clock wrapped around.
-      unsigned long telegramReadTimeMillis = millis() - telegramStartTime;
-      if (MIN_TELEGRAM_INTERVAL_MILLIS > telegramReadTimeMillis) {
-        // The Arduino Core does continue processing system-level events during
-        // delay():
-        // https://arduino-esp8266.readthedocs.io/en/2.4.0-rc1/reference.html#timing-and-delays
-        delay(MIN_TELEGRAM_INTERVAL_MILLIS - telegramReadTimeMillis);
-      }
-
       P1_INPUT.flush();
 #ifndef READ_FROM_SERIAL
       P1_INPUT.enableRx(true);
@@ -313,116 +564,341 @@ void readP1() {
 }
 
 void readInverter() {
-  static unsigned long lastRead = 0;
+  // Nothing here blocks, but leave the loop to the P1 port while a telegram
+  // is arriving anyway.
+  if (!telegramReader.isEmpty()) {
+    return;
+  }
 
-  unsigned long const now = millis();
-  if (now - lastRead >= INVERTER_READ_INTERVAL_MILLIS) {
-    lastRead = now;
-    inverterReader.update();
-    Serial.print("Current power (W): ");
-    Serial.println(inverterReader.powerWatts());
-    Serial.print("Total energy (kWh): ");
-    Serial.println(inverterReader.totalEnergyWattHours() / 1000.0);
+  // Errors are reported per device by the reader itself.
+  ErrorCode const error = inverterReader.update();
+  if (error) {
+    numErrors[error]++;
+  }
+
+  if (!inverterReader.takeNewValues()) {
+    return;
+  }
+
+  for (size_t i = 0; i < inverterReader.numDevices(); i++) {
+    if (inverterReader.isReady(i)) {
+      powerBalance.addProduction(i, inverterReader.powerWatts(i), inverterReader.readMillis(i));
+    }
+  }
+  updateCurrentReadings();
+
+  if (inverterReader.isReady()) {
+    if (inverterReader.numDevices() > 1) {
+      for (size_t i = 0; i < inverterReader.numDevices(); i++) {
+        LOG_INFO("inverter", "Device %u power (W): %.2f, energy (kWh): %.2f, next poll in (s): %lu",
+            static_cast<unsigned>(i), inverterReader.powerWatts(i), inverterReader.totalEnergyWattHours(i) / 1000.0,
+            inverterReader.scheduler(i).intervalMillis() / 1000);
+      }
+    }
+    LOG_INFO("inverter", "Current power (W): %.2f, total energy (kWh): %.2f",
+        inverterReader.powerWatts(), inverterReader.totalEnergyWattHours() / 1000.0);
   }
 }
 
 /**
- * Simple HTTP response wrapper. We don't use the ArduinoHttpServer reply
- * classes because they are very inflexible; for example, they don't let us
- * send custom headers.
+ * Sends one of the preformatted representations of the current readings.
  */
-// TODO extract to separate file
-class HttpResponse {
-  public:
-    HttpResponse(WiFiClient &client) :
-      client_(client)
-    {
-    }
+void sendCurrentReadings(HttpResponse &response, char const *contentType, uint8_t const *data, size_t size) {
+  response.sendStatus(200, "OK");
+  response.sendHeader("Content-Type", contentType);
+  response.sendContentLength(size);
+  // Clients poll this, so caches should never answer for us.
+  response.sendHeader("Cache-Control", "no-store");
+  response.sendData(data, size);
+}
 
-    ~HttpResponse() {
-      client_.stop();
-    }
+/**
+ * Reads an optional numeric query parameter into `value`. Returns `false` if
+ * it is there, but not a number.
+ */
+bool readQueryParameter(HttpRequestParser const &request, char const *name, uint32 *value) {
+  StringRef const parameter = request.queryParameter(name);
+  return !parameter.data || parameter.toUnsigned(value);
+}
 
-    void sendStatus(int code, char const *text) {
-      client_.print("HTTP/1.1 ");
-      client_.print(code);
-      client_.print(" ");
-      client_.print(text);
-      client_.print("\r\n");
-    }
+/**
+ * Sends the history from `from` to `to` (epoch seconds), by default the last
+ * hour, in steps of `step` seconds, by default as fine as is available. The
+ * response is formatted twice, the first time only to find its length.
+ */
+void sendHistory(HttpRequestParser const &request, HttpResponse &response, History::Format format) {
+  uint32 to = time(nullptr);
+  uint32 step = 0;
+  bool valid = readQueryParameter(request, "to", &to) && readQueryParameter(request, "step", &step);
+  uint32 from = to - 3600;
+  valid = valid && readQueryParameter(request, "from", &from);
+  if (!valid) {
+    response.sendError(400);
+    return;
+  }
+  CountingPrint counter;
+  history.write(counter, format, from, to, step);
+  response.sendStatus(200, "OK");
+  response.sendHeader("Content-Type", format == History::Format::CSV ? "text/csv; charset=UTF-8" : "application/octet-stream");
+  response.sendContentLength(counter.count());
+  response.sendHeader("Cache-Control", "no-store");
+  history.write(response.body(), format, from, to, step);
+}
 
-    void sendHeader(char const *name, char const *value) {
-      client_.print(name);
-      client_.print(": ");
-      client_.print(value);
-      client_.print("\r\n");
-    }
+/**
+ * Values for /metrics that may change while the response is being written, so
+ * they are read once for both passes.
+ */
+struct MetricsGauges {
+  uint64_t uptimeSeconds;
+  uint32 freeHeap;
+  uint32 maxFreeBlockSize;
+  uint8 heapFragmentation;
+};
 
-    void sendData(String const &data) {
-      if (!headersEnded_) {
-        client_.print("\r\n");
-        headersEnded_ = true;
-      }
-      client_.print(data);
-    }
+/**
+ * Writes the metrics in the Prometheus text format.
+ */
+void writeMetrics(Print &out, MetricsGauges const &gauges) {
+  PrometheusWriter writer(out);
+
+  writer.family("prikmeter_uptime_seconds", "counter", "Time since the device started.");
+  writer.sample("prikmeter_uptime_seconds", gauges.uptimeSeconds);
+  writer.family("prikmeter_heap_free_bytes", "gauge", "Free heap memory.");
+  writer.sample("prikmeter_heap_free_bytes", gauges.freeHeap);
+  writer.family("prikmeter_heap_max_block_bytes", "gauge", "Largest block that can be allocated.");
+  writer.sample("prikmeter_heap_max_block_bytes", gauges.maxFreeBlockSize);
+  writer.family("prikmeter_heap_fragmentation_percent", "gauge", "Fragmentation of the free heap.");
+  writer.sample("prikmeter_heap_fragmentation_percent", gauges.heapFragmentation);
+  writer.histogram("prikmeter_loop_duration_seconds", "Duration of main loop iterations.", loopMicros, 1e-6, 6);
+
+  LogBuffer::Stats const &logStats = Log::buffer().stats();
+  writer.family("prikmeter_log_lines_total", "counter", "Lines logged.");
+  writer.sample("prikmeter_log_lines_total", logStats.lines);
+  writer.family("prikmeter_log_dropped_lines_total", "counter", "Log lines overwritten before they were written to the serial port.");
+  writer.sample("prikmeter_log_dropped_lines_total", logStats.dropped);
+
+  writer.family("prikmeter_errors_total", "counter", "Errors, by code.");
+  for (size_t i = 1; i < NUM_ERROR_CODES; i++) {
+    writer.sample("prikmeter_errors_total", "error", errorName(static_cast<ErrorCode>(i)), numErrors[i]);
+  }
 
-    void sendData_P(PGM_P data, size_t length) {
-      if (!headersEnded_) {
-        client_.print("\r\n");
-        headersEnded_ = true;
+  UploadPolicy::Stats const &uploadStats = uploadPolicy.stats();
+  writer.family("prikmeter_telegrams_received_total", "counter", "Complete telegrams read from the P1 port.");
+  writer.sample("prikmeter_telegrams_received_total", numTelegramsReceived);
+  writer.family("prikmeter_telegrams_suppressed_total", "counter", "Telegrams not uploaded because nothing changed.");
+  writer.sample("prikmeter_telegrams_suppressed_total", uploadStats.suppressed);
+  writer.family("prikmeter_uploads_total", "counter", "Successful uploads, by the reason for uploading.");
+  for (size_t i = 1; i < UploadPolicy::NUM_REASONS; i++) {
+    UploadPolicy::Reason const reason = static_cast<UploadPolicy::Reason>(i);
+    writer.sample("prikmeter_uploads_total", "reason", UploadPolicy::reasonName(reason), uploadStats.uploads[i]);
+  }
+  writer.family("prikmeter_upload_failures_total", "counter", "Failed uploads.");
+  writer.sample("prikmeter_upload_failures_total", uploadStats.failures);
+  writer.histogram("prikmeter_upload_duration_seconds", "Duration of uploads, including failed ones.", uploadMillis, 1e-3);
+  writer.family("prikmeter_upload_span_seconds", "summary",
+      "Stages of the latest uploads, from the first byte of the telegram to the server's status code.");
+  for (size_t i = 0; i < LatencyStats::NUM_SERIES; i++) {
+    for (uint8 percent : LATENCY_PERCENTILES) {
+      uint32 spanMillis;
+      if (latencyStats.percentile(i, percent, &spanMillis)) {
+        writer.quantile("prikmeter_upload_span_seconds", "span", LatencyStats::seriesName(i), percent / 100.0, spanMillis * 1e-3);
       }
-      client_.write_P(data, length);
     }
-
-    void sendError(int code, char const *text) {
-      sendStatus(code, text);
-      sendHeader("Content-Type", "text/plain; charset=UTF-8");
-      sendData(String(code));
-      sendData(" ");
-      sendData(text);
+  }
+  TlsTuning::Result const &tlsResult = tlsTuning.result();
+  writer.family("prikmeter_tls_receive_buffer_bytes", "gauge", "Plaintext capacity of the TLS receive buffer for uploads.");
+  writer.sample("prikmeter_tls_receive_buffer_bytes", tlsResult.receiveBufferSize);
+  writer.family("prikmeter_tls_send_buffer_bytes", "gauge", "Plaintext capacity of the TLS send buffer for uploads.");
+  writer.sample("prikmeter_tls_send_buffer_bytes", tlsResult.sendBufferSize);
+  writer.family("prikmeter_tls_heap_freed_bytes", "gauge", "Heap saved on TLS buffers, compared to the defaults.");
+  writer.sample("prikmeter_tls_heap_freed_bytes", tlsTuning.isDone() ? tlsTuning.heapFreedBytes() : 0);
+  writer.family("prikmeter_tls_probe_handshake_seconds", "gauge",
+      "Duration of a full handshake with each cipher suite when the server was probed, or NaN if it failed.");
+  for (size_t i = 0; i < TlsTuning::NUM_CIPHER_SUITES; i++) {
+    unsigned long const handshakeMillis = tlsResult.handshakeMillis[i];
+    writer.sampleNumber("prikmeter_tls_probe_handshake_seconds", "suite",
+        TlsTuning::cipherSuiteName(TlsTuning::CIPHER_SUITES[i]), handshakeMillis ? handshakeMillis * 1e-3 : NAN);
+  }
+  writer.family("prikmeter_p1_buffer_bytes", "gauge", "Receive buffer of the P1 port.");
+  writer.sample("prikmeter_p1_buffer_bytes", P1_BUFFER_SIZE_BYTES);
+  writer.family("prikmeter_p1_buffer_max_bytes", "gauge",
+      "Additional P1 receive buffer that would have fit in the heap during a TLS connection.");
+  writer.sample("prikmeter_p1_buffer_max_bytes", tlsResult.connectedMaxFreeBlockSize / P1_HEAP_BYTES_PER_BUFFER_BYTE);
+  writer.family("prikmeter_tls_connections_total", "counter", "TLS connections to the server, by handshake.");
+  writer.sample("prikmeter_tls_connections_total", "handshake", "full", numTlsHandshakes);
+  writer.sample("prikmeter_tls_connections_total", "handshake", "resumed", numTlsResumptions);
+
+  HostCache::Stats const &dnsStats = hostCache.stats();
+  writer.family("prikmeter_dns_lookups_total", "counter", "DNS lookups, by outcome.");
+  writer.sample("prikmeter_dns_lookups_total", "result", "ok", dnsStats.lookups - dnsStats.failures);
+  writer.sample("prikmeter_dns_lookups_total", "result", "failed", dnsStats.failures);
+  writer.family("prikmeter_dns_cache_hits_total", "counter", "Host names answered from the cache.");
+  writer.sample("prikmeter_dns_cache_hits_total", dnsStats.hits);
+
+  // Samples of a metric must be together, so each of these loops over the
+  // devices again.
+  auto writePerDevice = [&](char const *name, char const *help, uint32 (*value)(size_t device)) {
+    writer.family(name, "counter", help);
+    for (size_t i = 0; i < inverterReader.numDevices(); i++) {
+      writer.sample(name, "device", i, value(i));
     }
+  };
+  writePerDevice("prikmeter_device_polls_total", "Polls of inverters and meters.",
+      [](size_t i) { return inverterReader.scheduler(i).numPolls(); });
+  writePerDevice("prikmeter_device_poll_failures_total", "Failed polls of inverters and meters.",
+      [](size_t i) { return inverterReader.scheduler(i).numFailures(); });
+  writePerDevice("prikmeter_modbus_requests_total", "Modbus requests sent.",
+      [](size_t i) { return inverterReader.modbusStats(i).requests; });
+  writePerDevice("prikmeter_modbus_responses_total", "Modbus requests answered with registers.",
+      [](size_t i) { return inverterReader.modbusStats(i).succeeded; });
+  writePerDevice("prikmeter_modbus_exceptions_total", "Modbus requests answered with an exception.",
+      [](size_t i) { return inverterReader.modbusStats(i).exceptions; });
+  writePerDevice("prikmeter_modbus_failures_total", "Modbus requests without a valid answer, timeouts included.",
+      [](size_t i) { return inverterReader.modbusStats(i).failed; });
+  writePerDevice("prikmeter_modbus_timeouts_total", "Modbus requests that timed out.",
+      [](size_t i) { return inverterReader.modbusStats(i).timeouts; });
+
+  HttpServer::Stats const &httpStats = httpServer.stats();
+  writer.family("prikmeter_http_connections_total", "counter", "Local HTTP connections, by outcome.");
+  writer.sample("prikmeter_http_connections_total", "result", "accepted", httpStats.accepted);
+  writer.sample("prikmeter_http_connections_total", "result", "rejected", httpStats.rejected);
+  writer.sample("prikmeter_http_connections_total", "result", "timeout", httpStats.timeouts);
+  writer.family("prikmeter_http_requests_total", "counter", "Local HTTP requests.");
+  writer.sample("prikmeter_http_requests_total", httpStats.requests);
+  writer.family("prikmeter_http_bad_requests_total", "counter", "Local HTTP requests that could not be parsed.");
+  writer.sample("prikmeter_http_bad_requests_total", httpStats.badRequests);
+  writer.family("prikmeter_http_connections_open", "gauge", "Open local HTTP connections, besides event streams.");
+  writer.sample("prikmeter_http_connections_open", httpServer.numConnections());
+
+  EventStream::Stats const &streamStats = eventStream.stats();
+  writer.family("prikmeter_event_subscribers", "gauge", "Open event streams.");
+  writer.sample("prikmeter_event_subscribers", eventStream.numSubscribers());
+  writer.family("prikmeter_events_total", "counter", "Events, by whether they were sent or dropped.");
+  writer.sample("prikmeter_events_total", "result", "sent", streamStats.sent);
+  writer.sample("prikmeter_events_total", "result", "dropped", streamStats.dropped);
+}
 
-  private:
-    WiFiClient &client_;
-    bool headersEnded_ = false;
-};
+/**
+ * Sends one of the files from dist/, or 304 if the client has it already, or
+ * 406 if it does not accept gzip.
+ */
+void sendFile(HttpRequestParser const &request, HttpResponse &response, dist_files::File const &file) {
+  // We only keep the gzipped version. Every browser accepts it, but not
+  // every other client.
+  if (!request.acceptsEncoding("gzip")) {
+    response.sendStatus(406, "Not Acceptable");
+    response.sendHeader("Vary", "Accept-Encoding");
+    response.sendContentLength(0);
+    return;
+  }
+  bool const notModified = request.matchesETag(file.etag);
+  response.sendStatus(notModified ? 304 : 200, notModified ? "Not Modified" : "OK");
+  response.sendHeader("ETag", file.etag);
+  response.sendHeader("Vary", "Accept-Encoding");
+  // HTML is revalidated on every load; what it refers to has the ETag in its
+  // URL, so it never changes.
+  response.sendHeader("Cache-Control", file.immutable ? "public, max-age=31536000, immutable" : "no-cache");
+  if (notModified) {
+    return;
+  }
+  response.sendHeader("Content-Type", file.contentType);
+  response.sendHeader("Content-Encoding", "gzip");
+  response.sendContentLength(file.size);
+  response.sendData_P(reinterpret_cast<PGM_P>(file.data), file.size);
+}
 
-void handleRequest(WiFiClient &client, ArduinoHttpServer::StreamHttpRequest<1024> &request) {
-  HttpResponse response(client);
-  if (request.getMethod() != ArduinoHttpServer::Method::Get) {
-    response.sendError(405, "Method Not Allowed");
+dist_files::File const *findFile(StringRef path) {
+  for (size_t i = 0; i < dist_files::numFiles; i++) {
+    if (path.equals(dist_files::files[i].path)) {
+      return &dist_files::files[i];
+    }
+  }
+  return nullptr;
+}
+
+void handleRequest(HttpRequestParser const &request, HttpResponse &response) {
+  if (!request.method().equals("GET")) {
+    response.sendStatus(405, "Method Not Allowed");
+    response.sendHeader("Allow", "GET");
+    response.sendContentLength(0);
     return;
   }
-  String path = request.getResource().toString();
-  if (path == "/") {
+  StringRef const path = request.path();
+  dist_files::File const *const file = findFile(path);
+  if (file) {
+    sendFile(request, response, *file);
+  } else if (path.equals("/api/current")) {
+    sendCurrentReadings(response, "application/json",
+        reinterpret_cast<uint8_t const *>(currentReadings.json()), currentReadings.jsonSize());
+  } else if (path.equals("/api/current.bin")) {
+    sendCurrentReadings(response, "application/octet-stream",
+        currentReadings.binary(), currentReadings.binarySize());
+  } else if (path.equals("/api/history")) {
+    sendHistory(request, response, History::Format::CSV);
+  } else if (path.equals("/api/history.bin")) {
+    sendHistory(request, response, History::Format::BINARY);
+  } else if (path.equals("/metrics")) {
+    MetricsGauges const gauges = {
+      micros64() / 1000000, ESP.getFreeHeap(), ESP.getMaxFreeBlockSize(), ESP.getHeapFragmentation(),
+    };
+    CountingPrint counter;
+    writeMetrics(counter, gauges);
     response.sendStatus(200, "OK");
-    response.sendHeader("Content-Type", "text/html; charset=UTF-8");
-    response.sendData_P(dist_files::index_html, dist_files::index_html_len);
-  } else if (path == "/style.css") {
+    response.sendHeader("Content-Type", "text/plain; version=0.0.4; charset=UTF-8");
+    response.sendContentLength(counter.count());
+    response.sendHeader("Cache-Control", "no-store");
+    writeMetrics(response.body(), gauges);
+  } else if (path.equals("/debug/profile")) {
+    // Zones only appear in builds with PROFILING=1.
+    CountingPrint counter;
+    Profiler::write(counter);
     response.sendStatus(200, "OK");
-    response.sendHeader("Content-Type", "text/css; charset=UTF-8");
-    response.sendData_P(dist_files::style_css, dist_files::style_css_len);
-  } else if (path == "/favicon.ico") {
+    response.sendHeader("Content-Type", "text/plain; charset=UTF-8");
+    response.sendContentLength(counter.count());
+    response.sendHeader("Cache-Control", "no-store");
+    Profiler::write(response.body());
+    if (request.queryParameter("reset").data) {
+      Profiler::reset();
+    }
+  } else if (path.equals("/log")) {
+    // Nothing is logged while the response is written, so the size holds.
+    LogBuffer const &logBuffer = Log::buffer();
+    response.sendStatus(200, "OK");
+    response.sendHeader("Content-Type", "text/plain; charset=UTF-8");
+    response.sendContentLength(logBuffer.size());
+    response.sendHeader("Cache-Control", "no-store");
+    logBuffer.write(response.body());
+  } else if (path.equals("/api/stream") || path.equals("/api/stream/telegrams")) {
+    uint8 const topic = path.equals("/api/stream") ? EventStream::READINGS : EventStream::TELEGRAMS;
+    if (eventStream.subscribe(response.client(), topic)) {
+      response.detach();
+    } else {
+      response.sendError(503);
+    }
+  } else if (path.equals("/favicon.ico")) {
     // TODO draw a favicon
-    response.sendError(404, "Not Found");
+    response.sendError(404);
   } else {
-    response.sendError(404, "Not Found");
-  }
-}
-
-void serveHttp() {
-  WiFiClient client = httpServer.available();
-  if (client) {
-    // TODO I'm not sure what this buffer size is for. Do we even need this lib?
-    ArduinoHttpServer::StreamHttpRequest<1024> request(client);
-    if (request.readRequest()) {
-      handleRequest(client, request);
-    }
+    response.sendError(404);
   }
 }
 
 void loop() {
+  PROFILE_ZONE("loop");
+  unsigned long const startMicros = micros();
   readP1();
   readInverter();
-  serveHttp();
+  httpServer.update();
+  eventStream.update();
+  Log::drainToSerial();
+  loopMicros.observe(micros() - startMicros);
+
+#if defined(PROFILING) && (PROFILING + 0)
+  static unsigned long lastProfileMillis = 0;
+  if (millis() - lastProfileMillis >= PROFILE_INTERVAL_MILLIS) {
+    lastProfileMillis = millis();
+    Profiler::write(Serial);
+  }
+#endif
 }
@@ -0,0 +1,114 @@
+#include <unity.h>
+
+#include <string>
+
+#include "CurrentReadings.h"
+
+template<typename T>
+T readAt(uint8 const *buffer, size_t offset) {
+  T value;
+  memcpy(&value, buffer + offset, sizeof(value));
+  return value;
+}
+
+P1Values p1Values() {
+  P1Values values;
+  values.importWatts = 1193;
+  values.exportWatts = 0;
+  values.phaseImportWatts[0] = 501;
+  values.importWattHours[0] = 123456789;
+  values.gasLitres = 12785123;
+  return values;
+}
+
+void testFormatsJson() {
+  CurrentReadings readings;
+  readings.setP1Values(p1Values(), 9000);
+  Sample::Device const device = {0, 4000, 1234.5, 5678};
+  readings.setDevices(&device, 1);
+  PowerSnapshot balance;
+  balance.netWatts = 1193;
+  readings.setBalance(balance);
+  readings.format(1600000010000ull, 10000);
+
+  TEST_ASSERT_EQUAL_STRING(
+      "{\"timestamp\":1600000010000,"
+      "\"p1\":{\"timestamp\":1600000009000,\"importW\":1193,\"exportW\":0,"
+      "\"phaseImportW\":[501,null,null],\"phaseExportW\":[null,null,null],"
+      "\"importWh\":[123456789,null],\"exportWh\":[null,null],\"gasL\":12785123},"
+      "\"inverters\":[{\"device\":0,\"timestamp\":1600000004000,\"powerW\":1234,\"totalEnergyWh\":5678}],"
+      "\"balance\":{\"netW\":1193,\"productionW\":null,\"consumptionW\":null,"
+      "\"selfConsumptionW\":null,\"selfConsumptionRatio\":null}}",
+      std::string(readings.json(), readings.jsonSize()).c_str());
+  TEST_ASSERT_EQUAL_UINT32(1, readings.version());
+}
+
+void testLeavesOutP1UntilFirstTelegram() {
+  CurrentReadings readings;
+  readings.format(1600000000000ull, 0);
+  TEST_ASSERT_EQUAL_STRING(
+      "{\"timestamp\":1600000000000,\"inverters\":[],"
+      "\"balance\":{\"netW\":null,\"productionW\":null,\"consumptionW\":null,"
+      "\"selfConsumptionW\":null,\"selfConsumptionRatio\":null}}",
+      std::string(readings.json(), readings.jsonSize()).c_str());
+}
+
+void testFitsLargestSnapshot() {
+  CurrentReadings readings;
+  P1Values values;
+  for (size_t i = 0; i < P1Values::NUM_PHASES; i++) {
+    values.phaseImportWatts[i] = values.phaseExportWatts[i] = -99999999;
+  }
+  values.importWatts = values.exportWatts = -99999999;
+  for (size_t i = 0; i < P1Values::NUM_TARIFFS; i++) {
+    values.importWattHours[i] = values.exportWattHours[i] = 4000000000u;
+  }
+  values.gasLitres = 4000000000u;
+  readings.setP1Values(values, 0);
+  Sample::Device devices[Sample::MAX_DEVICES];
+  for (size_t i = 0; i < Sample::MAX_DEVICES; i++) {
+    devices[i] = {static_cast<uint8>(i), 0, -99999999, 999999999999.0};
+  }
+  readings.setDevices(devices, Sample::MAX_DEVICES);
+  PowerSnapshot balance;
+  balance.netWatts = balance.productionWatts = balance.consumptionWatts = balance.selfConsumptionWatts = -99999999;
+  balance.selfConsumptionRatio = 1;
+  readings.setBalance(balance);
+  readings.format(18446744073709551615ull, 0);
+  TEST_ASSERT_TRUE(readings.jsonSize() > 0);
+  TEST_ASSERT_EQUAL_UINT32(CurrentReadings::MAX_BINARY_SIZE, readings.binarySize());
+}
+
+void testFormatsBinary() {
+  CurrentReadings readings;
+  readings.setP1Values(p1Values(), 9000);
+  Sample::Device const device = {2, 4000, 1234.5, 5678};
+  readings.setDevices(&device, 1);
+  readings.format(1600000010000ull, 10000);
+
+  uint8 const *binary = readings.binary();
+  TEST_ASSERT_EQUAL_UINT32(92 + 21, readings.binarySize());
+  TEST_ASSERT_EQUAL_UINT32(CurrentReadings::BINARY_VERSION, binary[0]);
+  TEST_ASSERT_EQUAL_UINT32(1, binary[1]);
+  TEST_ASSERT_EQUAL_UINT32(92 + 21, readAt<uint16>(binary, 2));
+  TEST_ASSERT_TRUE(readAt<uint64_t>(binary, 4) == 1600000010000ull);
+  TEST_ASSERT_TRUE(readAt<uint64_t>(binary, 12) == 1600000009000ull);
+  TEST_ASSERT_EQUAL_FLOAT(1193, readAt<float>(binary, 20));
+  TEST_ASSERT_EQUAL_FLOAT(501, readAt<float>(binary, 28));
+  TEST_ASSERT_EQUAL_UINT32(123456789, readAt<uint32>(binary, 52));
+  TEST_ASSERT_EQUAL_UINT32(12785123, readAt<uint32>(binary, 68));
+  TEST_ASSERT_TRUE(std::isnan(readAt<float>(binary, 72)));
+  TEST_ASSERT_EQUAL_UINT32(2, binary[92]);
+  TEST_ASSERT_TRUE(readAt<uint64_t>(binary, 93) == 1600000004000ull);
+  TEST_ASSERT_EQUAL_FLOAT(1234.5, readAt<float>(binary, 101));
+  TEST_ASSERT_EQUAL_FLOAT(5678, readAt<double>(binary, 105));
+}
+
+int main() {
+  UNITY_BEGIN();
+  RUN_TEST(testFormatsJson);
+  RUN_TEST(testLeavesOutP1UntilFirstTelegram);
+  RUN_TEST(testFitsLargestSnapshot);
+  RUN_TEST(testFormatsBinary);
+  UNITY_END();
+}
@@ -0,0 +1,232 @@
+#include <unity.h>
+
+#include <string>
+#include <vector>
+
+#include "ArrayPrint.h"
+#include "CountingPrint.h"
+#include "History.h"
+
+uint32 const T0 = 1600000200; // A multiple of 300 seconds.
+
+std::string csv(History const &history, uint32 from, uint32 to, uint32 step) {
+  static char buffer[64 * 1024];
+  ArrayPrint out(buffer, sizeof(buffer));
+  size_t const written = history.write(out, History::Format::CSV, from, to, step);
+  TEST_ASSERT_FALSE(out.overflowed());
+  TEST_ASSERT_EQUAL(out.size(), written);
+  return std::string(buffer, out.size());
+}
+
+/**
+ * Decodes the binary format into values, with INT32_MIN for missing points.
+ */
+std::vector<int32_t> decodeBinary(uint8 const *data, size_t size, uint32 *from, uint32 *step) {
+  auto readUint32 = [&](size_t offset) {
+    return data[offset] | data[offset + 1] << 8 | data[offset + 2] << 16 | static_cast<uint32>(data[offset + 3]) << 24;
+  };
+  *from = readUint32(0);
+  *step = readUint32(4);
+  uint32 const count = readUint32(8);
+  std::vector<int32_t> values;
+  int32_t previous = 0;
+  size_t offset = 12;
+  for (uint32 i = 0; i < count; i++) {
+    uint64_t code = 0;
+    for (int shift = 0; offset < size; shift += 7) {
+      uint8 const byte = data[offset++];
+      code |= static_cast<uint64_t>(byte & 0x7f) << shift;
+      if (!(byte & 0x80)) {
+        break;
+      }
+    }
+    if (!code) {
+      values.push_back(INT32_MIN);
+      continue;
+    }
+    code--;
+    previous += static_cast<int32_t>((code >> 1) ^ -(code & 1));
+    values.push_back(previous);
+  }
+  TEST_ASSERT_EQUAL(size, offset);
+  return values;
+}
+
+void testAveragesOverPeriods() {
+  History history;
+  history.add(100, T0);
+  history.add(200, T0 + 5);
+  history.add(-50, T0 + 10);
+  history.add(-51, T0 + 15);
+  history.add(0, T0 + 20);
+  TEST_ASSERT_EQUAL(2, history.numPoints(0));
+  TEST_ASSERT_EQUAL(0, history.numPoints(1));
+  TEST_ASSERT_EQUAL_STRING(
+      "timestamp,netW\n"
+      "1600000200,150\n"
+      "1600000210,-51\n"
+      "1600000220,\n",
+      csv(history, T0, T0 + 30, 0).c_str());
+}
+
+void testMarksMissingPeriods() {
+  History history;
+  history.add(100, T0);
+  history.add(300, T0 + 35);
+  history.add(300, T0 + 40);
+  TEST_ASSERT_EQUAL_STRING(
+      "timestamp,netW\n"
+      "1600000200,100\n"
+      "1600000210,\n"
+      "1600000220,\n"
+      "1600000230,300\n",
+      csv(history, T0, T0 + 40, 10).c_str());
+}
+
+void testResamplesToStep() {
+  History history;
+  for (uint32 t = 0; t <= 120; t += 10) {
+    history.add(t, T0 + t);
+  }
+  // 15 is rounded up to 20; the periods are 0..110.
+  TEST_ASSERT_EQUAL_STRING(
+      "timestamp,netW\n"
+      "1600000200,5\n"
+      "1600000220,25\n"
+      "1600000240,45\n"
+      "1600000260,65\n"
+      "1600000280,85\n"
+      "1600000300,105\n",
+      csv(history, T0 + 5, T0 + 120, 15).c_str());
+}
+
+void testUsesCoarserTierForOlderData() {
+  History history;
+  // Three hours at 1 second intervals, which the 10 second tier can't hold.
+  for (uint32 t = 0; t < 3 * 3600; t++) {
+    history.add(t / 10 % 2 ? 4000 : 0, T0 + t);
+  }
+  TEST_ASSERT_TRUE(history.oldestEpochSeconds(0) > T0);
+  TEST_ASSERT_EQUAL(T0, history.oldestEpochSeconds(1));
+  TEST_ASSERT_EQUAL_STRING(
+      "timestamp,netW\n"
+      "1600000200,2000\n"
+      "1600000500,2000\n",
+      csv(history, T0, T0 + 600, 0).c_str());
+  // Recent data comes from the finest tier.
+  TEST_ASSERT_EQUAL_STRING(
+      "timestamp,netW\n"
+      "1600010200,0\n"
+      "1600010210,4000\n",
+      csv(history, T0 + 10000, T0 + 10020, 0).c_str());
+}
+
+void testKeepsAWeek() {
+  History history;
+  // A varying load, every 10 seconds for 8 days.
+  uint32 const end = 8 * 24 * 3600;
+  for (uint32 t = 0; t < end; t += 10) {
+    history.add(static_cast<int32_t>((t * 7919) % 4000) - 1000, T0 + t);
+  }
+  TEST_ASSERT_TRUE(history.oldestEpochSeconds(0) <= T0 + end - 3600);
+  TEST_ASSERT_TRUE(history.oldestEpochSeconds(1) <= T0 + end - 24 * 3600);
+  TEST_ASSERT_TRUE(history.oldestEpochSeconds(2) <= T0 + end - 7 * 24 * 3600);
+}
+
+void testRestartsAfterLongGap() {
+  History history;
+  history.add(100, T0);
+  history.add(100, T0 + 10);
+  history.add(200, T0 + 2 * 3600);
+  history.add(200, T0 + 2 * 3600 + 10);
+  TEST_ASSERT_EQUAL(T0 + 2 * 3600, history.oldestEpochSeconds(0));
+  TEST_ASSERT_EQUAL(1, history.numPoints(0));
+}
+
+void testIgnoresClockGoingBack() {
+  History history;
+  history.add(100, T0 + 20);
+  history.add(999, T0);
+  history.add(100, T0 + 30);
+  TEST_ASSERT_EQUAL_STRING(
+      "timestamp,netW\n"
+      "1600000220,100\n",
+      csv(history, T0 + 20, T0 + 30, 0).c_str());
+}
+
+void testWritesBinary() {
+  History history;
+  int32_t const values[] = {1000, 1010, -2000000, 5, 5, 123456};
+  for (size_t i = 0; i < sizeof(values) / sizeof(values[0]); i++) {
+    history.add(values[i], T0 + 10 * i);
+  }
+  history.add(0, T0 + 80);
+  uint8 buffer[256];
+  ArrayPrint out(reinterpret_cast<char *>(buffer), sizeof(buffer));
+  size_t const written = history.write(out, History::Format::BINARY, T0, T0 + 80, 10);
+  TEST_ASSERT_EQUAL(out.size(), written);
+  // Most points take one or two bytes.
+  TEST_ASSERT_TRUE(written < 12 + 8 * 3);
+
+  uint32 from, step;
+  std::vector<int32_t> const decoded = decodeBinary(buffer, written, &from, &step);
+  TEST_ASSERT_EQUAL(T0, from);
+  TEST_ASSERT_EQUAL(10, step);
+  TEST_ASSERT_EQUAL(8, decoded.size());
+  for (size_t i = 0; i < 6; i++) {
+    TEST_ASSERT_EQUAL(values[i], decoded[i]);
+  }
+  TEST_ASSERT_EQUAL(INT32_MIN, decoded[6]);
+  TEST_ASSERT_EQUAL(INT32_MIN, decoded[7]);
+}
+
+void testLimitsNumberOfPoints() {
+  History history;
+  for (uint32 t = 0; t < 3600; t += 10) {
+    history.add(1, T0 + t);
+  }
+  CountingPrint counter;
+  history.write(counter, History::Format::BINARY, T0 - 100000, T0 + 3600, 0);
+  uint8 buffer[12 + History::MAX_POINTS];
+  ArrayPrint out(reinterpret_cast<char *>(buffer), sizeof(buffer));
+  size_t const written = history.write(out, History::Format::BINARY, T0 - 100000, T0 + 3600, 0);
+  TEST_ASSERT_EQUAL(counter.count(), written);
+  TEST_ASSERT_FALSE(out.overflowed());
+  uint32 from, step;
+  TEST_ASSERT_TRUE(decodeBinary(buffer, written, &from, &step).size() <= History::MAX_POINTS);
+}
+
+void testLimitsStep() {
+  History history;
+  history.add(100, T0);
+  history.add(300, T0 + 10);
+  history.add(0, T0 + 20);
+  // Steps longer than the span give a single bucket, and don't overflow.
+  TEST_ASSERT_EQUAL_STRING(
+      "timestamp,netW\n"
+      "1600000200,200\n",
+      csv(history, T0, T0 + 20, 0xFFFFFFFF).c_str());
+  TEST_ASSERT_EQUAL_STRING(
+      "timestamp,netW\n"
+      "1600000200,200\n",
+      csv(history, T0, T0 + 20, 0xFFFFFFFF - 5).c_str());
+  // Even with the widest span there is.
+  CountingPrint counter;
+  history.write(counter, History::Format::BINARY, 0, 0xFFFFFFFF, 0xFFFFFFFF);
+  TEST_ASSERT_TRUE(counter.count() > 12);
+}
+
+int main() {
+  UNITY_BEGIN();
+  RUN_TEST(testAveragesOverPeriods);
+  RUN_TEST(testMarksMissingPeriods);
+  RUN_TEST(testResamplesToStep);
+  RUN_TEST(testUsesCoarserTierForOlderData);
+  RUN_TEST(testKeepsAWeek);
+  RUN_TEST(testRestartsAfterLongGap);
+  RUN_TEST(testIgnoresClockGoingBack);
+  RUN_TEST(testWritesBinary);
+  RUN_TEST(testLimitsNumberOfPoints);
+  RUN_TEST(testLimitsStep);
+  UNITY_END();
+}
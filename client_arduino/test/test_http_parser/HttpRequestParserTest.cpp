@@ -0,0 +1,217 @@
+#include <unity.h>
+
+#include <string>
+
+#include "HttpRequestParser.h"
+
+/**
+ * Feeds the given bytes to the parser, `chunkSize` bytes at a time.
+ */
+void feed(HttpRequestParser &parser, std::string const &bytes, size_t chunkSize = 1000) {
+  for (size_t offset = 0; offset < bytes.size(); offset += chunkSize) {
+    size_t available;
+    char *const space = parser.space(&available);
+    size_t const count = std::min(std::min(chunkSize, bytes.size() - offset), available);
+    memcpy(space, bytes.data() + offset, count);
+    parser.received(count);
+  }
+}
+
+std::string str(StringRef ref) {
+  return std::string(ref.data ? ref.data : "", ref.length);
+}
+
+void testParsesRequest() {
+  HttpRequestParser parser;
+  feed(parser,
+      "GET /api/current?pretty=1 HTTP/1.1\r\n"
+      "Host: 192.168.1.10\r\n"
+      "Accept-Encoding: gzip, deflate\r\n"
+      "If-None-Match: \"abc\"\r\n"
+      "\r\n");
+  TEST_ASSERT_TRUE(parser.state() == HttpRequestParser::State::COMPLETE);
+  TEST_ASSERT_TRUE(parser.method().equals("GET"));
+  TEST_ASSERT_EQUAL_STRING("/api/current", str(parser.path()).c_str());
+  TEST_ASSERT_EQUAL_STRING("pretty=1", str(parser.query()).c_str());
+  TEST_ASSERT_EQUAL_STRING("gzip, deflate", str(parser.acceptEncoding()).c_str());
+  TEST_ASSERT_TRUE(parser.acceptEncoding().hasToken("GZIP"));
+  TEST_ASSERT_EQUAL_STRING("\"abc\"", str(parser.ifNoneMatch()).c_str());
+  TEST_ASSERT_TRUE(parser.keepAlive());
+}
+
+void testParsesByteByByte() {
+  HttpRequestParser parser;
+  std::string const request = "GET / HTTP/1.1\nConnection: close\n\n";
+  for (size_t i = 0; i + 1 < request.size(); i++) {
+    feed(parser, request.substr(i, 1));
+    TEST_ASSERT_TRUE(parser.state() != HttpRequestParser::State::COMPLETE);
+  }
+  feed(parser, "\n");
+  TEST_ASSERT_TRUE(parser.state() == HttpRequestParser::State::COMPLETE);
+  TEST_ASSERT_EQUAL_STRING("/", str(parser.path()).c_str());
+  TEST_ASSERT_TRUE(parser.query().isEmpty());
+  TEST_ASSERT_FALSE(parser.keepAlive());
+}
+
+void testKeepAliveDefaults() {
+  HttpRequestParser http10;
+  feed(http10, "GET / HTTP/1.0\r\n\r\n");
+  TEST_ASSERT_FALSE(http10.keepAlive());
+
+  HttpRequestParser http10KeepAlive;
+  feed(http10KeepAlive, "GET / HTTP/1.0\r\nConnection: Keep-Alive\r\n\r\n");
+  TEST_ASSERT_TRUE(http10KeepAlive.keepAlive());
+
+  HttpRequestParser http11Close;
+  feed(http11Close, "GET / HTTP/1.1\r\nconnection: TE, close\r\n\r\n");
+  TEST_ASSERT_FALSE(http11Close.keepAlive());
+}
+
+void testDropsUninterestingHeaders() {
+  HttpRequestParser parser;
+  std::string const filler(HttpRequestParser::BUFFER_SIZE - 100, 'x');
+  std::string request = "GET /style.css HTTP/1.1\r\n";
+  for (int i = 0; i < 10; i++) {
+    request += "User-Agent: " + filler + "\r\n";
+  }
+  request += "If-None-Match: \"v1\"\r\n\r\n";
+  feed(parser, request, 64);
+  TEST_ASSERT_TRUE(parser.state() == HttpRequestParser::State::COMPLETE);
+  TEST_ASSERT_EQUAL_STRING("/style.css", str(parser.path()).c_str());
+  TEST_ASSERT_EQUAL_STRING("\"v1\"", str(parser.ifNoneMatch()).c_str());
+}
+
+void testMatchesETags() {
+  HttpRequestParser none;
+  feed(none, "GET / HTTP/1.1\r\n\r\n");
+  TEST_ASSERT_FALSE(none.matchesETag("\"abc\""));
+
+  HttpRequestParser list;
+  feed(list, "GET / HTTP/1.1\r\nIf-None-Match: \"xyz\", W/\"abc\"\r\n\r\n");
+  TEST_ASSERT_TRUE(list.matchesETag("\"abc\""));
+  TEST_ASSERT_TRUE(list.matchesETag("\"xyz\""));
+  TEST_ASSERT_FALSE(list.matchesETag("\"ab\""));
+  TEST_ASSERT_FALSE(list.matchesETag("abc"));
+
+  HttpRequestParser any;
+  feed(any, "GET / HTTP/1.1\r\nIf-None-Match: *\r\n\r\n");
+  TEST_ASSERT_TRUE(any.matchesETag("\"abc\""));
+}
+
+void testParsesQueryParameters() {
+  HttpRequestParser parser;
+  feed(parser, "GET /api/history?from=1600000000&step=&to=x&flag HTTP/1.1\r\n\r\n");
+  TEST_ASSERT_EQUAL_STRING("1600000000", str(parser.queryParameter("from")).c_str());
+  TEST_ASSERT_TRUE(parser.queryParameter("step").data);
+  TEST_ASSERT_TRUE(parser.queryParameter("step").isEmpty());
+  TEST_ASSERT_TRUE(parser.queryParameter("flag").data);
+  TEST_ASSERT_FALSE(parser.queryParameter("fro").data);
+  TEST_ASSERT_FALSE(parser.queryParameter("missing").data);
+
+  uint32 value = 0;
+  TEST_ASSERT_TRUE(parser.queryParameter("from").toUnsigned(&value));
+  TEST_ASSERT_EQUAL(1600000000u, value);
+  TEST_ASSERT_FALSE(parser.queryParameter("to").toUnsigned(&value));
+  TEST_ASSERT_FALSE(parser.queryParameter("step").toUnsigned(&value));
+  StringRef tooLarge;
+  tooLarge.data = "4294967296";
+  tooLarge.length = 10;
+  TEST_ASSERT_FALSE(tooLarge.toUnsigned(&value));
+}
+
+void testParsesPipelinedRequests() {
+  HttpRequestParser parser;
+  feed(parser, "GET /a HTTP/1.1\r\n\r\nGET /b HTTP/1.1\r\n\r\nGET /c");
+  TEST_ASSERT_TRUE(parser.state() == HttpRequestParser::State::COMPLETE);
+  TEST_ASSERT_EQUAL_STRING("/a", str(parser.path()).c_str());
+  parser.nextRequest();
+  TEST_ASSERT_TRUE(parser.state() == HttpRequestParser::State::COMPLETE);
+  TEST_ASSERT_EQUAL_STRING("/b", str(parser.path()).c_str());
+  parser.nextRequest();
+  TEST_ASSERT_TRUE(parser.state() == HttpRequestParser::State::REQUEST_LINE);
+  TEST_ASSERT_TRUE(parser.hasPartialRequest());
+  feed(parser, " HTTP/1.1\r\n\r\n");
+  TEST_ASSERT_TRUE(parser.state() == HttpRequestParser::State::COMPLETE);
+  TEST_ASSERT_EQUAL_STRING("/c", str(parser.path()).c_str());
+  parser.nextRequest();
+  TEST_ASSERT_FALSE(parser.hasPartialRequest());
+}
+
+void testRejectsMalformedRequests() {
+  struct {
+    char const *request;
+    int status;
+  } const cases[] = {
+    {"GET\r\n\r\n", 400},
+    {"GET http://example.com/ HTTP/1.1\r\n\r\n", 400},
+    {"GET / HTTP/2.0\r\n\r\n", 505},
+    {"GET / HTTP/1.1\r\nNo colon\r\n\r\n", 400},
+    {"POST / HTTP/1.1\r\nContent-Length: 5\r\n\r\nhello", 413},
+    {"POST / HTTP/1.1\r\nTransfer-Encoding: chunked\r\n\r\n", 413},
+  };
+  for (auto const &c : cases) {
+    HttpRequestParser parser;
+    feed(parser, c.request);
+    TEST_ASSERT_TRUE(parser.state() == HttpRequestParser::State::ERROR);
+    TEST_ASSERT_EQUAL(c.status, parser.errorStatus());
+  }
+
+  HttpRequestParser empty;
+  feed(empty, "POST / HTTP/1.1\r\nContent-Length: 0\r\n\r\n");
+  TEST_ASSERT_TRUE(empty.state() == HttpRequestParser::State::COMPLETE);
+}
+
+void testRejectsOversizedRequests() {
+  HttpRequestParser longUri;
+  feed(longUri, "GET /" + std::string(HttpRequestParser::BUFFER_SIZE, 'a'));
+  TEST_ASSERT_TRUE(longUri.state() == HttpRequestParser::State::ERROR);
+  TEST_ASSERT_EQUAL(414, longUri.errorStatus());
+
+  HttpRequestParser longHeader;
+  feed(longHeader, "GET / HTTP/1.1\r\nCookie: " + std::string(HttpRequestParser::BUFFER_SIZE, 'a'));
+  TEST_ASSERT_TRUE(longHeader.state() == HttpRequestParser::State::ERROR);
+  TEST_ASSERT_EQUAL(431, longHeader.errorStatus());
+  size_t available;
+  longHeader.space(&available);
+  TEST_ASSERT_EQUAL(0, available);
+}
+
+bool acceptsGzip(char const *acceptEncoding) {
+  HttpRequestParser parser;
+  feed(parser, std::string("GET / HTTP/1.1\r\nAccept-Encoding: ") + acceptEncoding + "\r\n\r\n");
+  return parser.acceptsEncoding("gzip");
+}
+
+void testAcceptsEncodings() {
+  HttpRequestParser none;
+  feed(none, "GET / HTTP/1.1\r\n\r\n");
+  TEST_ASSERT_TRUE(none.acceptsEncoding("gzip"));
+
+  TEST_ASSERT_TRUE(acceptsGzip("gzip, deflate, br"));
+  TEST_ASSERT_TRUE(acceptsGzip("deflate, GZIP;q=0.5"));
+  TEST_ASSERT_TRUE(acceptsGzip("*"));
+  TEST_ASSERT_FALSE(acceptsGzip(""));
+  TEST_ASSERT_FALSE(acceptsGzip("identity"));
+  TEST_ASSERT_FALSE(acceptsGzip("x-gzip"));
+  TEST_ASSERT_FALSE(acceptsGzip("gzip;q=0"));
+  TEST_ASSERT_FALSE(acceptsGzip("gzip ; Q=0.00, deflate"));
+  TEST_ASSERT_FALSE(acceptsGzip("*;q=0"));
+  TEST_ASSERT_FALSE(acceptsGzip("gzip;q=0, *"));
+  TEST_ASSERT_TRUE(acceptsGzip("gzip;q=0.001"));
+  TEST_ASSERT_TRUE(acceptsGzip("*;q=0, gzip"));
+}
+
+int main() {
+  UNITY_BEGIN();
+  RUN_TEST(testParsesRequest);
+  RUN_TEST(testParsesByteByByte);
+  RUN_TEST(testKeepAliveDefaults);
+  RUN_TEST(testDropsUninterestingHeaders);
+  RUN_TEST(testMatchesETags);
+  RUN_TEST(testAcceptsEncodings);
+  RUN_TEST(testParsesQueryParameters);
+  RUN_TEST(testParsesPipelinedRequests);
+  RUN_TEST(testRejectsMalformedRequests);
+  RUN_TEST(testRejectsOversizedRequests);
+  UNITY_END();
+}
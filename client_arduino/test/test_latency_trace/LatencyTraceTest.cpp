@@ -0,0 +1,133 @@
+#include <unity.h>
+
+#include <string>
+
+#include "ArrayPrint.h"
+#include "LatencyTrace.h"
+
+typedef LatencyTrace::Stage Stage;
+
+LatencyTrace completeTrace(unsigned long start) {
+  LatencyTrace trace;
+  trace.begin(start);
+  trace.mark(Stage::LAST_BYTE, start + 850);
+  trace.mark(Stage::UPLOAD_START, start + 862);
+  trace.mark(Stage::RESOLVED, start + 862);
+  trace.mark(Stage::CONNECTED, start + 1293);
+  trace.mark(Stage::REQUEST_SENT, start + 1318);
+  trace.mark(Stage::STATUS_RECEIVED, start + 1628);
+  return trace;
+}
+
+std::string spans(LatencyTrace const &trace) {
+  char buffer[128];
+  ArrayPrint out(buffer, sizeof(buffer));
+  trace.writeSpans(out);
+  return std::string(buffer, out.size());
+}
+
+void testComputesSpans() {
+  LatencyTrace const trace = completeTrace(1000);
+  uint32 millis;
+  TEST_ASSERT_TRUE(trace.span(0, &millis));
+  TEST_ASSERT_EQUAL(850, millis);
+  TEST_ASSERT_TRUE(trace.span(3, &millis));
+  TEST_ASSERT_EQUAL(431, millis);
+  TEST_ASSERT_FALSE(trace.span(LatencyTrace::NUM_SPANS, &millis));
+  TEST_ASSERT_TRUE(trace.total(&millis));
+  TEST_ASSERT_EQUAL(1628, millis);
+}
+
+void testWritesKnownSpans() {
+  LatencyTrace trace;
+  trace.begin(1000);
+  TEST_ASSERT_EQUAL_STRING("", spans(trace).c_str());
+  trace.mark(Stage::LAST_BYTE, 1850);
+  trace.mark(Stage::UPLOAD_START, 1862);
+  trace.mark(Stage::RESOLVED, 1862);
+  TEST_ASSERT_EQUAL_STRING("read=850,queue=12,resolve=0", spans(trace).c_str());
+  uint32 millis;
+  TEST_ASSERT_FALSE(trace.total(&millis));
+  TEST_ASSERT_EQUAL_STRING("read=850,queue=12,resolve=0,connect=431,send=25,response=310",
+      spans(completeTrace(1000)).c_str());
+}
+
+void testBeginForgetsPreviousTrace() {
+  LatencyTrace trace = completeTrace(1000);
+  trace.begin(5000);
+  TEST_ASSERT_TRUE(trace.has(Stage::FIRST_BYTE));
+  TEST_ASSERT_FALSE(trace.has(Stage::LAST_BYTE));
+  TEST_ASSERT_EQUAL_STRING("", spans(trace).c_str());
+}
+
+void testSpansAcrossMillisOverflow() {
+  LatencyTrace const trace = completeTrace(0xffffff00ul);
+  uint32 millis;
+  TEST_ASSERT_TRUE(trace.total(&millis));
+  TEST_ASSERT_EQUAL(1628, millis);
+}
+
+void testCaptureEpochMillis() {
+  LatencyTrace trace;
+  trace.begin(1000);
+  TEST_ASSERT_EQUAL_INT64(1600000000000ull, trace.captureEpochMillis(1600000001500ull, 2500));
+}
+
+void testPercentiles() {
+  LatencyStats stats;
+  uint32 millis;
+  TEST_ASSERT_FALSE(stats.percentile(0, 50, &millis));
+  for (unsigned long i = 1; i <= 10; i++) {
+    LatencyTrace trace;
+    trace.begin(0);
+    trace.mark(Stage::LAST_BYTE, i * 100);
+    stats.add(trace);
+  }
+  TEST_ASSERT_EQUAL(10, stats.count(0));
+  TEST_ASSERT_EQUAL(0, stats.count(1));
+  TEST_ASSERT_EQUAL(0, stats.count(LatencyStats::TOTAL));
+  TEST_ASSERT_TRUE(stats.percentile(0, 50, &millis));
+  TEST_ASSERT_EQUAL(500, millis);
+  TEST_ASSERT_TRUE(stats.percentile(0, 90, &millis));
+  TEST_ASSERT_EQUAL(900, millis);
+  TEST_ASSERT_TRUE(stats.percentile(0, 99, &millis));
+  TEST_ASSERT_EQUAL(1000, millis);
+  TEST_ASSERT_TRUE(stats.percentile(0, 0, &millis));
+  TEST_ASSERT_EQUAL(100, millis);
+}
+
+void testWindowRollsOver() {
+  LatencyStats stats;
+  for (size_t i = 0; i < LatencyStats::WINDOW; i++) {
+    stats.add(completeTrace(0));
+  }
+  // Slower uploads replace the old ones one by one.
+  for (size_t i = 0; i < LatencyStats::WINDOW / 2; i++) {
+    LatencyTrace trace;
+    trace.begin(0);
+    trace.mark(Stage::LAST_BYTE, 100000);
+    stats.add(trace);
+  }
+  uint32 millis;
+  TEST_ASSERT_EQUAL(LatencyStats::WINDOW, stats.count(0));
+  TEST_ASSERT_TRUE(stats.percentile(0, 50, &millis));
+  TEST_ASSERT_EQUAL(850, millis);
+  TEST_ASSERT_TRUE(stats.percentile(0, 51, &millis));
+  // Clamped to 16 bits.
+  TEST_ASSERT_EQUAL(65535, millis);
+  TEST_ASSERT_TRUE(stats.percentile(LatencyStats::TOTAL, 50, &millis));
+  TEST_ASSERT_EQUAL(1628, millis);
+  TEST_ASSERT_EQUAL_STRING("total", LatencyStats::seriesName(LatencyStats::TOTAL));
+}
+
+int main() {
+  UNITY_BEGIN();
+  RUN_TEST(testComputesSpans);
+  RUN_TEST(testWritesKnownSpans);
+  RUN_TEST(testBeginForgetsPreviousTrace);
+  RUN_TEST(testSpansAcrossMillisOverflow);
+  RUN_TEST(testCaptureEpochMillis);
+  RUN_TEST(testPercentiles);
+  RUN_TEST(testWindowRollsOver);
+  UNITY_END();
+}
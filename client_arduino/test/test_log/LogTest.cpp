@@ -0,0 +1,116 @@
+#include <unity.h>
+
+#include <string>
+
+#include "ArrayPrint.h"
+#include "Log.h"
+
+std::string contents(LogBuffer const &buffer) {
+  static char output[LogBuffer::SIZE];
+  ArrayPrint out(output, sizeof(output));
+  buffer.write(out);
+  TEST_ASSERT_EQUAL(buffer.size(), out.size());
+  return std::string(output, out.size());
+}
+
+std::string drain(LogBuffer &buffer, size_t maxBytes) {
+  static char output[LogBuffer::SIZE];
+  ArrayPrint out(output, sizeof(output));
+  size_t const drained = buffer.drain(out, maxBytes);
+  TEST_ASSERT_EQUAL(out.size(), drained);
+  return std::string(output, out.size());
+}
+
+void append(LogBuffer &buffer, std::string const &line) {
+  buffer.append(line.data(), line.size());
+}
+
+void testKeepsLinesInOrder() {
+  LogBuffer buffer;
+  TEST_ASSERT_EQUAL_STRING("", contents(buffer).c_str());
+  append(buffer, "one\n");
+  append(buffer, "two\n");
+  TEST_ASSERT_EQUAL_STRING("one\ntwo\n", contents(buffer).c_str());
+  TEST_ASSERT_EQUAL(2, buffer.stats().lines);
+}
+
+void testDrainsInPieces() {
+  LogBuffer buffer;
+  append(buffer, "one\n");
+  append(buffer, "two\n");
+  TEST_ASSERT_EQUAL_STRING("one\ntw", drain(buffer, 6).c_str());
+  TEST_ASSERT_EQUAL(2, buffer.numUndrained());
+  append(buffer, "three\n");
+  TEST_ASSERT_EQUAL_STRING("o\nthree\n", drain(buffer, 100).c_str());
+  TEST_ASSERT_EQUAL_STRING("", drain(buffer, 100).c_str());
+  // Draining doesn't remove anything.
+  TEST_ASSERT_EQUAL_STRING("one\ntwo\nthree\n", contents(buffer).c_str());
+}
+
+void testDropsOldestLinesWhenFull() {
+  LogBuffer buffer;
+  // 100 lines of 39 bytes don't fit; the last 52 do.
+  for (int i = 0; i < 100; i++) {
+    char line[41];
+    snprintf(line, sizeof(line), "%038d\n", i);
+    append(buffer, line);
+  }
+  std::string const all = contents(buffer);
+  TEST_ASSERT_EQUAL(52 * 39, all.size());
+  TEST_ASSERT_EQUAL(0, all.find("00000000000000000000000000000000000048\n"));
+  TEST_ASSERT_EQUAL(all.size() - 39, all.find("00000000000000000000000000000000000099\n"));
+  TEST_ASSERT_EQUAL(48, buffer.stats().dropped);
+
+  // Draining resumes at the oldest line that is left.
+  TEST_ASSERT_EQUAL_STRING(all.c_str(), drain(buffer, LogBuffer::SIZE).c_str());
+}
+
+void testDrainedLinesAreNotCountedAsDropped() {
+  LogBuffer buffer;
+  std::string const line(1000, 'x');
+  append(buffer, line + "\n");
+  drain(buffer, 2000);
+  append(buffer, line + "\n");
+  append(buffer, line + "\n");
+  TEST_ASSERT_EQUAL(0, buffer.stats().dropped);
+  TEST_ASSERT_EQUAL(2002, buffer.size());
+}
+
+void testFormatsLines() {
+  NativeArduino::setMillis(12345);
+  size_t const before = Log::buffer().size();
+  LOG_AT(LOG_LEVEL_WARNING, "p1", "Received telegram of %u bytes", 812u);
+  std::string const all = contents(Log::buffer());
+  TEST_ASSERT_EQUAL_STRING("12.345 W p1: Received telegram of 812 bytes\n", all.substr(before).c_str());
+}
+
+void testTruncatesLongLines() {
+  NativeArduino::setMillis(0);
+  size_t const before = Log::buffer().size();
+  uint32 const truncated = Log::buffer().stats().truncated;
+  LOG_AT(LOG_LEVEL_INFO, "test", "%s", std::string(500, 'x').c_str());
+  std::string const line = contents(Log::buffer()).substr(before);
+  TEST_ASSERT_EQUAL(Log::MAX_LINE, line.size());
+  TEST_ASSERT_EQUAL_STRING("...\n", line.substr(line.size() - 4).c_str());
+  TEST_ASSERT_EQUAL(truncated + 1, Log::buffer().stats().truncated);
+}
+
+void testCompilesOutLowerLevels() {
+  size_t const lines = Log::buffer().stats().lines;
+  // LOG_LEVEL is INFO by default.
+  LOG_DEBUG("test", "Not logged");
+  LOG_INFO("test", "Logged");
+  TEST_ASSERT_EQUAL(lines + 1, Log::buffer().stats().lines);
+}
+
+int main() {
+  UNITY_BEGIN();
+  RUN_TEST(testKeepsLinesInOrder);
+  RUN_TEST(testDrainsInPieces);
+  RUN_TEST(testDropsOldestLinesWhenFull);
+  RUN_TEST(testDrainedLinesAreNotCountedAsDropped);
+  RUN_TEST(testFormatsLines);
+  RUN_TEST(testTruncatesLongLines);
+  RUN_TEST(testCompilesOutLowerLevels);
+  UNITY_END();
+}
@@ -0,0 +1,84 @@
+#include <unity.h>
+
+#include <string>
+
+#include "ArrayPrint.h"
+#include "Metrics.h"
+
+uint32 const BOUNDS[] = {10, 100, 1000};
+
+void testCountsIntoBuckets() {
+  Histogram histogram(BOUNDS);
+  histogram.observe(0);
+  histogram.observe(10);
+  histogram.observe(11);
+  histogram.observe(1000);
+  histogram.observe(5000);
+  TEST_ASSERT_EQUAL(2, histogram.bucketCount(0));
+  TEST_ASSERT_EQUAL(1, histogram.bucketCount(1));
+  TEST_ASSERT_EQUAL(1, histogram.bucketCount(2));
+  TEST_ASSERT_EQUAL(5, histogram.count());
+  TEST_ASSERT_EQUAL(6021, histogram.sum());
+}
+
+void testWritesExpositionFormat() {
+  Histogram histogram(BOUNDS);
+  histogram.observe(5);
+  histogram.observe(50);
+  histogram.observe(5000);
+
+  char buffer[1024];
+  ArrayPrint out(buffer, sizeof(buffer));
+  PrometheusWriter writer(out);
+  writer.family("test_uploads_total", "counter", "Uploads.");
+  writer.sample("test_uploads_total", "reason", "heartbeat", 12);
+  writer.sample("test_device_polls_total", "device", static_cast<uint64_t>(1), 3);
+  writer.sample("test_uptime_seconds", 4294967296ull);
+  writer.sampleNumber("test_ratio", 0.25);
+  writer.sampleNumber("test_unknown", NAN);
+  writer.sampleNumber("test_handshake_seconds", "suite", "fast", 0.5);
+  writer.quantile("test_span_seconds", "span", "connect", 0.9, 0.431);
+  writer.histogram("test_latency_seconds", "Latency.", histogram, 0.001);
+
+  TEST_ASSERT_FALSE(out.overflowed());
+  TEST_ASSERT_EQUAL(out.size(), writer.written());
+  TEST_ASSERT_EQUAL_STRING(
+      "# HELP test_uploads_total Uploads.\n"
+      "# TYPE test_uploads_total counter\n"
+      "test_uploads_total{reason=\"heartbeat\"} 12\n"
+      "test_device_polls_total{device=\"1\"} 3\n"
+      "test_uptime_seconds 4294967296\n"
+      "test_ratio 0.250\n"
+      "test_unknown NaN\n"
+      "test_handshake_seconds{suite=\"fast\"} 0.500\n"
+      "test_span_seconds{span=\"connect\",quantile=\"0.90\"} 0.431\n"
+      "# HELP test_latency_seconds Latency.\n"
+      "# TYPE test_latency_seconds histogram\n"
+      "test_latency_seconds_bucket{le=\"0.010\"} 1\n"
+      "test_latency_seconds_bucket{le=\"0.100\"} 2\n"
+      "test_latency_seconds_bucket{le=\"1.000\"} 2\n"
+      "test_latency_seconds_bucket{le=\"+Inf\"} 3\n"
+      "test_latency_seconds_sum 5.055\n"
+      "test_latency_seconds_count 3\n",
+      std::string(buffer, out.size()).c_str());
+}
+
+void testWritesFineBounds() {
+  uint32 const micros[] = {100};
+  Histogram histogram(micros);
+  histogram.observe(50);
+  char buffer[512];
+  ArrayPrint out(buffer, sizeof(buffer));
+  PrometheusWriter writer(out);
+  writer.histogram("test_loop_seconds", "Loop.", histogram, 1e-6, 6);
+  TEST_ASSERT_TRUE(std::string(buffer, out.size()).find("test_loop_seconds_bucket{le=\"0.000100\"} 1\n") != std::string::npos);
+  TEST_ASSERT_TRUE(std::string(buffer, out.size()).find("test_loop_seconds_sum 0.000050\n") != std::string::npos);
+}
+
+int main() {
+  UNITY_BEGIN();
+  RUN_TEST(testCountsIntoBuckets);
+  RUN_TEST(testWritesExpositionFormat);
+  RUN_TEST(testWritesFineBounds);
+  UNITY_END();
+}
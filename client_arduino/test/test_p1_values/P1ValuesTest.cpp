@@ -0,0 +1,76 @@
+#include <unity.h>
+
+#include "P1Values.h"
+
+char const TELEGRAM[] =
+  "/ISk5\\2MT382-1000\r\n"
+  "\r\n"
+  "1-3:0.2.8(50)\r\n"
+  "0-0:1.0.0(101209113020W)\r\n"
+  "1-0:1.8.1(123456.789*kWh)\r\n"
+  "1-0:1.8.2(123456.789*kWh)\r\n"
+  "1-0:2.8.1(000012.345*kWh)\r\n"
+  "1-0:2.8.2(000000.000*kWh)\r\n"
+  "1-0:1.7.0(01.193*kW)\r\n"
+  "1-0:2.7.0(00.000*kW)\r\n"
+  "1-0:21.7.0(00.501*kW)\r\n"
+  "1-0:41.7.0(00.692*kW)\r\n"
+  "1-0:61.7.0(00.000*kW)\r\n"
+  "1-0:22.7.0(00.000*kW)\r\n"
+  "1-0:42.7.0(00.000*kW)\r\n"
+  "1-0:62.7.0(00.012*kW)\r\n"
+  "0-1:24.1.0(003)\r\n"
+  "0-1:24.2.1(101209112500W)(12785.123*m3)\r\n"
+  "!EF2F\r\n";
+
+bool parse(P1Values &values, char const *telegram) {
+  return values.parse(reinterpret_cast<byte const *>(telegram), strlen(telegram));
+}
+
+void testParsesPowerFromTelegram() {
+  P1Values values;
+  TEST_ASSERT_TRUE(parse(values, TELEGRAM));
+  TEST_ASSERT_EQUAL_FLOAT(1193, values.importWatts);
+  TEST_ASSERT_EQUAL_FLOAT(0, values.exportWatts);
+  TEST_ASSERT_EQUAL_FLOAT(1193, values.netWatts());
+  TEST_ASSERT_EQUAL_FLOAT(501, values.phaseImportWatts[0]);
+  TEST_ASSERT_EQUAL_FLOAT(692, values.phaseImportWatts[1]);
+  TEST_ASSERT_EQUAL_FLOAT(0, values.phaseImportWatts[2]);
+  TEST_ASSERT_EQUAL_FLOAT(12, values.phaseExportWatts[2]);
+}
+
+void testParsesCountersFromTelegram() {
+  P1Values values;
+  TEST_ASSERT_TRUE(parse(values, TELEGRAM));
+  TEST_ASSERT_EQUAL_UINT32(123456789, values.importWattHours[0]);
+  TEST_ASSERT_EQUAL_UINT32(123456789, values.importWattHours[1]);
+  TEST_ASSERT_EQUAL_UINT32(12345, values.exportWattHours[0]);
+  TEST_ASSERT_EQUAL_UINT32(0, values.exportWattHours[1]);
+  TEST_ASSERT_EQUAL_UINT32(12785123, values.gasLitres);
+}
+
+void testIgnoresMissingAndMalformedValues() {
+  P1Values values;
+  TEST_ASSERT_TRUE(parse(values,
+    "/ISk5\\2MT382-1000\r\n"
+    "1-0:1.7.0(01.1x3*kW)\r\n"
+    "1-0:2.7.0(00.250*kW)\r\n"
+    "1-0:1.8.1(123456.789*m3)\r\n"
+    "!EF2F\r\n"));
+  TEST_ASSERT_TRUE(std::isnan(values.importWatts));
+  TEST_ASSERT_EQUAL_FLOAT(250, values.exportWatts);
+  TEST_ASSERT_TRUE(std::isnan(values.phaseImportWatts[0]));
+  TEST_ASSERT_EQUAL_UINT32(P1Values::NO_COUNTER, values.importWattHours[0]);
+  TEST_ASSERT_EQUAL_UINT32(P1Values::NO_COUNTER, values.gasLitres);
+
+  TEST_ASSERT_FALSE(parse(values, "/ISk5\\2MT382-1000\r\n1-0:1.8.1(123456.789*kWh)\r\n!EF2F\r\n"));
+  TEST_ASSERT_EQUAL_UINT32(123456789, values.importWattHours[0]);
+}
+
+int main() {
+  UNITY_BEGIN();
+  RUN_TEST(testParsesPowerFromTelegram);
+  RUN_TEST(testParsesCountersFromTelegram);
+  RUN_TEST(testIgnoresMissingAndMalformedValues);
+  UNITY_END();
+}
@@ -0,0 +1,136 @@
+#include <unity.h>
+
+#include "PollScheduler.h"
+
+unsigned long const MIN_MILLIS = 2000;
+unsigned long const MAX_MILLIS = 60000;
+
+PollScheduler scheduler() {
+  PollScheduler scheduler;
+  scheduler.begin(MIN_MILLIS, MAX_MILLIS);
+  return scheduler;
+}
+
+void testFirstPollIsDueImmediately() {
+  PollScheduler s = scheduler();
+  TEST_ASSERT_TRUE(s.isDue(0));
+  s.started(1000);
+  TEST_ASSERT_FALSE(s.isDue(1000 + PollScheduler::DEFAULT_INTERVAL_MILLIS - 1));
+  TEST_ASSERT_TRUE(s.isDue(1000 + PollScheduler::DEFAULT_INTERVAL_MILLIS));
+  TEST_ASSERT_EQUAL(1, s.numPolls());
+}
+
+void testClampsDefaultInterval() {
+  PollScheduler s;
+  s.begin(20000, 60000);
+  TEST_ASSERT_EQUAL(20000, s.intervalMillis());
+  s.begin(1000, 5000);
+  TEST_ASSERT_EQUAL(5000, s.intervalMillis());
+  // A maximum below the minimum is raised to it.
+  s.begin(3000, 1000);
+  TEST_ASSERT_EQUAL(3000, s.intervalMillis());
+}
+
+void testBacksOffWhenFailingUpToMaximum() {
+  PollScheduler s = scheduler();
+  s.failed();
+  TEST_ASSERT_EQUAL(20000, s.intervalMillis());
+  s.failed();
+  TEST_ASSERT_EQUAL(40000, s.intervalMillis());
+  s.failed();
+  TEST_ASSERT_EQUAL(MAX_MILLIS, s.intervalMillis());
+  s.failed();
+  TEST_ASSERT_EQUAL(MAX_MILLIS, s.intervalMillis());
+  TEST_ASSERT_EQUAL(4, s.numFailures());
+}
+
+void testBacksOffWhenIdle() {
+  PollScheduler s = scheduler();
+  s.succeeded(0.5);
+  TEST_ASSERT_EQUAL(20000, s.intervalMillis());
+  s.succeeded(-0.5);
+  TEST_ASSERT_EQUAL(40000, s.intervalMillis());
+}
+
+void testSpeedsUpOnFastChangesDownToMinimum() {
+  PollScheduler s = scheduler();
+  s.succeeded(1000);
+  TEST_ASSERT_EQUAL(10000, s.intervalMillis());
+  s.succeeded(2000);
+  TEST_ASSERT_EQUAL(5000, s.intervalMillis());
+  s.succeeded(1000);
+  TEST_ASSERT_EQUAL(2500, s.intervalMillis());
+  s.succeeded(2000);
+  TEST_ASSERT_EQUAL(MIN_MILLIS, s.intervalMillis());
+  s.succeeded(1000);
+  TEST_ASSERT_EQUAL(MIN_MILLIS, s.intervalMillis());
+}
+
+void testFastChangeIsRelativeToPower() {
+  PollScheduler s = scheduler();
+  s.succeeded(3000);
+  // 500 W is less than 20% of 3000 W.
+  s.succeeded(3500);
+  TEST_ASSERT_EQUAL(10000, s.intervalMillis());
+  // 800 W is more.
+  s.succeeded(2700);
+  TEST_ASSERT_EQUAL(5000, s.intervalMillis());
+
+  // At low power, 100 W is the threshold.
+  PollScheduler low = scheduler();
+  low.succeeded(50);
+  low.succeeded(140);
+  TEST_ASSERT_EQUAL(10000, low.intervalMillis());
+  low.succeeded(250);
+  TEST_ASSERT_EQUAL(5000, low.intervalMillis());
+}
+
+void testRelaxesToDefaultStepByStep() {
+  PollScheduler s = scheduler();
+  s.failed();
+  s.failed();
+  s.failed();
+  TEST_ASSERT_EQUAL(MAX_MILLIS, s.intervalMillis());
+  s.succeeded(1000);
+  TEST_ASSERT_EQUAL(30000, s.intervalMillis());
+  s.succeeded(1000);
+  TEST_ASSERT_EQUAL(15000, s.intervalMillis());
+  s.succeeded(1000);
+  TEST_ASSERT_EQUAL(10000, s.intervalMillis());
+  s.succeeded(1000);
+  TEST_ASSERT_EQUAL(10000, s.intervalMillis());
+
+  s.succeeded(2000);
+  s.succeeded(1000);
+  s.succeeded(2000);
+  TEST_ASSERT_EQUAL(MIN_MILLIS, s.intervalMillis());
+  s.succeeded(2000);
+  TEST_ASSERT_EQUAL(4000, s.intervalMillis());
+  s.succeeded(2000);
+  TEST_ASSERT_EQUAL(8000, s.intervalMillis());
+  s.succeeded(2000);
+  TEST_ASSERT_EQUAL(10000, s.intervalMillis());
+}
+
+void testFailureForgetsLastPower() {
+  PollScheduler s = scheduler();
+  s.succeeded(1000);
+  s.failed();
+  TEST_ASSERT_EQUAL(20000, s.intervalMillis());
+  // Not compared with the 1000 W from before the failure.
+  s.succeeded(3000);
+  TEST_ASSERT_EQUAL(10000, s.intervalMillis());
+}
+
+int main() {
+  UNITY_BEGIN();
+  RUN_TEST(testFirstPollIsDueImmediately);
+  RUN_TEST(testClampsDefaultInterval);
+  RUN_TEST(testBacksOffWhenFailingUpToMaximum);
+  RUN_TEST(testBacksOffWhenIdle);
+  RUN_TEST(testSpeedsUpOnFastChangesDownToMinimum);
+  RUN_TEST(testFastChangeIsRelativeToPower);
+  RUN_TEST(testRelaxesToDefaultStepByStep);
+  RUN_TEST(testFailureForgetsLastPower);
+  UNITY_END();
+}
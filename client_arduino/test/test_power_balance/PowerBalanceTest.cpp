@@ -0,0 +1,76 @@
+#include <unity.h>
+
+#include "PowerBalance.h"
+
+P1Values p1Values(double importWatts, double exportWatts) {
+  P1Values values;
+  values.importWatts = importWatts;
+  values.exportWatts = exportWatts;
+  return values;
+}
+
+void testComputesBalanceWhileExporting() {
+  PowerBalance balance;
+  balance.addProduction(0, 3000, 1000);
+  balance.setP1Values(p1Values(0, 1800), 1000);
+
+  PowerSnapshot const s = balance.snapshot();
+  TEST_ASSERT_EQUAL_UINT32(1000, s.p1Millis);
+  TEST_ASSERT_EQUAL_FLOAT(-1800, s.netWatts);
+  TEST_ASSERT_EQUAL_FLOAT(3000, s.productionWatts);
+  TEST_ASSERT_EQUAL_FLOAT(1200, s.consumptionWatts);
+  TEST_ASSERT_EQUAL_FLOAT(1200, s.selfConsumptionWatts);
+  TEST_ASSERT_EQUAL_FLOAT(0.4, s.selfConsumptionRatio);
+}
+
+void testInterpolatesProductionToP1Time() {
+  PowerBalance balance;
+  balance.addProduction(0, 1000, 10000);
+  balance.setP1Values(p1Values(500, 0), 14000);
+  // No reading after the P1 measurement yet, so the last one is held.
+  TEST_ASSERT_EQUAL_FLOAT(1000, balance.snapshot().productionWatts);
+  TEST_ASSERT_EQUAL_UINT32(4000, balance.snapshot().skewMillis);
+
+  uint32_t const sequence = balance.sequence();
+  balance.addProduction(0, 2000, 20000);
+  TEST_ASSERT_NOT_EQUAL(sequence, balance.sequence());
+  PowerSnapshot const s = balance.snapshot();
+  TEST_ASSERT_EQUAL_FLOAT(1400, s.productionWatts);
+  TEST_ASSERT_EQUAL_FLOAT(1900, s.consumptionWatts);
+  TEST_ASSERT_EQUAL_UINT32(4000, s.skewMillis);
+
+  // The same reading again changes nothing.
+  balance.addProduction(0, 2000, 20000);
+  TEST_ASSERT_EQUAL_FLOAT(1400, balance.snapshot().productionWatts);
+}
+
+void testSumsDevicesAndRejectsStaleReadings() {
+  PowerBalance balance;
+  balance.addProduction(0, 1000, 1000);
+  balance.addProduction(1, 500, 2000);
+  balance.setP1Values(p1Values(0, 0), 3000);
+  TEST_ASSERT_EQUAL_FLOAT(1500, balance.snapshot().productionWatts);
+
+  balance.setP1Values(p1Values(0, 0), 2000 + PowerBalance::MAX_SKEW_MILLIS);
+  PowerSnapshot const s = balance.snapshot();
+  TEST_ASSERT_TRUE(std::isnan(s.productionWatts));
+  TEST_ASSERT_TRUE(std::isnan(s.selfConsumptionWatts));
+  TEST_ASSERT_EQUAL_FLOAT(0, s.netWatts);
+}
+
+void testHandlesMillisWraparound() {
+  PowerBalance balance;
+  balance.addProduction(0, 1000, static_cast<unsigned long>(-1000));
+  balance.addProduction(0, 3000, 1000);
+  balance.setP1Values(p1Values(0, 0), 0);
+  TEST_ASSERT_EQUAL_FLOAT(2000, balance.snapshot().productionWatts);
+}
+
+int main() {
+  UNITY_BEGIN();
+  RUN_TEST(testComputesBalanceWhileExporting);
+  RUN_TEST(testInterpolatesProductionToP1Time);
+  RUN_TEST(testSumsDevicesAndRejectsStaleReadings);
+  RUN_TEST(testHandlesMillisWraparound);
+  UNITY_END();
+}
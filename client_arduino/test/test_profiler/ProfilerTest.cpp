@@ -0,0 +1,76 @@
+#include <unity.h>
+
+#include <string>
+
+// The native environment inherits PROFILING from the environment variable,
+// which is usually unset.
+#undef PROFILING
+#define PROFILING 1
+
+#include "ArrayPrint.h"
+#include "Profiler.h"
+
+void work(int iterations) {
+  PROFILE_ZONE("test.work");
+  volatile unsigned sum = 0;
+  for (int i = 0; i < iterations; i++) {
+    sum = sum + i;
+  }
+}
+
+void nested() {
+  PROFILE_ZONE("test.outer");
+  {
+    PROFILE_ZONE("test.inner");
+    work(10);
+  }
+}
+
+ProfileZone const *findZone(char const *name) {
+  for (ProfileZone const *zone = ProfileZone::first(); zone; zone = zone->next()) {
+    if (std::string(zone->name()) == name) {
+      return zone;
+    }
+  }
+  return nullptr;
+}
+
+void testRecordsZones() {
+  work(10);
+  work(100000);
+  nested();
+  ProfileZone const *const zone = findZone("test.work");
+  TEST_ASSERT_TRUE(zone);
+  TEST_ASSERT_EQUAL(3, zone->count());
+  TEST_ASSERT_TRUE(zone->maxCycles() > 0);
+  TEST_ASSERT_TRUE(zone->totalCycles() >= zone->maxCycles());
+  TEST_ASSERT_EQUAL(1, findZone("test.outer")->count());
+  TEST_ASSERT_EQUAL(1, findZone("test.inner")->count());
+  TEST_ASSERT_TRUE(findZone("test.outer")->totalCycles() >= findZone("test.inner")->totalCycles());
+  TEST_ASSERT_FALSE(findZone("test.unused"));
+}
+
+void testWritesTable() {
+  char buffer[512];
+  ArrayPrint out(buffer, sizeof(buffer));
+  size_t const written = Profiler::write(out);
+  TEST_ASSERT_EQUAL(out.size(), written);
+  std::string const table(buffer, out.size());
+  TEST_ASSERT_EQUAL(0, table.find("zone count total_us mean_us max_us\n"));
+  TEST_ASSERT_TRUE(table.find("\ntest.work 3 ") != std::string::npos);
+}
+
+void testResets() {
+  Profiler::reset();
+  TEST_ASSERT_EQUAL(0, findZone("test.work")->count());
+  work(1);
+  TEST_ASSERT_EQUAL(1, findZone("test.work")->count());
+}
+
+int main() {
+  UNITY_BEGIN();
+  RUN_TEST(testRecordsZones);
+  RUN_TEST(testWritesTable);
+  RUN_TEST(testResets);
+  UNITY_END();
+}
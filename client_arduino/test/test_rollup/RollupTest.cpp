@@ -0,0 +1,86 @@
+#include <unity.h>
+
+#include "Rollup.h"
+
+// 2020-09-13T12:26:40Z, which is on a quarter of an hour plus 11 minutes and
+// 40 seconds.
+uint32 const EPOCH = 1600000000;
+uint32 const MINUTE = EPOCH - EPOCH % 60;
+
+P1Values values(double importWatts, double exportWatts, uint32 importWattHours, uint32 gasLitres) {
+  P1Values values;
+  values.importWatts = importWatts;
+  values.exportWatts = exportWatts;
+  values.importWattHours[0] = importWattHours;
+  values.gasLitres = gasLitres;
+  return values;
+}
+
+void testAggregatesTelegramsPerMinute() {
+  RollupAggregator aggregator;
+  aggregator.add(values(1000, 0, 500000, 1000), MINUTE + 0);
+  aggregator.add(values(0, 300, 500001, 1000), MINUTE + 10);
+  aggregator.add(values(2000, 0, 500004, 1000), MINUTE + 59);
+  TEST_ASSERT_EQUAL_UINT32(0, aggregator.numPending());
+
+  aggregator.add(values(500, 0, 500010, 1005), MINUTE + 60);
+  TEST_ASSERT_EQUAL_UINT32(1, aggregator.numPending());
+  Rollup const &rollup = aggregator.pending()[0];
+  TEST_ASSERT_EQUAL_UINT32(MINUTE, rollup.startEpochSeconds);
+  TEST_ASSERT_EQUAL_UINT32(60, rollup.periodSeconds);
+  TEST_ASSERT_EQUAL_UINT32(3, rollup.numTelegrams);
+  TEST_ASSERT_EQUAL(-300, rollup.minWatts);
+  TEST_ASSERT_EQUAL(900, rollup.meanWatts);
+  TEST_ASSERT_EQUAL(2000, rollup.maxWatts);
+  TEST_ASSERT_EQUAL_UINT32(500000, rollup.firstImportWattHours[0]);
+  TEST_ASSERT_EQUAL_UINT32(500004, rollup.lastImportWattHours[0]);
+  TEST_ASSERT_EQUAL_UINT32(P1Values::NO_COUNTER, rollup.firstImportWattHours[1]);
+  TEST_ASSERT_EQUAL_UINT32(1000, rollup.lastGasLitres);
+  TEST_ASSERT_EQUAL_UINT32(P1Values::NO_COUNTER, rollup.gasDeltaLitres);
+}
+
+void testComputesGasDeltaAcrossPeriods() {
+  RollupAggregator aggregator;
+  aggregator.add(values(0, 0, 0, 1000), MINUTE);
+  aggregator.add(values(0, 0, 0, 1000), MINUTE + 60);
+  aggregator.add(values(0, 0, 0, 1250), MINUTE + 120);
+  aggregator.advance(MINUTE + 180);
+  TEST_ASSERT_EQUAL_UINT32(3, aggregator.numPending());
+  TEST_ASSERT_EQUAL_UINT32(0, aggregator.pending()[1].gasDeltaLitres);
+  TEST_ASSERT_EQUAL_UINT32(250, aggregator.pending()[2].gasDeltaLitres);
+}
+
+void testCompletesQuarterHours() {
+  RollupAggregator aggregator;
+  uint32 const quarter = EPOCH - EPOCH % 900;
+  aggregator.add(values(100, 0, 0, 0), quarter + 899);
+  aggregator.add(values(300, 0, 0, 0), quarter + 900);
+  TEST_ASSERT_EQUAL_UINT32(2, aggregator.numPending());
+  Rollup const &rollup = aggregator.pending()[1];
+  TEST_ASSERT_EQUAL_UINT32(quarter, rollup.startEpochSeconds);
+  TEST_ASSERT_EQUAL_UINT32(900, rollup.periodSeconds);
+  TEST_ASSERT_EQUAL(100, rollup.meanWatts);
+}
+
+void testDropsOldestRollupsWhenFull() {
+  RollupAggregator aggregator;
+  for (uint32 i = 0; i <= RollupAggregator::MAX_PENDING + 2; i++) {
+    aggregator.add(values(i, 0, 0, 0), MINUTE + 60 * i);
+  }
+  TEST_ASSERT_EQUAL_UINT32(RollupAggregator::MAX_PENDING, aggregator.numPending());
+  TEST_ASSERT_TRUE(aggregator.numDropped() > 0);
+
+  uint32 const newest = aggregator.pending()[RollupAggregator::MAX_PENDING - 1].startEpochSeconds;
+  aggregator.removePending(RollupAggregator::MAX_PENDING - 1);
+  TEST_ASSERT_EQUAL_UINT32(1, aggregator.numPending());
+  TEST_ASSERT_EQUAL_UINT32(newest, aggregator.pending()[0].startEpochSeconds);
+}
+
+int main() {
+  UNITY_BEGIN();
+  RUN_TEST(testAggregatesTelegramsPerMinute);
+  RUN_TEST(testComputesGasDeltaAcrossPeriods);
+  RUN_TEST(testCompletesQuarterHours);
+  RUN_TEST(testDropsOldestRollupsWhenFull);
+  UNITY_END();
+}
@@ -0,0 +1,90 @@
+#include <unity.h>
+
+#include <string>
+
+#include "Sample.h"
+
+/**
+ * Collects everything printed to it.
+ */
+class StringPrint : public Print {
+  public:
+    std::string str;
+
+    size_t write(uint8_t c) override {
+      str += static_cast<char>(c);
+      return 1;
+    }
+};
+
+void testWritesTelegramAndDevices() {
+  char const telegram[] = "/ACME\\5\r\n\r\n1-0:1.7.0(00.330*kW)\r\n!D0FD\r\n";
+  Sample sample;
+  sample.setTelegram(reinterpret_cast<byte const *>(telegram), strlen(telegram), 9000);
+  TEST_ASSERT_TRUE(sample.addDevice({0, 4000, 1234.5, 5678}));
+  TEST_ASSERT_TRUE(sample.addDevice({2, 8500, -20, 0.25}));
+
+  StringPrint out;
+  size_t const written = sample.writeJson(out, 1600000010000ull, 10000);
+  TEST_ASSERT_EQUAL_STRING(
+      "{\"timestamp\":1600000010000,"
+      "\"telegram\":{\"timestamp\":1600000009000,"
+      "\"raw\":\"/ACME\\\\5\\r\\n\\r\\n1-0:1.7.0(00.330*kW)\\r\\n!D0FD\\r\\n\"},"
+      "\"inverters\":["
+      "{\"device\":0,\"timestamp\":1600000004000,\"powerW\":1234.500,\"totalEnergyWh\":5678.000},"
+      "{\"device\":2,\"timestamp\":1600000008500,\"powerW\":-20.000,\"totalEnergyWh\":0.250}]}",
+      out.str.c_str());
+  TEST_ASSERT_EQUAL_UINT32(out.str.size(), written);
+  TEST_ASSERT_EQUAL_UINT32(out.str.size(), sample.jsonLength(1600000010000ull, 10000));
+}
+
+void testWritesSampleWithoutDevices() {
+  Sample sample;
+  StringPrint out;
+  sample.writeJson(out, 1600000000000ull, 0);
+  TEST_ASSERT_EQUAL_STRING("{\"timestamp\":1600000000000,\"inverters\":[]}", out.str.c_str());
+}
+
+void testWritesRollups() {
+  Rollup rollup;
+  rollup.startEpochSeconds = 1600000020;
+  rollup.periodSeconds = 60;
+  rollup.numTelegrams = 6;
+  rollup.minWatts = -250;
+  rollup.meanWatts = 100;
+  rollup.maxWatts = 400;
+  rollup.firstImportWattHours[0] = 1000;
+  rollup.lastImportWattHours[0] = 1002;
+  rollup.lastGasLitres = 12785123;
+  Sample sample;
+  sample.setRollups(&rollup, 1);
+
+  StringPrint out;
+  sample.writeJson(out, 1600000090000ull, 0);
+  TEST_ASSERT_EQUAL_STRING(
+      "{\"timestamp\":1600000090000,\"inverters\":[],\"rollups\":["
+      "{\"start\":1600000020000,\"periodSeconds\":60,\"telegrams\":6,"
+      "\"minPowerW\":-250,\"meanPowerW\":100,\"maxPowerW\":400,"
+      "\"firstImportWh\":[1000,null],\"lastImportWh\":[1002,null],"
+      "\"firstExportWh\":[null,null],\"lastExportWh\":[null,null],"
+      "\"lastGasL\":12785123,\"gasDeltaL\":null}]}",
+      out.str.c_str());
+}
+
+void testLimitsNumberOfDevices() {
+  Sample sample;
+  for (size_t i = 0; i < Sample::MAX_DEVICES; i++) {
+    TEST_ASSERT_TRUE(sample.addDevice({static_cast<uint8>(i), 0, 0, 0}));
+  }
+  TEST_ASSERT_FALSE(sample.addDevice({0, 0, 0, 0}));
+  TEST_ASSERT_EQUAL_UINT32(Sample::MAX_DEVICES, sample.numDevices());
+}
+
+int main() {
+  UNITY_BEGIN();
+  RUN_TEST(testWritesTelegramAndDevices);
+  RUN_TEST(testWritesSampleWithoutDevices);
+  RUN_TEST(testWritesRollups);
+  RUN_TEST(testLimitsNumberOfDevices);
+  UNITY_END();
+}
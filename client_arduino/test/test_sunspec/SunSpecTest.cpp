@@ -0,0 +1,460 @@
+#include <unity.h>
+
+#include <ArduinoSunSpec.h>
+#include <FakeSunSpecTransport.h>
+#include <SunSpecDeviceSimulator.h>
+
+// Simulated network round trip time.
+unsigned long const LATENCY_MILLIS = 30;
+
+/**
+ * Polls until the current operation is no longer busy, advancing simulated
+ * time by 1 ms per poll.
+ */
+SunSpec::Status run(SunSpec &sunSpec) {
+  for (int i = 0; i < 100000; i++) {
+    SunSpec::Status const status = sunSpec.poll();
+    if (status != SunSpec::Status::BUSY) {
+      return status;
+    }
+    NativeArduino::advanceMillis(1);
+  }
+  return SunSpec::Status::BUSY;
+}
+
+/**
+ * Collects everything printed to it.
+ */
+class StringPrint : public Print {
+  public:
+    std::string str;
+
+    size_t write(uint8_t c) override {
+      str += static_cast<char>(c);
+      return 1;
+    }
+};
+
+/**
+ * Returns the descriptor of the point with the given name from the table.
+ */
+SunSpecPointDescriptor findPoint(SunSpecPointTable const &table, char const *name) {
+  SunSpecPointDescriptor const *point = SunSpecPoints::find(table, name);
+  if (!point) {
+    TEST_FAIL_MESSAGE(name);
+    return {};
+  }
+  return SunSpecPoints::descriptor(point);
+}
+
+void assertContains(std::string const &haystack, char const *needle) {
+  TEST_ASSERT_TRUE_MESSAGE(haystack.find(needle) != std::string::npos, haystack.c_str());
+}
+
+/**
+ * Walks the model list from the common model up to and including the first
+ * inverter model, reading both. Returns the address of the inverter model, or
+ * 0 if it was not found.
+ */
+uint16 discover(SunSpec &sunSpec) {
+  sunSpec.begin();
+  TEST_ASSERT_TRUE(run(sunSpec) == SunSpec::Status::DONE);
+  TEST_ASSERT_EQUAL_UINT16(1, sunSpec.currentModelId());
+  sunSpec.readCurrentModel();
+  TEST_ASSERT_TRUE(run(sunSpec) == SunSpec::Status::DONE);
+  TEST_ASSERT_TRUE(sunSpec.currentModelAs<SunSpecModels::Common>().isValid());
+  while (true) {
+    sunSpec.nextModel();
+    TEST_ASSERT_TRUE(run(sunSpec) == SunSpec::Status::DONE);
+    if (!sunSpec.hasCurrentModel()) {
+      return 0;
+    }
+    if (sunSpec.currentModelIs<SunSpecModels::InverterThreePhase>()) {
+      return sunSpec.currentModelAddress();
+    }
+  }
+}
+
+void testDiscoversModels() {
+  SunSpecDeviceSimulator device;
+  device.addCommonModel("ACME", "Sunny 3000");
+  device.addNameplateModel(3000);
+  uint16 const inverter = device.addInverterModel(103);
+  device.setInverterValues(inverter, 1234, 56789);
+  FakeSunSpecTransport transport(&device);
+  SunSpec sunSpec(&transport);
+
+  TEST_ASSERT_EQUAL_UINT16(inverter, discover(sunSpec));
+  sunSpec.readCurrentModel();
+  TEST_ASSERT_TRUE(run(sunSpec) == SunSpec::Status::DONE);
+  SunSpecModels::InverterThreePhase model = sunSpec.currentModelAs<SunSpecModels::InverterThreePhase>();
+  TEST_ASSERT_TRUE(model.isValid());
+  TEST_ASSERT_EQUAL_FLOAT(1234, model.watts());
+  TEST_ASSERT_EQUAL_FLOAT(56789, model.wattHours());
+
+  sunSpec.nextModel();
+  TEST_ASSERT_TRUE(run(sunSpec) == SunSpec::Status::DONE);
+  TEST_ASSERT_FALSE(sunSpec.hasCurrentModel());
+}
+
+void testSmaServerIdQuirk() {
+  SunSpecDeviceSimulator device;
+  device.enableSmaServerIdQuirk(3);
+  device.addCommonModel("SMA", "SB3.0");
+  device.addInverterModel(103);
+  FakeSunSpecTransport transport(&device);
+  SunSpec sunSpec(&transport);
+
+  TEST_ASSERT_NOT_EQUAL(0, discover(sunSpec));
+  // Probes at server ID 0, the unit ID read, then probes at server ID 126.
+  TEST_ASSERT_GREATER_OR_EQUAL_UINT32(3, transport.stats().exceptions);
+}
+
+void testReadsMeterModel() {
+  SunSpecDeviceSimulator device;
+  device.addCommonModel("ACME", "Meter");
+  uint16 const meter = device.addMeterModel(203);
+  device.setMeterValues(meter, -2500, 1000000);
+  FakeSunSpecTransport transport(&device);
+  SunSpec sunSpec(&transport);
+
+  sunSpec.begin();
+  TEST_ASSERT_TRUE(run(sunSpec) == SunSpec::Status::DONE);
+  sunSpec.nextModel();
+  TEST_ASSERT_TRUE(run(sunSpec) == SunSpec::Status::DONE);
+  sunSpec.readCurrentModel();
+  TEST_ASSERT_TRUE(run(sunSpec) == SunSpec::Status::DONE);
+  SunSpecModels::WyeConnectThreePhaseAbcnMeter_203 model =
+    sunSpec.currentModelAs<SunSpecModels::WyeConnectThreePhaseAbcnMeter_203>();
+  TEST_ASSERT_TRUE(model.isValid());
+  TEST_ASSERT_EQUAL_FLOAT(-2500, model.watts());
+  TEST_ASSERT_EQUAL_FLOAT(1000000, model.totalWattHoursExported());
+
+  // The same in fixed point, through the point table.
+  SunSpecPointValue const watts = SunSpecPoints::decode(model, "watts");
+  TEST_ASSERT_TRUE(watts.kind == SunSpecPointValue::Kind::SIGNED);
+  TEST_ASSERT_EQUAL_FLOAT(-2500, watts.toDouble());
+  TEST_ASSERT_FALSE(SunSpecPoints::decode(model, "noSuchPoint").isImplemented());
+}
+
+void testIteratesRepeatingGroup() {
+  SunSpecDeviceSimulator device;
+  device.addCommonModel("ACME", "Sunny 3000");
+  uint16 const numModules = 3;
+  uint16 const mppt = device.addModel(160, 8 + numModules * 20);
+  uint16 const body = mppt + 2;
+  device.setRegister(body + 2, static_cast<uint16>(-1)); // DCW_SF
+  device.setRegister(body + 6, numModules); // N
+  for (uint16 i = 0; i < numModules; i++) {
+    uint16 const module = body + 8 + i * 20;
+    device.setRegister(module + 0, i + 1); // ID
+    device.setRegister(module + 11, 1000 * (i + 1)); // DCW
+  }
+  FakeSunSpecTransport transport(&device);
+  SunSpec sunSpec(&transport);
+
+  sunSpec.begin();
+  TEST_ASSERT_TRUE(run(sunSpec) == SunSpec::Status::DONE);
+  sunSpec.nextModel();
+  TEST_ASSERT_TRUE(run(sunSpec) == SunSpec::Status::DONE);
+  sunSpec.readCurrentModel();
+  TEST_ASSERT_TRUE(run(sunSpec) == SunSpec::Status::DONE);
+  SunSpecModels::MultipleMPPTInverterExtensionModel model =
+    sunSpec.currentModelAs<SunSpecModels::MultipleMPPTInverterExtensionModel>();
+  TEST_ASSERT_TRUE(model.isValid());
+  TEST_ASSERT_EQUAL_UINT16(numModules, model.numberOfModules());
+  TEST_ASSERT_EQUAL_UINT16(numModules, model.numModules());
+
+  uint16 index = 0;
+  for (auto const &module : model.modules()) {
+    TEST_ASSERT_EQUAL_UINT16(index + 1, module.inputID());
+    TEST_ASSERT_EQUAL_FLOAT(100 * (index + 1), module.DCPower());
+    index++;
+  }
+  TEST_ASSERT_EQUAL_UINT16(numModules, index);
+  TEST_ASSERT_EQUAL_FLOAT(200, model.module(1).DCPower());
+}
+
+void testDecodesPointsFromTable() {
+  SunSpecPointTable const table = SunSpecModels::InverterThreePhase::pointTable();
+  uint16 registers[50] = {};
+  SunSpecPointDescriptor const watts = findPoint(table, "watts");
+  TEST_ASSERT_EQUAL_STRING("W", watts.units);
+  registers[watts.offset] = static_cast<uint16>(-12345);
+  registers[watts.scaleFactorOffset] = static_cast<uint16>(-2);
+
+  SunSpecPointValue const value = SunSpecPoints::decode(registers, 50, watts);
+  TEST_ASSERT_TRUE(value.kind == SunSpecPointValue::Kind::SIGNED);
+  TEST_ASSERT_EQUAL_INT64(-12345, value.i);
+  TEST_ASSERT_EQUAL_INT8(-2, value.exponent);
+  TEST_ASSERT_EQUAL_FLOAT(-123.45, value.toDouble());
+
+  // Not implemented, either through the value or through its scale factor.
+  SunSpecPointDescriptor const amps = findPoint(table, "amps");
+  registers[amps.offset] = NotImplemented::UINT16;
+  TEST_ASSERT_FALSE(SunSpecPoints::decode(registers, 50, amps).isImplemented());
+  registers[watts.scaleFactorOffset] = NotImplemented::SUNSSF;
+  TEST_ASSERT_FALSE(SunSpecPoints::decode(registers, 50, watts).isImplemented());
+  // Beyond the end of the registers.
+  TEST_ASSERT_FALSE(SunSpecPoints::decode(registers, watts.offset, watts).isImplemented());
+}
+
+void testSerializesModelToJson() {
+  SunSpecPointTable const table = SunSpecModels::InverterThreePhase::pointTable();
+  uint16 registers[50] = {};
+  SunSpecPointDescriptor const watts = findPoint(table, "watts");
+  SunSpecPointDescriptor const amps = findPoint(table, "amps");
+  registers[watts.offset] = 12340;
+  registers[watts.scaleFactorOffset] = static_cast<uint16>(-3);
+  registers[amps.offset] = 7;
+  registers[amps.scaleFactorOffset] = 2;
+
+  StringPrint out;
+  size_t const written = SunSpecJson::write(out, table, registers, 50);
+  TEST_ASSERT_EQUAL_UINT32(out.str.size(), written);
+  TEST_ASSERT_EQUAL_CHAR('{', out.str.front());
+  TEST_ASSERT_EQUAL_CHAR('}', out.str.back());
+  assertContains(out.str, "{\"id\":103,");
+  assertContains(out.str, "\"watts\":12.34,");
+  assertContains(out.str, "\"amps\":700,");
+
+  registers[watts.offset] = 5;
+  out.str.clear();
+  SunSpecJson::write(out, table, registers, 50);
+  assertContains(out.str, "\"watts\":0.005,");
+}
+
+void testSerializesStringsAndGroupsToJson() {
+  SunSpecDeviceSimulator device;
+  device.addCommonModel("ACME \"Sun\"", "Sunny 3000");
+  uint16 const mppt = device.addModel(160, 8 + 2 * 20);
+  uint16 const body = mppt + 2;
+  device.setRegister(body + 2, static_cast<uint16>(-1)); // DCW_SF
+  device.setRegister(body + 6, 2); // N
+  device.setRegister(body + 8 + 11, 1234); // DCW of the first module
+  device.setRegister(body + 28 + 11, 5); // DCW of the second module
+  FakeSunSpecTransport transport(&device);
+  SunSpec sunSpec(&transport);
+
+  sunSpec.begin();
+  TEST_ASSERT_TRUE(run(sunSpec) == SunSpec::Status::DONE);
+  sunSpec.readCurrentModel();
+  TEST_ASSERT_TRUE(run(sunSpec) == SunSpec::Status::DONE);
+  StringPrint common;
+  SunSpecJson::write(common, sunSpec.currentModelAs<SunSpecModels::Common>());
+  assertContains(common.str, "\"manufacturer\":\"ACME \\\"Sun\\\"\",\"model\":\"Sunny 3000\",");
+
+  sunSpec.nextModel();
+  TEST_ASSERT_TRUE(run(sunSpec) == SunSpec::Status::DONE);
+  sunSpec.readCurrentModel();
+  TEST_ASSERT_TRUE(run(sunSpec) == SunSpec::Status::DONE);
+  StringPrint mppts;
+  SunSpecJson::write(mppts, sunSpec.currentModelAs<SunSpecModels::MultipleMPPTInverterExtensionModel>());
+  assertContains(mppts.str, "\"numberOfModules\":2,\"timestampPeriod\":0,\"module\":[{\"inputID\":0,");
+  assertContains(mppts.str, "\"DCPower\":123.4,");
+  assertContains(mppts.str, "\"DCPower\":0.5,");
+  TEST_ASSERT_EQUAL_CHAR('}', mppts.str[mppts.str.size() - 3]);
+  TEST_ASSERT_EQUAL_CHAR(']', mppts.str[mppts.str.size() - 2]);
+}
+
+void testPipeliningSavesTime() {
+  SunSpecDeviceSimulator device;
+  device.addCommonModel("ACME", "Sunny 3000");
+  device.addModel(64, 300); // Long vendor model, needing three requests.
+  device.addInverterModel(103);
+
+  size_t const windowSizes[2] = {1, SunSpecTransport::MAX_WINDOW_SIZE};
+  unsigned long elapsedMillis[2];
+  for (int i = 0; i < 2; i++) {
+    FakeSunSpecTransport transport(&device);
+    transport.setLatencyMillis(LATENCY_MILLIS);
+    transport.setWindowSize(windowSizes[i]);
+    SunSpec sunSpec(&transport);
+
+    // Read every model.
+    unsigned long const start = millis();
+    sunSpec.begin();
+    TEST_ASSERT_TRUE(run(sunSpec) == SunSpec::Status::DONE);
+    while (sunSpec.hasCurrentModel()) {
+      sunSpec.readCurrentModel();
+      TEST_ASSERT_TRUE(run(sunSpec) == SunSpec::Status::DONE);
+      sunSpec.nextModel();
+      TEST_ASSERT_TRUE(run(sunSpec) == SunSpec::Status::DONE);
+    }
+    elapsedMillis[i] = millis() - start;
+    TEST_ASSERT_LESS_OR_EQUAL(windowSizes[i], transport.stats().maxOutstanding);
+  }
+  TEST_ASSERT_LESS_THAN(elapsedMillis[0], elapsedMillis[1]);
+}
+
+void testTimeoutFailsRead() {
+  SunSpecDeviceSimulator device;
+  device.addCommonModel("ACME", "Sunny 3000");
+  FakeSunSpecTransport transport(&device);
+  transport.setLatencyMillis(LATENCY_MILLIS);
+  SunSpec sunSpec(&transport);
+
+  sunSpec.begin();
+  TEST_ASSERT_TRUE(run(sunSpec) == SunSpec::Status::DONE);
+  transport.setDropEvery(1);
+  sunSpec.readCurrentModel();
+  TEST_ASSERT_TRUE(run(sunSpec) == SunSpec::Status::FAILED);
+  TEST_ASSERT_EQUAL_UINT32(1, transport.stats().timeouts);
+}
+
+void testDisconnectFailsRead() {
+  SunSpecDeviceSimulator device;
+  device.addCommonModel("ACME", "Sunny 3000");
+  device.addInverterModel(103);
+  FakeSunSpecTransport transport(&device);
+  transport.setLatencyMillis(LATENCY_MILLIS);
+  SunSpec sunSpec(&transport);
+
+  sunSpec.begin();
+  TEST_ASSERT_TRUE(run(sunSpec) == SunSpec::Status::DONE);
+  transport.disconnectAfter(1);
+  sunSpec.nextModel();
+  TEST_ASSERT_TRUE(run(sunSpec) == SunSpec::Status::FAILED);
+
+  transport.reconnect();
+  TEST_ASSERT_NOT_EQUAL(0, discover(sunSpec));
+}
+
+/**
+ * Starts over at the common model and steps to the model at `index` in the
+ * device's model list, with 0 for the common model itself. Then reads it, and
+ * returns the number of requests that the read took.
+ */
+uint32 readModel(SunSpec &sunSpec, FakeSunSpecTransport &transport, int index) {
+  sunSpec.begin();
+  TEST_ASSERT_TRUE(run(sunSpec) == SunSpec::Status::DONE);
+  for (int i = 0; i < index; i++) {
+    sunSpec.nextModel();
+    TEST_ASSERT_TRUE(run(sunSpec) == SunSpec::Status::DONE);
+  }
+  transport.resetStats();
+  sunSpec.readCurrentModel();
+  TEST_ASSERT_TRUE(run(sunSpec) == SunSpec::Status::DONE);
+  return transport.stats().requests;
+}
+
+void testCacheServesStaticModels() {
+  SunSpecDeviceSimulator device;
+  device.addCommonModel("ACME", "Sunny 3000");
+  device.addInverterModel(103);
+  FakeSunSpecTransport transport(&device);
+  SunSpecCache cache;
+  SunSpec sunSpec(&transport);
+  sunSpec.setCache(&cache);
+
+  TEST_ASSERT_EQUAL_UINT32(1, readModel(sunSpec, transport, 0));
+  TEST_ASSERT_EQUAL_UINT32(0, readModel(sunSpec, transport, 0));
+  TEST_ASSERT_TRUE(sunSpec.currentModelAs<SunSpecModels::Common>().isValid());
+  TEST_ASSERT_EQUAL_UINT32(1, cache.numHits());
+
+  // Measurements always go to the device.
+  TEST_ASSERT_EQUAL_UINT32(1, readModel(sunSpec, transport, 1));
+  TEST_ASSERT_EQUAL_UINT32(1, readModel(sunSpec, transport, 1));
+}
+
+void testCacheExpiresPerModelClass() {
+  SunSpecDeviceSimulator device;
+  device.addCommonModel("ACME", "Sunny 3000");
+  device.addModel(121, 30); // Basic settings
+  FakeSunSpecTransport transport(&device);
+  SunSpecCache cache;
+  SunSpec sunSpec(&transport);
+  sunSpec.setCache(&cache);
+
+  TEST_ASSERT_EQUAL_UINT32(1, readModel(sunSpec, transport, 0));
+  TEST_ASSERT_EQUAL_UINT32(1, readModel(sunSpec, transport, 1));
+  NativeArduino::advanceMillis(SunSpecCache::SETTINGS_TTL_MILLIS - 1000);
+  TEST_ASSERT_EQUAL_UINT32(0, readModel(sunSpec, transport, 0));
+  TEST_ASSERT_EQUAL_UINT32(0, readModel(sunSpec, transport, 1));
+
+  // Settings expire long before static models do.
+  NativeArduino::advanceMillis(1000);
+  TEST_ASSERT_EQUAL_UINT32(0, readModel(sunSpec, transport, 0));
+  TEST_ASSERT_EQUAL_UINT32(1, readModel(sunSpec, transport, 1));
+
+  NativeArduino::advanceMillis(SunSpecCache::STATIC_TTL_MILLIS);
+  TEST_ASSERT_EQUAL_UINT32(1, readModel(sunSpec, transport, 0));
+  TEST_ASSERT_EQUAL_UINT32(0, readModel(sunSpec, transport, 0));
+}
+
+/**
+ * Like `readModel()` for the common model, but reads the aggregator model
+ * first if the cache knows where it is, like `SunSpecInverterReader` does.
+ * Returns the number of requests that reading the common model took.
+ */
+uint32 readCommonModelAfterAggregator(SunSpec &sunSpec, FakeSunSpecTransport &transport, SunSpecCache &cache) {
+  sunSpec.begin();
+  TEST_ASSERT_TRUE(run(sunSpec) == SunSpec::Status::DONE);
+  if (cache.aggregatorAddress()) {
+    sunSpec.seekAndRead(cache.aggregatorAddress(), cache.aggregatorLength());
+    TEST_ASSERT_TRUE(run(sunSpec) == SunSpec::Status::DONE);
+    sunSpec.restart();
+    TEST_ASSERT_TRUE(run(sunSpec) == SunSpec::Status::DONE);
+  }
+  transport.resetStats();
+  sunSpec.readCurrentModel();
+  TEST_ASSERT_TRUE(run(sunSpec) == SunSpec::Status::DONE);
+  return transport.stats().requests;
+}
+
+void testCacheIsClearedByAggregator() {
+  SunSpecDeviceSimulator device;
+  device.addCommonModel("ACME", "Sunny 3000");
+  uint16 const aggregator = device.addAggregatorModel(1);
+  FakeSunSpecTransport transport(&device);
+  SunSpecCache cache;
+  SunSpec sunSpec(&transport);
+  sunSpec.setCache(&cache);
+
+  TEST_ASSERT_EQUAL_UINT32(1, readModel(sunSpec, transport, 0));
+  readModel(sunSpec, transport, 1);
+  TEST_ASSERT_EQUAL_UINT16(aggregator, cache.aggregatorAddress());
+
+  // The same update number keeps the cache.
+  TEST_ASSERT_EQUAL_UINT32(0, readCommonModelAfterAggregator(sunSpec, transport, cache));
+  TEST_ASSERT_TRUE(sunSpec.currentModelAs<SunSpecModels::Common>().isValid());
+
+  // Until the update number has been checked again, nothing is served.
+  TEST_ASSERT_EQUAL_UINT32(1, readModel(sunSpec, transport, 0));
+
+  // A new one clears it before the stale common model can be served.
+  device.setRegister(aggregator + 2 + 2, 2);
+  TEST_ASSERT_EQUAL_UINT32(1, readCommonModelAfterAggregator(sunSpec, transport, cache));
+  TEST_ASSERT_EQUAL_UINT32(0, readCommonModelAfterAggregator(sunSpec, transport, cache));
+
+  // So does failing to read it.
+  sunSpec.begin();
+  TEST_ASSERT_TRUE(run(sunSpec) == SunSpec::Status::DONE);
+  sunSpec.nextModel();
+  TEST_ASSERT_TRUE(run(sunSpec) == SunSpec::Status::DONE);
+  transport.setDropEvery(1);
+  sunSpec.readCurrentModel();
+  TEST_ASSERT_TRUE(run(sunSpec) == SunSpec::Status::FAILED);
+  transport.setDropEvery(0);
+  TEST_ASSERT_EQUAL_UINT16(0, cache.aggregatorAddress());
+  TEST_ASSERT_EQUAL_UINT32(1, readCommonModelAfterAggregator(sunSpec, transport, cache));
+}
+
+int main() {
+  Serial.setMuted(true);
+  UNITY_BEGIN();
+  RUN_TEST(testDiscoversModels);
+  RUN_TEST(testSmaServerIdQuirk);
+  RUN_TEST(testReadsMeterModel);
+  RUN_TEST(testIteratesRepeatingGroup);
+  RUN_TEST(testDecodesPointsFromTable);
+  RUN_TEST(testSerializesModelToJson);
+  RUN_TEST(testSerializesStringsAndGroupsToJson);
+  RUN_TEST(testPipeliningSavesTime);
+  RUN_TEST(testTimeoutFailsRead);
+  RUN_TEST(testDisconnectFailsRead);
+  RUN_TEST(testCacheServesStaticModels);
+  RUN_TEST(testCacheExpiresPerModelClass);
+  RUN_TEST(testCacheIsClearedByAggregator);
+  UNITY_END();
+}
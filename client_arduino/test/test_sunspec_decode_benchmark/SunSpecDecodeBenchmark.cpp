@@ -0,0 +1,292 @@
+#include <unity.h>
+
+#include <chrono>
+#include <math.h>
+#include <stdio.h>
+#include <vector>
+
+#include <ArduinoSunSpec.h>
+#include <FakeSunSpecTransport.h>
+#include <SunSpecDeviceSimulator.h>
+
+// Benchmarks decoding a model through its typed getters, on the host. It
+// prints the time per decode of all `float` and `double` getters of a model,
+// the best of `NUM_RUNS` runs, and checks nothing about it; run it verbosely
+// to see the numbers:
+//
+//   pio test -e native -f test_sunspec_decode_benchmark -v
+//
+// Next to each, it prints the time that the same points take when decoded
+// the way the getters did before scale factors were decoded once per read:
+// reading the scale factor on every call, and applying it with `pow10f` or
+// `pow10`. That is the baseline to compare against. It walks a list of
+// points rather than calling inlined getters, which costs something of its
+// own; model 213, whose points have no scale factors, shows how much.
+//
+// Numbers depend on the compiler flags, and are only comparable between
+// builds with the same ones.
+
+int const NUM_RUNS = 5;
+int const NUM_DECODES = 200000;
+
+volatile double sink;
+
+// Model 103, three-phase inverter, integer with scale factors.
+double decode(SunSpecModels::InverterThreePhase const &model) {
+  return model.amps() + model.ampsPhaseA() + model.ampsPhaseB() + model.ampsPhaseC()
+      + model.phaseVoltageAB() + model.phaseVoltageBC() + model.phaseVoltageCA()
+      + model.phaseVoltageAN() + model.phaseVoltageBN() + model.phaseVoltageCN() + model.watts()
+      + model.hz() + model.VA() + model.vAr() + model.PF() + model.wattHours() + model.DCAmps()
+      + model.DCVoltage() + model.DCWatts() + model.cabinetTemperature()
+      + model.heatSinkTemperature() + model.transformerTemperature() + model.otherTemperature();
+}
+
+// Model 203, wye-connect meter, integer with scale factors.
+double decode(SunSpecModels::WyeConnectThreePhaseAbcnMeter_203 const &model) {
+  return model.amps() + model.ampsPhaseA() + model.ampsPhaseB() + model.ampsPhaseC()
+      + model.voltageLN() + model.phaseVoltageAN() + model.phaseVoltageBN() + model.phaseVoltageCN()
+      + model.voltageLL() + model.phaseVoltageAB() + model.phaseVoltageBC() + model.phaseVoltageCA()
+      + model.hz() + model.watts() + model.wattsPhaseA() + model.wattsPhaseB() + model.wattsPhaseC()
+      + model.VA() + model.VAPhaseA() + model.VAPhaseB() + model.VAPhaseC() + model.VAR()
+      + model.VARPhaseA() + model.VARPhaseB() + model.VARPhaseC() + model.PF() + model.PFPhaseA()
+      + model.PFPhaseB() + model.PFPhaseC() + model.totalWattHoursExported()
+      + model.totalWattHoursExportedPhaseA() + model.totalWattHoursExportedPhaseB()
+      + model.totalWattHoursExportedPhaseC() + model.totalWattHoursImported()
+      + model.totalWattHoursImportedPhaseA() + model.totalWattHoursImportedPhaseB()
+      + model.totalWattHoursImportedPhaseC() + model.totalVAHoursExported()
+      + model.totalVAHoursExportedPhaseA() + model.totalVAHoursExportedPhaseB()
+      + model.totalVAHoursExportedPhaseC() + model.totalVAHoursImported()
+      + model.totalVAHoursImportedPhaseA() + model.totalVAHoursImportedPhaseB()
+      + model.totalVAHoursImportedPhaseC() + model.totalVARHoursImportedQ1()
+      + model.totalVArHoursImportedQ1PhaseA() + model.totalVArHoursImportedQ1PhaseB()
+      + model.totalVArHoursImportedQ1PhaseC() + model.totalVArHoursImportedQ2()
+      + model.totalVArHoursImportedQ2PhaseA() + model.totalVArHoursImportedQ2PhaseB()
+      + model.totalVArHoursImportedQ2PhaseC() + model.totalVArHoursExportedQ3()
+      + model.totalVArHoursExportedQ3PhaseA() + model.totalVArHoursExportedQ3PhaseB()
+      + model.totalVArHoursExportedQ3PhaseC() + model.totalVArHoursExportedQ4()
+      + model.totalVArHoursExportedQ4ImportedPhaseA()
+      + model.totalVArHoursExportedQ4ImportedPhaseB()
+      + model.totalVArHoursExportedQ4ImportedPhaseC();
+}
+
+// Model 213, wye-connect meter, FLOAT32 without scale factors.
+double decode(SunSpecModels::WyeConnectThreePhaseAbcnMeter_213 const &model) {
+  return model.amps() + model.ampsPhaseA() + model.ampsPhaseB() + model.ampsPhaseC()
+      + model.voltageLN() + model.phaseVoltageAN() + model.phaseVoltageBN() + model.phaseVoltageCN()
+      + model.voltageLL() + model.phaseVoltageAB() + model.phaseVoltageBC() + model.phaseVoltageCA()
+      + model.hz() + model.watts() + model.wattsPhaseA() + model.wattsPhaseB() + model.wattsPhaseC()
+      + model.VA() + model.VAPhaseA() + model.VAPhaseB() + model.VAPhaseC() + model.VAR()
+      + model.VARPhaseA() + model.VARPhaseB() + model.VARPhaseC() + model.PF() + model.PFPhaseA()
+      + model.PFPhaseB() + model.PFPhaseC() + model.totalWattHoursExported()
+      + model.totalWattHoursExportedPhaseA() + model.totalWattHoursExportedPhaseB()
+      + model.totalWattHoursExportedPhaseC() + model.totalWattHoursImported()
+      + model.totalWattHoursImportedPhaseA() + model.totalWattHoursImportedPhaseB()
+      + model.totalWattHoursImportedPhaseC() + model.totalVAHoursExported()
+      + model.totalVAHoursExportedPhaseA() + model.totalVAHoursExportedPhaseB()
+      + model.totalVAHoursExportedPhaseC() + model.totalVAHoursImported()
+      + model.totalVAHoursImportedPhaseA() + model.totalVAHoursImportedPhaseB()
+      + model.totalVAHoursImportedPhaseC() + model.totalVARHoursImportedQ1()
+      + model.totalVArHoursImportedQ1PhaseA() + model.totalVArHoursImportedQ1PhaseB()
+      + model.totalVArHoursImportedQ1PhaseC() + model.totalVArHoursImportedQ2()
+      + model.totalVArHoursImportedQ2PhaseA() + model.totalVArHoursImportedQ2PhaseB()
+      + model.totalVArHoursImportedQ2PhaseC() + model.totalVArHoursExportedQ3()
+      + model.totalVArHoursExportedQ3PhaseA() + model.totalVArHoursExportedQ3PhaseB()
+      + model.totalVArHoursExportedQ3PhaseC() + model.totalVArHoursExportedQ4()
+      + model.totalVArHoursExportedQ4ImportedPhaseA()
+      + model.totalVArHoursExportedQ4ImportedPhaseB()
+      + model.totalVArHoursExportedQ4ImportedPhaseC();
+}
+
+/**
+ * A point that `decode()` sums, as found in the model's point table.
+ */
+struct Point {
+  uint16 offset;
+  uint16 scaleFactorOffset;
+  SunSpecPointType type;
+};
+
+/**
+ * Returns the points with a scale factor, and the floating-point ones.
+ */
+std::vector<Point> decodedPoints(SunSpecPointTable const &table) {
+  std::vector<Point> points;
+  for (uint16 i = 0; i < table.numPoints; i++) {
+    SunSpecPointDescriptor const point = SunSpecPoints::descriptor(&table.points[i]);
+    if (point.scaleFactorOffset != SunSpecPointDescriptor::NO_SCALE_FACTOR ||
+        point.type == SunSpecPointType::FLOAT32) {
+      points.push_back({point.offset, point.scaleFactorOffset, point.type});
+    }
+  }
+  return points;
+}
+
+/**
+ * Decodes a point like the getters did before scale factors were decoded
+ * once: bounds check and scale factor on every call, then `pow10f` for
+ * 16-bit points and `pow10` for wider ones.
+ */
+double decodePerAccess(uint16 const *registers, uint16 numRegisters, Point const &point) {
+  auto const read32 = [registers](uint16 offset) {
+    return static_cast<uint32>(registers[offset]) << 16 | registers[offset + 1];
+  };
+  uint16 const size =
+      point.type == SunSpecPointType::UINT64 ? 4 :
+      point.type == SunSpecPointType::INT16 || point.type == SunSpecPointType::UINT16 ? 1 : 2;
+  if (point.offset + size > numRegisters) {
+    return NAN;
+  }
+  if (point.type == SunSpecPointType::FLOAT32) {
+    uint32 const bits = read32(point.offset);
+    float value;
+    memcpy(&value, &bits, sizeof(value));
+    return value;
+  }
+  if (point.scaleFactorOffset >= numRegisters) {
+    return NAN;
+  }
+  int16_t const exponent = static_cast<int16_t>(registers[point.scaleFactorOffset]);
+  switch (point.type) {
+    case SunSpecPointType::INT16: {
+      int16_t const mantissa = static_cast<int16_t>(registers[point.offset]);
+      if (mantissa == NotImplemented::INT16 || exponent == NotImplemented::SUNSSF) {
+        return NotImplemented::FLOAT32;
+      }
+      return static_cast<float>(mantissa) * powf(10, static_cast<float>(exponent));
+    }
+    case SunSpecPointType::UINT16: {
+      uint16 const mantissa = registers[point.offset];
+      if (mantissa == NotImplemented::UINT16 || exponent == NotImplemented::SUNSSF) {
+        return NotImplemented::FLOAT32;
+      }
+      return static_cast<float>(mantissa) * powf(10, static_cast<float>(exponent));
+    }
+    case SunSpecPointType::UINT32:
+    case SunSpecPointType::ACC32: {
+      uint32 const mantissa = read32(point.offset);
+      uint32 const notImplemented =
+          point.type == SunSpecPointType::UINT32 ? NotImplemented::UINT32 : NotImplemented::ACC32;
+      if (mantissa == notImplemented || exponent == NotImplemented::SUNSSF) {
+        return NotImplemented::FLOAT64;
+      }
+      return static_cast<double>(mantissa) * pow(10, static_cast<double>(exponent));
+    }
+    case SunSpecPointType::UINT64: {
+      uint64_t const mantissa = static_cast<uint64_t>(read32(point.offset)) << 32 | read32(point.offset + 2);
+      if (mantissa == NotImplemented::UINT64 || exponent == NotImplemented::SUNSSF) {
+        return NotImplemented::FLOAT64;
+      }
+      return static_cast<double>(mantissa) * pow(10, static_cast<double>(exponent));
+    }
+    default:
+      return NAN;
+  }
+}
+
+double decodePerAccess(uint16 const *registers, uint16 numRegisters, std::vector<Point> const &points) {
+  double sum = 0;
+  for (Point const &point : points) {
+    sum += decodePerAccess(registers, numRegisters, point);
+  }
+  return sum;
+}
+
+/**
+ * Returns the best time per call of `decode`, in nanoseconds.
+ */
+template<typename Decode>
+double time(Decode const &decode) {
+  double bestNanos = 0;
+  for (int run = 0; run < NUM_RUNS; run++) {
+    auto const start = std::chrono::steady_clock::now();
+    for (int i = 0; i < NUM_DECODES; i++) {
+      sink = decode();
+    }
+    std::chrono::duration<double, std::nano> const elapsed = std::chrono::steady_clock::now() - start;
+    double const nanos = elapsed.count() / NUM_DECODES;
+    if (run == 0 || nanos < bestNanos) {
+      bestNanos = nanos;
+    }
+  }
+  return bestNanos;
+}
+
+/**
+ * Polls until the current operation is no longer busy.
+ */
+SunSpec::Status run(SunSpec &sunSpec) {
+  for (int i = 0; i < 100000; i++) {
+    SunSpec::Status const status = sunSpec.poll();
+    if (status != SunSpec::Status::BUSY) {
+      return status;
+    }
+    NativeArduino::advanceMillis(1);
+  }
+  return SunSpec::Status::BUSY;
+}
+
+/**
+ * Reads a model of the given type and length from a simulated device, with
+ * arbitrary but fixed register values, and times `decode()` on it, and the
+ * same points decoded per access.
+ */
+template<typename ModelType>
+void benchmark(char const *name, uint16 length) {
+  std::vector<Point> const points = decodedPoints(ModelType::pointTable());
+
+  SunSpecDeviceSimulator device;
+  device.addCommonModel("ACME", "Benchmark");
+  uint16 const address = device.addModel(ModelType::id(), length);
+  for (uint16 i = 0; i < length; i++) {
+    device.setRegister(address + 2 + i, (i * 7919 + 3) % 2000);
+  }
+  // Valid scale factors, so that decoding doesn't stop at "not implemented".
+  for (Point const &point : points) {
+    if (point.scaleFactorOffset != SunSpecPointDescriptor::NO_SCALE_FACTOR) {
+      device.setRegister(address + 2 + point.scaleFactorOffset, static_cast<uint16>(-2));
+    }
+  }
+  FakeSunSpecTransport transport(&device);
+  SunSpec sunSpec(&transport);
+  sunSpec.begin();
+  TEST_ASSERT_TRUE(run(sunSpec) == SunSpec::Status::DONE);
+  sunSpec.nextModel();
+  TEST_ASSERT_TRUE(run(sunSpec) == SunSpec::Status::DONE);
+  sunSpec.readCurrentModel();
+  TEST_ASSERT_TRUE(run(sunSpec) == SunSpec::Status::DONE);
+  ModelType const model = sunSpec.currentModelAs<ModelType>();
+  TEST_ASSERT_TRUE(model.isValid());
+
+  // Both must decode every point, and the same ones.
+  double const value = decode(model);
+  double const perAccessValue = decodePerAccess(model.registers(), model.numRegisters(), points);
+  TEST_ASSERT_FALSE(isnan(value));
+  TEST_ASSERT_TRUE(fabs(value - perAccessValue) <= 1e-6 * fabs(value));
+
+  double const nanos = time([&model]() { return decode(model); });
+  double const perAccessNanos = time([&model, &points]() {
+    return decodePerAccess(model.registers(), model.numRegisters(), points);
+  });
+  printf("%-40s %8.1f ns/decode, %8.1f ns per access\n", name, nanos, perAccessNanos);
+}
+
+void benchmarkInverter() {
+  benchmark<SunSpecModels::InverterThreePhase>("103 three-phase inverter", 50);
+}
+
+void benchmarkIntegerMeter() {
+  benchmark<SunSpecModels::WyeConnectThreePhaseAbcnMeter_203>("203 wye-connect meter (scale factors)", 105);
+}
+
+void benchmarkFloatMeter() {
+  benchmark<SunSpecModels::WyeConnectThreePhaseAbcnMeter_213>("213 wye-connect meter (float)", 124);
+}
+
+int main() {
+  Serial.setMuted(true);
+  UNITY_BEGIN();
+  RUN_TEST(benchmarkInverter);
+  RUN_TEST(benchmarkIntegerMeter);
+  RUN_TEST(benchmarkFloatMeter);
+  UNITY_END();
+}
@@ -0,0 +1,115 @@
+#include <unity.h>
+
+#include "UploadPolicy.h"
+
+typedef UploadPolicy::Reason Reason;
+
+P1Values values(double importWatts, uint32 importWattHours = 1000000) {
+  P1Values values;
+  values.importWatts = importWatts;
+  values.exportWatts = 0;
+  values.importWattHours[0] = importWattHours;
+  return values;
+}
+
+UploadPolicy::Settings settings(uint32 deadbandWatts, uint32 counterThresholdWattHours) {
+  UploadPolicy::Settings settings;
+  settings.minIntervalMillis = 10000;
+  settings.heartbeatMillis = 60000;
+  settings.deadbandWatts = deadbandWatts;
+  settings.counterThresholdWattHours = counterThresholdWattHours;
+  settings.rollupQueueSize = 32;
+  return settings;
+}
+
+/**
+ * Checks the values at the given time, and if an upload is due, records it as
+ * successful.
+ */
+Reason step(UploadPolicy &policy, P1Values const &values, unsigned long nowMillis) {
+  Reason const reason = policy.check(values, 0, nowMillis);
+  if (reason != Reason::NONE) {
+    policy.uploaded(values, nowMillis, true);
+  }
+  return reason;
+}
+
+void testUploadsEveryIntervalWithoutTriggers() {
+  UploadPolicy policy;
+  policy.begin(settings(0, 0));
+  TEST_ASSERT_TRUE(step(policy, values(500), 1000) == Reason::FIRST);
+  TEST_ASSERT_TRUE(step(policy, values(500), 2000) == Reason::NONE);
+  TEST_ASSERT_TRUE(step(policy, values(500), 10600) == Reason::INTERVAL);
+  TEST_ASSERT_EQUAL_UINT32(1, policy.stats().suppressed);
+}
+
+void testUploadsWhenPowerLeavesDeadband() {
+  UploadPolicy policy;
+  policy.begin(settings(100, 0));
+  TEST_ASSERT_TRUE(step(policy, values(500), 0) == Reason::FIRST);
+  // Not before the minimum interval, however large the change.
+  TEST_ASSERT_TRUE(step(policy, values(2000), 5000) == Reason::NONE);
+  TEST_ASSERT_TRUE(step(policy, values(590), 10000) == Reason::NONE);
+  TEST_ASSERT_TRUE(step(policy, values(410), 20000) == Reason::NONE);
+  TEST_ASSERT_TRUE(step(policy, values(2000), 30000) == Reason::POWER);
+  TEST_ASSERT_EQUAL_UINT32(3, policy.stats().suppressed);
+  TEST_ASSERT_EQUAL_UINT32(0, policy.stats().suppressedSinceUpload);
+  TEST_ASSERT_EQUAL_UINT32(1, policy.stats().uploads[static_cast<size_t>(Reason::POWER)]);
+}
+
+void testUploadsWhenCountersMove() {
+  UploadPolicy policy;
+  policy.begin(settings(0, 10));
+  TEST_ASSERT_TRUE(step(policy, values(500, 1000), 0) == Reason::FIRST);
+  TEST_ASSERT_TRUE(step(policy, values(500, 1009), 10000) == Reason::NONE);
+  TEST_ASSERT_TRUE(step(policy, values(500, 1010), 20000) == Reason::COUNTER);
+}
+
+void testSendsHeartbeatWhenQuiet() {
+  UploadPolicy policy;
+  policy.begin(settings(100, 0));
+  TEST_ASSERT_TRUE(step(policy, values(500), 0) == Reason::FIRST);
+  for (unsigned long now = 10000; now < 60000; now += 10000) {
+    TEST_ASSERT_TRUE(step(policy, values(500), now) == Reason::NONE);
+  }
+  TEST_ASSERT_EQUAL_UINT32(5, policy.stats().suppressedSinceUpload);
+  TEST_ASSERT_TRUE(step(policy, values(500), 60000) == Reason::HEARTBEAT);
+}
+
+void testUploadsBeforeRollupsAreDropped() {
+  UploadPolicy policy;
+  policy.begin(settings(100, 0));
+  TEST_ASSERT_TRUE(step(policy, values(500), 0) == Reason::FIRST);
+  TEST_ASSERT_TRUE(policy.check(values(500), 15, 10000) == Reason::NONE);
+  TEST_ASSERT_TRUE(policy.check(values(500), 16, 20000) == Reason::ROLLUPS);
+}
+
+void testRetriesFailedUploads() {
+  UploadPolicy policy;
+  policy.begin(settings(100, 0));
+  TEST_ASSERT_TRUE(policy.check(values(500), 0, 0) == Reason::FIRST);
+  policy.uploaded(values(500), 0, false);
+  TEST_ASSERT_TRUE(policy.check(values(500), 0, 5000) == Reason::NONE);
+  TEST_ASSERT_TRUE(policy.check(values(500), 0, 10000) == Reason::FIRST);
+  policy.uploaded(values(500), 10000, true);
+  TEST_ASSERT_TRUE(policy.check(values(1000), 0, 20000) == Reason::POWER);
+  policy.uploaded(values(1000), 20000, false);
+  // Still compared against the last successful upload.
+  TEST_ASSERT_TRUE(policy.check(values(500), 0, 30000) == Reason::NONE);
+  TEST_ASSERT_TRUE(policy.check(values(1000), 0, 40000) == Reason::POWER);
+  TEST_ASSERT_EQUAL_UINT32(2, policy.stats().failures);
+  // Only the successful upload counts as one.
+  TEST_ASSERT_EQUAL_UINT32(1, policy.stats().uploads[static_cast<size_t>(Reason::FIRST)]);
+  TEST_ASSERT_EQUAL_UINT32(0, policy.stats().uploads[static_cast<size_t>(Reason::POWER)]);
+}
+
+int main() {
+  UNITY_BEGIN();
+  RUN_TEST(testUploadsEveryIntervalWithoutTriggers);
+  RUN_TEST(testUploadsWhenPowerLeavesDeadband);
+  RUN_TEST(testUploadsWhenCountersMove);
+  RUN_TEST(testSendsHeartbeatWhenQuiet);
+  RUN_TEST(testUploadsBeforeRollupsAreDropped);
+  RUN_TEST(testRetriesFailedUploads);
+  UNITY_END();
+}
@@ -1,6 +1,7 @@
 const login = require('./login')
 const readings = require('./readings')
 const root = require('./root')
+const samples = require('./samples')
 const staticController = require('./static')
 const telegrams = require('./telegrams')
 // const users = require('./users')
@@ -19,6 +20,7 @@ module.exports.addRoutes = async function addRoutes (app) {
   // app.post('/users$', users.create)
 
   app.post('/telegrams$', telegrams.create)
+  app.post('/samples$', samples.create)
 
   app.get('/meters/:meterId/readings$', readings.get)
 }
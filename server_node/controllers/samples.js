@@ -0,0 +1,96 @@
+const bodyParser = require('body-parser')
+
+const authTokens = require('../services/authTokens')
+const inverterReadings = require('../services/inverterReadings')
+const log = require('../core/log')
+const rollups = require('../services/rollups')
+const { AUTH_TOKEN_HEADER, logIngestDelay, storeTelegram } = require('./telegrams')
+
+/**
+ * Returns whether the value is a timestamp in milliseconds since the epoch.
+ */
+function isTimestamp (value) {
+  return Number.isFinite(value) && value > 0
+}
+
+function isValidSample (sample) {
+  if (!sample || typeof sample !== 'object') {
+    return false
+  }
+  if (sample.telegram !== undefined &&
+      (!sample.telegram || typeof sample.telegram.raw !== 'string')) {
+    return false
+  }
+  if (sample.inverters !== undefined &&
+      (!Array.isArray(sample.inverters) ||
+       !sample.inverters.every(inverter => inverter &&
+         Number.isInteger(inverter.device) && isTimestamp(inverter.timestamp)))) {
+    return false
+  }
+  if (sample.rollups !== undefined &&
+      (!Array.isArray(sample.rollups) ||
+       !sample.rollups.every(rollup => rollup &&
+         isTimestamp(rollup.start) && Number.isInteger(rollup.periodSeconds)))) {
+    return false
+  }
+  return true
+}
+
+/**
+ * Accepts a sample as uploaded by the client: the latest P1 telegram, if any,
+ * the latest reading of each inverter, and the rollups of telegrams completed
+ * since the last upload, in a single request. Timestamps are in milliseconds
+ * since the epoch, measured by the client.
+ */
+async function createFromBody (req, res) {
+  const token = req.headers[AUTH_TOKEN_HEADER] || ''
+  const sample = req.body
+
+  const user = await authTokens.getOwnerUser({ token })
+  if (!user) {
+    log.warn(`Auth token ${token} is invalid`)
+    res.sendStatus(403)
+    return
+  }
+
+  if (!isValidSample(sample)) {
+    log.warn(`Malformed sample: ${JSON.stringify(sample)}`)
+    res.sendStatus(400)
+    return
+  }
+
+  // The rows are independent, so insert them all at once.
+  await Promise.all([
+    ...(sample.inverters || []).map(inverter => inverterReadings.createOrIgnore({
+      ownerUserId: user.id,
+      device: inverter.device,
+      timestamp: new Date(inverter.timestamp),
+      powerW: inverter.powerW,
+      totalEnergyWh: inverter.totalEnergyWh
+    })),
+    ...(sample.rollups || []).map(rollup =>
+      rollups.createOrIgnore(user.id, Object.assign({}, rollup, { start: new Date(rollup.start) })))
+  ])
+
+  if (sample.telegram) {
+    // The client sends the telegram bytes as they were received, which are
+    // ASCII by specification; latin1 maps them back one to one.
+    const error = await storeTelegram(user, Buffer.from(sample.telegram.raw, 'latin1'))
+    if (error) {
+      res.status(400)
+      res.send(error)
+      return
+    }
+  }
+
+  logIngestDelay(req, user)
+  res.sendStatus(200)
+}
+
+module.exports = {
+  create: [
+    bodyParser.json({ limit: '16kb' }), // Populates req.body as an object.
+    createFromBody
+  ],
+  createFromBody
+}
@@ -0,0 +1,141 @@
+/* eslint-env mocha, chai */
+
+const { expect } = require('../core/chai')
+
+const { simulateRequest } = require('./testing')
+const inverterReadings = require('../services/inverterReadings')
+const readings = require('../services/readings')
+const rollups = require('../services/rollups')
+const samples = require('./samples')
+const telegramsService = require('../services/telegrams')
+const testDb = require('../core/testDb')
+
+describe('controllers/samples', () => {
+  beforeEach(testDb.reset)
+
+  const TIMESTAMP = Date.parse('2018-11-18T19:07:20+01:00')
+
+  function sample (telegram) {
+    return {
+      timestamp: TIMESTAMP + 500,
+      telegram: { timestamp: TIMESTAMP, raw: telegram.toString('latin1') },
+      inverters: [
+        { device: 0, timestamp: TIMESTAMP - 1000, powerW: 1234.5, totalEnergyWh: 567890 }
+      ],
+      rollups: [
+        {
+          start: TIMESTAMP - 60000,
+          periodSeconds: 60,
+          telegrams: 6,
+          minPowerW: 1000,
+          meanPowerW: 1193,
+          maxPowerW: 1400,
+          firstImportWh: [1000, 2000],
+          lastImportWh: [1020, 2000],
+          firstExportWh: [0, 0],
+          lastExportWh: [0, 0],
+          lastGasL: null,
+          gasDeltaL: null
+        }
+      ]
+    }
+  }
+
+  describe('createFromBody', () => {
+    it('rejects requests with an invalid token', async () => {
+      const res = await simulateRequest(samples.createFromBody, {
+        headers: { 'X-Auth-Token': testDb.data.nonexistentAuthToken.token },
+        body: sample(testDb.data.telegram.telegram)
+      })
+
+      expect(res.statusCode).to.equal(403)
+      await expect(await inverterReadings.getForUser({ id: testDb.data.user.id })).to.have.length(0)
+    })
+
+    it('rejects malformed samples', async () => {
+      const res = await simulateRequest(samples.createFromBody, {
+        headers: { 'X-Auth-Token': testDb.data.authToken.token },
+        body: { inverters: [{ device: 'first' }] }
+      })
+
+      expect(res.statusCode).to.equal(400)
+    })
+
+    it('rejects telegrams whose CRC does not match, but stores the telegram anyway', async () => {
+      const res = await simulateRequest(samples.createFromBody, {
+        headers: { 'X-Auth-Token': testDb.data.authToken.token },
+        body: sample(testDb.data.telegram.corruptTelegram)
+      })
+
+      expect(res.statusCode).to.equal(400)
+      await expect(await telegramsService.getForUser({ id: testDb.data.user.id })).to.have.length(2)
+    })
+
+    it('accepts samples without a telegram', async () => {
+      const body = sample(testDb.data.telegram.telegram)
+      delete body.telegram
+      const res = await simulateRequest(samples.createFromBody, {
+        headers: { 'X-Auth-Token': testDb.data.authToken.token },
+        body
+      })
+
+      expect(res.statusCode).to.equal(200)
+      await expect(await inverterReadings.getForUser({ id: testDb.data.user.id })).to.have.length(1)
+    })
+
+    describe('when passed valid credentials and a valid sample', async () => {
+      let res
+
+      beforeEach(async () => {
+        res = await simulateRequest(samples.createFromBody, {
+          headers: { 'X-Auth-Token': testDb.data.authToken.token },
+          body: sample(testDb.data.telegram.telegram)
+        })
+      })
+
+      it('returns a success response', () => {
+        expect(res.statusCode).to.equal(200)
+      })
+
+      it('creates the telegram', async () => {
+        const telegrams = await telegramsService.getForUser({ id: testDb.data.user.id })
+        expect(telegrams).to.have.length(2)
+        expect(telegrams[1].telegram).to.deep.equal(testDb.data.telegram.telegram)
+      })
+
+      it('creates the electricity reading', async () => {
+        const reading = Object.assign({}, testDb.data.electricityReading, { type: 'electricity' })
+        await expect(readings.getForMeter({ id: testDb.data.electricityReading.meterId, type: 'electricity' })).to.eventually.deep.equal([reading])
+      })
+
+      it('creates the inverter reading', async () => {
+        const stored = await inverterReadings.getForUser({ id: testDb.data.user.id })
+        expect(testDb.datesToTimestamps(stored)).to.deep.equal(testDb.datesToTimestamps([{
+          ownerUserId: testDb.data.user.id,
+          device: 0,
+          timestamp: new Date(TIMESTAMP - 1000),
+          powerW: 1234.5,
+          totalEnergyWh: 567890
+        }]))
+      })
+
+      it('creates the rollups', async () => {
+        const stored = await rollups.getForUser({ id: testDb.data.user.id })
+        expect(stored).to.have.length(1)
+        expect(stored[0].start).to.be.sameMoment(new Date(TIMESTAMP - 60000))
+        expect(stored[0]).to.include({ periodSeconds: 60, meanPowerW: 1193, firstImportWh1: 1000 })
+      })
+
+      it('ignores the same inverter reading in the next sample', async () => {
+        const body = sample(testDb.data.telegram.telegram)
+        delete body.telegram
+        res = await simulateRequest(samples.createFromBody, {
+          headers: { 'X-Auth-Token': testDb.data.authToken.token },
+          body
+        })
+        expect(res.statusCode).to.equal(200)
+        await expect(await inverterReadings.getForUser({ id: testDb.data.user.id })).to.have.length(1)
+      })
+    })
+  })
+})
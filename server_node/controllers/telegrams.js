@@ -9,25 +9,58 @@ const telegrams = require('../services/telegrams')
 const telegramParser = require('../services/telegramParser')
 
 const AUTH_TOKEN_HEADER = 'x-auth-token'
+// Sent by the client along with each upload: the time at which the first byte
+// of the telegram was received, in milliseconds since the epoch, and the
+// spans of this upload that were known when sending it, as well as all spans
+// of the previous upload, like `read=850,queue=12,resolve=0`.
+const TRACE_CAPTURED_HEADER = 'x-trace-captured'
+const TRACE_SPANS_HEADER = 'x-trace-spans'
+const TRACE_PREVIOUS_SPANS_HEADER = 'x-trace-previous-spans'
 
-async function createFromBody (req, res) {
-  const errors = check.validationResult(req)
-  if (!errors.isEmpty()) {
-    log.warn(errors.array())
-    res.sendStatus(400)
-    return
+/**
+ * Parses spans as sent by the client into an object of milliseconds by name.
+ * Malformed entries are left out.
+ */
+function parseTraceSpans (header) {
+  const spans = {}
+  for (const entry of (header || '').split(',')) {
+    const match = /^\s*([a-z]+)=(\d+)\s*$/.exec(entry)
+    if (match) {
+      spans[match[1]] = parseInt(match[2], 10)
+    }
   }
+  return spans
+}
 
-  const token = req.headers[AUTH_TOKEN_HEADER] || ''
-  const dataBuffer = req.body
+function formatTraceSpans (spans) {
+  return Object.keys(spans).map(name => `${name}=${spans[name]}`).join(' ')
+}
 
-  const user = await authTokens.getOwnerUser({ token })
-  if (!user) {
-    log.warn(`Auth token ${token} is invalid`)
-    res.sendStatus(403)
-    return
+/**
+ * Logs the ingest delay: the time from the first byte of the telegram on the
+ * client until it was stored, along with the spans the client measured.
+ * Returns the delay in milliseconds, or `null` if the client did not send a
+ * capture time. The delay relies on the client's clock, which is set by NTP,
+ * so it may be off by a few milliseconds either way.
+ */
+function logIngestDelay (req, user, now = Date.now()) {
+  const captured = parseInt(req.headers[TRACE_CAPTURED_HEADER], 10)
+  if (!Number.isFinite(captured)) {
+    return null
   }
+  const delay = now - captured
+  const spans = parseTraceSpans(req.headers[TRACE_SPANS_HEADER])
+  const previousSpans = parseTraceSpans(req.headers[TRACE_PREVIOUS_SPANS_HEADER])
+  log.info(`Ingest delay ${delay} ms for user ${user.id}: ${formatTraceSpans(spans)}` +
+    (Object.keys(previousSpans).length ? `; previous upload: ${formatTraceSpans(previousSpans)}` : ''))
+  return delay
+}
 
+/**
+ * Stores the raw telegram and the readings parsed from it. Returns an error
+ * message if the telegram was stored but could not be used.
+ */
+async function storeTelegram (user, dataBuffer) {
   // TODO add columns "crcValid" and "parsed" to telegrams, clean up parsed
   // telegrams more aggressively
 
@@ -35,9 +68,7 @@ async function createFromBody (req, res) {
   log.info(`Stored ${dataBuffer.length} byte telegram for user ${user.id}`)
 
   if (!telegramParser.isCrcValid(dataBuffer)) {
-    res.status(400)
-    res.send('CRC mismatch')
-    return
+    return 'CRC mismatch'
   }
 
   let telegramReadings
@@ -54,14 +85,45 @@ async function createFromBody (req, res) {
     await meters.createOrUpdate({ id: reading.meterId, type: reading.type, ownerUserId: user.id })
     await readings.create(reading)
   }
+}
+
+async function createFromBody (req, res) {
+  const errors = check.validationResult(req)
+  if (!errors.isEmpty()) {
+    log.warn(errors.array())
+    res.sendStatus(400)
+    return
+  }
+
+  const token = req.headers[AUTH_TOKEN_HEADER] || ''
+  const dataBuffer = req.body
+
+  const user = await authTokens.getOwnerUser({ token })
+  if (!user) {
+    log.warn(`Auth token ${token} is invalid`)
+    res.sendStatus(403)
+    return
+  }
+
+  const error = await storeTelegram(user, dataBuffer)
+  if (error) {
+    res.status(400)
+    res.send(error)
+    return
+  }
 
+  logIngestDelay(req, user)
   res.sendStatus(200)
 }
 
 module.exports = {
+  AUTH_TOKEN_HEADER,
   create: [
     bodyParser.raw({ type: 'text/plain' }), // Populates req.body as a Buffer.
     createFromBody
   ],
-  createFromBody
+  createFromBody,
+  logIngestDelay,
+  parseTraceSpans,
+  storeTelegram
 }
@@ -107,4 +107,29 @@ describe('controllers/telegrams', () => {
       })
     })
   })
+
+  describe('parseTraceSpans', () => {
+    it('parses spans in milliseconds by name', () => {
+      expect(telegrams.parseTraceSpans('read=850,queue=12,resolve=0')).to.deep.equal({ read: 850, queue: 12, resolve: 0 })
+    })
+
+    it('leaves out malformed entries', () => {
+      expect(telegrams.parseTraceSpans('read=850,queue,=3,send=-1,connect=431')).to.deep.equal({ read: 850, connect: 431 })
+    })
+
+    it('accepts a missing header', () => {
+      expect(telegrams.parseTraceSpans(undefined)).to.deep.equal({})
+    })
+  })
+
+  describe('logIngestDelay', () => {
+    it('returns the time since the telegram was captured', () => {
+      const req = { headers: { 'x-trace-captured': '1600000000000', 'x-trace-spans': 'read=850' } }
+      expect(telegrams.logIngestDelay(req, testDb.data.user, 1600000001628)).to.equal(1628)
+    })
+
+    it('returns null without a capture time', () => {
+      expect(telegrams.logIngestDelay({ headers: {} }, testDb.data.user, 1600000001628)).to.equal(null)
+    })
+  })
 })
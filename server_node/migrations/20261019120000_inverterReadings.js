@@ -0,0 +1,16 @@
+module.exports.up = async function (knex) {
+  await knex.schema.createTable('inverterReadings', function (table) {
+    table.integer('ownerUserId')
+    table.foreign('ownerUserId').references('users.id').onDelete('cascade')
+    // Index of the inverter or meter in the client's configuration.
+    table.integer('device')
+    table.timestamp('timestamp')
+    table.double('powerW')
+    table.double('totalEnergyWh')
+    table.primary(['ownerUserId', 'device', 'timestamp'])
+  })
+}
+
+module.exports.down = async function (knex) {
+  await knex.schema.dropTable('inverterReadings')
+}
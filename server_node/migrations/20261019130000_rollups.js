@@ -0,0 +1,26 @@
+module.exports.up = async function (knex) {
+  await knex.schema.createTable('rollups', function (table) {
+    table.integer('ownerUserId')
+    table.foreign('ownerUserId').references('users.id').onDelete('cascade')
+    table.timestamp('start')
+    table.integer('periodSeconds')
+    table.integer('telegrams')
+    // Net power, negative while exporting.
+    table.integer('minPowerW')
+    table.integer('meanPowerW')
+    table.integer('maxPowerW')
+    // Energy counters per tariff at the first and last telegram of the period.
+    for (const column of ['firstImportWh', 'lastImportWh', 'firstExportWh', 'lastExportWh']) {
+      table.bigInteger(`${column}1`)
+      table.bigInteger(`${column}2`)
+    }
+    table.bigInteger('lastGasL')
+    // Gas delivered since the last value seen in an earlier period.
+    table.bigInteger('gasDeltaL')
+    table.primary(['ownerUserId', 'start', 'periodSeconds'])
+  })
+}
+
+module.exports.down = async function (knex) {
+  await knex.schema.dropTable('rollups')
+}
@@ -0,0 +1,38 @@
+const db = require('../core/db')
+
+const KEYS = ['ownerUserId', 'device', 'timestamp', 'powerW', 'totalEnergyWh']
+
+module.exports = {
+  /**
+   * Inverters are usually read less often than telegrams arrive, so the same
+   * reading is uploaded with several samples. Only the first one is stored.
+   */
+  createOrIgnore: async function (reading) {
+    const object = {}
+    for (const key of KEYS) {
+      object[key] = reading[key] !== undefined ? reading[key] : null
+    }
+    try {
+      await db('inverterReadings').insert(object)
+    } catch (ex) {
+      if (ex.code === 'SQLITE_CONSTRAINT' /* SQLite */ ||
+          (ex.constraint || '').endsWith('_pkey') /* PostgreSQL */) {
+        return
+      }
+      throw ex
+    }
+  },
+
+  getForUser: async function (user, { startTime, endTime } = {}) {
+    let query = db.from('inverterReadings')
+        .where({ ownerUserId: user.id })
+        .orderBy(['timestamp', 'device'])
+    if (startTime) {
+      query = query.where('timestamp', '>=', startTime)
+    }
+    if (endTime) {
+      query = query.where('timestamp', '<=', endTime)
+    }
+    return query.select(KEYS)
+  }
+}
@@ -0,0 +1,58 @@
+/* eslint-env mocha, chai */
+
+const { expect } = require('../core/chai')
+const moment = require('moment')
+
+const inverterReadings = require('./inverterReadings')
+const testDb = require('../core/testDb')
+
+describe('services/inverterReadings', () => {
+  beforeEach(testDb.reset)
+
+  function reading (overrides = {}) {
+    return Object.assign({
+      ownerUserId: testDb.data.user.id,
+      device: 0,
+      timestamp: moment('2018-11-18T19:07:20+01:00').toDate(),
+      powerW: 1234.5,
+      totalEnergyWh: 567890
+    }, overrides)
+  }
+
+  describe('createOrIgnore', () => {
+    it('creates the reading', async () => {
+      await inverterReadings.createOrIgnore(reading())
+      const readings = await inverterReadings.getForUser({ id: testDb.data.user.id })
+      expect(testDb.datesToTimestamps(readings)).to.deep.equal(testDb.datesToTimestamps([reading()]))
+    })
+
+    it('ignores a reading that was already stored', async () => {
+      await inverterReadings.createOrIgnore(reading())
+      await inverterReadings.createOrIgnore(reading())
+      await expect(inverterReadings.getForUser({ id: testDb.data.user.id })).to.eventually.have.length(1)
+    })
+
+    it('keeps readings of different devices apart', async () => {
+      await inverterReadings.createOrIgnore(reading())
+      await inverterReadings.createOrIgnore(reading({ device: 1, powerW: 0 }))
+      const readings = await inverterReadings.getForUser({ id: testDb.data.user.id })
+      expect(readings.map(r => r.device)).to.deep.equal([0, 1])
+    })
+  })
+
+  describe('getForUser', () => {
+    it('filters by time', async () => {
+      for (let minutes = 0; minutes < 3; minutes++) {
+        await inverterReadings.createOrIgnore(reading({
+          timestamp: moment('2018-11-18T19:00:00+01:00').add(minutes, 'minutes').toDate()
+        }))
+      }
+      const readings = await inverterReadings.getForUser({ id: testDb.data.user.id }, {
+        startTime: moment('2018-11-18T19:01:00+01:00').toDate(),
+        endTime: moment('2018-11-18T19:01:59+01:00').toDate()
+      })
+      expect(readings).to.have.length(1)
+      expect(readings[0].timestamp).to.be.sameMoment(moment('2018-11-18T19:01:00+01:00'))
+    })
+  })
+})
@@ -0,0 +1,69 @@
+const db = require('../core/db')
+
+const COUNTER_COLUMNS = ['firstImportWh', 'lastImportWh', 'firstExportWh', 'lastExportWh']
+
+const KEYS = [
+  'ownerUserId', 'start', 'periodSeconds', 'telegrams',
+  'minPowerW', 'meanPowerW', 'maxPowerW',
+  ...COUNTER_COLUMNS.flatMap(column => [`${column}1`, `${column}2`]),
+  'lastGasL', 'gasDeltaL'
+]
+
+/**
+ * PostgreSQL returns bigint columns as strings, because they may not fit in a
+ * JavaScript number. Ours always do.
+ */
+function bigIntegersToNumbers (rollup) {
+  for (const key of KEYS) {
+    if (typeof rollup[key] === 'string') {
+      rollup[key] = Number(rollup[key])
+    }
+  }
+  return rollup
+}
+
+module.exports = {
+  /**
+   * Takes a rollup as uploaded by the client, with tariffs as arrays, e.g.
+   * `firstImportWh: [1234, 5678]`. The client sends rollups again if it
+   * didn't see the response to an upload, so these are ignored.
+   */
+  createOrIgnore: async function (ownerUserId, rollup) {
+    const object = { ownerUserId }
+    for (const key of KEYS) {
+      if (key !== 'ownerUserId') {
+        object[key] = rollup[key] !== undefined ? rollup[key] : null
+      }
+    }
+    for (const column of COUNTER_COLUMNS) {
+      const tariffs = rollup[column] || []
+      object[`${column}1`] = tariffs[0] !== undefined ? tariffs[0] : null
+      object[`${column}2`] = tariffs[1] !== undefined ? tariffs[1] : null
+    }
+    try {
+      await db('rollups').insert(object)
+    } catch (ex) {
+      if (ex.code === 'SQLITE_CONSTRAINT' /* SQLite */ ||
+          (ex.constraint || '').endsWith('_pkey') /* PostgreSQL */) {
+        return
+      }
+      throw ex
+    }
+  },
+
+  getForUser: async function (user, { periodSeconds, startTime, endTime } = {}) {
+    let query = db.from('rollups')
+        .where({ ownerUserId: user.id })
+        .orderBy(['start', 'periodSeconds'])
+    if (periodSeconds) {
+      query = query.where({ periodSeconds })
+    }
+    if (startTime) {
+      query = query.where('start', '>=', startTime)
+    }
+    if (endTime) {
+      query = query.where('start', '<', endTime)
+    }
+    return (await query.select(KEYS)).map(bigIntegersToNumbers)
+  }
+}
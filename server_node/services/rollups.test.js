@@ -0,0 +1,67 @@
+/* eslint-env mocha, chai */
+
+const { expect } = require('../core/chai')
+const moment = require('moment')
+
+const rollups = require('./rollups')
+const testDb = require('../core/testDb')
+
+describe('services/rollups', () => {
+  beforeEach(testDb.reset)
+
+  const START = moment('2020-09-13T12:26:00Z').toDate()
+
+  function rollup (overrides = {}) {
+    return Object.assign({
+      start: START,
+      periodSeconds: 60,
+      telegrams: 6,
+      minPowerW: -250,
+      meanPowerW: 100,
+      maxPowerW: 400,
+      firstImportWh: [1000, 2000],
+      lastImportWh: [1002, 2000],
+      firstExportWh: [10, null],
+      lastExportWh: [11, null],
+      lastGasL: 12785123,
+      gasDeltaL: null
+    }, overrides)
+  }
+
+  describe('createOrIgnore', () => {
+    it('creates the rollup with a column per tariff', async () => {
+      await rollups.createOrIgnore(testDb.data.user.id, rollup())
+      const stored = await rollups.getForUser({ id: testDb.data.user.id })
+      expect(stored).to.have.length(1)
+      expect(stored[0].start).to.be.sameMoment(START)
+      expect(stored[0]).to.include({
+        ownerUserId: testDb.data.user.id,
+        periodSeconds: 60,
+        minPowerW: -250,
+        firstImportWh1: 1000,
+        firstImportWh2: 2000,
+        lastExportWh1: 11,
+        lastExportWh2: null,
+        lastGasL: 12785123,
+        gasDeltaL: null
+      })
+    })
+
+    it('ignores a rollup that was already stored', async () => {
+      await rollups.createOrIgnore(testDb.data.user.id, rollup())
+      await rollups.createOrIgnore(testDb.data.user.id, rollup({ meanPowerW: 0 }))
+      const stored = await rollups.getForUser({ id: testDb.data.user.id })
+      expect(stored).to.have.length(1)
+      expect(stored[0].meanPowerW).to.equal(100)
+    })
+  })
+
+  describe('getForUser', () => {
+    it('filters by period', async () => {
+      await rollups.createOrIgnore(testDb.data.user.id, rollup())
+      await rollups.createOrIgnore(testDb.data.user.id, rollup({ periodSeconds: 900 }))
+      const stored = await rollups.getForUser({ id: testDb.data.user.id }, { periodSeconds: 900 })
+      expect(stored.map(r => r.periodSeconds)).to.deep.equal([900])
+    })
+  })
+})